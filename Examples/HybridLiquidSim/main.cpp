@@ -10,6 +10,7 @@
 
 #include <../ClaraUtils.hpp>
 
+#include <Core/Animation/FrameExporter.hpp>
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/Emitter/ParticleEmitterSet3.hpp>
 #include <Core/Emitter/VolumeParticleEmitter3.hpp>
@@ -45,11 +46,9 @@
 
 using namespace CubbyFlow;
 
-void SaveParticleAsPos(const ParticleSystemData3Ptr& particles,
+void SaveParticleAsPos(const ConstArrayView1<Vector3D>& positions,
                        const std::string& rootDir, int frameCnt)
 {
-    Array1<Vector3D> positions(particles->NumberOfParticles());
-    Copy(particles->Positions(), positions.View());
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.pos", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
@@ -58,17 +57,15 @@ void SaveParticleAsPos(const ParticleSystemData3Ptr& particles,
     {
         printf("Writing %s...\n", fileName.c_str());
         std::vector<uint8_t> buffer;
-        Serialize<Vector3D>(positions.View(), &buffer);
+        Serialize<Vector3D>(positions, &buffer);
         file.write(reinterpret_cast<char*>(buffer.data()), buffer.size());
         file.close();
     }
 }
 
-void SaveParticleAsXYZ(const ParticleSystemData3Ptr& particles,
+void SaveParticleAsXYZ(const ConstArrayView1<Vector3D>& positions,
                        const std::string& rootDir, int frameCnt)
 {
-    Array1<Vector3D> positions(particles->NumberOfParticles());
-    Copy(particles->Positions(), positions.View());
     char baseName[256];
     snprintf(baseName, sizeof(baseName), "frame_%06d.xyz", frameCnt);
     std::string fileName = pystring::os::path::join(rootDir, baseName);
@@ -105,18 +102,30 @@ void RunSimulation(const std::string& rootDir, const PICSolver3Ptr& solver,
 {
     const auto particles = solver->GetParticleSystemData();
 
+    // Write the frames on a background thread while the next one simulates.
+    const auto exporter = std::make_shared<FrameExporter>(
+        [&](const FrameExporter::Snapshot& snapshot) {
+            const ConstArrayView1<Vector3D> positions =
+                snapshot.vectorChannels[0];
+            if (format == "xyz")
+            {
+                SaveParticleAsXYZ(positions, rootDir, snapshot.frame.index);
+            }
+            else if (format == "pos")
+            {
+                SaveParticleAsPos(positions, rootDir, snapshot.frame.index);
+            }
+        });
+    exporter->AddVectorChannel([&]() { return particles->Positions(); });
+    solver->SetFrameExporter(exporter);
+
     for (Frame frame(0, 1.0 / fps); frame.index < numberOfFrames; ++frame)
     {
         solver->Update(frame);
-        if (format == "xyz")
-        {
-            SaveParticleAsXYZ(particles, rootDir, frame.index);
-        }
-        else if (format == "pos")
-        {
-            SaveParticleAsPos(particles, rootDir, frame.index);
-        }
     }
+
+    exporter->Flush();
+    solver->SetFrameExporter(nullptr);
 }
 
 // Water-drop example (FLIP)
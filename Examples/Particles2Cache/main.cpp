@@ -0,0 +1,176 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <../ClaraUtils.hpp>
+
+#include <Core/Array/Array.hpp>
+#include <Core/Matrix/Matrix.hpp>
+#include <Core/Particle/ParticleCache.hpp>
+#include <Core/Utils/Serialization.hpp>
+
+#include <pystring/pystring.h>
+#include <Clara/include/clara.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace CubbyFlow;
+
+std::string FrameFileName(const std::string& dir, int frame,
+                          const std::string& extension)
+{
+    char baseName[256];
+    snprintf(baseName, sizeof(baseName), "frame_%06d.%s", frame,
+             extension.c_str());
+    return pystring::os::path::join(dir, baseName);
+}
+
+bool ReadPositions(const std::string& fileName, Array1<Vector3D>* positions)
+{
+    std::ifstream file(fileName.c_str(), std::ifstream::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    const std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
+                                      (std::istreambuf_iterator<char>()));
+    Deserialize(buffer, positions);
+
+    return true;
+}
+
+void WritePositions(const std::string& fileName,
+                    const ConstArrayView1<Vector3D>& positions)
+{
+    std::ofstream file(fileName.c_str(), std::ios::binary);
+    if (file)
+    {
+        printf("Writing %s...\n", fileName.c_str());
+        std::vector<uint8_t> buffer;
+        Serialize<Vector3D>(positions, &buffer);
+        file.write(reinterpret_cast<char*>(buffer.data()), buffer.size());
+        file.close();
+    }
+    else
+    {
+        printf("Cannot write file %s.\n", fileName.c_str());
+        exit(EXIT_FAILURE);
+    }
+}
+
+void Encode(const std::string& inputDir, const std::string& outputDir,
+            int beginFrame, int endFrame, const ParticleCacheParameters& params)
+{
+    ParticleCacheWriter3 writer(params);
+    Array1<Vector3D> positions;
+
+    for (int frame = beginFrame; frame < endFrame; ++frame)
+    {
+        const std::string inputFileName =
+            FrameFileName(inputDir, frame, "pos");
+        if (!ReadPositions(inputFileName, &positions))
+        {
+            printf("Cannot read file %s.\n", inputFileName.c_str());
+            exit(EXIT_FAILURE);
+        }
+
+        ParticleSystemData3 particles;
+        particles.AddParticles(positions);
+
+        const std::string outputFileName =
+            FrameFileName(outputDir, frame, "pcache");
+        printf("Writing %s...\n", outputFileName.c_str());
+        writer.Write(outputFileName, particles);
+    }
+}
+
+void Decode(const std::string& inputDir, const std::string& outputDir,
+            int beginFrame, int endFrame)
+{
+    ParticleCacheReader3 reader;
+    ParticleSystemData3 particles;
+
+    for (int frame = beginFrame; frame < endFrame; ++frame)
+    {
+        const std::string inputFileName =
+            FrameFileName(inputDir, frame, "pcache");
+        reader.Read(inputFileName, &particles);
+
+        WritePositions(FrameFileName(outputDir, frame, "pos"),
+                       particles.Positions());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool showHelp = false;
+    bool decode = false;
+
+    std::string inputDir;
+    std::string outputDir;
+    int beginFrame = 0;
+    int endFrame = 100;
+    ParticleCacheParameters params;
+
+    // Parsing
+    auto parser =
+        clara::Help(showHelp) |
+        clara::Opt(inputDir, "inputDir")["-i"]["--input"](
+            "input directory name") |
+        clara::Opt(outputDir, "outputDir")["-o"]["--output"](
+            "output directory name") |
+        clara::Opt(beginFrame, "beginFrame")["-b"]["--begin"](
+            "first frame index (default is 0)") |
+        clara::Opt(endFrame, "endFrame")["-e"]["--end"](
+            "frame index after the last frame (default is 100)") |
+        clara::Opt(params.positionBits, "positionBits")["-p"]["--bits"](
+            "number of bits per position component (default is 16)") |
+        clara::Opt(params.useDeltaEncoding)["-t"]["--delta"](
+            "encode positions as deltas from the previous frame") |
+        clara::Opt(params.keyFrameInterval, "keyFrameInterval")["-k"]
+                  ["--key_interval"]("max number of frames between key "
+                                     "frames (default is 30)") |
+        clara::Opt(decode)["-d"]["--decode"](
+            "decode cache files (frame_*.pcache) into position files "
+            "(frame_*.pos) instead of encoding them");
+
+    auto result = parser.parse(clara::Args(argc, argv));
+    if (!result)
+    {
+        std::cerr << "Error in command line: " << result.errorMessage() << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    if (showHelp)
+    {
+        std::cout << ToString(parser) << '\n';
+        exit(EXIT_SUCCESS);
+    }
+
+    if (inputDir.empty() || outputDir.empty())
+    {
+        std::cout << ToString(parser) << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    if (decode)
+    {
+        Decode(inputDir, outputDir, beginFrame, endFrame);
+    }
+    else
+    {
+        Encode(inputDir, outputDir, beginFrame, endFrame, params);
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <Core/Geometry/Plane.hpp>
 #include <Core/Geometry/RigidBodyCollider.hpp>
 #include <Core/Geometry/Sphere.hpp>
+#include <Core/Particle/ParticleCache.hpp>
 #include <Core/Particle/ParticleSystemData.hpp>
 #include <Core/Solver/Particle/PCISPH/PCISPHSolver3.hpp>
 #include <Core/Solver/Particle/SPH/SPHSolver3.hpp>
@@ -60,6 +61,17 @@ void SaveParticleAsPos(const ParticleSystemData3Ptr& particles,
     }
 }
 
+void SaveParticleAsCache(const ParticleSystemData3Ptr& particles,
+                         const std::string& rootDir, int frameCnt,
+                         ParticleCacheWriter3* writer)
+{
+    char baseName[256];
+    snprintf(baseName, sizeof(baseName), "frame_%06d.pcache", frameCnt);
+    std::string fileName = pystring::os::path::join(rootDir, baseName);
+    printf("Writing %s...\n", fileName.c_str());
+    writer->Write(fileName, *particles);
+}
+
 void SaveParticleAsXYZ(const ParticleSystemData3Ptr& particles,
                        const std::string& rootDir, int frameCnt)
 {
@@ -91,6 +103,10 @@ void RunSimulation(const std::string& rootDir, const SPHSolver3Ptr& solver,
 {
     const auto particles = solver->GetSPHSystemData();
 
+    ParticleCacheParameters cacheParams;
+    cacheParams.useDeltaEncoding = true;
+    ParticleCacheWriter3 cacheWriter(cacheParams);
+
     for (Frame frame(0, 1.0 / fps); frame.index < numberOfFrames; ++frame)
     {
         solver->Update(frame);
@@ -103,6 +119,10 @@ void RunSimulation(const std::string& rootDir, const SPHSolver3Ptr& solver,
         {
             SaveParticleAsPos(particles, rootDir, frame.index);
         }
+        else if (format == "pcache")
+        {
+            SaveParticleAsCache(particles, rootDir, frame.index, &cacheWriter);
+        }
     }
 }
 
@@ -342,7 +362,7 @@ int main(int argc, char* argv[])
         clara::Opt(outputDir, "outputDir")["-o"]["--output"](
             "output directory name (default is " APP_NAME "_output)") |
         clara::Opt(format, "format")["-m"]["--format"](
-            "particle output format (xyz or pos. default is xyz)");
+            "particle output format (xyz, pos or pcache. default is xyz)");
 
     auto result = parser.parse(clara::Args(argc, argv));
     if (!result)
@@ -0,0 +1,64 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PYTHON_ANIMATION_FUTURE_HPP
+#define CUBBYFLOW_PYTHON_ANIMATION_FUTURE_HPP
+
+#include <pybind11/pybind11.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+
+//!
+//! \brief Handle of an animation step running on a background thread.
+//!
+//! The step runs without the GIL, so Python can keep working (e.g. exporting
+//! the last frame) until it waits for the result. The owner object is kept
+//! alive until the handle is destroyed.
+//!
+class AnimationFuture
+{
+ public:
+    //! Runs \p func on a new thread while holding a reference to \p owner.
+    AnimationFuture(pybind11::object owner, std::function<void()> func);
+
+    //! Deleted copy constructor.
+    AnimationFuture(const AnimationFuture&) = delete;
+
+    //! Deleted move constructor.
+    AnimationFuture(AnimationFuture&&) noexcept = delete;
+
+    //! Waits for the step to finish without holding the GIL.
+    ~AnimationFuture();
+
+    //! Deleted copy assignment operator.
+    AnimationFuture& operator=(const AnimationFuture&) = delete;
+
+    //! Deleted move assignment operator.
+    AnimationFuture& operator=(AnimationFuture&&) noexcept = delete;
+
+    //! Returns true if the step has finished.
+    [[nodiscard]] bool IsReady() const;
+
+    //! Waits for the step to finish and rethrows its exception, if any.
+    void Wait() const;
+
+ private:
+    pybind11::object m_owner;
+    std::shared_future<void> m_future;
+};
+
+//! Shared pointer type for the AnimationFuture.
+using AnimationFuturePtr = std::shared_ptr<AnimationFuture>;
+
+void AddAnimationFuture(pybind11::module& m);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,137 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PYTHON_NUMPY_UTILS_HPP
+#define CUBBYFLOW_PYTHON_NUMPY_UTILS_HPP
+
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Matrix/Matrix.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstring>
+
+namespace CubbyFlow
+{
+//! NumPy array type that accepts any array convertible to C-contiguous double.
+//! Arrays that already match are passed through without copying.
+using NumPyArrayD =
+    pybind11::array_t<double, pybind11::array::c_style |
+                                  pybind11::array::forcecast>;
+
+//!
+//! \brief Returns a read-only view of a (n, N)-shaped NumPy array as an array
+//!        of N-D vectors without copying.
+//!
+template <size_t N>
+ConstArrayView1<Vector<double, N>> NumPyArrayToVectorView(
+    const NumPyArrayD& array)
+{
+    if (array.ndim() != 2 || static_cast<size_t>(array.shape(1)) != N)
+    {
+        throw std::invalid_argument("Invalid shape.");
+    }
+
+    return ConstArrayView1<Vector<double, N>>(
+        reinterpret_cast<const Vector<double, N>*>(array.data()),
+        static_cast<size_t>(array.shape(0)));
+}
+
+//! Allocates a NumPy array of shape (n,) and returns it with its view.
+inline std::pair<NumPyArrayD, ArrayView1<double>> MakeNumPyArray(size_t n)
+{
+    NumPyArrayD array(static_cast<pybind11::ssize_t>(n));
+
+    return { array, ArrayView1<double>(array.mutable_data(), n) };
+}
+
+//! Allocates a NumPy array of shape (n, N) and returns it with its vector view.
+template <size_t N>
+std::pair<NumPyArrayD, ArrayView1<Vector<double, N>>> MakeNumPyVectorArray(
+    size_t n)
+{
+    NumPyArrayD array({ static_cast<pybind11::ssize_t>(n),
+                        static_cast<pybind11::ssize_t>(N) });
+
+    return { array, ArrayView1<Vector<double, N>>(
+                        reinterpret_cast<Vector<double, N>*>(
+                            array.mutable_data()),
+                        n) };
+}
+
+//!
+//! \brief Calls \p func with the execution policy to evaluate \p field with.
+//!
+//! The custom fields created from Python call back into the interpreter, so
+//! they are evaluated serially while holding the GIL. The other fields are
+//! evaluated in parallel with the GIL released.
+//!
+template <typename CustomFieldType, typename FieldType, typename Function>
+void EvaluateMany(const FieldType& field, const Function& func)
+{
+    if (dynamic_cast<const CustomFieldType*>(&field) != nullptr)
+    {
+        func(ExecutionPolicy::Serial);
+        return;
+    }
+
+    pybind11::gil_scoped_release release;
+    func(ExecutionPolicy::Parallel);
+}
+
+//!
+//! \brief Copies a NumPy array into the grid data view \p dst in parallel.
+//!
+//! The array shape must be the reversed grid data size ((y, x) for 2-D and
+//! (z, y, x) for 3-D), followed by \p ValueSize for vector-valued data.
+//!
+template <typename T, size_t N, size_t ValueSize = 1>
+void CopyNumPyArrayToView(const NumPyArrayD& src, ArrayView<T, N> dst)
+{
+    constexpr size_t ndim = (ValueSize > 1) ? N + 1 : N;
+
+    if (static_cast<size_t>(src.ndim()) != ndim)
+    {
+        throw std::invalid_argument("Invalid number of dimensions.");
+    }
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (static_cast<size_t>(src.shape(i)) != dst.Size()[N - i - 1])
+        {
+            throw std::invalid_argument("Invalid shape.");
+        }
+    }
+
+    if (ValueSize > 1 && static_cast<size_t>(src.shape(N)) != ValueSize)
+    {
+        throw std::invalid_argument("Invalid shape.");
+    }
+
+    static_assert(sizeof(T) == ValueSize * sizeof(double),
+                  "Value type must consist of ValueSize doubles.");
+
+    const double* srcData = src.data();
+    T* dstData = dst.data();
+    const size_t length = dst.Length();
+
+    pybind11::gil_scoped_release release;
+
+    ParallelRangeFor(ZERO_SIZE, length, [&](size_t begin, size_t end) {
+        std::memcpy(static_cast<void*>(dstData + begin),
+                    srcData + begin * ValueSize, (end - begin) * sizeof(T));
+    });
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_FRAME_EXPORTER_HPP
+#define CUBBYFLOW_FRAME_EXPORTER_HPP
+
+#include <Core/Animation/Frame.hpp>
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Matrix/Matrix.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Asynchronous frame exporter for the physics animations.
+//!
+//! This class takes a snapshot of the selected particle channels and grids at
+//! the end of each frame and hands it over to a writer callback that runs on a
+//! background thread, so that the serialization and the file I/O overlap with
+//! the simulation of the next frame. At most \p maxQueueDepth snapshots wait
+//! for the writer; when the queue is full, Capture() blocks until the writer
+//! catches up. Counting the snapshot being written and the one being filled
+//! by Capture(), the peak memory is maxQueueDepth + 2 snapshots. The snapshot
+//! buffers are recycled, so once the pipeline is warmed up, taking a snapshot
+//! is a copy without any allocation. Large arrays are copied in parallel (see
+//! Array::CopyFrom).
+//!
+//! The sources are called from the thread calling Capture() and must return a
+//! view of the storage owned by the caller (e.g. ParticleSystemData3::
+//! Positions()), not a temporary array. Face-centered grids can be added as
+//! three scalar grids of their u, v, and w data.
+//!
+//! Errors thrown by the writer are rethrown by Capture(), Flush(), or Wait().
+//! Call Wait() before the destruction to receive the errors of the last
+//! snapshots; the destructor can only log them.
+//!
+class FrameExporter final
+{
+ public:
+    //! Copy of the selected data taken at the end of a frame.
+    struct Snapshot
+    {
+        //! The frame that has just been simulated.
+        Frame frame;
+
+        //! Copies of the scalar channels, in the order they were added.
+        std::vector<Array1<double>> scalarChannels;
+
+        //! Copies of the vector channels, in the order they were added.
+        std::vector<Array1<Vector3D>> vectorChannels;
+
+        //! Copies of the scalar grids, in the order they were added.
+        std::vector<Array3<double>> scalarGrids;
+
+        //! Copies of the vector grids, in the order they were added.
+        std::vector<Array3<Vector3D>> vectorGrids;
+    };
+
+    //! Callback that writes a snapshot. Runs on the background thread.
+    using Writer = std::function<void(const Snapshot&)>;
+
+    //! Callback that returns the scalar channel to copy.
+    using ScalarChannelSource = std::function<ConstArrayView1<double>()>;
+
+    //! Callback that returns the vector channel to copy.
+    using VectorChannelSource = std::function<ConstArrayView1<Vector3D>()>;
+
+    //! Callback that returns the scalar grid data to copy.
+    using ScalarGridSource = std::function<ConstArrayView3<double>()>;
+
+    //! Callback that returns the vector grid data to copy.
+    using VectorGridSource = std::function<ConstArrayView3<Vector3D>()>;
+
+    //!
+    //! \brief Constructs the exporter and starts the writer thread.
+    //!
+    //! \param[in] writer        The callback that writes a snapshot.
+    //! \param[in] maxQueueDepth The max number of snapshots waiting for the
+    //!                          writer. Up to maxQueueDepth + 2 snapshots
+    //!                          are alive at once: one being written, the
+    //!                          queued ones and one being filled.
+    //!
+    explicit FrameExporter(Writer writer, size_t maxQueueDepth = 1);
+
+    //! Deleted copy constructor.
+    FrameExporter(const FrameExporter&) = delete;
+
+    //! Deleted move constructor.
+    FrameExporter(FrameExporter&&) noexcept = delete;
+
+    //!
+    //! \brief Writes the pending snapshots and stops the writer thread.
+    //!
+    //! A writer exception that has not been reported is logged, since the
+    //! destructor cannot throw it.
+    //!
+    ~FrameExporter();
+
+    //! Deleted copy assignment operator.
+    FrameExporter& operator=(const FrameExporter&) = delete;
+
+    //! Deleted move assignment operator.
+    FrameExporter& operator=(FrameExporter&&) noexcept = delete;
+
+    //! Adds a scalar channel and returns its index in the snapshot.
+    size_t AddScalarChannel(ScalarChannelSource source);
+
+    //! Adds a vector channel and returns its index in the snapshot.
+    size_t AddVectorChannel(VectorChannelSource source);
+
+    //! Adds a scalar grid and returns its index in the snapshot.
+    size_t AddScalarGrid(ScalarGridSource source);
+
+    //! Adds a vector grid (e.g. CollocatedVectorGrid3::DataView()) and returns
+    //! its index in the snapshot.
+    size_t AddVectorGrid(VectorGridSource source);
+
+    //!
+    //! \brief Takes a snapshot of the selected data and queues it.
+    //!
+    //! Blocks while the queue is full. If the writer has thrown an exception
+    //! since the last call, the exception is rethrown here. Throws
+    //! std::logic_error after Wait().
+    //!
+    //! \param[in] frame The frame that has just been simulated.
+    //!
+    void Capture(const Frame& frame);
+
+    //!
+    //! \brief Waits until all queued snapshots are written.
+    //!
+    //! If the writer has thrown an exception since the last call, the
+    //! exception is rethrown here.
+    //!
+    void Flush();
+
+    //!
+    //! \brief Writes all queued snapshots and stops the writer thread.
+    //!
+    //! If the writer has thrown an exception that has not been reported yet,
+    //! the exception is rethrown here. No snapshot can be captured afterwards.
+    //!
+    void Wait();
+
+    //! Returns the max number of snapshots waiting for the writer.
+    [[nodiscard]] size_t GetMaxQueueDepth() const;
+
+    //! Returns the number of snapshots that are queued or being written.
+    [[nodiscard]] size_t NumberOfPendingFrames() const;
+
+    //! Returns the number of snapshots the writer has finished.
+    [[nodiscard]] size_t NumberOfExportedFrames() const;
+
+ private:
+    void Run();
+
+    void Stop();
+
+    void RethrowIfFailed();
+
+    Writer m_writer;
+    size_t m_maxQueueDepth;
+
+    // Only accessed by the thread calling Capture()
+    std::vector<ScalarChannelSource> m_scalarChannelSources;
+    std::vector<VectorChannelSource> m_vectorChannelSources;
+    std::vector<ScalarGridSource> m_scalarGridSources;
+    std::vector<VectorGridSource> m_vectorGridSources;
+
+    // Guarded by m_mutex
+    std::deque<Snapshot> m_queue;
+    std::vector<Snapshot> m_freeSnapshots;
+    std::exception_ptr m_error;
+    size_t m_numberOfExportedFrames = 0;
+    bool m_isWriting = false;
+    bool m_isStopped = false;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_queueCondition;
+    std::condition_variable m_doneCondition;
+    std::thread m_thread;
+};
+
+//! Shared pointer type for the FrameExporter.
+using FrameExporterPtr = std::shared_ptr<FrameExporter>;
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
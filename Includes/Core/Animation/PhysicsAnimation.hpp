@@ -12,6 +12,8 @@
 #define CUBBYFLOW_PHYSICS_ANIMATION_HPP
 
 #include <Core/Animation/Animation.hpp>
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 
 namespace CubbyFlow
 {
@@ -111,6 +113,40 @@ class PhysicsAnimation : public Animation
     //!
     [[nodiscard]] double GetCurrentTimeInSeconds() const;
 
+    //!
+    //! \brief Returns the frame exporter.
+    //!
+    [[nodiscard]] const FrameExporterPtr& GetFrameExporter() const;
+
+    //!
+    //! \brief Sets the frame exporter.
+    //!
+    //! When set, the exporter takes a snapshot at the end of each updated frame
+    //! and writes it on a background thread while the next frame is simulated.
+    //! Pass nullptr to export nothing.
+    //!
+    //! \param[in] exporter The frame exporter.
+    //!
+    void SetFrameExporter(const FrameExporterPtr& exporter);
+
+    //!
+    //! \brief Saves the complete simulation state into \p checkpoint.
+    //!
+    //! Together with the same setup code (solver types, callbacks and so on),
+    //! the saved state lets LoadCheckpoint resume the simulation with the
+    //! bit-exact results of an uninterrupted run.
+    //!
+    void SaveCheckpoint(Checkpoint* checkpoint) const;
+
+    //!
+    //! \brief Restores the simulation state from \p checkpoint.
+    //!
+    //! The animation must be set up in the same way as the one that saved the
+    //! checkpoint. The next Update() call continues from the saved frame
+    //! without initializing the simulation again.
+    //!
+    void LoadCheckpoint(const Checkpoint& checkpoint);
+
  protected:
     //!
     //! \brief Called when a single time-step should be advanced.
@@ -149,6 +185,22 @@ class PhysicsAnimation : public Animation
     //!
     virtual void OnInitialize();
 
+    //!
+    //! \brief Called when the simulation state is saved into \p checkpoint.
+    //!
+    //! Inheriting classes should override this function to save their own
+    //! state, calling the function of the base class first.
+    //!
+    virtual void OnSaveCheckpoint(Checkpoint* checkpoint) const;
+
+    //!
+    //! \brief Called when the simulation state is restored from \p checkpoint.
+    //!
+    //! Inheriting classes should override this function to restore their own
+    //! state, calling the function of the base class first.
+    //!
+    virtual void OnLoadCheckpoint(const Checkpoint& checkpoint);
+
  private:
     void OnUpdate(const Frame& frame) final;
 
@@ -160,6 +212,7 @@ class PhysicsAnimation : public Animation
     bool m_isUsingFixedSubTimeSteps = true;
     unsigned int m_numberOfFixedSubTimeSteps = 1;
     double m_currentTime = 0.0;
+    FrameExporterPtr m_frameExporter;
 };
 
 using PhysicsAnimationPtr = std::shared_ptr<PhysicsAnimation>;
@@ -167,7 +167,7 @@ Array<T, N>::Array() : Base()
 template <typename T, size_t N>
 Array<T, N>::Array(const Vector<size_t, N>& size_, const T& initVal) : Array()
 {
-    m_data.resize(Product<size_t, N>(size_, 1), initVal);
+    Allocate(Product<size_t, N>(size_, 1), initVal);
     Base::SetPtrAndSize(m_data.data(), size_);
 }
 
@@ -179,7 +179,7 @@ Array<T, N>::Array(size_t nx, Args... args)
     T initVal;
 
     Internal::GetSizeAndInitVal<T, N, N - 1>::Call(size, initVal, nx, args...);
-    m_data.resize(Product<size_t, N>(size, 1), initVal);
+    Allocate(Product<size_t, N>(size, 1), initVal);
     Base::SetPtrAndSize(m_data.data(), size);
 }
 
@@ -262,29 +262,46 @@ template <typename T, size_t N>
 template <typename D>
 void Array<T, N>::CopyFrom(const ArrayBase<T, N, D>& other)
 {
-    Resize(other.Size());
-    ForEachIndex(Vector<size_t, N>{}, other.Size(),
-                 [&](auto... idx) { this->At(idx...) = other(idx...); });
+    ResizeUninitialized(other.Size());
+
+    // Copy with the same partitioning as Fill so that the pages of a new
+    // storage are first touched by the threads which later process them.
+    const auto src = other.data();
+    ParallelFor(
+        ZERO_SIZE, m_data.size(), [&](size_t i) { m_data[i] = src[i]; },
+        GetInitPolicy(m_data.size()));
 }
 
 template <typename T, size_t N>
 template <typename D>
 void Array<T, N>::CopyFrom(const ArrayBase<const T, N, D>& other)
 {
-    Resize(other.Size());
-    ForEachIndex(Vector<size_t, N>{}, other.Size(),
-                 [&](auto... idx) { this->At(idx...) = other(idx...); });
+    ResizeUninitialized(other.Size());
+
+    // Copy with the same partitioning as Fill so that the pages of a new
+    // storage are first touched by the threads which later process them.
+    const auto src = other.data();
+    ParallelFor(
+        ZERO_SIZE, m_data.size(), [&](size_t i) { m_data[i] = src[i]; },
+        GetInitPolicy(m_data.size()));
 }
 
 template <typename T, size_t N>
 void Array<T, N>::Fill(const T& val)
 {
-    std::fill(m_data.begin(), m_data.end(), val);
+    ParallelFill(m_data.begin(), m_data.end(), val,
+                 GetInitPolicy(m_data.size()));
 }
 
 template <typename T, size_t N>
 void Array<T, N>::Resize(Vector<size_t, N> size_, const T& initVal)
 {
+    // Every element is kept, so the storage is reused.
+    if (size_ == m_size)
+    {
+        return;
+    }
+
     Array newArray(size_, initVal);
     Vector<size_t, N> minSize = Min(m_size, newArray.m_size);
 
@@ -306,6 +323,31 @@ void Array<T, N>::Resize(size_t nx, Args... args)
     Resize(size, initVal);
 }
 
+template <typename T, size_t N>
+void Array<T, N>::ResizeUninitialized(const Vector<size_t, N>& size_)
+{
+    const size_t length = Product<size_t, N>(size_, 1);
+
+    // Drop the old elements first so that growing does not copy them.
+    if (length > m_data.capacity())
+    {
+        std::vector<T, ArrayAllocator<T>>{}.swap(m_data);
+    }
+
+    m_data.resize(length);
+    Base::SetPtrAndSize(m_data.data(), size_);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+void Array<T, N>::ResizeUninitialized(size_t nx, Args... args)
+{
+    static_assert(sizeof...(Args) == N - 1, "Invalid number of sizes.");
+
+    ResizeUninitialized(
+        Vector<size_t, N>{ nx, static_cast<size_t>(args)... });
+}
+
 template <typename T, size_t N>
 template <size_t M>
 std::enable_if_t<(M == 1), void> Array<T, N>::Append(const T& val)
@@ -351,6 +393,30 @@ void Array<T, N>::Swap(Array& other)
     std::swap(m_data, other.m_data);
 }
 
+template <typename T, size_t N>
+void Array<T, N>::Allocate(size_t length, const T& initVal)
+{
+    if constexpr (ArrayAllocationPolicy<T>::DEFER_INITIALIZATION)
+    {
+        // The allocator leaves the pages untouched, so Fill is the first touch
+        // and uses the same partitioning as ParallelFor.
+        m_data.resize(length);
+        Fill(initVal);
+    }
+    else
+    {
+        m_data.resize(length, initVal);
+    }
+}
+
+template <typename T, size_t N>
+ExecutionPolicy Array<T, N>::GetInitPolicy(size_t length)
+{
+    return length * sizeof(T) >= PARALLEL_INIT_THRESHOLD
+               ? ExecutionPolicy::Parallel
+               : ExecutionPolicy::Serial;
+}
+
 template <typename T, size_t N>
 ArrayView<T, N> Array<T, N>::View()
 {
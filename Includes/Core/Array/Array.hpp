@@ -11,7 +11,9 @@
 #ifndef CUBBYFLOW_ARRAY_HPP
 #define CUBBYFLOW_ARRAY_HPP
 
+#include <Core/Array/ArrayAllocator.hpp>
 #include <Core/Array/ArrayBase.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 #include <vector>
 
@@ -42,6 +44,11 @@ class Array final : public ArrayBase<T, N, Array<T, N>>
     using Base::SwapPtrAndSize;
 
  public:
+    //! Arrays larger than this (in bytes) are initialized in parallel so that
+    //! the pages are first touched by the threads which later process them.
+    static constexpr size_t PARALLEL_INIT_THRESHOLD =
+        ArrayAllocationPolicy<T>::PARALLEL_INIT_THRESHOLD;
+
     Array();
 
     Array(const Vector<size_t, N>& size, const T& initVal = T{});
@@ -86,6 +93,14 @@ class Array final : public ArrayBase<T, N, Array<T, N>>
     template <typename... Args>
     void Resize(size_t nx, Args... args);
 
+    //! Resizes the array without preserving the elements. The elements are
+    //! left uninitialized if ArrayAllocationPolicy<T> defers the
+    //! initialization. Use this for buffers that are overwritten.
+    void ResizeUninitialized(const Vector<size_t, N>& size_);
+
+    template <typename... Args>
+    void ResizeUninitialized(size_t nx, Args... args);
+
     template <size_t M = N>
     std::enable_if_t<(M == 1), void> Append(const T& val);
 
@@ -106,7 +121,11 @@ class Array final : public ArrayBase<T, N, Array<T, N>>
     [[nodiscard]] ArrayView<const T, N> View() const;
 
  private:
-    std::vector<T> m_data;
+    void Allocate(size_t length, const T& initVal);
+
+    [[nodiscard]] static ExecutionPolicy GetInitPolicy(size_t length);
+
+    std::vector<T, ArrayAllocator<T>> m_data;
 };
 
 template <class T>
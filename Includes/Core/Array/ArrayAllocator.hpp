@@ -0,0 +1,140 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_ARRAY_ALLOCATOR_HPP
+#define CUBBYFLOW_ARRAY_ALLOCATOR_HPP
+
+#include <Core/Utils/Macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Allocation policy for the Array storage.
+//!
+//! The policy can be specialized for a value type to change how arrays of that
+//! type are allocated and initialized.
+//!
+//! - ALIGNMENT is the alignment of the storage in bytes.
+//! - DEFER_INITIALIZATION leaves the elements of a newly allocated storage
+//!   untouched so that the array can initialize them with ParallelFill. It
+//!   must only be enabled for implicit-lifetime types, i.e. types which are
+//!   trivially copyable and trivially destructible. This covers Vector and
+//!   Matrix, whose default constructors are user-provided.
+//! - PARALLEL_INIT_THRESHOLD is the size in bytes from which the array
+//!   initializes and copies its elements in parallel.
+//!
+//! \tparam T - Value type.
+//!
+template <typename T>
+struct ArrayAllocationPolicy
+{
+    static constexpr size_t ALIGNMENT = std::max<size_t>(64, alignof(T));
+
+    static constexpr bool DEFER_INITIALIZATION =
+        std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+    static constexpr size_t PARALLEL_INIT_THRESHOLD = 1 << 20;
+};
+
+//!
+//! \brief Allocator for the Array storage.
+//!
+//! The allocator returns memory aligned to ArrayAllocationPolicy<T>::ALIGNMENT
+//! bytes so that the rows of an array can be loaded with aligned vector
+//! instructions. If the policy defers the initialization, construction without
+//! arguments does nothing, so resizing the storage does not touch the memory.
+//! This leaves the first touch of the pages to the parallel loops that
+//! initialize the array, which places the pages on the NUMA nodes of the
+//! threads working on them.
+//!
+//! \tparam T - Value type.
+//!
+template <typename T>
+class ArrayAllocator
+{
+ public:
+    using value_type = T;
+
+    //! Alignment of the allocated memory in bytes.
+    static constexpr size_t ALIGNMENT = ArrayAllocationPolicy<T>::ALIGNMENT;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = ArrayAllocator<U>;
+    };
+
+    //! Default constructor.
+    ArrayAllocator() noexcept = default;
+
+    //! Constructs from an allocator of another type.
+    template <typename U>
+    ArrayAllocator(const ArrayAllocator<U>&) noexcept
+    {
+        // Do nothing
+    }
+
+    //! Allocates aligned memory for \p n elements.
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T), std::align_val_t{ ALIGNMENT }));
+    }
+
+    //! Deallocates memory returned by allocate().
+    void deallocate(T* p, size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t{ ALIGNMENT });
+    }
+
+    //! Constructs an element without arguments. This is a no-op if the policy
+    //! of \p U defers the initialization.
+    template <typename U>
+    void construct(U* p) noexcept(
+        std::is_nothrow_default_constructible_v<U>)
+    {
+        if constexpr (!ArrayAllocationPolicy<U>::DEFER_INITIALIZATION)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+        else
+        {
+            UNUSED_VARIABLE(p);
+        }
+    }
+
+    //! Constructs an element with given arguments.
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArrayAllocator<T>&, const ArrayAllocator<U>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArrayAllocator<T>&, const ArrayAllocator<U>&) noexcept
+{
+    return false;
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
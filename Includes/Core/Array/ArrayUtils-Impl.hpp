@@ -53,151 +53,244 @@ void Copy(ArrayView<T, 1> src, size_t begin, size_t end, ArrayView<U, 1> dst)
     Copy(src, Vector1UZ{ begin }, Vector1UZ{ end }, dst);
 }
 
-template <typename T, typename U>
-void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
-                         unsigned int numberOfIterations, ArrayView2<U> output)
+namespace Internal
 {
-    const Vector2UZ size = input.Size();
+template <typename T, typename U, size_t N>
+void ExtrapolateToRegion(ArrayView<T, N> input, ArrayView<char, N> valid,
+                         unsigned int numberOfIterations,
+                         ArrayView<U, N> output,
+                         ExtrapolationBuffers<N>& buffers)
+{
+    using Index = Vector<size_t, N>;
+    using ScalarType = typename GetScalarType<T>::value;
+
+    constexpr char INVALID = 0;
+    constexpr char VALID = 1;
+    constexpr char QUEUED = 2;
+    constexpr char FRONT = 3;
+
+    // Number of front points handled by one block when collecting the next
+    // front.
+    constexpr size_t BLOCK_SIZE = 1024;
+
+    const Index size = input.Size();
 
     assert(size == valid.Size());
     assert(size == output.Size());
 
-    Array2<char> valid0(size);
-    Array2<char> valid1(size);
+    if (numberOfIterations == 0)
+    {
+        ParallelForEachIndex(
+            size, [&](auto... idx) { output(idx...) = input(idx...); });
+        return;
+    }
 
-    ParallelForEachIndex(valid0.Size(), [&](size_t i, size_t j) {
-        valid0(i, j) = valid(i, j);
-        output(i, j) = input(i, j);
-    });
+    Array<char, N>& markers = buffers.markers;
+    Array1<Index>& frontier = buffers.frontier;
+    Array1<Index>& nextFrontier = buffers.nextFrontier;
+    Array1<size_t>& blockOffsets = buffers.blockOffsets;
 
-    for (unsigned int iter = 0; iter < numberOfIterations; ++iter)
-    {
-        ForEachIndex(valid0.Size(), [&](size_t i, size_t j) {
-            if (!valid0(i, j))
+    const auto forEachNeighbor = [&](const Index& idx, const auto& func) {
+        for (size_t axis = 0; axis < N; ++axis)
+        {
+            if (idx[axis] + 1 < size[axis])
             {
-                T sum = T{};
-                unsigned int count = 0;
-
-                if (i + 1 < size.x && valid0(i + 1, j))
-                {
-                    sum += output(i + 1, j);
-                    ++count;
-                }
+                Index neighbor = idx;
+                ++neighbor[axis];
+                func(neighbor);
+            }
 
-                if (i > 0 && valid0(i - 1, j))
-                {
-                    sum += output(i - 1, j);
-                    ++count;
-                }
+            if (idx[axis] > 0)
+            {
+                Index neighbor = idx;
+                --neighbor[axis];
+                func(neighbor);
+            }
+        }
+    };
+
+    // Gathers the points emitted by forEachPoint(block, emit) into dst in the
+    // order of the blocks. The points of each block are counted, the counts
+    // are scanned, then the blocks are written in parallel.
+    const auto compact = [&](size_t numberOfBlocks, const auto& forEachPoint,
+                             Array1<Index>& dst) {
+        blockOffsets.ResizeUninitialized(numberOfBlocks + 1);
+        blockOffsets[0] = 0;
+
+        ParallelFor(ZERO_SIZE, numberOfBlocks, [&](size_t b) {
+            size_t count = 0;
+            forEachPoint(b, [&](const Index&) { ++count; });
+            blockOffsets[b + 1] = count;
+        });
 
-                if (j + 1 < size.y && valid0(i, j + 1))
-                {
-                    sum += output(i, j + 1);
-                    ++count;
-                }
+        for (size_t b = 0; b < numberOfBlocks; ++b)
+        {
+            blockOffsets[b + 1] += blockOffsets[b];
+        }
 
-                if (j > 0 && valid0(i, j - 1))
-                {
-                    sum += output(i, j - 1);
-                    ++count;
-                }
+        dst.ResizeUninitialized(blockOffsets[numberOfBlocks]);
 
-                if (count > 0)
-                {
-                    output(i, j) =
-                        sum /
-                        static_cast<typename GetScalarType<T>::value>(count);
-                    valid1(i, j) = 1;
-                }
-            }
-            else
-            {
-                valid1(i, j) = 1;
-            }
+        ParallelFor(ZERO_SIZE, numberOfBlocks, [&](size_t b) {
+            size_t n = blockOffsets[b];
+            forEachPoint(b, [&](const Index& idx) { dst[n++] = idx; });
         });
+    };
 
-        valid0.Swap(valid1);
-    }
-}
+    // The first front is the invalid points next to the valid region. Only
+    // the input mask is read here, so the markers can be written in parallel.
+    markers.ResizeUninitialized(size);
 
-template <typename T, typename U>
-void ExtrapolateToRegion(ArrayView3<T> input, ArrayView3<char> valid,
-                         unsigned int numberOfIterations, ArrayView3<U> output)
-{
-    const Vector3UZ size = input.Size();
+    ParallelForEachIndex(size, [&](auto... idx) {
+        output(idx...) = input(idx...);
 
-    assert(size == valid.Size());
-    assert(size == output.Size());
+        if (valid(idx...))
+        {
+            markers(idx...) = VALID;
+            return;
+        }
 
-    Array3<char> valid0(size);
-    Array3<char> valid1(size);
+        bool isFront = false;
+        forEachNeighbor(Index{ idx... }, [&](const Index& neighbor) {
+            isFront |= (valid(neighbor) != 0);
+        });
 
-    ParallelForEachIndex(valid0.Size(), [&](size_t i, size_t j, size_t k) {
-        valid0(i, j, k) = valid(i, j, k);
-        output(i, j, k) = input(i, j, k);
+        markers(idx...) = isFront ? QUEUED : INVALID;
     });
 
+    // Blocks are the slices along the last axis.
+    compact(
+        size[N - 1],
+        [&](size_t slice, const auto& emit) {
+            Index begin{};
+            Index end = size;
+            begin[N - 1] = slice;
+            end[N - 1] = slice + 1;
+
+            CubbyFlow::ForEachIndex(begin, end, [&](auto... idx) {
+                if (markers(idx...) == QUEUED)
+                {
+                    emit(Index{ idx... });
+                }
+            });
+        },
+        frontier);
+
+    // Each layer averages the values of the neighbors that were valid before
+    // the layer, which is the same as a Jacobi-style sweep over the grid. The
+    // front points themselves are never read during the sweep, so the results
+    // are written to the output directly.
     for (unsigned int iter = 0; iter < numberOfIterations; ++iter)
     {
-        ForEachIndex(valid0.Size(), [&](size_t i, size_t j, size_t k) {
-            if (!valid0(i, j, k))
-            {
-                T sum = T{};
-                unsigned int count = 0;
+        const size_t numberOfFrontPoints = frontier.Length();
 
-                if (i + 1 < size.x && valid0(i + 1, j, k))
-                {
-                    sum += output(i + 1, j, k);
-                    ++count;
-                }
+        if (numberOfFrontPoints == 0)
+        {
+            break;
+        }
 
-                if (i > 0 && valid0(i - 1, j, k))
-                {
-                    sum += output(i - 1, j, k);
-                    ++count;
-                }
+        ParallelFor(ZERO_SIZE, numberOfFrontPoints, [&](size_t n) {
+            T sum = T{};
+            unsigned int count = 0;
 
-                if (j + 1 < size.y && valid0(i, j + 1, k))
+            forEachNeighbor(frontier[n], [&](const Index& neighbor) {
+                if (markers(neighbor) == VALID)
                 {
-                    sum += output(i, j + 1, k);
+                    sum += output(neighbor);
                     ++count;
                 }
+            });
 
-                if (j > 0 && valid0(i, j - 1, k))
-                {
-                    sum += output(i, j - 1, k);
-                    ++count;
-                }
+            output(frontier[n]) = sum / static_cast<ScalarType>(count);
+        });
 
-                if (k + 1 < size.z && valid0(i, j, k + 1))
-                {
-                    sum += output(i, j, k + 1);
-                    ++count;
-                }
+        if (iter + 1 == numberOfIterations)
+        {
+            break;
+        }
+
+        ParallelFor(ZERO_SIZE, numberOfFrontPoints,
+                    [&](size_t n) { markers(frontier[n]) = FRONT; });
 
-                if (k > 0 && valid0(i, j, k - 1))
+        // The next front is the invalid neighbors of the current front. A
+        // point is collected by the first of its neighbors on the current
+        // front so that every point is collected exactly once.
+        const auto isOwner = [&](const Index& point, const Index& owner) {
+            bool isFound = false;
+            bool isOwned = false;
+
+            forEachNeighbor(point, [&](const Index& neighbor) {
+                if (!isFound && markers(neighbor) == FRONT)
                 {
-                    sum += output(i, j, k - 1);
-                    ++count;
+                    isFound = true;
+                    isOwned = (neighbor == owner);
                 }
+            });
+
+            return isOwned;
+        };
 
-                if (count > 0)
+        compact(
+            (numberOfFrontPoints + BLOCK_SIZE - 1) / BLOCK_SIZE,
+            [&](size_t b, const auto& emit) {
+                const size_t end =
+                    std::min((b + 1) * BLOCK_SIZE, numberOfFrontPoints);
+
+                for (size_t n = b * BLOCK_SIZE; n < end; ++n)
                 {
-                    output(i, j, k) =
-                        sum /
-                        static_cast<typename GetScalarType<T>::value>(count);
-                    valid1(i, j, k) = 1;
+                    forEachNeighbor(frontier[n], [&](const Index& neighbor) {
+                        if (markers(neighbor) == INVALID &&
+                            isOwner(neighbor, frontier[n]))
+                        {
+                            emit(neighbor);
+                        }
+                    });
                 }
-            }
-            else
-            {
-                valid1(i, j, k) = 1;
-            }
-        });
+            },
+            nextFrontier);
 
-        valid0.Swap(valid1);
+        ParallelFor(ZERO_SIZE, numberOfFrontPoints,
+                    [&](size_t n) { markers(frontier[n]) = VALID; });
+
+        frontier.Swap(nextFrontier);
     }
 }
+}  // namespace Internal
+
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
+                         unsigned int numberOfIterations, ArrayView2<U> output)
+{
+    ExtrapolationBuffers<2> buffers;
+    Internal::ExtrapolateToRegion(input, valid, numberOfIterations, output,
+                                  buffers);
+}
+
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
+                         unsigned int numberOfIterations, ArrayView2<U> output,
+                         ExtrapolationBuffers<2>& buffers)
+{
+    Internal::ExtrapolateToRegion(input, valid, numberOfIterations, output,
+                                  buffers);
+}
+
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView3<T> input, ArrayView3<char> valid,
+                         unsigned int numberOfIterations, ArrayView3<U> output)
+{
+    ExtrapolationBuffers<3> buffers;
+    Internal::ExtrapolateToRegion(input, valid, numberOfIterations, output,
+                                  buffers);
+}
+
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView3<T> input, ArrayView3<char> valid,
+                         unsigned int numberOfIterations, ArrayView3<U> output,
+                         ExtrapolationBuffers<3>& buffers)
+{
+    Internal::ExtrapolateToRegion(input, valid, numberOfIterations, output,
+                                  buffers);
+}
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_ARRAY_UTILS_HPP
 #define CUBBYFLOW_ARRAY_UTILS_HPP
 
+#include <Core/Array/Array.hpp>
 #include <Core/Array/ArrayView.hpp>
 
 namespace CubbyFlow
@@ -35,6 +36,21 @@ void Copy(ArrayView<T, N> src, ArrayView<U, N> dst);
 template <typename T, typename U>
 void Copy(ArrayView<T, 1> src, size_t begin, size_t end, ArrayView<U, 1> dst);
 
+//!
+//! \brief Scratch buffers for ExtrapolateToRegion.
+//!
+//! Passing the same instance to repeated calls reuses its memory. An instance
+//! must not be shared by concurrent calls.
+//!
+template <size_t N>
+struct ExtrapolationBuffers
+{
+    Array<char, N> markers;
+    Array1<Vector<size_t, N>> frontier;
+    Array1<Vector<size_t, N>> nextFrontier;
+    Array1<size_t> blockOffsets;
+};
+
 //!
 //! \brief Extrapolates 2-D input data from 'valid' (1) to 'invalid' (0) region.
 //!
@@ -44,6 +60,11 @@ void Copy(ArrayView<T, 1> src, size_t begin, size_t end, ArrayView<U, 1> dst);
 //! numberOfIterations. The input parameters 'valid' and 'data' should be
 //! collocated.
 //!
+//! Each iteration assigns the average of the 'valid' neighbors to the
+//! 'invalid' points next to the 'valid' region. Only the front of the
+//! propagation is visited per iteration, so the cost is proportional to the
+//! number of extrapolated points rather than the size of the grid.
+//!
 //! \param input - data to extrapolate
 //! \param valid - set 1 if valid, else 0.
 //! \param numberOfIterations - number of iterations for propagation
@@ -53,6 +74,18 @@ template <typename T, typename U>
 void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
                          unsigned int numberOfIterations, ArrayView2<U> output);
 
+//!
+//! \brief Extrapolates 2-D input data using the given scratch buffers.
+//!
+//! Same as the overload above, but reusing \p buffers across calls avoids
+//! allocating the scratch memory every time. One instance must not be shared
+//! by concurrent calls.
+//!
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
+                         unsigned int numberOfIterations, ArrayView2<U> output,
+                         ExtrapolationBuffers<2>& buffers);
+
 //!
 //! \brief Extrapolates 3-D input data from 'valid' (1) to 'invalid' (0) region.
 //!
@@ -62,6 +95,11 @@ void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
 //! numberOfIterations. The input parameters 'valid' and 'data' should be
 //! collocated.
 //!
+//! Each iteration assigns the average of the 'valid' neighbors to the
+//! 'invalid' points next to the 'valid' region. Only the front of the
+//! propagation is visited per iteration, so the cost is proportional to the
+//! number of extrapolated points rather than the size of the grid.
+//!
 //! \param input - data to extrapolate
 //! \param valid - set 1 if valid, else 0.
 //! \param numberOfIterations - number of iterations for propagation
@@ -70,6 +108,18 @@ void ExtrapolateToRegion(ArrayView2<T> input, ArrayView2<char> valid,
 template <typename T, typename U>
 void ExtrapolateToRegion(ArrayView3<T> input, ArrayView3<char> valid,
                          unsigned int numberOfIterations, ArrayView3<U> output);
+
+//!
+//! \brief Extrapolates 3-D input data using the given scratch buffers.
+//!
+//! Same as the overload above, but reusing \p buffers across calls avoids
+//! allocating the scratch memory every time. One instance must not be shared
+//! by concurrent calls.
+//!
+template <typename T, typename U>
+void ExtrapolateToRegion(ArrayView3<T> input, ArrayView3<char> valid,
+                         unsigned int numberOfIterations, ArrayView3<U> output,
+                         ExtrapolationBuffers<3>& buffers);
 }  // namespace CubbyFlow
 
 #include <Core/Array/ArrayUtils-Impl.hpp>
@@ -11,8 +11,11 @@
 #ifndef CUBBYFLOW_GRID_EMITTER3_HPP
 #define CUBBYFLOW_GRID_EMITTER3_HPP
 
+#include <Core/Utils/Checkpoint.hpp>
+
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace CubbyFlow
 {
@@ -71,10 +74,32 @@ class GridEmitter3
     //!
     void SetOnBeginUpdateCallback(const OnBeginUpdateCallback& callback);
 
+    //!
+    //! \brief Saves the emitter state into \p checkpoint.
+    //!
+    //! The emission progress is saved with the channel names starting with
+    //! \p prefix. The update callback is not part of the state and must be set
+    //! again when restoring.
+    //!
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //! Restores the emitter state saved with given \p prefix.
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
  protected:
     virtual void OnUpdate(double currentTimeInSeconds,
                           double timeIntervalInSeconds) = 0;
 
+    //! Called when the emitter state is saved into \p checkpoint.
+    virtual void OnSaveCheckpoint(const std::string& prefix,
+                                  Checkpoint* checkpoint) const;
+
+    //! Called when the emitter state is restored from \p checkpoint.
+    virtual void OnLoadCheckpoint(const std::string& prefix,
+                                  const Checkpoint& checkpoint);
+
     void CallOnBeginUpdateCallback(double currentTimeInSeconds,
                                    double timeIntervalInSeconds);
 
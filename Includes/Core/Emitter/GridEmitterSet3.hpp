@@ -56,6 +56,12 @@ class GridEmitterSet3 final : public GridEmitter3
     void OnUpdate(double currentTimeInSeconds,
                   double timeIntervalInSeconds) override;
 
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
     std::vector<GridEmitter3Ptr> m_emitters;
 };
 
@@ -12,6 +12,7 @@
 #define CUBBYFLOW_PARTICLE_EMITTER3_HPP
 
 #include <Core/Particle/ParticleSystemData.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 
 namespace CubbyFlow
 {
@@ -76,6 +77,20 @@ class ParticleEmitter3
     //!
     void SetOnBeginUpdateCallback(const OnBeginUpdateCallback& callback);
 
+    //!
+    //! \brief Saves the emitter state into \p checkpoint.
+    //!
+    //! The emission progress is saved with the channel names starting with
+    //! \p prefix. The update callback is not part of the state and must be set
+    //! again when restoring.
+    //!
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //! Restores the emitter state saved with given \p prefix.
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
  protected:
     //! Called when ParticleEmitter3::SetTarget is executed.
     virtual void OnSetTarget(const ParticleSystemData3Ptr& particles);
@@ -84,6 +99,14 @@ class ParticleEmitter3
     virtual void OnUpdate(double currentTimeInSeconds,
                           double timeIntervalInSeconds) = 0;
 
+    //! Called when the emitter state is saved into \p checkpoint.
+    virtual void OnSaveCheckpoint(const std::string& prefix,
+                                  Checkpoint* checkpoint) const;
+
+    //! Called when the emitter state is restored from \p checkpoint.
+    virtual void OnLoadCheckpoint(const std::string& prefix,
+                                  const Checkpoint& checkpoint);
+
  private:
     ParticleSystemData3Ptr m_particles;
     OnBeginUpdateCallback m_onBeginUpdateCallback;
@@ -57,6 +57,12 @@ class ParticleEmitterSet3 final : public ParticleEmitter3
 
     void OnUpdate(double currentTimeInSeconds,
                   double timeIntervalInSecond) override;
+
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
 };
 
 //! Shared pointer type for the ParticleEmitterSet3.
@@ -74,6 +74,12 @@ class PointParticleEmitter3 final : public ParticleEmitter3
     void OnUpdate(double currentTimeInSeconds,
                   double timeIntervalInSeconds) override;
 
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
     void Emit(Array1<Vector3D>* newPositions, Array1<Vector3D>* newVelocities,
               size_t maxNewNumberOfParticles);
 
@@ -124,6 +124,12 @@ class VolumeGridEmitter3 final : public GridEmitter3
     void OnUpdate(double currentTimeInSeconds,
                   double timeIntervalInSeconds) override;
 
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
     void Emit();
 
     ImplicitSurface3Ptr m_sourceRegion;
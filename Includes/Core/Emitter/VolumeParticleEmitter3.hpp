@@ -156,6 +156,12 @@ class VolumeParticleEmitter3 final : public ParticleEmitter3
     void OnUpdate(double currentTimeInSeconds,
                   double timeIntervalInSeconds) override;
 
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
     void Emit(const ParticleSystemData3Ptr& particles,
               Array1<Vector3D>* newPositions, Array1<Vector3D>* newVelocities);
 
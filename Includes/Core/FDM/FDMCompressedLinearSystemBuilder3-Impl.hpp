@@ -0,0 +1,159 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_FDM_COMPRESSED_LINEAR_SYSTEM_BUILDER3_IMPL_HPP
+#define CUBBYFLOW_FDM_COMPRESSED_LINEAR_SYSTEM_BUILDER3_IMPL_HPP
+
+#include <Core/Utils/IterationUtils.hpp>
+
+namespace CubbyFlow
+{
+template <typename ActiveFunc, typename RowFunc>
+void FDMCompressedLinearSystemBuilder3::Build(
+    const Vector3UZ& size, const ActiveFunc& isActive, const RowFunc& buildRow,
+    FDMCompressedLinearSystem3* system)
+{
+    // Each line along the x-axis is processed by a single thread so that the
+    // active points can be numbered in the i-major order.
+    const size_t numLines = size.y * size.z;
+
+    if (m_coordToIndex.Size() != size)
+    {
+        m_coordToIndex.Resize(size);
+    }
+
+    m_lineOffsets.resize(numLines + 1);
+    m_lineOffsets[0] = 0;
+
+    ParallelForEachIndex(numLines, [&](size_t line) {
+        const size_t j = line % size.y;
+        const size_t k = line / size.y;
+
+        size_t count = 0;
+        for (size_t i = 0; i < size.x; ++i)
+        {
+            if (isActive(i, j, k))
+            {
+                ++count;
+            }
+        }
+
+        m_lineOffsets[line + 1] = count;
+    });
+
+    for (size_t line = 0; line < numLines; ++line)
+    {
+        m_lineOffsets[line + 1] += m_lineOffsets[line];
+    }
+
+    const size_t numRows = m_lineOffsets[numLines];
+
+    MatrixCSRD& A = system->A;
+    A.Reserve(numRows, numRows, 0);
+    system->x.Resize(numRows, 0.0);
+    system->b.Resize(numRows, 0.0);
+    m_stencils.resize(numRows);
+
+    auto rp = A.RowPointersBegin();
+    rp[0] = 0;
+
+    // First pass: number the rows, evaluate the stencils and count non-zeros
+    ParallelForEachIndex(numLines, [&](size_t line) {
+        const size_t j = line % size.y;
+        const size_t k = line / size.y;
+
+        size_t row = m_lineOffsets[line];
+        for (size_t i = 0; i < size.x; ++i)
+        {
+            if (!isActive(i, j, k))
+            {
+                m_coordToIndex(i, j, k) = INVALID_INDEX;
+                continue;
+            }
+
+            FDMStencil3& s = m_stencils[row];
+            s = FDMStencil3{};
+            system->b[row] = buildRow(i, j, k, s);
+
+            rp[row + 1] = 1 + (s.left != 0.0) + (s.right != 0.0) +
+                          (s.down != 0.0) + (s.up != 0.0) + (s.back != 0.0) +
+                          (s.front != 0.0);
+
+            m_coordToIndex(i, j, k) = row++;
+        }
+    });
+
+    for (size_t row = 0; row < numRows; ++row)
+    {
+        rp[row + 1] += rp[row];
+    }
+
+    A.Reserve(numRows, numRows, rp[numRows]);
+    rp = A.RowPointersBegin();
+
+    auto ci = A.ColumnIndicesBegin();
+    auto nnz = A.NonZeroBegin();
+
+    // Second pass: fill the rows in the ascending column order
+    ParallelForEachIndex(numLines, [&](size_t line) {
+        const size_t j = line % size.y;
+        const size_t k = line / size.y;
+
+        for (size_t i = 0; i < size.x; ++i)
+        {
+            const size_t row = m_coordToIndex(i, j, k);
+            if (row == INVALID_INDEX)
+            {
+                continue;
+            }
+
+            const FDMStencil3& s = m_stencils[row];
+            size_t dst = rp[row];
+
+            const auto emit = [&](double value, size_t col) {
+                assert(col != INVALID_INDEX);
+                ci[dst] = col;
+                nnz[dst] = value;
+                ++dst;
+            };
+
+            if (s.back != 0.0)
+            {
+                emit(s.back, m_coordToIndex(i, j, k - 1));
+            }
+            if (s.down != 0.0)
+            {
+                emit(s.down, m_coordToIndex(i, j - 1, k));
+            }
+            if (s.left != 0.0)
+            {
+                emit(s.left, m_coordToIndex(i - 1, j, k));
+            }
+
+            emit(s.center, row);
+
+            if (s.right != 0.0)
+            {
+                emit(s.right, m_coordToIndex(i + 1, j, k));
+            }
+            if (s.up != 0.0)
+            {
+                emit(s.up, m_coordToIndex(i, j + 1, k));
+            }
+            if (s.front != 0.0)
+            {
+                emit(s.front, m_coordToIndex(i, j, k + 1));
+            }
+        }
+    });
+}
+}  // namespace CubbyFlow
+
+#endif
@@ -0,0 +1,99 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_FDM_COMPRESSED_LINEAR_SYSTEM_BUILDER3_HPP
+#define CUBBYFLOW_FDM_COMPRESSED_LINEAR_SYSTEM_BUILDER3_HPP
+
+#include <Core/FDM/FDMLinearSystem3.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace CubbyFlow
+{
+//! 7-point stencil of a row of the compressed 3-D finite differencing system.
+struct FDMStencil3
+{
+    //! Diagonal component of the matrix.
+    double center = 0.0;
+
+    //! Off-diagonal element where column refers to (i-1, j, k) grid point.
+    double left = 0.0;
+
+    //! Off-diagonal element where column refers to (i+1, j, k) grid point.
+    double right = 0.0;
+
+    //! Off-diagonal element where column refers to (i, j-1, k) grid point.
+    double down = 0.0;
+
+    //! Off-diagonal element where column refers to (i, j+1, k) grid point.
+    double up = 0.0;
+
+    //! Off-diagonal element where column refers to (i, j, k-1) grid point.
+    double back = 0.0;
+
+    //! Off-diagonal element where column refers to (i, j, k+1) grid point.
+    double front = 0.0;
+};
+
+//!
+//! \brief Parallel builder for 3-D compressed linear system.
+//!
+//! This class assembles FDMCompressedLinearSystem3 from the grid points that
+//! are marked as active. The active points are numbered in the i-major order
+//! and the matrix is built in two passes: the first pass evaluates the stencil
+//! of each row and counts its non-zeros, and the second pass fills the CSR
+//! arrays after the prefix sum of the counts. Both passes run in parallel, and
+//! the intermediate buffers are kept so that building the system every frame
+//! does not reallocate memory.
+//!
+class FDMCompressedLinearSystemBuilder3
+{
+ public:
+    //! Row index of the inactive grid points.
+    static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+
+    //!
+    //! \brief Builds the compressed linear system.
+    //!
+    //! \p isActive(i, j, k) returns true if the grid point is a row of the
+    //! system. \p buildRow(i, j, k, stencil) fills the stencil of the active
+    //! point and returns the RHS value. Off-diagonal elements must be zero if
+    //! the neighboring grid point is inactive or out of the grid.
+    //!
+    //! \param size     The grid resolution.
+    //! \param isActive The function that tells the active grid points.
+    //! \param buildRow The function that builds the row of the system.
+    //! \param system   The compressed linear system to build.
+    //!
+    template <typename ActiveFunc, typename RowFunc>
+    void Build(const Vector3UZ& size, const ActiveFunc& isActive,
+               const RowFunc& buildRow, FDMCompressedLinearSystem3* system);
+
+    //! Returns the number of rows of the last built system.
+    [[nodiscard]] size_t GetNumberOfRows() const;
+
+    //! Returns the row index of the grid point (\p i, \p j, \p k), or
+    //! INVALID_INDEX if the point is inactive.
+    [[nodiscard]] size_t GetIndex(size_t i, size_t j, size_t k) const;
+
+    //! Returns the row indices of the grid points.
+    [[nodiscard]] const Array3<size_t>& GetCoordToIndex() const;
+
+ private:
+    Array3<size_t> m_coordToIndex;
+    std::vector<size_t> m_lineOffsets;
+    std::vector<FDMStencil3> m_stencils;
+};
+}  // namespace CubbyFlow
+
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3-Impl.hpp>
+
+#endif
@@ -14,6 +14,7 @@
 #include <Core/Array/Array.hpp>
 #include <Core/Matrix/Matrix.hpp>
 #include <Core/Matrix/MatrixCSR.hpp>
+#include <Core/Matrix/MatrixSELL.hpp>
 
 namespace CubbyFlow
 {
@@ -74,6 +75,65 @@ struct FDMCompressedLinearSystem3
     VectorND b;
 };
 
+//!
+//! \brief Matrix-free 3-D finite differencing matrix of the Poisson equation.
+//!
+//! Instead of storing an FDMMatrixRow3 (32 bytes) per grid point, this matrix
+//! stores a single marker byte per grid point and evaluates the rows of the
+//! 7-point Laplacian on the fly. A fluid cell is coupled with the fluid
+//! neighbors, the air neighbors only add to the diagonal (Dirichlet), and the
+//! boundary neighbors are skipped (Neumann). The rows of the non-fluid cells
+//! are identity.
+//!
+struct FDMMarkerMatrix3
+{
+    //! Marker of the fluid cell.
+    static constexpr char FLUID = 0;
+
+    //! Marker of the air cell.
+    static constexpr char AIR = 1;
+
+    //! Marker of the boundary cell.
+    static constexpr char BOUNDARY = 2;
+
+    //! Clears all the data.
+    void Clear();
+
+    //! Resizes the markers with given grid size.
+    void Resize(const Vector3UZ& size);
+
+    //! Returns the size of the grid.
+    [[nodiscard]] Vector3UZ Size() const;
+
+    //! Evaluates the row where row corresponds to (i, j, k) grid point.
+    [[nodiscard]] FDMMatrixRow3 operator()(size_t i, size_t j, size_t k) const;
+
+    //! Cell markers.
+    Array3<char> markers;
+
+    //! Squared inverse grid spacing.
+    Vector3D invGridSpacingSqr = Vector3D{ 1.0, 1.0, 1.0 };
+};
+
+//! Matrix-free linear system (Ax=b) for 3-D finite differencing.
+struct FDMMatrixFreeLinearSystem3
+{
+    //! Clears all the data.
+    void Clear();
+
+    //! Resizes the arrays with given grid size.
+    void Resize(const Vector3UZ& size);
+
+    //! System matrix.
+    FDMMarkerMatrix3 A;
+
+    //! Solution vector.
+    FDMVector3 x;
+
+    //! RHS vector.
+    FDMVector3 b;
+};
+
 //! BLAS operator wrapper for 3-D finite differencing.
 struct FDMBLAS3
 {
@@ -116,6 +176,26 @@ struct FDMBLAS3
     [[nodiscard]] static ScalarType LInfNorm(const VectorType& v);
 };
 
+//!
+//! \brief BLAS operator wrapper for matrix-free 3-D finite differencing.
+//!
+//! The vector operations are shared with FDMBLAS3, while the matrix-vector
+//! multiplications evaluate the coefficients from the markers of
+//! FDMMarkerMatrix3.
+//!
+struct FDMMatrixFreeBLAS3 : FDMBLAS3
+{
+    using MatrixType = FDMMarkerMatrix3;
+
+    //! Performs matrix-vector multiplication.
+    static void MVM(const MatrixType& m, const VectorType& v,
+                    VectorType* result);
+
+    //! Computes residual vector (b - ax).
+    static void Residual(const MatrixType& a, const VectorType& x,
+                         const VectorType& b, VectorType* result);
+};
+
 //! BLAS operator wrapper for compressed 3-D finite differencing.
 struct FDMCompressedBLAS3
 {
@@ -157,6 +237,27 @@ struct FDMCompressedBLAS3
     //! Returns Linf-norm of the given vector \p v.
     [[nodiscard]] static ScalarType LInfNorm(const VectorType& v);
 };
+
+//!
+//! \brief BLAS operator wrapper for compressed 3-D finite differencing using
+//!        the sliced ELLPACK (SELL-C-sigma) matrix.
+//!
+//! The vector operations are shared with FDMCompressedBLAS3. Only the matrix
+//! type differs, so the matrix-vector multiplications process a chunk of
+//! rows at a time.
+//!
+struct FDMCompressedSELLBLAS3 : FDMCompressedBLAS3
+{
+    using MatrixType = MatrixSELLD;
+
+    //! Performs matrix-vector multiplication.
+    static void MVM(const MatrixType& m, const VectorType& v,
+                    VectorType* result);
+
+    //! Computes residual vector (b - ax).
+    static void Residual(const MatrixType& a, const VectorType& x,
+                         const VectorType& b, VectorType* result);
+};
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
@@ -11,8 +11,10 @@
 #ifndef CUBBYFLOW_SCALAR_FIELD_HPP
 #define CUBBYFLOW_SCALAR_FIELD_HPP
 
+#include <Core/Array/ArrayView.hpp>
 #include <Core/Field/Field.hpp>
 #include <Core/Matrix/Matrix.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 #include <functional>
 #include <memory>
@@ -55,6 +57,28 @@ class ScalarField : public Field<N>
     //! Returns sampler function object.
     [[nodiscard]] virtual std::function<double(const Vector<double, N>&)>
     Sampler() const;
+
+    //!
+    //! \brief Samples the field at given positions \p x in parallel.
+    //!
+    //! \param x      The positions to sample.
+    //! \param result The sampled values. Must have the same length as \p x.
+    //! \param policy The execution policy.
+    //!
+    virtual void SampleMany(
+        const ConstArrayView1<Vector<double, N>>& x, ArrayView1<double> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+    //! Computes the gradient vectors at given positions \p x in parallel.
+    virtual void GradientMany(
+        const ConstArrayView1<Vector<double, N>>& x,
+        ArrayView1<Vector<double, N>> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+    //! Computes the Laplacians at given positions \p x in parallel.
+    virtual void LaplacianMany(
+        const ConstArrayView1<Vector<double, N>>& x, ArrayView1<double> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
 };
 
 //! 2-D ScalarField type.
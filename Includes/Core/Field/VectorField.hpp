@@ -11,8 +11,10 @@
 #ifndef CUBBYFLOW_VECTOR_FIELD_HPP
 #define CUBBYFLOW_VECTOR_FIELD_HPP
 
+#include <Core/Array/ArrayView.hpp>
 #include <Core/Field/Field.hpp>
 #include <Core/Matrix/Matrix.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 #include <functional>
 #include <memory>
@@ -75,6 +77,29 @@ class VectorField : public Field<N>
     [[nodiscard]] virtual std::function<
         Vector<double, N>(const Vector<double, N>&)>
     Sampler() const;
+
+    //!
+    //! \brief Samples the field at given positions \p x in parallel.
+    //!
+    //! \param x      The positions to sample.
+    //! \param result The sampled vectors. Must have the same length as \p x.
+    //! \param policy The execution policy.
+    //!
+    virtual void SampleMany(
+        const ConstArrayView1<Vector<double, N>>& x,
+        ArrayView1<Vector<double, N>> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+    //! Computes the divergences at given positions \p x in parallel.
+    virtual void DivergenceMany(
+        const ConstArrayView1<Vector<double, N>>& x, ArrayView1<double> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
+
+    //! Computes the curls at given positions \p x in parallel.
+    virtual void CurlMany(
+        const ConstArrayView1<Vector<double, N>>& x,
+        ArrayView1<typename GetCurl<N>::Type> result,
+        ExecutionPolicy policy = ExecutionPolicy::Parallel) const;
 };
 
 //! 2-D VectorField type.
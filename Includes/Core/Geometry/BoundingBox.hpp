@@ -64,16 +64,16 @@ class BoundingBox
     ~BoundingBox() = default;
 
     //! Constructs a box with other box instance.
-    BoundingBox(const BoundingBox& other);
+    BoundingBox(const BoundingBox& other) = default;
 
     //! Constructs a box with other box instance.
-    BoundingBox(BoundingBox&& other) noexcept;
+    BoundingBox(BoundingBox&& other) noexcept = default;
 
     //! Copy assignment operator.
-    BoundingBox& operator=(const BoundingBox& other);
+    BoundingBox& operator=(const BoundingBox& other) = default;
 
     //! Move assignment operator.
-    BoundingBox& operator=(BoundingBox&& other) noexcept;
+    BoundingBox& operator=(BoundingBox&& other) noexcept = default;
 
     //! Returns width of the box.
     [[nodiscard]] T Width() const;
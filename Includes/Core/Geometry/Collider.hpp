@@ -12,6 +12,7 @@
 #define CUBBYFLOW_COLLIDER_HPP
 
 #include <Core/Geometry/Surface.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 
 #include <functional>
 
@@ -87,9 +88,40 @@ class Collider
     //! Returns the surface instance.
     [[nodiscard]] const std::shared_ptr<Surface<N>>& GetSurface() const;
 
-    //! Updates the collider state.
+    //!
+    //! \brief Updates the collider state.
+    //!
+    //! After invoking the callback, the surface transform is compared with the
+    //! one from the previous update. If it has moved, the transform revision is
+    //! increased. Flipping the surface normal increases the shape revision.
+    //!
     void Update(double currentTimeInSeconds, double timeIntervalInSeconds);
 
+    //!
+    //! \brief Returns the shape revision of the collider.
+    //!
+    //! The shape revision changes whenever the surface is replaced or
+    //! Collider::MarkShapeChanged is called. Caches built from the collider
+    //! surface in its local frame stay valid while the revision is unchanged.
+    //!
+    [[nodiscard]] size_t GetShapeRevision() const;
+
+    //!
+    //! \brief Returns the transform revision of the collider.
+    //!
+    //! The transform revision changes whenever Collider::Update detects that
+    //! the surface has been translated or rotated since the previous update.
+    //!
+    [[nodiscard]] size_t GetTransformRevision() const;
+
+    //!
+    //! \brief Notifies that the surface geometry has been changed in place.
+    //!
+    //! Call this function after modifying the surface (other than its
+    //! transform) so that the caches depending on the collider get rebuilt.
+    //!
+    void MarkShapeChanged();
+
     //!
     //! \brief      Sets the callback function to be called when
     //!             Collider::update function is invoked.
@@ -102,6 +134,20 @@ class Collider
     //!
     void SetOnBeginUpdateCallback(const OnBeginUpdateCallback& callback);
 
+    //!
+    //! \brief Saves the collider state into \p checkpoint.
+    //!
+    //! The friction coefficient and the surface transform are saved with the
+    //! channel names starting with \p prefix. The update callback is not part
+    //! of the state and must be set again when restoring.
+    //!
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //! Restores the collider state saved with given \p prefix.
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
  protected:
     //! Internal query result structure.
     struct ColliderQueryResult final
@@ -115,6 +161,25 @@ class Collider
     //! Assigns the surface instance from the subclass.
     void SetSurface(const std::shared_ptr<Surface<N>>& newSurface);
 
+    //!
+    //! \brief Updates the shape and transform revisions.
+    //!
+    //! This function is called at the end of Collider::Update. Override it to
+    //! track the changes of the surfaces owned by the subclass.
+    //!
+    virtual void UpdateRevisions();
+
+    //! Increases the transform revision.
+    void MarkTransformChanged();
+
+    //! Called when the collider state is saved into \p checkpoint.
+    virtual void OnSaveCheckpoint(const std::string& prefix,
+                                  Checkpoint* checkpoint) const;
+
+    //! Called when the collider state is restored from \p checkpoint.
+    virtual void OnLoadCheckpoint(const std::string& prefix,
+                                  const Checkpoint& checkpoint);
+
     //! Outputs closest point's information.
     void GetClosestPoint(const std::shared_ptr<Surface<N>>& surface,
                          const Vector<double, N>& queryPoint,
@@ -129,6 +194,10 @@ class Collider
     std::shared_ptr<Surface<N>> m_surface;
     double m_frictionCoefficient = 0.0;
     OnBeginUpdateCallback m_onUpdateCallback;
+    size_t m_shapeRevision = 0;
+    size_t m_transformRevision = 0;
+    Transform<N> m_lastTransform;
+    bool m_lastIsNormalFlipped = false;
 };
 
 //! 2-D collider type.
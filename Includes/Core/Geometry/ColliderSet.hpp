@@ -52,8 +52,22 @@ class ColliderSet final : public Collider<N>
     //! Returns builder for ColliderSet.
     static Builder GetBuilder();
 
+ protected:
+    //! Tracks the motion and the normal flips of the child surfaces.
+    void UpdateRevisions() override;
+
+    //! Saves the state of the child colliders into \p checkpoint.
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    //! Restores the state of the child colliders from \p checkpoint.
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
  private:
     Array1<std::shared_ptr<Collider<N>>> m_colliders;
+    Array1<Transform<N>> m_lastTransforms;
+    Array1<char> m_lastIsNormalFlipped;
 };
 
 //! 2-D ColliderSet type.
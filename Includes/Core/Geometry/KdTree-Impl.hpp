@@ -11,7 +11,11 @@
 #ifndef CUBBYFLOW_KDTREE_IMPL_HPP
 #define CUBBYFLOW_KDTREE_IMPL_HPP
 
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
 #include <numeric>
+#include <tuple>
 
 namespace CubbyFlow
 {
@@ -52,12 +56,64 @@ void KdTree<T, K>::Build(const ConstArrayView1<Point>& points)
     }
 
     m_nodes.clear();
+    m_nodes.resize(NumberOfNodes(m_points.size()));
 
     std::vector<size_t> itemIndices(m_points.size());
     std::iota(std::begin(itemIndices), std::end(itemIndices), 0);
 
-    [[maybe_unused]] const size_t d =
-        Build(0, itemIndices.data(), m_points.size(), 0);
+    // The upper levels are split one level at a time, with the nodes of a
+    // level split in parallel, until there are enough subtrees to keep all
+    // threads busy. The size of a left subtree only depends on its number of
+    // items, so the node indices are known before the subtrees are built.
+    const size_t numThreads = std::max(GetMaxNumberOfThreads(), 1u);
+    std::vector<Subtree> subtrees{ { 0, itemIndices.data(), m_points.size() } };
+    bool hasLargeSubtree = m_points.size() >= PARALLEL_BUILD_THRESHOLD;
+
+    while (hasLargeSubtree && subtrees.size() < 4 * numThreads)
+    {
+        std::vector<Subtree> children(2 * subtrees.size(),
+                                      Subtree{ 0, nullptr, 0 });
+
+        ParallelFor(ZERO_SIZE, subtrees.size(), [&](size_t i) {
+            const Subtree& subtree = subtrees[i];
+            if (subtree.nItems < PARALLEL_BUILD_THRESHOLD)
+            {
+                children[2 * i] = subtree;
+                return;
+            }
+
+            const size_t axis =
+                Partition(subtree.itemIndices, subtree.nItems);
+            const size_t midPoint = subtree.nItems / 2;
+            const size_t rightChild =
+                subtree.nodeIndex + 1 + NumberOfNodes(midPoint);
+            const size_t midItem = subtree.itemIndices[midPoint];
+            m_nodes[subtree.nodeIndex].InitInternal(axis, midItem, rightChild,
+                                                    m_points[midItem]);
+
+            children[2 * i] = { subtree.nodeIndex + 1, subtree.itemIndices,
+                                midPoint };
+            children[2 * i + 1] = { rightChild,
+                                    subtree.itemIndices + midPoint + 1,
+                                    subtree.nItems - midPoint - 1 };
+        });
+
+        subtrees.clear();
+        hasLargeSubtree = false;
+        for (const Subtree& child : children)
+        {
+            if (child.itemIndices != nullptr)
+            {
+                subtrees.push_back(child);
+                hasLargeSubtree |= child.nItems >= PARALLEL_BUILD_THRESHOLD;
+            }
+        }
+    }
+
+    Internal::ParallelForDynamic(subtrees.size(), [&](size_t i) {
+        Build(subtrees[i].nodeIndex, subtrees[i].itemIndices,
+              subtrees[i].nItems);
+    });
 }
 
 template <typename T, size_t K>
@@ -260,6 +316,41 @@ size_t KdTree<T, K>::GetNearestPoint(const Point& origin) const
     return nearest;
 }
 
+template <typename T, size_t K>
+void KdTree<T, K>::GetKNearestPoints(const Point& origin, size_t k,
+                                     Array1<size_t>* indices) const
+{
+    std::vector<std::pair<T, size_t>> heap;
+    SearchKNearestPoints(origin, k, heap);
+
+    indices->Resize(heap.size());
+    for (size_t i = 0; i < heap.size(); ++i)
+    {
+        (*indices)[i] = heap[i].second;
+    }
+}
+
+template <typename T, size_t K>
+void KdTree<T, K>::GetKNearestPoints(const ConstArrayView1<Point>& origins,
+                                     size_t k, Array2<size_t>* indices) const
+{
+    const size_t numNearest = std::min(k, m_points.size());
+    indices->Resize(Vector2UZ{ numNearest, origins.Length() });
+
+    ParallelFor(ZERO_SIZE, origins.Length(), [&](size_t j) {
+        // Reuse the heap of each thread across the queries
+        static thread_local std::vector<std::pair<T, size_t>> heapBuffer;
+        std::vector<std::pair<T, size_t>>& heap = heapBuffer;
+
+        SearchKNearestPoints(origins[j], k, heap);
+
+        for (size_t i = 0; i < numNearest; ++i)
+        {
+            (*indices)(i, j) = heap[i].second;
+        }
+    });
+}
+
 template <typename T, size_t K>
 void KdTree<T, K>::Reserve(size_t numPoints, size_t numNodes)
 {
@@ -316,24 +407,46 @@ typename KdTree<T, K>::ConstNodeIterator KdTree<T, K>::EndNode() const
 };
 
 template <typename T, size_t K>
-size_t KdTree<T, K>::Build(size_t nodeIndex, size_t* itemIndices, size_t nItems,
-                           size_t currentDepth)
+size_t KdTree<T, K>::NumberOfNodes(size_t nItems)
 {
-    // add a node
-    m_nodes.emplace_back();
+    // Let g(n) be the number of nodes of a subtree with n items. Since
+    // g(2m) = 1 + g(m) + g(m - 1) and g(2m + 1) = 1 + 2g(m), the pair
+    // (g(n - 1), g(n)) only depends on (g(m - 1), g(m)) where m = n / 2.
+    if (nItems <= 2)
+    {
+        return (nItems == 2) ? 3 : 1;
+    }
 
-    // initialize leaf node if termination criteria met
-    if (nItems == 0)
+    std::vector<size_t> halves;
+    for (size_t n = nItems; n > 2; n /= 2)
     {
-        m_nodes[nodeIndex].InitLeaf(std::numeric_limits<size_t>::max(), {});
-        return currentDepth + 1;
+        halves.push_back(n);
     }
-    if (nItems == 1)
+
+    // (g(m - 1), g(m)) for the smallest m, which is either 1 or 2
+    size_t prev = 1;
+    size_t curr = (halves.back() / 2 == 1) ? 1 : 3;
+
+    for (auto iter = halves.rbegin(); iter != halves.rend(); ++iter)
     {
-        m_nodes[nodeIndex].InitLeaf(itemIndices[0], m_points[itemIndices[0]]);
-        return currentDepth + 1;
+        if (*iter % 2 == 0)
+        {
+            std::tie(prev, curr) =
+                std::make_pair(1 + 2 * prev, 1 + curr + prev);
+        }
+        else
+        {
+            std::tie(prev, curr) =
+                std::make_pair(1 + curr + prev, 1 + 2 * curr);
+        }
     }
 
+    return curr;
+}
+
+template <typename T, size_t K>
+size_t KdTree<T, K>::Partition(size_t* itemIndices, size_t nItems)
+{
     // choose which axis to split along
     BBox nodeBound;
     for (size_t i = 0; i < nItems; ++i)
@@ -348,19 +461,128 @@ size_t KdTree<T, K>::Build(size_t nodeIndex, size_t* itemIndices, size_t nItems,
                      itemIndices + nItems, [&](size_t a, size_t b) {
                          return m_points[a][axis] < m_points[b][axis];
                      });
+
+    return axis;
+}
+
+template <typename T, size_t K>
+size_t KdTree<T, K>::Build(size_t nodeIndex, size_t* itemIndices, size_t nItems)
+{
+    // initialize leaf node if termination criteria met
+    if (nItems == 0)
+    {
+        m_nodes[nodeIndex].InitLeaf(std::numeric_limits<size_t>::max(), {});
+        return 1;
+    }
+    if (nItems == 1)
+    {
+        m_nodes[nodeIndex].InitLeaf(itemIndices[0], m_points[itemIndices[0]]);
+        return 1;
+    }
+
+    const size_t axis = Partition(itemIndices, nItems);
     const size_t midPoint = nItems / 2;
 
     // recursively initialize children nodes
-    const size_t d0 =
-        Build(nodeIndex + 1, itemIndices, midPoint, currentDepth + 1);
-    m_nodes[nodeIndex].InitInternal(axis, itemIndices[midPoint], m_nodes.size(),
+    const size_t numLeftNodes = Build(nodeIndex + 1, itemIndices, midPoint);
+    const size_t rightChild = nodeIndex + 1 + numLeftNodes;
+    m_nodes[nodeIndex].InitInternal(axis, itemIndices[midPoint], rightChild,
                                     m_points[itemIndices[midPoint]]);
-    const size_t d1 =
-        Build(m_nodes[nodeIndex].child, itemIndices + midPoint + 1,
-              nItems - midPoint - 1, currentDepth + 1);
+    const size_t numRightNodes =
+        Build(rightChild, itemIndices + midPoint + 1, nItems - midPoint - 1);
+
+    return 1 + numLeftNodes + numRightNodes;
+}
+
+template <typename T, size_t K>
+void KdTree<T, K>::SearchKNearestPoints(
+    const Point& origin, size_t k,
+    std::vector<std::pair<T, size_t>>& heap) const
+{
+    heap.clear();
+
+    if (k == 0 || m_nodes.empty())
+    {
+        return;
+    }
+
+    // Max-heap of (squared distance, item) bounded by k, so that the front
+    // is the farthest candidate found so far.
+    const auto visit = [&](const Node* node) {
+        if (node->item == std::numeric_limits<size_t>::max())
+        {
+            return;
+        }
+
+        const T dist2 = (node->point - origin).LengthSquared();
+        if (heap.size() < k)
+        {
+            heap.emplace_back(dist2, node->item);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (dist2 < heap.front().first)
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = std::make_pair(dist2, node->item);
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    // prepare to traverse the tree, where the squared distance to the
+    // splitting plane is stored with the far child for pruning
+    static const int maxTreeDepth = 8 * sizeof(size_t);
+    std::pair<const Node*, T> todo[maxTreeDepth];
+    size_t todoPos = 0;
+
+    const Node* node = m_nodes.data();
 
-    return std::max(d0, d1);
+    while (node != nullptr)
+    {
+        visit(node);
+
+        if (node->IsLeaf())
+        {
+            node = nullptr;
+
+            // grab next node that may contain closer points
+            while (todoPos > 0)
+            {
+                --todoPos;
+                if (heap.size() < k ||
+                    todo[todoPos].second < heap.front().first)
+                {
+                    node = todo[todoPos].first;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            const Node* firstChild = node + 1;
+            const Node* secondChild = &m_nodes[node->child];
+
+            // descend to the near child first and enqueue the far child
+            const size_t axis = node->flags;
+            const T diff = origin[axis] - node->point[axis];
+
+            if (diff < 0)
+            {
+                todo[todoPos] = std::make_pair(secondChild, diff * diff);
+                node = firstChild;
+            }
+            else
+            {
+                todo[todoPos] = std::make_pair(firstChild, diff * diff);
+                node = secondChild;
+            }
+
+            ++todoPos;
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
 }
+
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
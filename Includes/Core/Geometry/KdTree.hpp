@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_KDTREE_HPP
 #define CUBBYFLOW_KDTREE_HPP
 
+#include <Core/Array/Array.hpp>
 #include <Core/Array/ArrayView.hpp>
 #include <Core/Geometry/BoundingBox.hpp>
 #include <Core/Matrix/Matrix.hpp>
@@ -59,7 +60,12 @@ class KdTree final
     using NodeIterator = typename NodeContainerType::iterator;
     using ConstNodeIterator = typename NodeContainerType::const_iterator;
 
-    //! Builds internal acceleration structure for given points list.
+    //!
+    //! \brief Builds internal acceleration structure for given points list.
+    //!
+    //! Subtrees are built in parallel. The node layout does not depend on the
+    //! number of threads.
+    //!
     void Build(const ConstArrayView1<Point>& points);
 
     //!
@@ -88,6 +94,34 @@ class KdTree final
     //! Returns index of the nearest point.
     [[nodiscard]] size_t GetNearestPoint(const Point& origin) const;
 
+    //!
+    //! \brief Finds the k nearest points of the origin.
+    //!
+    //! The indices of the points are stored in the ascending order of the
+    //! distance from the origin. If the tree has fewer than \p k points, all
+    //! the points are returned.
+    //!
+    //! \param[in]  origin  The origin position.
+    //! \param[in]  k       The number of points to find.
+    //! \param[out] indices The indices of the nearest points.
+    //!
+    void GetKNearestPoints(const Point& origin, size_t k,
+                           Array1<size_t>* indices) const;
+
+    //!
+    //! \brief Finds the k nearest points of each origin in parallel.
+    //!
+    //! The j-th row of \p indices, i.e. (0, j) ... (k' - 1, j) where k' is
+    //! min(k, number of points), holds the result of GetKNearestPoints() for
+    //! the j-th origin.
+    //!
+    //! \param[in]  origins The origin positions.
+    //! \param[in]  k       The number of points to find for each origin.
+    //! \param[out] indices The indices of the nearest points.
+    //!
+    void GetKNearestPoints(const ConstArrayView1<Point>& origins, size_t k,
+                           Array2<size_t>* indices) const;
+
     //! Returns the mutable begin iterator of the item.
     [[nodiscard]] Iterator begin();
 
@@ -116,8 +150,25 @@ class KdTree final
     void Reserve(size_t numPoints, size_t numNodes);
 
  private:
-    [[nodiscard]] size_t Build(size_t nodeIndex, size_t* itemIndices,
-                               size_t nItems, size_t currentDepth);
+    //! Subtree of the nodes built from a range of items.
+    struct Subtree
+    {
+        size_t nodeIndex;
+        size_t* itemIndices;
+        size_t nItems;
+    };
+
+    //! Minimum number of items of a subtree that is split in parallel.
+    static constexpr size_t PARALLEL_BUILD_THRESHOLD = 1 << 14;
+
+    [[nodiscard]] static size_t NumberOfNodes(size_t nItems);
+
+    [[nodiscard]] size_t Partition(size_t* itemIndices, size_t nItems);
+
+    size_t Build(size_t nodeIndex, size_t* itemIndices, size_t nItems);
+
+    void SearchKNearestPoints(const Point& origin, size_t k,
+                              std::vector<std::pair<T, size_t>>& heap) const;
 
     std::vector<Point> m_points;
     std::vector<Node> m_nodes;
@@ -0,0 +1,566 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_LINEAR_TREE_IMPL_HPP
+#define CUBBYFLOW_LINEAR_TREE_IMPL_HPP
+
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+// Interleaves the lower numBits bits of the cell coordinates, where the x
+// coordinate goes to the least significant bit so that the octant order
+// matches BoundingBox::Corner().
+template <size_t N>
+uint64_t MortonCode(const Vector<uint64_t, N>& cell, size_t numBits)
+{
+    uint64_t code = 0;
+
+    for (size_t b = 0; b < numBits; ++b)
+    {
+        for (size_t axis = 0; axis < N; ++axis)
+        {
+            code |= ((cell[axis] >> b) & 1) << (b * N + axis);
+        }
+    }
+
+    return code;
+}
+}  // namespace Internal
+
+template <typename T, size_t N>
+void LinearTree<T, N>::Build(
+    const ConstArrayView1<T>& items,
+    const ConstArrayView1<BoundingBox<double, N>>& itemsBounds,
+    size_t maxDepth)
+{
+    Clear();
+
+    m_maxDepth = std::clamp(maxDepth, ONE_SIZE, MAX_DEPTH);
+
+    const size_t numItems = items.Length();
+    if (numItems == 0)
+    {
+        return;
+    }
+
+    // Normalize bounding box
+    m_bbox = ParallelReduce(
+        ZERO_SIZE, numItems, BoundingBox<double, N>{},
+        [&](size_t begin, size_t end, BoundingBox<double, N> result) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                result.Merge(itemsBounds[i]);
+            }
+            return result;
+        },
+        [](BoundingBox<double, N> a, const BoundingBox<double, N>& b) {
+            a.Merge(b);
+            return a;
+        });
+
+    const double edgeLen =
+        std::max((m_bbox.upperCorner - m_bbox.lowerCorner).Max(),
+                 std::numeric_limits<double>::epsilon());
+    m_bbox.upperCorner =
+        m_bbox.lowerCorner + Vector<double, N>::MakeConstant(edgeLen);
+
+    // Compute the level and the Morton code of the cell of each item
+    const size_t finestLevel = m_maxDepth - 1;
+    const uint64_t resolution = uint64_t{ 1 } << finestLevel;
+    const double finestCellSize = edgeLen / static_cast<double>(resolution);
+
+    Array1<ItemKey> keys(numItems);
+    ParallelFor(ZERO_SIZE, numItems, [&](size_t i) {
+        const BoundingBox<double, N>& bound = itemsBounds[i];
+        const double extent = (bound.upperCorner - bound.lowerCorner).Max();
+
+        // Deepest level whose cell is not smaller than the item
+        size_t level = finestLevel;
+        while (level > 0 &&
+               finestCellSize * static_cast<double>(
+                                    uint64_t{ 1 } << (finestLevel - level)) <
+                   extent)
+        {
+            --level;
+        }
+
+        const Vector<double, N> center = bound.MidPoint();
+        Vector<uint64_t, N> cell;
+        for (size_t axis = 0; axis < N; ++axis)
+        {
+            const double x =
+                (center[axis] - m_bbox.lowerCorner[axis]) / finestCellSize;
+            cell[axis] = static_cast<uint64_t>(
+                std::clamp(x, 0.0, static_cast<double>(resolution - 1)));
+        }
+
+        // Clear the bits below the level so that the code of a node is the
+        // smallest code in its subtree.
+        const size_t shift = N * (finestLevel - level);
+        const uint64_t code = Internal::MortonCode(cell, finestLevel);
+        keys[i] = ItemKey{ (code >> shift) << shift, level, i };
+    });
+
+    // Items of a node come first, followed by its subtree.
+    ParallelSort(keys.begin(), keys.end(),
+                 [](const ItemKey& a, const ItemKey& b) {
+                     return std::tie(a.code, a.level, a.item) <
+                            std::tie(b.code, b.level, b.item);
+                 });
+
+    m_items.Resize(numItems);
+    ParallelFor(ZERO_SIZE, numItems,
+                [&](size_t i) { m_items[i] = items[keys[i].item]; });
+
+    // Build the nodes level by level, where each node covers a contiguous
+    // range of the sorted keys.
+    std::vector<size_t> rangeEnds{ numItems };
+    std::vector<Vector<uint64_t, N>> cells(1);
+
+    m_nodes.resize(1);
+    m_nodes[0].bound = m_bbox;
+    m_nodes[0].bound.Expand(0.5 * edgeLen);
+
+    size_t levelBegin = 0;
+    size_t levelEnd = 1;
+
+    for (size_t level = 0; levelBegin < levelEnd; ++level)
+    {
+        const size_t childShift =
+            (level < finestLevel) ? N * (finestLevel - level - 1) : 0;
+        const auto octant = [&](size_t k) {
+            return (keys[k].code >> childShift) & ((ONE_SIZE << N) - 1);
+        };
+
+        // Count the children of each node
+        std::vector<size_t> childOffsets(levelEnd - levelBegin + 1, 0);
+        ParallelFor(levelBegin, levelEnd, [&](size_t nodeIdx) {
+            Node& node = m_nodes[nodeIdx];
+
+            const auto isNodeItem = [level](const ItemKey& key) {
+                return key.level == level;
+            };
+            node.itemEnd = static_cast<size_t>(
+                std::partition_point(keys.begin() + node.itemBegin,
+                                     keys.begin() + rangeEnds[nodeIdx],
+                                     isNodeItem) -
+                keys.begin());
+
+            size_t numChildren = 0;
+            for (size_t k = node.itemEnd; k < rangeEnds[nodeIdx]; ++k)
+            {
+                if (k == node.itemEnd || octant(k) != octant(k - 1))
+                {
+                    ++numChildren;
+                }
+            }
+
+            childOffsets[nodeIdx - levelBegin + 1] = numChildren;
+        });
+
+        for (size_t i = 1; i < childOffsets.size(); ++i)
+        {
+            childOffsets[i] += childOffsets[i - 1];
+        }
+
+        const size_t numNodes = levelEnd + childOffsets.back();
+        m_nodes.resize(numNodes);
+        rangeEnds.resize(numNodes);
+        cells.resize(numNodes);
+
+        // Create the children of each node
+        const double childCellSize =
+            edgeLen / static_cast<double>(uint64_t{ 1 } << (level + 1));
+
+        ParallelFor(levelBegin, levelEnd, [&](size_t nodeIdx) {
+            Node& node = m_nodes[nodeIdx];
+            node.childBegin = levelEnd + childOffsets[nodeIdx - levelBegin];
+            node.childEnd = node.childBegin;
+
+            for (size_t k = node.itemEnd; k < rangeEnds[nodeIdx]; ++k)
+            {
+                if (k != node.itemEnd && octant(k) == octant(k - 1))
+                {
+                    continue;
+                }
+
+                const size_t childIdx = node.childEnd++;
+                const size_t childOctant = octant(k);
+
+                Vector<uint64_t, N> cell;
+                Vector<double, N> lower;
+                for (size_t axis = 0; axis < N; ++axis)
+                {
+                    cell[axis] = 2 * cells[nodeIdx][axis] +
+                                 ((childOctant >> axis) & 1);
+                    lower[axis] =
+                        m_bbox.lowerCorner[axis] +
+                        childCellSize * static_cast<double>(cell[axis]);
+                }
+
+                Node& child = m_nodes[childIdx];
+                child.bound = BoundingBox<double, N>{
+                    lower,
+                    lower + Vector<double, N>::MakeConstant(childCellSize)
+                };
+                child.bound.Expand(0.5 * childCellSize);
+                child.itemBegin = k;
+
+                cells[childIdx] = cell;
+
+                if (childIdx > node.childBegin)
+                {
+                    rangeEnds[childIdx - 1] = k;
+                }
+            }
+
+            if (node.childEnd > node.childBegin)
+            {
+                rangeEnds[node.childEnd - 1] = rangeEnds[nodeIdx];
+            }
+        });
+
+        levelBegin = levelEnd;
+        levelEnd = numNodes;
+    }
+}
+
+template <typename T, size_t N>
+void LinearTree<T, N>::Clear()
+{
+    m_maxDepth = 1;
+    m_bbox = BoundingBox<double, N>();
+    m_items.Clear();
+    m_nodes.clear();
+}
+
+template <typename T, size_t N>
+NearestNeighborQueryResult<T, N> LinearTree<T, N>::Nearest(
+    const Vector<double, N>& pt,
+    const NearestNeighborDistanceFunc<T, N>& distanceFunc) const
+{
+    NearestNeighborQueryResult<T, N> best;
+    best.distance = std::numeric_limits<double>::max();
+    best.item = nullptr;
+
+    if (m_nodes.empty())
+    {
+        return best;
+    }
+
+    using NodeDistSqr = std::pair<const Node*, double>;
+
+    // Prepare to traverse the tree, where each node is stored with its
+    // squared distance to the query point
+    constexpr size_t numChildren = ONE_SIZE << N;
+    NodeDistSqr todo[(numChildren - 1) * MAX_DEPTH + 1];
+    size_t todoPos = 0;
+
+    todo[todoPos++] = NodeDistSqr{ m_nodes.data(), 0.0 };
+
+    while (todoPos > 0)
+    {
+        const NodeDistSqr current = todo[--todoPos];
+        if (current.second >= best.distance * best.distance)
+        {
+            continue;
+        }
+
+        const Node* node = current.first;
+        for (size_t i = node->itemBegin; i < node->itemEnd; ++i)
+        {
+            if (const double dist = distanceFunc(m_items[i], pt);
+                dist < best.distance)
+            {
+                best.distance = dist;
+                best.item = &m_items[i];
+            }
+        }
+
+        // Enqueue the children so that the nearest one is processed first
+        std::array<NodeDistSqr, numChildren> children;
+        size_t numVisibleChildren = 0;
+        const double bestDistSqr = best.distance * best.distance;
+
+        for (size_t c = node->childBegin; c < node->childEnd; ++c)
+        {
+            const Node* child = &m_nodes[c];
+            const double distSqr = child->bound.Clamp(pt).DistanceSquaredTo(pt);
+
+            if (distSqr >= bestDistSqr)
+            {
+                continue;
+            }
+
+            // Insertion sort in descending order of the distance. There are
+            // at most numChildren entries, and bounding the loop by
+            // numVisibleChildren keeps the accesses inside the array.
+            size_t pos = numVisibleChildren++;
+            while (pos > 0 && children[pos - 1].second < distSqr)
+            {
+                children[pos] = children[pos - 1];
+                --pos;
+            }
+
+            children[pos] = NodeDistSqr{ child, distSqr };
+        }
+
+        for (size_t c = 0; c < numVisibleChildren; ++c)
+        {
+            todo[todoPos++] = children[c];
+        }
+    }
+
+    return best;
+}
+
+template <typename T, size_t N>
+bool LinearTree<T, N>::Intersects(
+    const BoundingBox<double, N>& box,
+    const BoxIntersectionTestFunc<T, N>& testFunc) const
+{
+    bool result = false;
+
+    ForEachNode(
+        [&](const Node& node) { return !box.Overlaps(node.bound); },
+        [&](const Node& node) {
+            for (size_t i = node.itemBegin; i < node.itemEnd; ++i)
+            {
+                if (testFunc(m_items[i], box))
+                {
+                    result = true;
+                    return true;
+                }
+            }
+
+            return false;
+        });
+
+    return result;
+}
+
+template <typename T, size_t N>
+bool LinearTree<T, N>::Intersects(
+    const Ray<double, N>& ray,
+    const RayIntersectionTestFunc<T, N>& testFunc) const
+{
+    bool result = false;
+
+    ForEachNode(
+        [&](const Node& node) { return !node.bound.Intersects(ray); },
+        [&](const Node& node) {
+            for (size_t i = node.itemBegin; i < node.itemEnd; ++i)
+            {
+                if (testFunc(m_items[i], ray))
+                {
+                    result = true;
+                    return true;
+                }
+            }
+
+            return false;
+        });
+
+    return result;
+}
+
+template <typename T, size_t N>
+void LinearTree<T, N>::ForEachIntersectingItem(
+    const BoundingBox<double, N>& box,
+    const BoxIntersectionTestFunc<T, N>& testFunc,
+    const IntersectionVisitorFunc<T>& visitorFunc) const
+{
+    ForEachNode(
+        [&](const Node& node) { return !box.Overlaps(node.bound); },
+        [&](const Node& node) {
+            for (size_t i = node.itemBegin; i < node.itemEnd; ++i)
+            {
+                if (testFunc(m_items[i], box))
+                {
+                    visitorFunc(m_items[i]);
+                }
+            }
+
+            return false;
+        });
+}
+
+template <typename T, size_t N>
+void LinearTree<T, N>::ForEachIntersectingItem(
+    const Ray<double, N>& ray, const RayIntersectionTestFunc<T, N>& testFunc,
+    const IntersectionVisitorFunc<T>& visitorFunc) const
+{
+    ForEachNode(
+        [&](const Node& node) { return !node.bound.Intersects(ray); },
+        [&](const Node& node) {
+            for (size_t i = node.itemBegin; i < node.itemEnd; ++i)
+            {
+                if (testFunc(m_items[i], ray))
+                {
+                    visitorFunc(m_items[i]);
+                }
+            }
+
+            return false;
+        });
+}
+
+template <typename T, size_t N>
+ClosestIntersectionQueryResult<T, N> LinearTree<T, N>::ClosestIntersection(
+    const Ray<double, N>& ray,
+    const GetRayIntersectionFunc<T, N>& testFunc) const
+{
+    ClosestIntersectionQueryResult<T, N> best;
+    best.distance = std::numeric_limits<double>::max();
+    best.item = nullptr;
+
+    ForEachNode(
+        [&](const Node& node) {
+            // ClosestIntersection() reports the exit distance when the origin
+            // is inside the box, so such nodes are never culled.
+            if (node.bound.Contains(ray.origin))
+            {
+                return false;
+            }
+
+            const BoundingBoxRayIntersection<double> intersection =
+                node.bound.ClosestIntersection(ray);
+            return !intersection.isIntersecting ||
+                   intersection.near > best.distance;
+        },
+        [&](const Node& node) {
+            for (size_t i = node.itemBegin; i < node.itemEnd; ++i)
+            {
+                if (const double dist = testFunc(m_items[i], ray);
+                    dist < best.distance)
+                {
+                    best.distance = dist;
+                    best.item = &m_items[i];
+                }
+            }
+
+            return false;
+        });
+
+    return best;
+}
+
+template <typename T, size_t N>
+typename LinearTree<T, N>::Iterator LinearTree<T, N>::begin()
+{
+    return m_items.begin();
+}
+
+template <typename T, size_t N>
+typename LinearTree<T, N>::Iterator LinearTree<T, N>::end()
+{
+    return m_items.end();
+}
+
+template <typename T, size_t N>
+typename LinearTree<T, N>::ConstIterator LinearTree<T, N>::begin() const
+{
+    return m_items.begin();
+}
+
+template <typename T, size_t N>
+typename LinearTree<T, N>::ConstIterator LinearTree<T, N>::end() const
+{
+    return m_items.end();
+}
+
+template <typename T, size_t N>
+size_t LinearTree<T, N>::GetNumberOfItems() const
+{
+    return m_items.Length();
+}
+
+template <typename T, size_t N>
+const T& LinearTree<T, N>::GetItem(size_t i) const
+{
+    return m_items[i];
+}
+
+template <typename T, size_t N>
+size_t LinearTree<T, N>::GetNumberOfNodes() const
+{
+    return m_nodes.size();
+}
+
+template <typename T, size_t N>
+size_t LinearTree<T, N>::GetNumberOfItemsAtNode(size_t nodeIdx) const
+{
+    return m_nodes[nodeIdx].itemEnd - m_nodes[nodeIdx].itemBegin;
+}
+
+template <typename T, size_t N>
+const BoundingBox<double, N>& LinearTree<T, N>::GetNodeBound(
+    size_t nodeIdx) const
+{
+    return m_nodes[nodeIdx].bound;
+}
+
+template <typename T, size_t N>
+const BoundingBox<double, N>& LinearTree<T, N>::GetBoundingBox() const
+{
+    return m_bbox;
+}
+
+template <typename T, size_t N>
+size_t LinearTree<T, N>::GetMaxDepth() const
+{
+    return m_maxDepth;
+}
+
+template <typename T, size_t N>
+template <typename CullFunc, typename VisitFunc>
+void LinearTree<T, N>::ForEachNode(const CullFunc& isCulled,
+                                   const VisitFunc& visit) const
+{
+    if (m_nodes.empty())
+    {
+        return;
+    }
+
+    // Depth-first traversal, where each node pushes at most 2^N children
+    const Node* todo[((ONE_SIZE << N) - 1) * MAX_DEPTH + 1];
+    size_t todoPos = 0;
+
+    todo[todoPos++] = m_nodes.data();
+
+    while (todoPos > 0)
+    {
+        const Node* node = todo[--todoPos];
+        if (isCulled(*node))
+        {
+            continue;
+        }
+
+        if (visit(*node))
+        {
+            return;
+        }
+
+        for (size_t c = node->childEnd; c > node->childBegin; --c)
+        {
+            todo[todoPos++] = &m_nodes[c - 1];
+        }
+    }
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
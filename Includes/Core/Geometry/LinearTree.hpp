@@ -0,0 +1,172 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_LINEAR_TREE_HPP
+#define CUBBYFLOW_LINEAR_TREE_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
+#include <Core/QueryEngine/IntersectionQueryEngine.hpp>
+#include <Core/QueryEngine/NearestNeighborQueryEngine.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Linear (Morton code based) loose quadtree/octree in N-D.
+//!
+//! This class is an alternative to Quadtree and Octree which is built from
+//! the bounding boxes of the items. Each item is assigned to the deepest
+//! level whose cell is not smaller than the item, and to the cell containing
+//! its center. The items are then sorted by the Morton code of the cell in
+//! parallel, and the tree is built level by level in parallel. Since a node
+//! may hold items sticking out of its cell, the nodes use the loose bounds,
+//! which are the cells expanded by the half of the cell size.
+//!
+//! Unlike Octree, every item is stored exactly once, the items are stored
+//! contiguously in the Morton order, and the nodes are stored contiguously
+//! in breadth-first order, where only non-empty nodes are created.
+//!
+//! \see Ulrich, Thatcher. "Loose octrees." Game Programming Gems 1 (2000).
+//!
+template <typename T, size_t N>
+class LinearTree final : public IntersectionQueryEngine<T, N>,
+                         public NearestNeighborQueryEngine<T, N>
+{
+ public:
+    static_assert(N == 2 || N == 3, "Only 2-D and 3-D trees are supported.");
+
+    using ContainerType = Array1<T>;
+    using Iterator = typename ContainerType::Iterator;
+    using ConstIterator = typename ContainerType::ConstIterator;
+
+    //! Max depth of the tree that 64-bit Morton codes can represent.
+    static constexpr size_t MAX_DEPTH = 63 / N + 1;
+
+    //!
+    //! \brief Builds the tree with given items and their bounding boxes.
+    //!
+    //! The items are reordered in the Morton order of their cells. \p maxDepth
+    //! is clamped to [1, MAX_DEPTH].
+    //!
+    void Build(const ConstArrayView1<T>& items,
+               const ConstArrayView1<BoundingBox<double, N>>& itemsBounds,
+               size_t maxDepth);
+
+    //! Clears all the contents of this instance.
+    void Clear();
+
+    //! Returns the nearest neighbor for given point and distance measure
+    //! function.
+    [[nodiscard]] NearestNeighborQueryResult<T, N> Nearest(
+        const Vector<double, N>& pt,
+        const NearestNeighborDistanceFunc<T, N>& distanceFunc) const override;
+
+    //! Returns true if given \p box intersects with any of the stored items.
+    [[nodiscard]] bool Intersects(
+        const BoundingBox<double, N>& box,
+        const BoxIntersectionTestFunc<T, N>& testFunc) const override;
+
+    //! Returns true if given \p ray intersects with any of the stored items.
+    [[nodiscard]] bool Intersects(
+        const Ray<double, N>& ray,
+        const RayIntersectionTestFunc<T, N>& testFunc) const override;
+
+    //! Invokes \p visitorFunc for every intersecting items.
+    void ForEachIntersectingItem(
+        const BoundingBox<double, N>& box,
+        const BoxIntersectionTestFunc<T, N>& testFunc,
+        const IntersectionVisitorFunc<T>& visitorFunc) const override;
+
+    //! Invokes \p visitorFunc for every intersecting items.
+    void ForEachIntersectingItem(
+        const Ray<double, N>& ray,
+        const RayIntersectionTestFunc<T, N>& testFunc,
+        const IntersectionVisitorFunc<T>& visitorFunc) const override;
+
+    //! Returns the closest intersection for given \p ray.
+    [[nodiscard]] ClosestIntersectionQueryResult<T, N> ClosestIntersection(
+        const Ray<double, N>& ray,
+        const GetRayIntersectionFunc<T, N>& testFunc) const override;
+
+    //! Returns the begin iterator of the item.
+    [[nodiscard]] Iterator begin();
+
+    //! Returns the end iterator of the item.
+    [[nodiscard]] Iterator end();
+
+    //! Returns the immutable begin iterator of the item.
+    [[nodiscard]] ConstIterator begin() const;
+
+    //! Returns the immutable end iterator of the item.
+    [[nodiscard]] ConstIterator end() const;
+
+    //! Returns the number of items.
+    [[nodiscard]] size_t GetNumberOfItems() const;
+
+    //! Returns the item at \p i.
+    [[nodiscard]] const T& GetItem(size_t i) const;
+
+    //! Returns the number of nodes.
+    [[nodiscard]] size_t GetNumberOfNodes() const;
+
+    //! Returns the number of items stored at given node.
+    [[nodiscard]] size_t GetNumberOfItemsAtNode(size_t nodeIdx) const;
+
+    //! Returns the loose bounding box of given node.
+    [[nodiscard]] const BoundingBox<double, N>& GetNodeBound(
+        size_t nodeIdx) const;
+
+    //! Returns the bounding box of this tree.
+    [[nodiscard]] const BoundingBox<double, N>& GetBoundingBox() const;
+
+    //! Returns the maximum depth of the tree.
+    [[nodiscard]] size_t GetMaxDepth() const;
+
+ private:
+    struct Node
+    {
+        BoundingBox<double, N> bound;
+        size_t childBegin = 0;
+        size_t childEnd = 0;
+        size_t itemBegin = 0;
+        size_t itemEnd = 0;
+    };
+
+    struct ItemKey
+    {
+        uint64_t code = 0;
+        size_t level = 0;
+        size_t item = 0;
+    };
+
+    template <typename CullFunc, typename VisitFunc>
+    void ForEachNode(const CullFunc& isCulled, const VisitFunc& visit) const;
+
+    size_t m_maxDepth = 1;
+    BoundingBox<double, N> m_bbox;
+    ContainerType m_items;
+    std::vector<Node> m_nodes;
+};
+
+//! Linear loose quadtree.
+template <typename T>
+using LinearQuadtree = LinearTree<T, 2>;
+
+//! Linear loose octree.
+template <typename T>
+using LinearOctree = LinearTree<T, 3>;
+}  // namespace CubbyFlow
+
+#include <Core/Geometry/LinearTree-Impl.hpp>
+
+#endif
\ No newline at end of file
@@ -105,6 +105,15 @@ class RigidBodyCollider final : public Collider<N>
 
     //! Angular velocity of the rigid body.
     AngularVelocity<N> angularVelocity;
+
+ protected:
+    //! Saves the linear and angular velocities into \p checkpoint.
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    //! Restores the linear and angular velocities from \p checkpoint.
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
 };
 
 //! 2-D RigidBodyCollider type.
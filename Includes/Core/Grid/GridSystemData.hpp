@@ -13,6 +13,8 @@
 
 #include <Core/Grid/FaceCenteredGrid.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 #include <Core/Utils/Serialization.hpp>
 
 namespace CubbyFlow
@@ -234,6 +236,42 @@ class GridSystemData : public Serializable
     //! Serialize the data from the given buffer.
     void Deserialize(const std::vector<uint8_t>& buffer) override;
 
+    //!
+    //! \brief Writes the grid layers to \p writer channel by channel.
+    //!
+    //! The data of each layer is written straight from the grid, so the whole
+    //! system is never serialized into a single buffer.
+    //!
+    void Serialize(ChannelStreamWriter* writer) const;
+
+    //!
+    //! \brief Reads the grid layers written by Serialize(ChannelStreamWriter*).
+    //!
+    //! The layers are restored in place like LoadCheckpoint(), so the system
+    //! must have the same layers as the one that was written.
+    //!
+    void Deserialize(const MappedChannelReader& reader);
+
+    //!
+    //! \brief Saves the grid layers into \p checkpoint.
+    //!
+    //! Each layer is saved as a separate channel whose name starts with
+    //! \p prefix, so that an incremental checkpoint only stores the layers
+    //! that have changed.
+    //!
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //!
+    //! \brief Restores the grid layers saved with given \p prefix.
+    //!
+    //! The layers are restored in place, so the grids shared with the other
+    //! objects stay valid. The system must have the same layers as the one
+    //! that saved the checkpoint.
+    //!
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
  private:
     template <size_t M = N>
     static std::enable_if_t<M == 2, void> Serialize(
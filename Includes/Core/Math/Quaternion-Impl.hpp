@@ -56,32 +56,6 @@ Quaternion<T>::Quaternion(const Matrix3x3<T>& m33)
     Set(m33);
 }
 
-template <typename T>
-Quaternion<T>::Quaternion(const Quaternion& other)
-{
-    Set(other);
-}
-
-template <typename T>
-Quaternion<T>::Quaternion(Quaternion&& other) noexcept
-{
-    Set(other);
-}
-
-template <typename T>
-Quaternion<T>& Quaternion<T>::operator=(const Quaternion& other)
-{
-    Set(other);
-    return *this;
-}
-
-template <typename T>
-Quaternion<T>& Quaternion<T>::operator=(Quaternion&& other) noexcept
-{
-    Set(other);
-    return *this;
-}
-
 template <typename T>
 void Quaternion<T>::Set(const Quaternion& other)
 {
@@ -48,20 +48,20 @@ class Quaternion
     //! Constructs a quaternion with 3x3 rotational matrix.
     explicit Quaternion(const Matrix3x3<T>& m33);
 
-    //! Copy constructor.
-    Quaternion(const Quaternion& other);
+    //! Default copy constructor.
+    Quaternion(const Quaternion& other) = default;
 
     //! Default move constructor.
-    Quaternion(Quaternion&& other) noexcept;
+    Quaternion(Quaternion&& other) noexcept = default;
 
     //! Default destructor.
     ~Quaternion() = default;
 
-    //! Copy assignment operator.
-    Quaternion& operator=(const Quaternion& other);
+    //! Default copy assignment operator.
+    Quaternion& operator=(const Quaternion& other) = default;
 
     //! Default move assignment operator.
-    Quaternion& operator=(Quaternion&& other) noexcept;
+    Quaternion& operator=(Quaternion&& other) noexcept = default;
 
     //! Sets the quaternion with other quaternion.
     void Set(const Quaternion& other);
@@ -0,0 +1,255 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SYMMETRIC_EIGEN_IMPL_HPP
+#define CUBBYFLOW_SYMMETRIC_EIGEN_IMPL_HPP
+
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+// Cyclic Jacobi converges quadratically, so a few sweeps are enough to reach
+// the machine precision for 2x2 and 3x3 matrices.
+constexpr size_t SYMMETRIC_EIGEN_NUM_SWEEPS = 5;
+
+// Number of matrices decomposed together by the batched kernel.
+constexpr size_t SYMMETRIC_EIGEN_BLOCK_SIZE = 64;
+
+template <typename T, size_t L>
+using SymmetricEigenLanes = std::array<T, L>;
+
+// Index of the entry (i, j), i <= j, in the packed upper triangle.
+template <size_t N>
+constexpr size_t SymmetricEntryIndex(size_t i, size_t j)
+{
+    return (i <= j) ? i * (2 * N - i + 1) / 2 + (j - i)
+                    : SymmetricEntryIndex<N>(j, i);
+}
+
+// Diagonalizes L symmetric matrices at once. On return, the diagonal entries
+// of a hold the eigenvalues and v is multiplied by the accumulated rotations.
+template <typename T, size_t N, size_t L>
+void JacobiEigen(
+    std::array<SymmetricEigenLanes<T, L>, N * (N + 1) / 2>& a,
+    std::array<SymmetricEigenLanes<T, L>, N * N>& v)
+{
+    for (size_t sweep = 0; sweep < SYMMETRIC_EIGEN_NUM_SWEEPS; ++sweep)
+    {
+        for (size_t p = 0; p + 1 < N; ++p)
+        {
+            for (size_t q = p + 1; q < N; ++q)
+            {
+                T* app = a[SymmetricEntryIndex<N>(p, p)].data();
+                T* aqq = a[SymmetricEntryIndex<N>(q, q)].data();
+                T* apq = a[SymmetricEntryIndex<N>(p, q)].data();
+
+                for (size_t l = 0; l < L; ++l)
+                {
+                    // Rotation that annihilates apq without any branch. The
+                    // denominator is zero only if the matrix is already
+                    // diagonal in (p, q), where t becomes zero.
+                    const T x = apq[l];
+                    const T tau = aqq[l] - app[l];
+                    const T denom =
+                        std::fabs(tau) + std::sqrt(tau * tau + 4 * x * x);
+                    const T t = 2 * x * std::copysign(T(1), tau) /
+                                std::max(denom, std::numeric_limits<T>::min());
+                    const T c = 1 / std::sqrt(1 + t * t);
+                    const T s = t * c;
+
+                    app[l] -= t * x;
+                    aqq[l] += t * x;
+                    apq[l] = 0;
+
+                    for (size_t r = 0; r < N; ++r)
+                    {
+                        if (r != p && r != q)
+                        {
+                            T& arp = a[SymmetricEntryIndex<N>(r, p)][l];
+                            T& arq = a[SymmetricEntryIndex<N>(r, q)][l];
+                            const T g = arp;
+                            const T h = arq;
+                            arp = c * g - s * h;
+                            arq = s * g + c * h;
+                        }
+                    }
+
+                    for (size_t r = 0; r < N; ++r)
+                    {
+                        T& vrp = v[r * N + p][l];
+                        T& vrq = v[r * N + q][l];
+                        const T g = vrp;
+                        const T h = vrq;
+                        vrp = c * g - s * h;
+                        vrq = s * g + c * h;
+                    }
+                }
+            }
+        }
+    }
+}
+}  // namespace Internal
+
+template <typename T, size_t N>
+void SymmetricEigen(const Matrix<T, N, N>& a, Vector<T, N>& d,
+                    Matrix<T, N, N>& v)
+{
+    static_assert(N == 2 || N == 3, "Only 2x2 and 3x3 matrices are supported.");
+
+    std::array<Internal::SymmetricEigenLanes<T, 1>, N * (N + 1) / 2> entries;
+    std::array<Internal::SymmetricEigenLanes<T, 1>, N * N> vectors;
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        for (size_t j = 0; j < N; ++j)
+        {
+            if (i <= j)
+            {
+                entries[Internal::SymmetricEntryIndex<N>(i, j)][0] = a(i, j);
+            }
+
+            vectors[i * N + j][0] = (i == j) ? T(1) : T(0);
+        }
+    }
+
+    Internal::JacobiEigen<T, N, 1>(entries, vectors);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        d[i] = entries[Internal::SymmetricEntryIndex<N>(i, i)][0];
+
+        for (size_t j = 0; j < N; ++j)
+        {
+            v(i, j) = vectors[i * N + j][0];
+        }
+    }
+}
+
+template <typename T, size_t N>
+SymmetricEigenBatch<T, N>::SymmetricEigenBatch(size_t size)
+{
+    Resize(size);
+}
+
+template <typename T, size_t N>
+void SymmetricEigenBatch<T, N>::Resize(size_t size)
+{
+    for (Array1<T>& entry : m_entries)
+    {
+        entry.Resize(size);
+    }
+
+    for (Array1<T>& vector : m_eigenVectors)
+    {
+        vector.Resize(size);
+    }
+}
+
+template <typename T, size_t N>
+size_t SymmetricEigenBatch<T, N>::Length() const
+{
+    return m_entries[0].Length();
+}
+
+template <typename T, size_t N>
+void SymmetricEigenBatch<T, N>::SetMatrix(size_t i, const Matrix<T, N, N>& a)
+{
+    for (size_t r = 0; r < N; ++r)
+    {
+        for (size_t c = r; c < N; ++c)
+        {
+            m_entries[Internal::SymmetricEntryIndex<N>(r, c)][i] = a(r, c);
+        }
+    }
+}
+
+template <typename T, size_t N>
+void SymmetricEigenBatch<T, N>::Compute()
+{
+    constexpr size_t blockSize = Internal::SYMMETRIC_EIGEN_BLOCK_SIZE;
+
+    const size_t size = Length();
+    const size_t numBlocks = (size + blockSize - 1) / blockSize;
+
+    ParallelFor(ZERO_SIZE, numBlocks, [&](size_t block) {
+        const size_t begin = block * blockSize;
+        const size_t count = std::min(blockSize, size - begin);
+
+        // Unused lanes of the last block are zero matrices, which are left
+        // untouched by the rotations.
+        std::array<Internal::SymmetricEigenLanes<T, blockSize>, NUM_ENTRIES>
+            entries{};
+        std::array<Internal::SymmetricEigenLanes<T, blockSize>, N * N>
+            vectors{};
+
+        for (size_t e = 0; e < NUM_ENTRIES; ++e)
+        {
+            std::copy_n(m_entries[e].data() + begin, count,
+                        entries[e].data());
+        }
+
+        for (size_t r = 0; r < N; ++r)
+        {
+            vectors[r * N + r].fill(T(1));
+        }
+
+        Internal::JacobiEigen<T, N, blockSize>(entries, vectors);
+
+        for (size_t e = 0; e < NUM_ENTRIES; ++e)
+        {
+            std::copy_n(entries[e].data(), count,
+                        m_entries[e].data() + begin);
+        }
+
+        for (size_t e = 0; e < N * N; ++e)
+        {
+            std::copy_n(vectors[e].data(), count,
+                        m_eigenVectors[e].data() + begin);
+        }
+    });
+}
+
+template <typename T, size_t N>
+Vector<T, N> SymmetricEigenBatch<T, N>::EigenValues(size_t i) const
+{
+    Vector<T, N> d;
+
+    for (size_t r = 0; r < N; ++r)
+    {
+        d[r] = m_entries[Internal::SymmetricEntryIndex<N>(r, r)][i];
+    }
+
+    return d;
+}
+
+template <typename T, size_t N>
+Matrix<T, N, N> SymmetricEigenBatch<T, N>::EigenVectors(size_t i) const
+{
+    Matrix<T, N, N> v;
+
+    for (size_t r = 0; r < N; ++r)
+    {
+        for (size_t c = 0; c < N; ++c)
+        {
+            v(r, c) = m_eigenVectors[r * N + c][i];
+        }
+    }
+
+    return v;
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SYMMETRIC_EIGEN_HPP
+#define CUBBYFLOW_SYMMETRIC_EIGEN_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Matrix/Matrix.hpp>
+
+#include <array>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Eigen-decomposition of a symmetric matrix.
+//!
+//! This function decomposes the symmetric input matrix \p a to
+//! \p v * diag(\p d) * \p v^T using a fixed number of cyclic Jacobi sweeps.
+//! The eigenvalues are not sorted and the columns of \p v are the
+//! corresponding eigenvectors. Only the upper triangle of \p a is read.
+//!
+//! \tparam T Real-value type.
+//! \tparam N Dimension of the matrix, either 2 or 3.
+//!
+//! \param a The symmetric input matrix to decompose.
+//! \param d The vector of eigenvalues.
+//! \param v The orthogonal matrix of eigenvectors.
+//!
+template <typename T, size_t N>
+void SymmetricEigen(const Matrix<T, N, N>& a, Vector<T, N>& d,
+                    Matrix<T, N, N>& v);
+
+//!
+//! \brief Batched eigen-decomposition of symmetric matrices.
+//!
+//! This class stores the unique entries of the symmetric matrices and their
+//! eigenvectors in structure-of-arrays layout, and decomposes the matrices
+//! block by block with the same branch-free Jacobi sweeps as
+//! SymmetricEigen(). Each rotation is applied to all the matrices of a block
+//! in a single loop, so that the compiler can vectorize the kernel.
+//!
+//! The matrices are decomposed in place: once Compute() is called, the
+//! diagonal entries hold the eigenvalues and SetMatrix() should be called
+//! again before the next Compute().
+//!
+//! \tparam T Real-value type.
+//! \tparam N Dimension of the matrices, either 2 or 3.
+//!
+template <typename T, size_t N>
+class SymmetricEigenBatch
+{
+ public:
+    static_assert(N == 2 || N == 3,
+                  "Only 2x2 and 3x3 matrices are supported.");
+
+    //! Number of unique entries of a symmetric matrix.
+    static constexpr size_t NUM_ENTRIES = N * (N + 1) / 2;
+
+    //! Constructs a batch with given number of matrices.
+    explicit SymmetricEigenBatch(size_t size = 0);
+
+    //! Resizes the batch.
+    void Resize(size_t size);
+
+    //! Returns the number of matrices in the batch.
+    [[nodiscard]] size_t Length() const;
+
+    //! Sets the i-th matrix. Only the upper triangle of \p a is read.
+    void SetMatrix(size_t i, const Matrix<T, N, N>& a);
+
+    //! Decomposes all the matrices in the batch in parallel.
+    void Compute();
+
+    //! Returns the eigenvalues of the i-th matrix.
+    [[nodiscard]] Vector<T, N> EigenValues(size_t i) const;
+
+    //! Returns the eigenvectors of the i-th matrix as columns.
+    [[nodiscard]] Matrix<T, N, N> EigenVectors(size_t i) const;
+
+ private:
+    std::array<Array1<T>, NUM_ENTRIES> m_entries;
+    std::array<Array1<T>, N * N> m_eigenVectors;
+};
+
+//! Batched eigen-decomposition of 2x2 symmetric matrices.
+template <typename T>
+using SymmetricEigenBatch2 = SymmetricEigenBatch<T, 2>;
+
+//! Batched eigen-decomposition of 3x3 symmetric matrices.
+template <typename T>
+using SymmetricEigenBatch3 = SymmetricEigenBatch<T, 3>;
+}  // namespace CubbyFlow
+
+#include <Core/Math/SymmetricEigen-Impl.hpp>
+
+#endif
\ No newline at end of file
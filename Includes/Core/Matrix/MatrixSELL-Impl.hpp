@@ -0,0 +1,213 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_MATRIX_SELL_IMPL_HPP
+#define CUBBYFLOW_MATRIX_SELL_IMPL_HPP
+
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace CubbyFlow
+{
+template <typename T>
+MatrixSELL<T>::MatrixSELL(const MatrixCSR<T>& m, size_t sortingScope)
+{
+    Build(m, sortingScope);
+}
+
+template <typename T>
+void MatrixSELL<T>::Build(const MatrixCSR<T>& m, size_t sortingScope)
+{
+    const size_t numRows = m.GetRows();
+    const size_t numChunks = (numRows + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const auto rp = m.RowPointersBegin();
+    const auto ci = m.ColumnIndicesBegin();
+    const auto nnz = m.NonZeroBegin();
+
+    m_size = m.Size();
+    m_numNonZeros = m.NumberOfNonZeros();
+
+    // Sort the rows by their lengths within each sorting window
+    sortingScope = std::max(sortingScope, ONE_SIZE);
+    m_rowIndices.resize(numChunks * CHUNK_SIZE);
+    std::iota(m_rowIndices.begin(), m_rowIndices.begin() + numRows, ZERO_SIZE);
+    std::fill(m_rowIndices.begin() + numRows, m_rowIndices.end(), INVALID_ROW);
+
+    if (sortingScope > 1)
+    {
+        const size_t numWindows = (numRows + sortingScope - 1) / sortingScope;
+
+        ParallelFor(ZERO_SIZE, numWindows, [&](size_t w) {
+            const auto begin = m_rowIndices.begin() + w * sortingScope;
+            const auto end = m_rowIndices.begin() +
+                             std::min((w + 1) * sortingScope, numRows);
+
+            std::stable_sort(begin, end, [&](size_t a, size_t b) {
+                return rp[a + 1] - rp[a] > rp[b + 1] - rp[b];
+            });
+        });
+    }
+
+    // Compute the width of each chunk
+    m_chunkOffsets.resize(numChunks + 1);
+    m_chunkOffsets[0] = 0;
+
+    ParallelFor(ZERO_SIZE, numChunks, [&](size_t c) {
+        size_t width = 0;
+
+        for (size_t l = 0; l < CHUNK_SIZE; ++l)
+        {
+            const size_t row = m_rowIndices[c * CHUNK_SIZE + l];
+            if (row != INVALID_ROW)
+            {
+                width = std::max(width, rp[row + 1] - rp[row]);
+            }
+        }
+
+        m_chunkOffsets[c + 1] = width * CHUNK_SIZE;
+    });
+
+    for (size_t c = 0; c < numChunks; ++c)
+    {
+        m_chunkOffsets[c + 1] += m_chunkOffsets[c];
+    }
+
+    // Fill the chunks in the column-major order. The padded elements are zero
+    // and point to the first column so that they never read out of the range.
+    m_nonZeros.resize(m_chunkOffsets[numChunks]);
+    m_columnIndices.resize(m_chunkOffsets[numChunks]);
+
+    ParallelFor(ZERO_SIZE, numChunks, [&](size_t c) {
+        const size_t offset = m_chunkOffsets[c];
+        const size_t width = (m_chunkOffsets[c + 1] - offset) / CHUNK_SIZE;
+
+        for (size_t l = 0; l < CHUNK_SIZE; ++l)
+        {
+            const size_t row = m_rowIndices[c * CHUNK_SIZE + l];
+            const size_t length =
+                (row != INVALID_ROW) ? rp[row + 1] - rp[row] : 0;
+
+            for (size_t s = 0; s < width; ++s)
+            {
+                const size_t dst = offset + s * CHUNK_SIZE + l;
+
+                if (s < length)
+                {
+                    m_nonZeros[dst] = nnz[rp[row] + s];
+                    m_columnIndices[dst] = ci[rp[row] + s];
+                }
+                else
+                {
+                    m_nonZeros[dst] = T{};
+                    m_columnIndices[dst] = 0;
+                }
+            }
+        }
+    });
+}
+
+template <typename T>
+void MatrixSELL<T>::Clear()
+{
+    m_size = Vector2UZ{};
+    m_numNonZeros = 0;
+    m_nonZeros.clear();
+    m_columnIndices.clear();
+    m_chunkOffsets.clear();
+    m_rowIndices.clear();
+}
+
+template <typename T>
+Vector2UZ MatrixSELL<T>::Size() const
+{
+    return m_size;
+}
+
+template <typename T>
+size_t MatrixSELL<T>::GetRows() const
+{
+    return m_size.x;
+}
+
+template <typename T>
+size_t MatrixSELL<T>::GetCols() const
+{
+    return m_size.y;
+}
+
+template <typename T>
+size_t MatrixSELL<T>::NumberOfNonZeros() const
+{
+    return m_numNonZeros;
+}
+
+template <typename T>
+size_t MatrixSELL<T>::NumberOfStoredElements() const
+{
+    return m_nonZeros.size();
+}
+
+template <typename T>
+void MatrixSELL<T>::Multiply(const VectorN<T>& x, VectorN<T>* result) const
+{
+    ForEachChunkRow(x, [&](size_t row, T sum) { (*result)[row] = sum; });
+}
+
+template <typename T>
+void MatrixSELL<T>::Residual(const VectorN<T>& x, const VectorN<T>& b,
+                             VectorN<T>* result) const
+{
+    ForEachChunkRow(
+        x, [&](size_t row, T sum) { (*result)[row] = b[row] - sum; });
+}
+
+template <typename T>
+template <typename Callback>
+void MatrixSELL<T>::ForEachChunkRow(const VectorN<T>& x,
+                                    const Callback& func) const
+{
+    const size_t numChunks =
+        m_chunkOffsets.empty() ? 0 : m_chunkOffsets.size() - 1;
+    const T* nnz = m_nonZeros.data();
+    const size_t* ci = m_columnIndices.data();
+    const T* xData = x.data();
+
+    ParallelRangeFor(ZERO_SIZE, numChunks, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            // Fixed-length lane loops are vectorized by the compiler; the
+            // loads of x become gathers on the targets that support them.
+            T sum[CHUNK_SIZE] = {};
+
+            for (size_t s = m_chunkOffsets[c]; s < m_chunkOffsets[c + 1];
+                 s += CHUNK_SIZE)
+            {
+                for (size_t l = 0; l < CHUNK_SIZE; ++l)
+                {
+                    sum[l] += nnz[s + l] * xData[ci[s + l]];
+                }
+            }
+
+            for (size_t l = 0; l < CHUNK_SIZE; ++l)
+            {
+                const size_t row = m_rowIndices[c * CHUNK_SIZE + l];
+                if (row != INVALID_ROW)
+                {
+                    func(row, sum[l]);
+                }
+            }
+        }
+    });
+}
+}  // namespace CubbyFlow
+
+#endif
@@ -0,0 +1,123 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_MATRIX_SELL_HPP
+#define CUBBYFLOW_MATRIX_SELL_HPP
+
+#include <Core/Matrix/MatrixCSR.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Sliced ELLPACK (SELL-C-sigma) sparse matrix class.
+//!
+//! This class stores a sparse matrix in the SELL-C-sigma format. The rows are
+//! grouped into chunks of CHUNK_SIZE rows, and each chunk is stored in the
+//! column-major order padded to its longest row, so that the elements of the
+//! rows in a chunk are contiguous for every slot. Before chunking, the rows
+//! are sorted by their lengths within windows of sigma rows to reduce the
+//! padding. As a result, the matrix-vector multiplication processes
+//! CHUNK_SIZE rows in lock-step which maps to SIMD lanes, while the CSR format
+//! processes a single short row at a time.
+//!
+//! The matrix is read-only and built from MatrixCSR; it is meant to be used
+//! as an alternate storage for the matrix-vector multiplication in the
+//! iterative solvers.
+//!
+//! \see Kreutzer, Moritz, et al. "A unified sparse matrix data format for
+//!      efficient general sparse matrix-vector multiplication on modern
+//!      processors with wide SIMD units." SIAM Journal on Scientific
+//!      Computing 36.5 (2014): C401-C423.
+//!
+//! \tparam T Type of the element.
+//!
+template <typename T>
+class MatrixSELL final
+{
+ public:
+    static_assert(
+        std::is_floating_point<T>::value,
+        "MatrixSELL only can be instantiated with floating point types");
+
+    //! Number of rows in a chunk (C).
+    static constexpr size_t CHUNK_SIZE = 8;
+
+    //! Default sorting scope (sigma).
+    static constexpr size_t DEFAULT_SORTING_SCOPE = 256;
+
+    //! Constructs an empty matrix.
+    MatrixSELL() = default;
+
+    //! Constructs the matrix from CSR matrix \p m.
+    explicit MatrixSELL(const MatrixCSR<T>& m,
+                        size_t sortingScope = DEFAULT_SORTING_SCOPE);
+
+    //!
+    //! \brief Builds the matrix from CSR matrix \p m.
+    //!
+    //! \param m            The CSR matrix.
+    //! \param sortingScope The number of rows (sigma) within which the rows
+    //!                     are sorted by their lengths. 1 disables sorting.
+    //!
+    void Build(const MatrixCSR<T>& m,
+               size_t sortingScope = DEFAULT_SORTING_SCOPE);
+
+    //! Clears the matrix and make it zero-dimensional.
+    void Clear();
+
+    //! Returns the size of this matrix.
+    [[nodiscard]] Vector2UZ Size() const;
+
+    //! Returns number of rows of this matrix.
+    [[nodiscard]] size_t GetRows() const;
+
+    //! Returns number of columns of this matrix.
+    [[nodiscard]] size_t GetCols() const;
+
+    //! Returns the number of non-zero elements.
+    [[nodiscard]] size_t NumberOfNonZeros() const;
+
+    //! Returns the number of stored elements including the padding.
+    [[nodiscard]] size_t NumberOfStoredElements() const;
+
+    //! Computes \p result = this * \p x.
+    void Multiply(const VectorN<T>& x, VectorN<T>* result) const;
+
+    //! Computes \p result = \p b - this * \p x.
+    void Residual(const VectorN<T>& x, const VectorN<T>& b,
+                  VectorN<T>* result) const;
+
+ private:
+    static constexpr size_t INVALID_ROW = std::numeric_limits<size_t>::max();
+
+    template <typename Callback>
+    void ForEachChunkRow(const VectorN<T>& x, const Callback& func) const;
+
+    Vector2UZ m_size;
+    size_t m_numNonZeros = 0;
+    std::vector<T> m_nonZeros;
+    std::vector<size_t> m_columnIndices;
+    std::vector<size_t> m_chunkOffsets;
+    std::vector<size_t> m_rowIndices;
+};
+
+//! Float-type SELL matrix.
+typedef MatrixSELL<float> MatrixSELLF;
+
+//! Double-type SELL matrix.
+typedef MatrixSELL<double> MatrixSELLD;
+}  // namespace CubbyFlow
+
+#include <Core/Matrix/MatrixSELL-Impl.hpp>
+
+#endif
@@ -0,0 +1,142 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PARTICLE_CACHE_HPP
+#define CUBBYFLOW_PARTICLE_CACHE_HPP
+
+#include <Core/Geometry/BoundingBox.hpp>
+#include <Core/Particle/ParticleSystemData.hpp>
+
+#include <string>
+
+namespace CubbyFlow
+{
+//! Particle cache input parameter set.
+struct ParticleCacheParameters
+{
+    //! Number of bits per position component, in range [1, 32].
+    unsigned int positionBits = 16;
+
+    //! True if velocities are stored.
+    bool storeVelocities = false;
+
+    //! True if forces are stored.
+    bool storeForces = false;
+
+    //! True if the custom scalar and vector data layers are stored.
+    bool storeCustomData = false;
+
+    //! True if velocities, forces and custom data are stored as float.
+    bool downcastToFloat = true;
+
+    //! True if positions are stored as deltas from the previous frame.
+    bool useDeltaEncoding = false;
+
+    //! Max number of frames from a key frame to the next key frame.
+    size_t keyFrameInterval = 30;
+
+    //! Padding of the quantization box of a key frame relative to its size.
+    //! Delta frames fall back to key frames once particles leave the box.
+    double keyFramePadding = 0.05;
+};
+
+//!
+//! \brief N-D particle cache writer.
+//!
+//! This class writes one particle system data frame per file in a compact
+//! form. Positions are quantized relative to the bounding box of the particles
+//! with ParticleCacheParameters::positionBits bits per component. When delta
+//! encoding is enabled, the quantized positions of the frames between two key
+//! frames are stored as differences from the previous frame, using the
+//! narrowest integer type that fits. Other channels are optional and can be
+//! downcast to float. The neighbor searcher and lists are never stored.
+//!
+template <size_t N>
+class ParticleCacheWriter final
+{
+ public:
+    //! Constructs the writer with given parameters.
+    explicit ParticleCacheWriter(
+        const ParticleCacheParameters& params = ParticleCacheParameters{});
+
+    //! Returns the parameters.
+    [[nodiscard]] const ParticleCacheParameters& GetParams() const;
+
+    //! Writes \p particles as the next frame of the cache to the file.
+    void Write(const std::string& filename,
+               const ParticleSystemData<N>& particles);
+
+    //! Makes the next frame a key frame.
+    void Reset();
+
+    //! Returns true if the last written frame is a key frame.
+    [[nodiscard]] bool IsLastFrameKeyFrame() const;
+
+ private:
+    ParticleCacheParameters m_params;
+    size_t m_frame = 0;
+    size_t m_lastKeyFrame = 0;
+    bool m_hasKeyFrame = false;
+    bool m_isLastFrameKeyFrame = false;
+    BoundingBox<double, N> m_box;
+    Array1<uint32_t> m_lastQuantized;
+};
+
+//!
+//! \brief N-D particle cache reader.
+//!
+//! This class reads the frames written by ParticleCacheWriter. The file is
+//! memory-mapped and decoded in parallel chunks. A delta frame can only be read
+//! right after its previous frame, so the frames of a delta-encoded cache
+//! should be read in order starting from a key frame.
+//!
+template <size_t N>
+class ParticleCacheReader final
+{
+ public:
+    //! Reads the frame in the file into \p particles.
+    void Read(const std::string& filename, ParticleSystemData<N>* particles);
+
+    //! Returns true if the last read frame is a key frame.
+    [[nodiscard]] bool IsLastFrameKeyFrame() const;
+
+ private:
+    size_t m_frame = 0;
+    bool m_hasFrame = false;
+    bool m_isLastFrameKeyFrame = false;
+    Array1<uint32_t> m_lastQuantized;
+};
+
+//! 2-D ParticleCacheWriter type.
+using ParticleCacheWriter2 = ParticleCacheWriter<2>;
+
+//! 3-D ParticleCacheWriter type.
+using ParticleCacheWriter3 = ParticleCacheWriter<3>;
+
+//! 2-D ParticleCacheReader type.
+using ParticleCacheReader2 = ParticleCacheReader<2>;
+
+//! 3-D ParticleCacheReader type.
+using ParticleCacheReader3 = ParticleCacheReader<3>;
+
+//! Shared pointer type of ParticleCacheWriter2.
+using ParticleCacheWriter2Ptr = std::shared_ptr<ParticleCacheWriter2>;
+
+//! Shared pointer type of ParticleCacheWriter3.
+using ParticleCacheWriter3Ptr = std::shared_ptr<ParticleCacheWriter3>;
+
+//! Shared pointer type of ParticleCacheReader2.
+using ParticleCacheReader2Ptr = std::shared_ptr<ParticleCacheReader2>;
+
+//! Shared pointer type of ParticleCacheReader3.
+using ParticleCacheReader3Ptr = std::shared_ptr<ParticleCacheReader3>;
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
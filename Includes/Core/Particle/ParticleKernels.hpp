@@ -0,0 +1,79 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PARTICLE_KERNELS_HPP
+#define CUBBYFLOW_PARTICLE_KERNELS_HPP
+
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Geometry/BoundingBox.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Integrates the particles with the semi-implicit Euler method.
+//!
+//! Computes newVelocities = velocities + dt * forces / mass and
+//! newPositions = positions + dt * newVelocities. The particle kernels work
+//! on the particle channels as flat arrays of doubles and are dispatched to
+//! the instruction set level returned by GetSIMDLevel(). This kernel gives
+//! bitwise identical results on every level.
+//!
+void IntegrateParticles(const ConstArrayView1<Vector3D>& positions,
+                        const ConstArrayView1<Vector3D>& velocities,
+                        const ConstArrayView1<Vector3D>& forces, double mass,
+                        double timeStepInSeconds,
+                        ArrayView1<Vector3D> newPositions,
+                        ArrayView1<Vector3D> newVelocities);
+
+//!
+//! \brief Clamps the particles to the closed sides of the bounding box.
+//!
+//! For each side enabled in \p boundaryFlags (DIRECTION_LEFT, ...), the
+//! particles on or beyond the side are moved onto it and the velocity
+//! component normal to the side is set to zero.
+//!
+void ClampParticlesToBox(const BoundingBox3D& boundingBox, int boundaryFlags,
+                         ArrayView1<Vector3D> positions,
+                         ArrayView1<Vector3D> velocities);
+
+//!
+//! \brief Computes the densities using the standard SPH kernel.
+//!
+//! Same as SPHSystemData3::UpdateDensities(), but iterates the neighbor lists
+//! (which do not contain the particle itself) instead of the neighbor
+//! searcher.
+//!
+void ComputeSPHStdKernelDensities(const ConstArrayView1<Vector3D>& positions,
+                                  const Array1<Array1<size_t>>& neighborLists,
+                                  double kernelRadius, double mass,
+                                  ArrayView1<double> densities);
+
+//!
+//! \brief Accumulates the symmetric pressure forces using the spiky kernel.
+//!
+//! \p pressureTerms holds p / d^2 of each particle.
+//!
+void AccumulateSPHPressureForces(const ConstArrayView1<Vector3D>& positions,
+                                 const ConstArrayView1<double>& pressureTerms,
+                                 const Array1<Array1<size_t>>& neighborLists,
+                                 double kernelRadius, double mass,
+                                 ArrayView1<Vector3D> pressureForces);
+
+//! Accumulates the viscosity forces using the spiky kernel.
+void AccumulateSPHViscosityForces(const ConstArrayView1<Vector3D>& positions,
+                                  const ConstArrayView1<Vector3D>& velocities,
+                                  const ConstArrayView1<double>& densities,
+                                  const Array1<Array1<size_t>>& neighborLists,
+                                  double kernelRadius, double mass,
+                                  double viscosityCoefficient,
+                                  ArrayView1<Vector3D> forces);
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
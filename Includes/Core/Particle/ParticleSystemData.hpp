@@ -13,6 +13,8 @@
 
 #include <Core/Array/Array.hpp>
 #include <Core/Searcher/PointNeighborSearcher.hpp>
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 #include <Core/Utils/Serialization.hpp>
 
 #ifndef CUBBYFLOW_DOXYGEN
@@ -91,6 +93,12 @@ class ParticleSystemData : public Serializable
     //! Returns the number of particles.
     [[nodiscard]] size_t NumberOfParticles() const;
 
+    //! Returns the number of scalar data layers.
+    [[nodiscard]] size_t NumberOfScalarData() const;
+
+    //! Returns the number of vector data layers, including the default ones.
+    [[nodiscard]] size_t NumberOfVectorData() const;
+
     //!
     //! \brief      Adds a scalar data layer and returns its index.
     //!
@@ -230,6 +238,38 @@ class ParticleSystemData : public Serializable
     //! Deserializes this particle system data from the buffer.
     void Deserialize(const std::vector<uint8_t>& buffer) override;
 
+    //!
+    //! \brief Writes this particle system data to \p writer channel by channel.
+    //!
+    //! Unlike the buffer serialization, each data channel is written directly
+    //! from the particle arrays without building an intermediate buffer. The
+    //! neighbor searcher and the neighbor lists are not written and should be
+    //! rebuilt after the deserialization.
+    //!
+    virtual void Serialize(ChannelStreamWriter* writer) const;
+
+    //! Deserializes this particle system data from the mapped \p reader.
+    virtual void Deserialize(const MappedChannelReader& reader);
+
+    //!
+    //! \brief Saves the particle data into \p checkpoint.
+    //!
+    //! Each data layer is saved as a separate channel whose name starts with
+    //! \p prefix. The neighbor searcher and the neighbor lists are not saved
+    //! and should be rebuilt after restoring.
+    //!
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //!
+    //! \brief Restores the particle data saved with given \p prefix.
+    //!
+    //! The system must have the same data layers as the one that saved the
+    //! checkpoint.
+    //!
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
     //! Copies from other particle system data.
     void Set(const ParticleSystemData& other);
 
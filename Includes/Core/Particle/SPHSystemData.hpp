@@ -218,6 +218,12 @@ class SPHSystemData : public ParticleSystemData<N>
     //! Deserializes this SPH system data from the buffer.
     void Deserialize(const std::vector<uint8_t>& buffer) override;
 
+    //! Writes this SPH system data to \p writer channel by channel.
+    void Serialize(ChannelStreamWriter* writer) const override;
+
+    //! Deserializes this SPH system data from the mapped \p reader.
+    void Deserialize(const MappedChannelReader& reader) override;
+
     //! Copies from other SPH system data.
     void Set(const SPHSystemData& other);
 
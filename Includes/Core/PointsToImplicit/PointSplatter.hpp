@@ -0,0 +1,106 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_POINT_SPLATTER_HPP
+#define CUBBYFLOW_POINT_SPLATTER_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Matrix/Matrix.hpp>
+
+#include <functional>
+
+namespace CubbyFlow
+{
+//!
+//! \brief N-D helper for splatting points onto grid data points.
+//!
+//! This class buckets the points into tiles of data points by the bounding
+//! box of their kernel, so that each tile can be processed independently by
+//! a single thread. Points-to-implicit converters use it to scatter the
+//! kernel contributions of each point only into the data points within the
+//! kernel radius, instead of gathering the neighbors of every data point.
+//!
+template <size_t N>
+class PointSplatter
+{
+ public:
+    //! Edge length of a tile in number of data points.
+    static constexpr size_t TILE_SIZE = 8;
+
+    //!
+    //! Callback function type for the tiles. The data point index range of
+    //! the tile is [begin, end) and the last argument is the list of the
+    //! point indices whose kernel overlaps with the tile.
+    //!
+    using TileCallback = std::function<void(
+        const Vector<size_t, N>& begin, const Vector<size_t, N>& end,
+        const ConstArrayView1<size_t>& pointIndices)>;
+
+    //! Constructs the splatter with given data layout and kernel radius.
+    PointSplatter(const Vector<size_t, N>& dataSize,
+                  const Vector<double, N>& dataOrigin,
+                  const Vector<double, N>& gridSpacing, double kernelRadius);
+
+    //!
+    //! \brief Buckets the given points into the tiles in parallel.
+    //!
+    //! The point indices of each tile are sorted in ascending order, so the
+    //! order in which the tiles visit the points does not depend on the
+    //! thread scheduling.
+    //!
+    void Build(const ConstArrayView1<Vector<double, N>>& points);
+
+    //!
+    //! \brief Invokes the callback for every tile in parallel.
+    //!
+    //! Tiles with no overlapping point are also visited with an empty index
+    //! list, so that the callback can set the far values directly.
+    //!
+    void ParallelForEachTile(const TileCallback& callback) const;
+
+    //!
+    //! \brief Returns the data point index range within the kernel radius.
+    //!
+    //! The range [begin, end) is clipped to the data size. Returns false if
+    //! no data point is within the kernel radius of the point.
+    //!
+    bool GetSplatRange(const Vector<double, N>& point,
+                       Vector<size_t, N>* begin, Vector<size_t, N>* end) const;
+
+    //! Returns the position of the data point at given index.
+    [[nodiscard]] Vector<double, N> DataPosition(
+        const Vector<size_t, N>& idx) const;
+
+    //! Returns the kernel radius.
+    [[nodiscard]] double KernelRadius() const;
+
+ private:
+    [[nodiscard]] size_t NumberOfTiles() const;
+
+    [[nodiscard]] size_t TileIndex(const Vector<size_t, N>& tile) const;
+
+    Vector<size_t, N> m_dataSize;
+    Vector<double, N> m_dataOrigin;
+    Vector<double, N> m_gridSpacing;
+    double m_kernelRadius;
+    Vector<size_t, N> m_tileResolution;
+    Array1<size_t> m_tileOffsets;
+    Array1<size_t> m_pointIndices;
+};
+
+//! 2-D PointSplatter type.
+using PointSplatter2 = PointSplatter<2>;
+
+//! 3-D PointSplatter type.
+using PointSplatter3 = PointSplatter<3>;
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -33,10 +33,30 @@ class ZhuBridsonPointsToImplicit3 final : public PointsToImplicit3
     void Convert(const ConstArrayView1<Vector3D>& points,
                  ScalarGrid3* output) const override;
 
+    //! Returns true if the points are splatted onto the grid.
+    [[nodiscard]] bool GetUseSplatting() const;
+
+    //!
+    //! \brief Sets true to splat the points onto the grid.
+    //!
+    //! When enabled, each point accumulates its weight and weighted position
+    //! only to the grid points within the kernel radius, and the grid points
+    //! with no point nearby are set to the far value without any query.
+    //! Otherwise, the neighbors of every grid point are searched. Both modes
+    //! produce the same field up to round-off errors. Splatting is disabled
+    //! by default so that the output stays bitwise identical to the earlier
+    //! versions unless requested.
+    //!
+    void SetUseSplatting(bool useSplatting);
+
  private:
+    void Splat(const ConstArrayView1<Vector3D>& points,
+               ScalarGrid3* output) const;
+
     double m_kernelRadius = 1.0;
     double m_cutOffThreshold = 0.25;
     bool m_isOutputSDF = true;
+    bool m_useSplatting = false;
 };
 
 //! Shared pointer type for ZhuBridsonPointsToImplicit3 class
@@ -80,6 +80,28 @@ class PointKdTreeSearcher final : public PointNeighborSearcher<N>
     [[nodiscard]] bool HasNearbyPoint(const Vector<double, N>& origin,
                                       double radius) const override;
 
+    //!
+    //! Finds the k nearest points of the origin in the ascending order of the
+    //! distance.
+    //!
+    //! \param[in]  origin  The origin.
+    //! \param[in]  k       The number of points to find.
+    //! \param[out] indices The indices of the nearest points.
+    //!
+    void GetKNearestPoints(const Vector<double, N>& origin, size_t k,
+                           Array1<size_t>* indices) const;
+
+    //!
+    //! Finds the k nearest points of each origin in parallel. The j-th row of
+    //! \p indices holds the nearest points of the j-th origin.
+    //!
+    //! \param[in]  origins The origins.
+    //! \param[in]  k       The number of points to find for each origin.
+    //! \param[out] indices The indices of the nearest points.
+    //!
+    void GetKNearestPoints(const ConstArrayView1<Vector<double, N>>& origins,
+                           size_t k, Array2<size_t>* indices) const;
+
     //!
     //! \brief      Creates a new instance of the object with same properties
     //!             than original.
@@ -233,6 +233,9 @@ class PointParallelHashGridSearcher final : public PointNeighborSearcher<N>
     Array1<size_t> m_startIndexTable;
     Array1<size_t> m_endIndexTable;
     Array1<size_t> m_sortedIndices;
+
+    // Unsorted hash keys, kept so that rebuilding does not reallocate.
+    Array1<size_t> m_tempKeys;
 };
 
 //! 2-D PointParallelHashGridSearcher type.
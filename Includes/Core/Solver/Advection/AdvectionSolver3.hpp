@@ -119,6 +119,33 @@ class AdvectionSolver3
                         FaceCenteredGrid3* output,
                         const ScalarField3& boundarySDF = ConstantScalarField3(
                             std::numeric_limits<double>::max()));
+
+    //!
+    //! \brief Solves advection equation for given scalar grid only within the
+    //!        given tiles.
+    //!
+    //! This function works the same as Advect() for the scalar grid, but only
+    //! updates the data points inside the tiles listed in \p tiles. Each tile
+    //! starts from the given data point index and spans \p tileSize data
+    //! points (clipped by the data size of \p output). The other data points of
+    //! \p output are left untouched. The default implementation ignores the
+    //! tiles and advects the entire grid.
+    //!
+    //! \param input Input scalar grid.
+    //! \param flow Vector field that advects the input field.
+    //! \param dt Time-step for the advection.
+    //! \param tiles First data point indices of the tiles to update.
+    //! \param tileSize Number of data points of a tile along each axis.
+    //! \param output Output scalar grid.
+    //! \param boundarySDF Boundary interface defined by signed-distance
+    //!     field.
+    //!
+    virtual void AdvectTiles(
+        const ScalarGrid3& input, const VectorField3& flow, double dt,
+        const ConstArrayView1<Vector3UZ>& tiles, const Vector3UZ& tileSize,
+        ScalarGrid3* output,
+        const ScalarField3& boundarySDF =
+            ConstantScalarField3(std::numeric_limits<double>::max()));
 };
 
 //! Shared pointer type for the 3-D advection solver.
@@ -119,6 +119,29 @@ class SemiLagrangian3 : public AdvectionSolver3
                 const ScalarField3& boundarySDF = ConstantScalarField3(
                     std::numeric_limits<double>::max())) final;
 
+    //!
+    //! \brief Computes semi-Lagrangian for given scalar grid only within the
+    //!        given tiles.
+    //!
+    //! Same as Advect() for the scalar grid, but only the data points inside
+    //! the tiles listed in \p tiles are back-traced. The other data points of
+    //! \p output are left untouched.
+    //!
+    //! \param input Input scalar grid.
+    //! \param flow Vector field that advects the input field.
+    //! \param dt Time-step for the advection.
+    //! \param tiles First data point indices of the tiles to update.
+    //! \param tileSize Number of data points of a tile along each axis.
+    //! \param output Output scalar grid.
+    //! \param boundarySDF Boundary interface defined by signed-distance
+    //!     field.
+    //!
+    void AdvectTiles(const ScalarGrid3& input, const VectorField3& flow,
+                     double dt, const ConstArrayView1<Vector3UZ>& tiles,
+                     const Vector3UZ& tileSize, ScalarGrid3* output,
+                     const ScalarField3& boundarySDF = ConstantScalarField3(
+                         std::numeric_limits<double>::max())) final;
+
  protected:
     //!
     //! \brief Returns spatial interpolation function object for given scalar
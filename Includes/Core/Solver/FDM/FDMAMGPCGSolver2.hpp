@@ -0,0 +1,94 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_FDM_AMGPCG_SOLVER2_HPP
+#define CUBBYFLOW_FDM_AMGPCG_SOLVER2_HPP
+
+#include <Core/Solver/FDM/FDMLinearSystemSolver2.hpp>
+#include <Core/Utils/AMG.hpp>
+
+namespace CubbyFlow
+{
+//!
+//! \brief 2-D finite difference-type linear system solver using algebraic
+//!        multigrid preconditioned conjugate gradient (AMGPCG).
+//!
+//! Unlike FDMMGPCGSolver2, this solver builds the multigrid hierarchy from the
+//! matrix entries (smoothed aggregation), so it can solve compressed linear
+//! systems. The hierarchy is reused as long as the sparsity pattern of the
+//! system does not change between the solves.
+//!
+class FDMAMGPCGSolver2 final : public FDMLinearSystemSolver2
+{
+ public:
+    //! Constructs the solver with given parameters.
+    FDMAMGPCGSolver2(unsigned int maxNumberOfIterations, double tolerance,
+                     const AMGParameters& params = AMGParameters{});
+
+    //! Solves the given linear system.
+    bool Solve(FDMLinearSystem2* system) override;
+
+    //! Solves the given compressed linear system.
+    bool SolveCompressed(FDMCompressedLinearSystem2* system) override;
+
+    //! Returns the max number of AMGPCG iterations.
+    [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
+
+    //! Returns the last number of AMGPCG iterations the solver made.
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+
+    //! Returns the max residual tolerance for the AMGPCG method.
+    [[nodiscard]] double GetTolerance() const;
+
+    //! Returns the last residual after the AMGPCG iterations.
+    [[nodiscard]] double GetLastResidual() const;
+
+    //! Returns the algebraic multigrid parameters.
+    [[nodiscard]] const AMGParameters& GetParams() const;
+
+    //! Returns the number of levels of the last multigrid hierarchy.
+    [[nodiscard]] size_t GetNumberOfLevels() const;
+
+    //! Returns true if the last solve reused the previous hierarchy.
+    [[nodiscard]] bool IsLastHierarchyReused() const;
+
+ private:
+    struct Preconditioner final
+    {
+        void Build(const MatrixCSRD& matrix, const AMGParameters& params);
+
+        void Solve(const VectorND& b, VectorND* x);
+
+        AMGHierarchy hierarchy;
+    };
+
+    void Compress(const FDMLinearSystem2& system);
+
+    VectorND m_r;
+    VectorND m_d;
+    VectorND m_q;
+    VectorND m_s;
+    Preconditioner m_precond;
+
+    // Compressed copy of the uncompressed system
+    FDMCompressedLinearSystem2 m_compSystem;
+
+    unsigned int m_maxNumberOfIterations;
+    unsigned int m_lastNumberOfIterations;
+    double m_tolerance;
+    double m_lastResidualNorm;
+    AMGParameters m_params;
+};
+
+//! Shared pointer type for the FDMAMGPCGSolver2.
+using FDMAMGPCGSolver2Ptr = std::shared_ptr<FDMAMGPCGSolver2>;
+}  // namespace CubbyFlow
+
+#endif
@@ -29,17 +29,20 @@ class FDMCGSolver3 final : public FDMLinearSystemSolver3
     //! Solves the given compressed linear system.
     bool SolveCompressed(FDMCompressedLinearSystem3* system) override;
 
+    //! Solves the given matrix-free linear system.
+    bool SolveMatrixFree(FDMMatrixFreeLinearSystem3* system) override;
+
     //! Returns the max number of Jacobi iterations.
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Jacobi iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Jacobi method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Jacobi iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
 
  private:
     void ClearUncompressedVectors();
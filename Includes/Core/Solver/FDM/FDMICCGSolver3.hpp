@@ -11,7 +11,6 @@
 #ifndef CUBBYFLOW_FDM_ICCG_SOLVER3_HPP
 #define CUBBYFLOW_FDM_ICCG_SOLVER3_HPP
 
-#include <Core/Array/ArrayView.hpp>
 #include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
 
 namespace CubbyFlow
@@ -32,34 +31,49 @@ class FDMICCGSolver3 final : public FDMLinearSystemSolver3
     //! Solves the given compressed linear system.
     bool SolveCompressed(FDMCompressedLinearSystem3* system) override;
 
+    //! Solves the given matrix-free linear system.
+    bool SolveMatrixFree(FDMMatrixFreeLinearSystem3* system) override;
+
     //! Returns the max number of Jacobi iterations.
     [[nodiscard]] unsigned int GetMaxNumberOfIterations() const;
 
     //! Returns the last number of Jacobi iterations the solver made.
-    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const override;
 
     //! Returns the max residual tolerance for the Jacobi method.
     [[nodiscard]] double GetTolerance() const;
 
     //! Returns the last residual after the Jacobi iterations.
-    [[nodiscard]] double GetLastResidual() const;
+    [[nodiscard]] double GetLastResidual() const override;
 
  private:
+    template <typename MatrixType>
     struct Preconditioner final
     {
-        void Build(const FDMMatrix3& matrix);
+        void Build(const MatrixType& matrix);
+
+        [[nodiscard]] bool IsBuiltFor(const MatrixType& matrix) const;
 
         void Solve(const FDMVector3& b, FDMVector3* x);
 
-        ConstArrayView3<FDMMatrixRow3> A;
+        // Returns the right, up, and front coefficients of the row.
+        [[nodiscard]] Vector3D Upper(size_t i, size_t j, size_t k) const;
+
+        const MatrixType* A = nullptr;
         FDMVector3 d;
         FDMVector3 y;
+
+        // Cached couplings of the marker rows with the right (bit 0), up
+        // (bit 1), and front (bit 2) neighbors.
+        Array3<char> couplings;
     };
 
     struct PreconditionerCompressed final
     {
         void Build(const MatrixCSRD& matrix);
 
+        [[nodiscard]] bool IsBuiltFor(const MatrixCSRD& matrix) const;
+
         void Solve(const VectorND& b, VectorND* x);
 
         const MatrixCSRD* A = nullptr;
@@ -75,7 +89,8 @@ class FDMICCGSolver3 final : public FDMLinearSystemSolver3
     FDMVector3 m_d;
     FDMVector3 m_q;
     FDMVector3 m_s;
-    Preconditioner m_precond;
+    Preconditioner<FDMMatrix3> m_precond;
+    Preconditioner<FDMMarkerMatrix3> m_precondMatrixFree;
 
     // Compressed vectors and preconditioner
     VectorND m_rComp;
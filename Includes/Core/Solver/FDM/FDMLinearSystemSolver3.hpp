@@ -46,6 +46,79 @@ class FDMLinearSystemSolver3
     {
         return false;
     }
+
+    //!
+    //! \brief Solves the given matrix-free linear system.
+    //!
+    //! The default implementation assembles the matrix and calls Solve(), so
+    //! that every solver accepts the matrix-free system, but without saving
+    //! any memory. Only FDMCGSolver3 and FDMICCGSolver3 override this function
+    //! to evaluate the matrix on the fly. The multigrid and fractional solvers
+    //! do not use this system.
+    //!
+    virtual bool SolveMatrixFree(FDMMatrixFreeLinearSystem3* system);
+
+    //! Returns the last number of iterations the solver made, or zero if the
+    //! solver does not track it.
+    [[nodiscard]] virtual unsigned int GetLastNumberOfIterations() const;
+
+    //! Returns the last residual after the iterations, or zero if the solver
+    //! does not track it.
+    [[nodiscard]] virtual double GetLastResidual() const;
+
+    //! Returns true if the solver starts from the current solution vector.
+    [[nodiscard]] bool GetUseInitialGuess() const;
+
+    //!
+    //! \brief Sets true if the solver should start from the current solution
+    //!        vector instead of zero.
+    //!
+    //! Iterative solvers converge in fewer iterations when the solution
+    //! vector already holds a good estimate, such as the solution of the
+    //! previous time step. Solvers that always start from the current
+    //! solution vector (e.g. Jacobi or Gauss-Seidel) ignore this flag.
+    //!
+    void SetUseInitialGuess(bool useInitialGuess);
+
+    //! Returns true if the solver may reuse the last preconditioner.
+    [[nodiscard]] bool GetReusePreconditioner() const;
+
+    //!
+    //! \brief Sets true if the solver may reuse the preconditioner built in
+    //!        the last solve.
+    //!
+    //! The preconditioner is only reused when the next solve is called with
+    //! the same matrix object. The caller is responsible for the matrix entries
+    //! being unchanged since the last solve.
+    //!
+    void SetReusePreconditioner(bool reusePreconditioner);
+
+    //! Returns true if the solver uses the sliced ELLPACK matrix.
+    [[nodiscard]] bool GetUseSlicedEllpack() const;
+
+    //!
+    //! \brief Sets true if the solver should use the sliced ELLPACK
+    //!        (SELL-C-sigma) copy of the compressed matrix for the
+    //!        matrix-vector multiplications.
+    //!
+    //! The copy costs an extra matrix of memory and a conversion per solve,
+    //! which pays off for large systems that need many iterations. Solvers
+    //! that do not support it ignore this flag.
+    //!
+    void SetUseSlicedEllpack(bool useSlicedEllpack);
+
+ protected:
+    //! Returns the sliced ELLPACK copy of \p matrix, which is rebuilt unless
+    //! the preconditioner can be reused for the same matrix.
+    const MatrixSELLD& GetSlicedEllpackMatrix(const MatrixCSRD& matrix);
+
+ private:
+    bool m_useInitialGuess = false;
+    bool m_reusePreconditioner = false;
+    bool m_useSlicedEllpack = false;
+
+    MatrixSELLD m_sellMatrix;
+    const MatrixCSRD* m_sellSource = nullptr;
 };
 
 //! Shared pointer type for the FDMLinearSystemSolver3.
@@ -69,7 +69,13 @@ class GridBlockedBoundaryConditionSolver3 final
                            const Vector3D& gridSpacing,
                            const Vector3D& gridOrigin) override;
 
+    //! Restores the collider SDF cache and the marker from \p checkpoint.
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
  private:
+    void UpdateMarker(const Vector3UZ& begin, const Vector3UZ& end);
+
     Array3<char> m_marker;
 };
 
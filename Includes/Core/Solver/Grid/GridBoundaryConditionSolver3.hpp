@@ -14,6 +14,7 @@
 #include <Core/Field/ScalarField.hpp>
 #include <Core/Geometry/Collider.hpp>
 #include <Core/Grid/FaceCenteredGrid.hpp>
+#include <Core/Utils/Checkpoint.hpp>
 
 namespace CubbyFlow
 {
@@ -89,12 +90,33 @@ class GridBoundaryConditionSolver3
     //! Returns the velocity field of the collider.
     [[nodiscard]] virtual VectorField3Ptr GetColliderVelocityField() const = 0;
 
+    //! Saves the internal cache into \p checkpoint.
+    void SaveCheckpoint(const std::string& prefix,
+                        Checkpoint* checkpoint) const;
+
+    //!
+    //! \brief Restores the internal cache saved with given \p prefix.
+    //!
+    //! UpdateCollider() should be called with the restored collider and the
+    //! same grid before restoring, so that the cache matches the collider.
+    //!
+    void LoadCheckpoint(const std::string& prefix,
+                        const Checkpoint& checkpoint);
+
  protected:
     //! Invoked when a new collider is set.
     virtual void OnColliderUpdated(const Vector3UZ& gridSize,
                                    const Vector3D& gridSpacing,
                                    const Vector3D& gridOrigin) = 0;
 
+    //! Called when the internal cache is saved into \p checkpoint.
+    virtual void OnSaveCheckpoint(const std::string& prefix,
+                                  Checkpoint* checkpoint) const;
+
+    //! Called when the internal cache is restored from \p checkpoint.
+    virtual void OnLoadCheckpoint(const std::string& prefix,
+                                  const Checkpoint& checkpoint);
+
     //! Returns the size of the velocity grid to be constrained.
     [[nodiscard]] const Vector3UZ& GetGridSize() const;
 
@@ -12,6 +12,7 @@
 #define CUBBYFLOW_GRID_FLUID_SOLVER3_HPP
 
 #include <Core/Animation/PhysicsAnimation.hpp>
+#include <Core/Array/ArrayUtils.hpp>
 #include <Core/Emitter/GridEmitter3.hpp>
 #include <Core/Geometry/Collider.hpp>
 #include <Core/Grid/GridSystemData.hpp>
@@ -19,6 +20,10 @@
 #include <Core/Solver/Grid/GridDiffusionSolver3.hpp>
 #include <Core/Solver/Grid/GridPressureSolver3.hpp>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace CubbyFlow
 {
 //!
@@ -98,6 +103,20 @@ class GridFluidSolver3 : public PhysicsAnimation
     //! Sets whether the solver should use compressed linear system.
     void SetUseCompressedLinearSystem(bool isOn);
 
+    //! Returns true if the advectable fields are advected concurrently.
+    [[nodiscard]] bool GetUseConcurrentAdvection() const;
+
+    //!
+    //! \brief Sets whether the advectable fields are advected concurrently.
+    //!
+    //! When on, the advectable scalar and vector fields other than the
+    //! velocity are advected at the same time. The advection solver's
+    //! Advect() and the ComputeScalarAdvection() override must then be safe
+    //! to call from several threads at once, which holds for the built-in
+    //! advection solvers. Off by default.
+    //!
+    void SetUseConcurrentAdvection(bool isOn);
+
     //! Returns the advection solver instance.
     [[nodiscard]] const AdvectionSolver3Ptr& GetAdvectionSolver() const;
 
@@ -218,6 +237,12 @@ class GridFluidSolver3 : public PhysicsAnimation
     [[nodiscard]] unsigned int GetNumberOfSubTimeSteps(
         double timeIntervalInSeconds) const override;
 
+    //! Saves the solver state into \p checkpoint.
+    void OnSaveCheckpoint(Checkpoint* checkpoint) const override;
+
+    //! Restores the solver state from \p checkpoint.
+    void OnLoadCheckpoint(const Checkpoint& checkpoint) override;
+
     //! Called at the beginning of a time-step.
     virtual void OnBeginAdvanceTimeStep(double timeIntervalInSeconds);
 
@@ -243,6 +268,19 @@ class GridFluidSolver3 : public PhysicsAnimation
     //! Computes the advection term using the advection solver.
     virtual void ComputeAdvection(double timeIntervalInSeconds);
 
+    //!
+    //! \brief Advects the given advectable scalar data.
+    //!
+    //! This function is called by ComputeAdvection for each advectable scalar
+    //! data. The \p output grid holds a copy of \p input when called. By
+    //! default, it advects the entire grid using the advection solver. It is
+    //! called concurrently for different data if SetUseConcurrentAdvection()
+    //! is on.
+    //!
+    virtual void ComputeScalarAdvection(const ScalarGrid3& input,
+                                        double timeIntervalInSeconds,
+                                        ScalarGrid3* output);
+
     //!
     //! \brief Returns the signed-distance representation of the fluid.
     //!
@@ -280,6 +318,18 @@ class GridFluidSolver3 : public PhysicsAnimation
     //! Returns the velocity field of the collider.
     [[nodiscard]] VectorField3Ptr GetColliderVelocityField() const;
 
+    //!
+    //! \brief Copies \p grid into \p copy.
+    //!
+    //! The copy is cloned from \p grid only when it is empty or of another
+    //! grid type. Otherwise its storage is reused, so the copies taken every
+    //! step do not allocate once the resolution has settled.
+    //!
+    static void CopyGrid(const ScalarGrid3& grid, ScalarGrid3Ptr* copy);
+
+    //! Copies \p grid into \p copy, reusing the storage of \p copy.
+    static void CopyGrid(const VectorGrid3& grid, VectorGrid3Ptr* copy);
+
  private:
     void BeginAdvanceTimeStep(double timeIntervalInSeconds);
 
@@ -289,6 +339,23 @@ class GridFluidSolver3 : public PhysicsAnimation
 
     void UpdateEmitter(double timeIntervalInSeconds) const;
 
+    // Scratch memory of one collider extrapolation
+    struct ExtrapolationScratch
+    {
+        Array3<char> marker;
+        ExtrapolationBuffers<3> buffers;
+    };
+
+    template <typename T>
+    void ExtrapolateDataIntoCollider(ArrayView3<T> data,
+                                     const GridDataPositionFunc<3>& pos);
+
+    [[nodiscard]] std::unique_ptr<ExtrapolationScratch>
+    AcquireExtrapolationScratch();
+
+    void ReleaseExtrapolationScratch(
+        std::unique_ptr<ExtrapolationScratch> scratch);
+
     GridSystemData3Ptr m_grids;
     Collider3Ptr m_collider;
     GridEmitter3Ptr m_emitter;
@@ -298,11 +365,24 @@ class GridFluidSolver3 : public PhysicsAnimation
     GridPressureSolver3Ptr m_pressureSolver;
     GridBoundaryConditionSolver3Ptr m_boundaryConditionSolver;
 
+    // The fields are extrapolated into the collider concurrently, so each
+    // extrapolation takes its own scratch from this pool. The pool grows to
+    // the largest number of concurrent extrapolations and is reused after.
+    std::mutex m_extrapolationScratchMutex;
+    std::vector<std::unique_ptr<ExtrapolationScratch>> m_extrapolationScratch;
+
+    // Copies of the fields taken before they are overwritten, kept across
+    // steps so that their storage is reused.
+    FaceCenteredGrid3 m_velocity0;
+    std::vector<ScalarGrid3Ptr> m_scalarData0;
+    std::vector<VectorGrid3Ptr> m_vectorData0;
+
     Vector3D m_gravity = Vector3D{ 0.0, -9.8, 0.0 };
     double m_viscosityCoefficient = 0.0;
     double m_maxCFL = 5.0;
     int m_closedDomainBoundaryFlag = DIRECTION_ALL;
     bool m_useCompressedLinearSys = false;
+    bool m_useConcurrentAdvection = false;
 };
 
 //! Shared pointer type for the GridFluidSolver3.
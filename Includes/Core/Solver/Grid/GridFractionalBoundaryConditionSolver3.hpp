@@ -11,7 +11,9 @@
 #ifndef CUBBYFLOW_GRID_FRACTIONAL_BOUNDARY_CONDITION_SOLVER3_HPP
 #define CUBBYFLOW_GRID_FRACTIONAL_BOUNDARY_CONDITION_SOLVER3_HPP
 
+#include <Core/Array/ArrayUtils.hpp>
 #include <Core/Field/CustomVectorField.hpp>
+#include <Core/Geometry/ImplicitSurface.hpp>
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Grid/GridBoundaryConditionSolver3.hpp>
 
@@ -25,6 +27,13 @@ namespace CubbyFlow
 //! should pair up with GridFractionalSinglePhasePressureSolver3 to provide
 //! sub-grid resolution velocity projection.
 //!
+//! The collider SDF is re-rasterized only when the collider changes. If the
+//! collider has only been translated or rotated, the cells inside the box swept
+//! by the collider (plus a narrow band) are updated while the rest of the grid
+//! is kept. For RigidBodyCollider3, the swept cells are sampled from an SDF
+//! cached in the collider's local frame, which is rebuilt only when the shape
+//! revision of the collider changes.
+//!
 class GridFractionalBoundaryConditionSolver3
     : public GridBoundaryConditionSolver3
 {
@@ -67,15 +76,77 @@ class GridFractionalBoundaryConditionSolver3
     //! Returns the velocity field of the collider.
     [[nodiscard]] VectorField3Ptr GetColliderVelocityField() const override;
 
+    //! Returns true if the collider SDF is updated incrementally.
+    [[nodiscard]] bool GetUseIncrementalUpdate() const;
+
+    //!
+    //! \brief Sets true to update the collider SDF incrementally.
+    //!
+    //! When enabled, the collider SDF is not re-rasterized if the collider
+    //! revisions and the grid are unchanged, and only the swept region is
+    //! re-rasterized if the collider has only moved. Outside of the updated
+    //! region, the sign of the SDF stays exact while the far-field magnitude
+    //! may be stale. Changes of the surface geometry are only detected through
+    //! the shape revision, so enable it only if every in-place edit of the
+    //! collider surface is followed by Collider::MarkShapeChanged. Disabled by
+    //! default, which rebuilds the whole SDF on every update.
+    //!
+    void SetUseIncrementalUpdate(bool isOn);
+
  protected:
     //! Invoked when a new collider is set.
     void OnColliderUpdated(const Vector3UZ& gridSize,
                            const Vector3D& gridSpacing,
                            const Vector3D& gridOrigin) override;
 
+    //! Saves the collider SDF cache into \p checkpoint.
+    void OnSaveCheckpoint(const std::string& prefix,
+                          Checkpoint* checkpoint) const override;
+
+    //! Restores the collider SDF cache from \p checkpoint.
+    void OnLoadCheckpoint(const std::string& prefix,
+                          const Checkpoint& checkpoint) override;
+
+    //! Returns the first index of the region updated by the last update.
+    [[nodiscard]] const Vector3UZ& GetUpdatedRegionBegin() const;
+
+    //! Returns the end index of the region updated by the last update.
+    [[nodiscard]] const Vector3UZ& GetUpdatedRegionEnd() const;
+
  private:
+    [[nodiscard]] bool IsGridChanged(const Vector3UZ& gridSize,
+                                     const Vector3D& gridSpacing,
+                                     const Vector3D& gridOrigin) const;
+
+    void RebuildColliderSDF(const ImplicitSurface3Ptr& implicitSurface);
+
+    void UpdateSweptRegion(const ImplicitSurface3Ptr& implicitSurface,
+                           const BoundingBox3D& sweptBox);
+
+    void BuildLocalColliderSDF(const ImplicitSurface3Ptr& implicitSurface);
+
     CellCenteredScalarGrid3Ptr m_colliderSDF;
     CustomVectorField3Ptr m_colliderVel;
+
+    bool m_useIncrementalUpdate = false;
+    bool m_isColliderSDFValid = false;
+    std::weak_ptr<Collider3> m_lastCollider;
+    size_t m_lastShapeRevision = 0;
+    size_t m_lastTransformRevision = 0;
+    BoundingBox3D m_lastColliderBox;
+    Vector3UZ m_updatedRegionBegin;
+    Vector3UZ m_updatedRegionEnd;
+
+    CellCenteredScalarGrid3 m_localColliderSDF;
+    bool m_isLocalColliderSDFValid = false;
+
+    Array3<double> m_uTemp;
+    Array3<double> m_vTemp;
+    Array3<double> m_wTemp;
+    Array3<char> m_uMarker;
+    Array3<char> m_vMarker;
+    Array3<char> m_wMarker;
+    ExtrapolationBuffers<3> m_extrapolationBuffers;
 };
 
 //! Shared pointer type for the GridFractionalBoundaryConditionSolver3.
@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_FRACTIONAL_SINGLE_PHASE_PRESSURE_SOLVER3_HPP
 #define CUBBYFLOW_FRACTIONAL_SINGLE_PHASE_PRESSURE_SOLVER3_HPP
 
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3.hpp>
 #include <Core/FDM/FDMMGLinearSystem3.hpp>
 #include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
 #include <Core/Solver/FDM/FDMMGSolver3.hpp>
@@ -123,12 +124,32 @@ class GridFractionalSinglePhasePressureSolver3 : public GridPressureSolver3
     //! Returns the pressure field.
     [[nodiscard]] const FDMVector3& GetPressure() const;
 
+    //! Returns true if the solver is warm started from the last pressure.
+    [[nodiscard]] bool GetUseWarmStart() const;
+
+    //!
+    //! \brief Sets true to warm start the solver from the last pressure.
+    //!
+    //! When enabled, the pressure of the last solve is used as the initial
+    //! guess of the linear system solver. Cells that were not inside the fluid
+    //! in the last solve start from zero.
+    //!
+    void SetUseWarmStart(bool useWarmStart);
+
+    //! Returns the number of iterations of the last linear system solve.
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+
+    //! Returns the residual of the last linear system solve.
+    [[nodiscard]] double GetLastResidual() const;
+
  private:
     void BuildWeights(const FaceCenteredGrid3& input,
                       const ScalarField3& boundarySDF,
                       const VectorField3& boundaryVelocity,
                       const ScalarField3& fluidSDF);
 
+    void BuildInitialGuess(bool useCompressed);
+
     void DecompressSolution();
 
     virtual void BuildSystem(const FaceCenteredGrid3& input,
@@ -139,6 +160,7 @@ class GridFractionalSinglePhasePressureSolver3 : public GridPressureSolver3
 
     FDMLinearSystem3 m_system;
     FDMCompressedLinearSystem3 m_compSystem;
+    FDMCompressedLinearSystemBuilder3 m_compSystemBuilder;
     FDMLinearSystemSolver3Ptr m_systemSolver;
 
     FDMMGLinearSystem3 m_mgSystem;
@@ -150,6 +172,11 @@ class GridFractionalSinglePhasePressureSolver3 : public GridPressureSolver3
     std::vector<Array3<double>> m_fluidSDF;
 
     std::function<Vector3D(const Vector3D&)> m_boundaryVel;
+
+    Array3<double> m_prevFluidSDF;
+    bool m_useWarmStart = false;
+    unsigned int m_lastNumberOfIterations = 0;
+    double m_lastResidual = 0.0;
 };
 
 //! Shared pointer type for the GridFractionalSinglePhasePressureSolver3.
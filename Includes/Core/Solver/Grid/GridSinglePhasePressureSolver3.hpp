@@ -11,6 +11,7 @@
 #ifndef CUBBYFLOW_SINGLE_PHASE_PRESSURE_SOLVER3_HPP
 #define CUBBYFLOW_SINGLE_PHASE_PRESSURE_SOLVER3_HPP
 
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3.hpp>
 #include <Core/FDM/FDMMGLinearSystem3.hpp>
 #include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
 #include <Core/Solver/FDM/FDMMGSolver3.hpp>
@@ -113,14 +114,73 @@ class GridSinglePhasePressureSolver3 : public GridPressureSolver3
     //! Returns the pressure field.
     [[nodiscard]] const FDMVector3& GetPressure() const;
 
+    //! Returns true if the solver is warm started from the last pressure.
+    [[nodiscard]] bool GetUseWarmStart() const;
+
+    //!
+    //! \brief Sets true to warm start the solver from the last pressure.
+    //!
+    //! When enabled, the pressure of the last solve is used as the initial
+    //! guess of the linear system solver. Cells that were not fluid in the last
+    //! solve start from zero. In addition, if the markers and the grid did not
+    //! change since the last solve, the system matrix and the preconditioner
+    //! of the linear system solver are reused and only the right-hand side is
+    //! rebuilt.
+    //!
+    void SetUseWarmStart(bool useWarmStart);
+
+    //! Returns true if the solver uses the matrix-free linear system.
+    [[nodiscard]] bool GetUseMatrixFree() const;
+
+    //!
+    //! \brief Sets true to solve the matrix-free linear system.
+    //!
+    //! When enabled, the system matrix is not assembled. Instead, the linear
+    //! system solver evaluates the coefficients from the cell markers, which
+    //! takes a byte per cell instead of four doubles. Only FDMCGSolver3 and
+    //! FDMICCGSolver3 solve it without assembling the matrix; the other flat
+    //! solvers assemble it internally. This flag is ignored when the
+    //! compressed system or a multigrid solver is used.
+    //!
+    void SetUseMatrixFree(bool useMatrixFree);
+
+    //! Returns the number of iterations of the last linear system solve.
+    [[nodiscard]] unsigned int GetLastNumberOfIterations() const;
+
+    //! Returns the residual of the last linear system solve.
+    [[nodiscard]] double GetLastResidual() const;
+
+    //! Returns true if the last solve reused the previous system matrix.
+    [[nodiscard]] bool IsLastSystemReused() const;
+
  private:
     void BuildMarkers(
         const Vector3UZ& size,
         const std::function<Vector3D(size_t, size_t, size_t)>& pos,
         const ScalarField3& boundarySDF, const ScalarField3& fluidSDF);
 
+    // Storage of the matrix built by a solve.
+    enum class SystemLayout
+    {
+        None,
+        Uncompressed,
+        Compressed,
+        MatrixFree
+    };
+
+    [[nodiscard]] SystemLayout GetSystemLayout(bool useCompressed) const;
+
+    [[nodiscard]] bool IsSystemReusable(const FaceCenteredGrid3& input,
+                                        bool useCompressed) const;
+
+    void BuildInitialGuess(bool useCompressed);
+
     void DecompressSolution();
 
+    [[nodiscard]] bool IsMatrixFree(bool useCompressed) const;
+
+    void SolveMatrixFree(const FaceCenteredGrid3& input);
+
     virtual void BuildSystem(const FaceCenteredGrid3& input,
                              bool useCompressed);
 
@@ -129,12 +189,27 @@ class GridSinglePhasePressureSolver3 : public GridPressureSolver3
 
     FDMLinearSystem3 m_system;
     FDMCompressedLinearSystem3 m_compSystem;
+    FDMCompressedLinearSystemBuilder3 m_compSystemBuilder;
+    FDMMatrixFreeLinearSystem3 m_matrixFreeSystem;
     FDMLinearSystemSolver3Ptr m_systemSolver;
 
     FDMMGLinearSystem3 m_mgSystem;
     FDMMGSolver3Ptr m_mgSystemSolver;
 
     std::vector<Array3<char>> m_markers;
+
+    Array3<char> m_prevMarkers;
+
+    // What the kept matrix was built from. It is reused only when the next
+    // solve has the same layout, grid spacing and markers.
+    SystemLayout m_systemLayout = SystemLayout::None;
+    Array3<char> m_systemMarkers;
+    Vector3D m_systemGridSpacing;
+    bool m_useWarmStart = false;
+    bool m_useMatrixFree = false;
+    bool m_isLastSystemReused = false;
+    unsigned int m_lastNumberOfIterations = 0;
+    double m_lastResidual = 0.0;
 };
 
 //! Shared pointer type for the GridSinglePhasePressureSolver3.
@@ -165,6 +165,58 @@ class GridSmokeSolver3 : public GridFluidSolver3
     //!
     void SetTemperatureDecayFactor(double newValue);
 
+    //! Returns true if the solver only updates the active region.
+    [[nodiscard]] bool GetUseActiveRegion() const;
+
+    //!
+    //! \brief Sets true to update the smoke only within the active region.
+    //!
+    //! The domain is divided into tiles of 8x8x8 cells. At the beginning of
+    //! each time-step, a tile becomes active if any of its cells has smoke
+    //! density or temperature whose magnitude is above the active region
+    //! threshold. Since the emitters are applied before that, the emitted
+    //! regions are always active. The active tiles are then dilated so that
+    //! the smoke cannot be advected out of them within a sub-step bounded by
+    //! the max CFL. Advection, diffusion, decay and buoyancy of the smoke only
+    //! run on the active tiles while the velocity field is still advected over
+    //! the entire domain. The ambient temperature of the buoyancy force is
+    //! still averaged over the entire domain, so the buoyancy force is the
+    //! same as without the active region.
+    //!
+    //! \param isOn True to enable the active region tracking.
+    //!
+    void SetUseActiveRegion(bool isOn);
+
+    //! Returns the threshold of smoke density and temperature to activate
+    //! the tiles.
+    [[nodiscard]] double GetActiveRegionThreshold() const;
+
+    //! Sets the threshold of smoke density and temperature to activate the
+    //! tiles.
+    void SetActiveRegionThreshold(double newValue);
+
+    //! Returns true if the pressure is only solved within the active region.
+    [[nodiscard]] bool GetUseActiveRegionForPressure() const;
+
+    //!
+    //! \brief Sets true to solve the pressure only within the active region.
+    //!
+    //! When both this and the active region tracking are enabled, the
+    //! bounding box of the active tiles is used as the fluid region for the
+    //! pressure and viscosity solvers. The faces of the bounding box are then
+    //! treated as open boundaries, so enable this only when the smoke stays
+    //! away from the closed domain boundaries.
+    //!
+    //! \param isOn True to restrict the pressure solve.
+    //!
+    void SetUseActiveRegionForPressure(bool isOn);
+
+    //! Returns the number of active tiles of the last time-step.
+    [[nodiscard]] size_t GetNumberOfActiveTiles() const;
+
+    //! Returns the bounding box of the active tiles of the last time-step.
+    [[nodiscard]] BoundingBox3D GetActiveRegion() const;
+
     //! Returns smoke density field.
     [[nodiscard]] ScalarGrid3Ptr GetSmokeDensity() const;
 
@@ -175,15 +227,31 @@ class GridSmokeSolver3 : public GridFluidSolver3
     [[nodiscard]] static Builder GetBuilder();
 
  protected:
+    void OnBeginAdvanceTimeStep(double timeIntervalInSeconds) override;
+
     void OnEndAdvanceTimeStep(double timeIntervalInSeconds) override;
 
     void ComputeExternalForces(double timeIntervalInSeconds) override;
 
+    void ComputeScalarAdvection(const ScalarGrid3& input,
+                                double timeIntervalInSeconds,
+                                ScalarGrid3* output) override;
+
+    [[nodiscard]] ScalarField3Ptr GetFluidSDF() const override;
+
  private:
     void ComputeDiffusion(double timeIntervalInSeconds);
 
     void ComputeBuoyancyForce(double timeIntervalInSeconds);
 
+    void UpdateActiveRegion();
+
+    [[nodiscard]] ScalarField3Ptr GetActiveRegionSDF() const;
+
+    template <typename Callback>
+    void ParallelForEachActiveIndex(const Vector3UZ& size,
+                                    const Callback& func) const;
+
     size_t m_smokeDensityDataID = 0;
     size_t m_temperatureDataID = 0;
     double m_smokeDiffusionCoefficient = 0.0;
@@ -192,6 +260,16 @@ class GridSmokeSolver3 : public GridFluidSolver3
     double m_buoyancyTemperatureFactor = 5.0;
     double m_smokeDecayFactor = 0.001;
     double m_temperatureDecayFactor = 0.001;
+    bool m_useActiveRegion = false;
+    bool m_useActiveRegionForPressure = false;
+    double m_activeRegionThreshold = 1e-3;
+    Array3<char> m_activeTileMarkers;
+    Array1<Vector3UZ> m_activeTiles;
+    Vector3UZ m_activeRegionLower;
+    Vector3UZ m_activeRegionUpper;
+
+    // Input of the diffusion solves, reused across steps.
+    ScalarGrid3Ptr m_diffusionInput;
 };
 
 //! Shared pointer type for the GridSmokeSolver3.
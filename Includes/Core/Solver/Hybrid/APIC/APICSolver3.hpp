@@ -61,6 +61,12 @@ class APICSolver3 : public PICSolver3
     //! Transfers velocity field from grids to particles.
     void TransferFromGridsToParticles() override;
 
+    //! Saves the solver state into \p checkpoint.
+    void OnSaveCheckpoint(Checkpoint* checkpoint) const override;
+
+    //! Restores the solver state from \p checkpoint.
+    void OnLoadCheckpoint(const Checkpoint& checkpoint) override;
+
  private:
     Array1<Vector3D> m_cX;
     Array1<Vector3D> m_cY;
@@ -78,6 +78,12 @@ class FLIPSolver3 : public PICSolver3
     //! Transfers velocity field from grids to particles.
     void TransferFromGridsToParticles() override;
 
+    //! Saves the solver state into \p checkpoint.
+    void OnSaveCheckpoint(Checkpoint* checkpoint) const override;
+
+    //! Restores the solver state from \p checkpoint.
+    void OnLoadCheckpoint(const Checkpoint& checkpoint) override;
+
  private:
     double m_picBlendingFactor = 0.0;
     Array3<double> m_uDelta;
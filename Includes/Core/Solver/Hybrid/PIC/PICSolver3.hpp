@@ -14,6 +14,7 @@
 #include <Core/Emitter/ParticleEmitter3.hpp>
 #include <Core/Particle/ParticleSystemData.hpp>
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
+#include <Core/Utils/ScratchArena.hpp>
 
 namespace CubbyFlow
 {
@@ -66,6 +67,9 @@ class PICSolver3 : public GridFluidSolver3
     //! Sets the particle emitter.
     void SetParticleEmitter(const ParticleEmitter3Ptr& newEmitter);
 
+    //! Returns the scratch arena used for the per-step temporaries.
+    [[nodiscard]] const ScratchArena& GetScratchArena() const;
+
     //! Returns builder fox PICSolver3.
     [[nodiscard]] static Builder GetBuilder();
 
@@ -91,9 +95,17 @@ class PICSolver3 : public GridFluidSolver3
     //! Moves particles.
     virtual void MoveParticles(double timeIntervalInSeconds);
 
+    //! Saves the solver state into \p checkpoint.
+    void OnSaveCheckpoint(Checkpoint* checkpoint) const override;
+
+    //! Restores the solver state from \p checkpoint.
+    void OnLoadCheckpoint(const Checkpoint& checkpoint) override;
+
     Array3<char> m_uMarkers;
     Array3<char> m_vMarkers;
     Array3<char> m_wMarkers;
+    ScratchArena m_scratchArena;
+    ExtrapolationBuffers<3> m_extrapolationBuffers;
 
  private:
     void ExtrapolateVelocityToAir();
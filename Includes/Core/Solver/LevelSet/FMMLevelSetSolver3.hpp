@@ -12,6 +12,9 @@
 #define CUBBYFLOW_FMM_LEVEL_SET_SOLVER3_HPP
 
 #include <Core/Solver/LevelSet/LevelSetSolver3.hpp>
+#include <Core/Utils/ScratchArena.hpp>
+
+#include <vector>
 
 namespace CubbyFlow
 {
@@ -84,6 +87,9 @@ class FMMLevelSetSolver3 final : public LevelSetSolver3
                      const ConstArrayView3<double>& sdf,
                      const Vector3D& gridSpacing, double maxDistance,
                      ArrayView3<double> output);
+
+    ScratchArena m_scratchArena;
+    std::vector<Vector3UZ> m_trial;
 };
 
 //! Shared pointer type for the FMMLevelSetSolver3.
@@ -12,6 +12,7 @@
 #define CUBBYFLOW_ITERATIVE_LEVEL_SET_SOLVER3_HPP
 
 #include <Core/Solver/LevelSet/LevelSetSolver3.hpp>
+#include <Core/Utils/ScratchArena.hpp>
 
 namespace CubbyFlow
 {
@@ -23,8 +24,14 @@ namespace CubbyFlow
 //! the inheriting classes must provide a way to compute the derivatives for
 //! given grid points.
 //!
+//! When the narrow band mode is enabled, only the cells close to the interface
+//! are updated so that the cost scales with the area of the interface rather
+//! than the volume of the grid.
+//!
 //! \see Osher, Stanley, and Ronald Fedkiw. Level set methods and dynamic
 //!     implicit surfaces. Vol. 153. Springer Science & Business Media, 2006.
+//! \see Peng, Danping, et al. "A PDE-based fast local level set method."
+//!     Journal of computational physics 155.2 (1999): 410-438.
 //!
 class IterativeLevelSetSolver3 : public LevelSetSolver3
 {
@@ -106,6 +113,21 @@ class IterativeLevelSetSolver3 : public LevelSetSolver3
     //!
     void SetMaxCFL(double newMaxCFL);
 
+    //! Returns true if the solver only updates the narrow band.
+    [[nodiscard]] bool GetUseNarrowBand() const;
+
+    //!
+    //! \brief Sets true to update only the narrow band around the interface.
+    //!
+    //! In the narrow band mode, Reinitialize updates the cells within
+    //! \p maxDistance of the interface (measured in cells) and clamps the
+    //! others to the band width with the same sign. Extrapolate updates the
+    //! cells whose reference SDF is in [0, band width] and keeps the input
+    //! values for the others. The band width is \p maxDistance rounded up to
+    //! the smallest grid spacing plus one cell. It is off by default.
+    //!
+    void SetUseNarrowBand(bool isOn);
+
  protected:
     //! Computes the derivatives for given grid point.
     virtual void GetDerivatives(ConstArrayView3<double> grid,
@@ -120,9 +142,36 @@ class IterativeLevelSetSolver3 : public LevelSetSolver3
                      const Vector3D& gridSpacing, double maxDistance,
                      ArrayView3<double> output);
 
+    void ReinitializeNarrowBand(const ConstArrayView3<double>& inputSDF,
+                                const Vector3D& gridSpacing,
+                                double maxDistance,
+                                ArrayView3<double> outputSDF);
+
+    void ExtrapolateNarrowBand(const ConstArrayView3<double>& sdf,
+                               const Vector3D& gridSpacing, double maxDistance,
+                               ArrayView3<double> output);
+
+    void DilateBandMarkers(size_t axis, size_t radius);
+
+    void CollectBand();
+
+    [[nodiscard]] double ReinitializeStep(const ConstArrayView3<double>& sdf,
+                                          const Vector3D& gridSpacing,
+                                          double dtau, size_t i, size_t j,
+                                          size_t k) const;
+
+    [[nodiscard]] double ExtrapolateStep(const ConstArrayView3<double>& field,
+                                         const ConstArrayView3<double>& sdf,
+                                         const Vector3D& gridSpacing,
+                                         double dtau, size_t i, size_t j,
+                                         size_t k) const;
+
     [[nodiscard]] static unsigned int DistanceToNumberOfIterations(
         double distance, double dtau);
 
+    [[nodiscard]] static size_t NumberOfBandLayers(double maxDistance,
+                                                   const Vector3D& gridSpacing);
+
     [[nodiscard]] static double Sign(const ConstArrayView3<double>& sdf,
                                      const Vector3D& gridSpacing, size_t i,
                                      size_t j, size_t k);
@@ -130,7 +179,16 @@ class IterativeLevelSetSolver3 : public LevelSetSolver3
     [[nodiscard]] double PseudoTimeStep(const ConstArrayView3<double>& sdf,
                                         const Vector3D& gridSpacing) const;
 
+    [[nodiscard]] double PseudoTimeStep(double maxS,
+                                        const Vector3D& gridSpacing) const;
+
     double m_maxCFL = 0.5;
+    bool m_useNarrowBand = false;
+    Array1<Vector3UZ> m_band;
+    Array1<double> m_bandValues;
+    Array1<size_t> m_bandOffsets;
+    Array3<char> m_bandMarkers;
+    ScratchArena m_scratchArena;
 };
 
 using IterativeLevelSetSolver3Ptr = std::shared_ptr<IterativeLevelSetSolver3>;
@@ -12,6 +12,7 @@
 #define CUBBYFLOW_LEVEL_SET_LIQUID_SOLVER3_HPP
 
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
+#include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
 #include <Core/Solver/LevelSet/LevelSetSolver3.hpp>
 
 namespace CubbyFlow
@@ -112,6 +113,12 @@ class LevelSetLiquidSolver3 : public GridFluidSolver3
     //!
     [[nodiscard]] ScalarField3Ptr GetFluidSDF() const override;
 
+    //! Saves the solver state into \p checkpoint.
+    void OnSaveCheckpoint(Checkpoint* checkpoint) const override;
+
+    //! Restores the solver state from \p checkpoint.
+    void OnLoadCheckpoint(const Checkpoint& checkpoint) override;
+
  private:
     void Reinitialize(double currentCFL);
 
@@ -124,6 +131,10 @@ class LevelSetLiquidSolver3 : public GridFluidSolver3
     double m_minReinitializeDistance = 10.0;
     bool m_isGlobalCompensationEnabled = false;
     double m_lastKnownVolume = 0.0;
+
+    // Reused across steps so that they do not allocate.
+    ScalarGrid3Ptr m_signedDistanceField0;
+    FMMLevelSetSolver3 m_velocityExtrapolator;
 };
 
 //! Shared pointer type for the LevelSetLiquidSolver3.
@@ -13,6 +13,7 @@
 
 #include <Core/Particle/SPHSystemData.hpp>
 #include <Core/Solver/Particle/ParticleSystemSolver3.hpp>
+#include <Core/Utils/ScratchArena.hpp>
 
 namespace CubbyFlow
 {
@@ -132,6 +133,9 @@ class SPHSolver3 : public ParticleSystemSolver3
     //! Returns the SPH system data.
     [[nodiscard]] SPHSystemData3Ptr GetSPHSystemData() const;
 
+    //! Returns the scratch arena used for the per-step temporaries.
+    [[nodiscard]] const ScratchArena& GetScratchArena() const;
+
     //! Returns builder fox SPHSolver3.
     [[nodiscard]] static Builder GetBuilder();
 
@@ -173,6 +177,8 @@ class SPHSolver3 : public ParticleSystemSolver3
     //! Computes pseudo viscosity.
     void ComputePseudoViscosity(double timeStepInSeconds);
 
+    ScratchArena m_scratchArena;
+
  private:
     //! Exponent component of equation-of-state (or Tait's equation).
     double m_eosExponent = 7.0;
@@ -0,0 +1,126 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_ALGEBRAIC_MULTI_GRID_HPP
+#define CUBBYFLOW_ALGEBRAIC_MULTI_GRID_HPP
+
+#include <Core/Matrix/Matrix.hpp>
+#include <Core/Matrix/MatrixCSR.hpp>
+
+#include <vector>
+
+namespace CubbyFlow
+{
+//! Algebraic multi-grid input parameter set.
+struct AMGParameters
+{
+    //! Max number of multi-grid levels including the finest one.
+    size_t maxNumberOfLevels = 10;
+
+    //! Coarsening stops when a level has fewer rows than this.
+    size_t coarsestSize = 64;
+
+    //! Threshold for the strength-of-connection test used for aggregation.
+    double strengthThreshold = 0.08;
+
+    //! Damping factor (scaled by the inverse spectral radius estimate) used
+    //! to smooth the tentative prolongation operator.
+    double prolongationDamping = 4.0 / 3.0;
+
+    //! Weight of the damped Jacobi smoother.
+    double jacobiWeight = 2.0 / 3.0;
+
+    //! Number of smoothing iterations before the coarse-grid correction.
+    unsigned int numberOfPreSmoothingIter = 1;
+
+    //! Number of smoothing iterations after the coarse-grid correction.
+    unsigned int numberOfPostSmoothingIter = 1;
+
+    //! Number of symmetric Gauss-Seidel iterations at the coarsest level.
+    unsigned int numberOfCoarsestIter = 20;
+};
+
+//!
+//! \brief Smoothed aggregation algebraic multi-grid hierarchy.
+//!
+//! This class builds a multi-grid hierarchy directly from a CSR matrix using
+//! smoothed aggregation. Since it only relies on the matrix entries, it works
+//! with compressed linear systems that have no underlying grid structure. The
+//! hierarchy can be reused across solves: if the sparsity pattern of the
+//! matrix passed to Build() is identical to the previous one, the aggregates
+//! and the prolongation/restriction operators are kept and only the coarse
+//! level operators are recomputed.
+//!
+//! \see Vanek, Petr, Jan Mandel, and Marian Brezina. "Algebraic multigrid by
+//!      smoothed aggregation for second and fourth order elliptic problems."
+//!      Computing 56.3 (1996): 179-196.
+//!
+class AMGHierarchy
+{
+ public:
+    //! Builds the hierarchy for the given matrix \p A.
+    //! \warning \p A must outlive the hierarchy or the next Build() call.
+    void Build(const MatrixCSRD& A, const AMGParameters& params);
+
+    //! Clears the hierarchy.
+    void Clear();
+
+    //!
+    //! \brief Performs a single V-cycle.
+    //!
+    //! The result does not depend on the initial value of \p x, so that the
+    //! V-cycle can be used as a symmetric preconditioner.
+    //!
+    void VCycle(const VectorND& b, VectorND* x);
+
+    //! Returns the number of levels, including the finest one.
+    [[nodiscard]] size_t GetNumberOfLevels() const;
+
+    //! Returns the number of rows at the given level.
+    [[nodiscard]] size_t GetNumberOfRows(size_t level) const;
+
+    //! Returns true if the last Build() call reused the previous hierarchy.
+    [[nodiscard]] bool IsLastBuildReused() const;
+
+ private:
+    struct Level
+    {
+        MatrixCSRD A;
+        MatrixCSRD P;
+        MatrixCSRD R;
+        VectorND invDiag;
+        VectorND x;
+        VectorND b;
+        VectorND r;
+    };
+
+    [[nodiscard]] const MatrixCSRD& GetMatrix(size_t level) const;
+
+    [[nodiscard]] bool IsSamePattern(const MatrixCSRD& A) const;
+
+    void BuildCoarseOperators();
+
+    void VCycle(size_t level, const VectorND& b, VectorND* x);
+
+    void Smooth(size_t level, const VectorND& b, unsigned int numberOfIter,
+                VectorND* x);
+
+    void SolveCoarsest(const VectorND& b, VectorND* x);
+
+    const MatrixCSRD* m_fineMatrix = nullptr;
+    std::vector<Level> m_levels;
+    AMGParameters m_params;
+    std::vector<size_t> m_lastRowPointers;
+    std::vector<size_t> m_lastColumnIndices;
+    bool m_isLastBuildReused = false;
+};
+}  // namespace CubbyFlow
+
+#endif
@@ -0,0 +1,80 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHANNEL_STREAM_IMPL_HPP
+#define CUBBYFLOW_CHANNEL_STREAM_IMPL_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+template <typename T>
+void ChannelStreamWriter::Write(const std::string& name,
+                                const ConstArrayView1<T>& array)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Channel element must be trivially copyable.");
+
+    WriteRaw(name, array.data(), sizeof(T), array.Length());
+}
+
+template <typename T>
+void ChannelStreamWriter::WriteValue(const std::string& name, const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Channel element must be trivially copyable.");
+
+    WriteRaw(name, &value, sizeof(T), 1);
+}
+
+template <typename T>
+ConstArrayView1<T> MappedChannelReader::View(const std::string& name) const
+{
+    const Channel& channel = GetChannel(name, sizeof(T));
+
+    return ConstArrayView1<T>(
+        reinterpret_cast<const T*>(m_data + channel.offset),
+        channel.numberOfElements);
+}
+
+template <typename T>
+T MappedChannelReader::Value(const std::string& name) const
+{
+    const Channel& channel = GetChannel(name, sizeof(T));
+    if (channel.numberOfElements != 1)
+    {
+        throw std::invalid_argument{ "Channel is not a single value." };
+    }
+
+    T value;
+    std::memcpy(&value, m_data + channel.offset, sizeof(T));
+
+    return value;
+}
+
+template <typename T>
+void MappedChannelReader::Read(const std::string& name, Array1<T>* array) const
+{
+    const ConstArrayView1<T> view = View<T>(name);
+
+    array->Resize(view.Length());
+    ParallelRangeFor(ZERO_SIZE, view.Length(), [&](size_t begin, size_t end) {
+        std::memcpy(static_cast<void*>(array->data() + begin),
+                    view.data() + begin, (end - begin) * sizeof(T));
+    });
+}
+}  // namespace CubbyFlow
+
+#endif
@@ -0,0 +1,182 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHANNEL_STREAM_HPP
+#define CUBBYFLOW_CHANNEL_STREAM_HPP
+
+#include <Core/Array/ArrayView.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief File-backed streaming writer for named data channels.
+//!
+//! Each channel is written to the file as soon as it is emitted, directly
+//! from the memory of the given array, so saving a large data set does not
+//! require any intermediate buffer. The data of each channel is aligned to
+//! CHANNEL_ALIGNMENT bytes in the file so that MappedChannelReader can expose
+//! it without copying.
+//!
+class ChannelStreamWriter final
+{
+ public:
+    //! Alignment of the channel data in bytes.
+    static constexpr size_t CHANNEL_ALIGNMENT = 64;
+
+    //! Opens the file with given \p filename for writing.
+    explicit ChannelStreamWriter(const std::string& filename);
+
+    //! Deleted copy constructor.
+    ChannelStreamWriter(const ChannelStreamWriter&) = delete;
+
+    //! Deleted move constructor.
+    ChannelStreamWriter(ChannelStreamWriter&&) noexcept = delete;
+
+    //! Destructor. Closes the file without reporting a failure.
+    ~ChannelStreamWriter();
+
+    //! Deleted copy assignment operator.
+    ChannelStreamWriter& operator=(const ChannelStreamWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    ChannelStreamWriter& operator=(ChannelStreamWriter&&) noexcept = delete;
+
+    //! Writes the array as a channel with given \p name.
+    template <typename T>
+    void Write(const std::string& name, const ConstArrayView1<T>& array);
+
+    //! Writes the single value as a channel with given \p name.
+    template <typename T>
+    void WriteValue(const std::string& name, const T& value);
+
+    //!
+    //! \brief Writes raw bytes as a channel with given \p name.
+    //!
+    //! \param name            The name of the channel.
+    //! \param data            The pointer to the first element.
+    //! \param elementSize     The size of a single element in bytes.
+    //! \param numberOfElements The number of elements.
+    //!
+    void WriteRaw(const std::string& name, const void* data,
+                  size_t elementSize, size_t numberOfElements);
+
+    //!
+    //! \brief Flushes and closes the file.
+    //!
+    //! \exception std::runtime_error if the remaining data cannot be written.
+    //!
+    void Close();
+
+ private:
+    std::ofstream m_file;
+    size_t m_offset = 0;
+};
+
+//!
+//! \brief Memory-mapped reader for files written by ChannelStreamWriter.
+//!
+//! The file is mapped into the address space instead of being read, and the
+//! channels are exposed as views over the mapped pages. Only the pages that are
+//! actually accessed are loaded, and they can be evicted by the OS at any time,
+//! which keeps the memory footprint flat regardless of the file size.
+//!
+class MappedChannelReader final
+{
+ public:
+    //! Maps the file with given \p filename.
+    explicit MappedChannelReader(const std::string& filename);
+
+    //! Deleted copy constructor.
+    MappedChannelReader(const MappedChannelReader&) = delete;
+
+    //! Deleted move constructor.
+    MappedChannelReader(MappedChannelReader&&) noexcept = delete;
+
+    //! Destructor. Unmaps the file.
+    ~MappedChannelReader();
+
+    //! Deleted copy assignment operator.
+    MappedChannelReader& operator=(const MappedChannelReader&) = delete;
+
+    //! Deleted move assignment operator.
+    MappedChannelReader& operator=(MappedChannelReader&&) noexcept = delete;
+
+    //! Returns the number of channels in the file.
+    [[nodiscard]] size_t NumberOfChannels() const;
+
+    //! Returns true if the file has a channel with given \p name.
+    [[nodiscard]] bool HasChannel(const std::string& name) const;
+
+    //! Returns the names of the channels in the file.
+    [[nodiscard]] std::vector<std::string> ChannelNames() const;
+
+    //! Returns the size of a single element of the channel in bytes.
+    [[nodiscard]] size_t ElementSize(const std::string& name) const;
+
+    //! Returns the raw bytes of the channel with given \p name.
+    [[nodiscard]] ConstArrayView1<uint8_t> RawView(
+        const std::string& name) const;
+
+    //!
+    //! \brief Returns the view of the channel with given \p name.
+    //!
+    //! The view points directly into the mapped file and is valid as long as
+    //! this reader is alive.
+    //!
+    template <typename T>
+    [[nodiscard]] ConstArrayView1<T> View(const std::string& name) const;
+
+    //! Returns the single value of the channel with given \p name.
+    template <typename T>
+    [[nodiscard]] T Value(const std::string& name) const;
+
+    //! Copies the channel with given \p name into \p array.
+    template <typename T>
+    void Read(const std::string& name, Array1<T>* array) const;
+
+ private:
+    struct Channel
+    {
+        size_t offset = 0;
+        size_t elementSize = 0;
+        size_t numberOfElements = 0;
+    };
+
+    [[nodiscard]] const Channel& GetChannel(const std::string& name) const;
+
+    [[nodiscard]] const Channel& GetChannel(const std::string& name,
+                                            size_t elementSize) const;
+
+    void Map(const std::string& filename);
+
+    void Unmap();
+
+    void ParseChannels();
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+    std::unordered_map<std::string, Channel> m_channels;
+};
+
+//! Shared pointer type for the MappedChannelReader.
+using MappedChannelReaderPtr = std::shared_ptr<MappedChannelReader>;
+}  // namespace CubbyFlow
+
+#include <Core/Utils/ChannelStream-Impl.hpp>
+
+#endif
@@ -0,0 +1,69 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHECKPOINT_IMPL_HPP
+#define CUBBYFLOW_CHECKPOINT_IMPL_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+template <typename T>
+void Checkpoint::Write(const std::string& name,
+                       const ConstArrayView1<T>& array)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Channel element must be trivially copyable.");
+
+    WriteRaw(name, array.data(), sizeof(T), array.Length());
+}
+
+template <typename T>
+void Checkpoint::WriteValue(const std::string& name, const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Channel element must be trivially copyable.");
+
+    WriteRaw(name, &value, sizeof(T), 1);
+}
+
+template <typename T>
+void Checkpoint::Read(const std::string& name, Array1<T>* array) const
+{
+    const Channel& channel = GetChannel(name, sizeof(T));
+    const size_t numberOfElements = channel.data.size() / sizeof(T);
+
+    array->Resize(numberOfElements);
+    if (numberOfElements > 0)
+    {
+        std::memcpy(static_cast<void*>(array->data()), channel.data.data(),
+                    channel.data.size());
+    }
+}
+
+template <typename T>
+T Checkpoint::Value(const std::string& name) const
+{
+    const Channel& channel = GetChannel(name, sizeof(T));
+    if (channel.data.size() != sizeof(T))
+    {
+        throw std::invalid_argument{ "Channel is not a single value." };
+    }
+
+    T value;
+    std::memcpy(static_cast<void*>(&value), channel.data.data(), sizeof(T));
+
+    return value;
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -0,0 +1,228 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_CHECKPOINT_HPP
+#define CUBBYFLOW_CHECKPOINT_HPP
+
+#include <Core/Array/Array.hpp>
+#include <Core/Array/ArrayView.hpp>
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Serialization.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace CubbyFlow
+{
+class CheckpointWriter;
+
+//!
+//! \brief Set of named data channels describing a simulation state.
+//!
+//! The physics animations, their data and their emitters and colliders save
+//! their state into a checkpoint channel by channel, so that a simulation can
+//! be stopped and resumed later with bit-exact results. A default constructed
+//! checkpoint keeps the channels in memory. The checkpoint returned by
+//! CheckpointWriter::Begin instead streams each channel to the file as soon
+//! as it is written, so the state is never held in memory twice. Use
+//! Checkpoint::Load to read a checkpoint file back.
+//!
+class Checkpoint
+{
+ public:
+    //! Default constructor. The channels are kept in memory.
+    Checkpoint() = default;
+
+    //! Writes the array as a channel with given \p name.
+    template <typename T>
+    void Write(const std::string& name, const ConstArrayView1<T>& array);
+
+    //! Writes the single value as a channel with given \p name.
+    template <typename T>
+    void WriteValue(const std::string& name, const T& value);
+
+    //! Writes the string as a channel with given \p name.
+    void WriteString(const std::string& name, const std::string& value);
+
+    //! Writes the serialized \p serializable as a channel with given \p name.
+    void WriteSerializable(const std::string& name,
+                           const Serializable& serializable);
+
+    //! Writes raw bytes as a channel with given \p name.
+    void WriteRaw(const std::string& name, const void* data,
+                  size_t elementSize, size_t numberOfElements);
+
+    //! Copies the channel with given \p name into \p array.
+    template <typename T>
+    void Read(const std::string& name, Array1<T>* array) const;
+
+    //! Returns the single value of the channel with given \p name.
+    template <typename T>
+    [[nodiscard]] T Value(const std::string& name) const;
+
+    //! Returns the string of the channel with given \p name.
+    [[nodiscard]] std::string String(const std::string& name) const;
+
+    //! Deserializes the channel with given \p name into \p serializable.
+    void ReadSerializable(const std::string& name,
+                          Serializable* serializable) const;
+
+    //! Returns true if the checkpoint has a channel with given \p name.
+    [[nodiscard]] bool HasChannel(const std::string& name) const;
+
+    //! Returns the number of channels.
+    [[nodiscard]] size_t NumberOfChannels() const;
+
+    //! Returns the names of the channels in lexicographical order.
+    [[nodiscard]] std::vector<std::string> ChannelNames() const;
+
+    //! Returns the size of a single element of the channel in bytes.
+    [[nodiscard]] size_t ElementSize(const std::string& name) const;
+
+    //! Returns the raw bytes of the channel with given \p name.
+    [[nodiscard]] ConstArrayView1<uint8_t> RawView(
+        const std::string& name) const;
+
+    //! Removes all channels.
+    void Clear();
+
+    //!
+    //! \brief Loads the checkpoint file written by CheckpointWriter.
+    //!
+    //! The channels that were not stored in the file because they had not
+    //! changed are read from the earlier checkpoint files they refer to. Those
+    //! files are looked up in the directory of \p filename.
+    //!
+    void Load(const std::string& filename);
+
+ private:
+    struct Channel
+    {
+        size_t elementSize = 0;
+        std::vector<uint8_t> data;
+    };
+
+    friend class CheckpointWriter;
+
+    [[nodiscard]] const Channel& GetChannel(const std::string& name,
+                                            size_t elementSize) const;
+
+    std::map<std::string, Channel> m_channels;
+
+    // Writer that receives the channels instead of m_channels, if streaming.
+    CheckpointWriter* m_writer = nullptr;
+};
+
+//!
+//! \brief Incremental writer for a sequence of checkpoint files.
+//!
+//! Each checkpoint is written with ChannelStreamWriter. A channel is stored
+//! only if its content hash differs from the one stored by the previous
+//! checkpoint of this writer; otherwise a small reference to the earlier file
+//! that holds the data is written instead. The referenced files must be kept
+//! next to the newer ones, and they cannot be overwritten until Reset() starts
+//! a new chain with a full checkpoint.
+//!
+class CheckpointWriter
+{
+ public:
+    //! Default constructor.
+    CheckpointWriter();
+
+    //! Deleted copy constructor.
+    CheckpointWriter(const CheckpointWriter&) = delete;
+
+    //! Deleted move constructor.
+    CheckpointWriter(CheckpointWriter&&) noexcept = delete;
+
+    //! Destructor. Discards the checkpoint that was begun but not committed.
+    ~CheckpointWriter();
+
+    //! Deleted copy assignment operator.
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    CheckpointWriter& operator=(CheckpointWriter&&) noexcept = delete;
+
+    //!
+    //! \brief Begins a checkpoint that is written to the file \p filename.
+    //!
+    //! The channels written to the returned checkpoint are hashed and written
+    //! to a temporary file one by one, without being collected in memory. The
+    //! returned checkpoint cannot be read from. Call Commit() to move the file
+    //! in place. A checkpoint that was begun but not committed is discarded.
+    //!
+    //! \exception std::invalid_argument if a file written since the last
+    //!            Reset() refers to \p filename.
+    //!
+    [[nodiscard]] Checkpoint& Begin(const std::string& filename);
+
+    //!
+    //! \brief Finishes the checkpoint begun by Begin() and moves it in place.
+    //!
+    //! If the temporary file cannot be written completely, it is removed and
+    //! the file previously committed with the same name is left untouched.
+    //!
+    //! \exception std::runtime_error if the temporary file cannot be flushed.
+    //! \exception std::invalid_argument if the file cannot be moved in place.
+    //!
+    void Commit();
+
+    //! Writes \p checkpoint to the file with given \p filename.
+    void Write(const Checkpoint& checkpoint, const std::string& filename);
+
+    //! Forgets the previous checkpoints so the next one is written in full.
+    void Reset();
+
+    //! Returns the number of channels stored by the last commit.
+    [[nodiscard]] size_t GetLastNumberOfStoredChannels() const;
+
+    //! Returns the number of channel bytes stored by the last commit.
+    [[nodiscard]] size_t GetLastNumberOfStoredBytes() const;
+
+ private:
+    friend class Checkpoint;
+
+    struct ChannelRecord
+    {
+        uint64_t hash = 0;
+        size_t elementSize = 0;
+        size_t size = 0;
+        std::string filename;
+    };
+
+    void WriteChannel(const std::string& name, const void* data,
+                      size_t elementSize, size_t numberOfElements);
+
+    void Abort();
+
+    std::unordered_map<std::string, ChannelRecord> m_records;
+    std::unordered_set<std::string> m_referencedFilenames;
+    size_t m_lastNumberOfStoredChannels = 0;
+    size_t m_lastNumberOfStoredBytes = 0;
+
+    // State of the checkpoint between Begin() and Commit().
+    Checkpoint m_checkpoint;
+    std::unique_ptr<ChannelStreamWriter> m_stream;
+    std::string m_filename;
+    std::unordered_map<std::string, ChannelRecord> m_newRecords;
+    std::unordered_set<std::string> m_newReferencedFilenames;
+    size_t m_numberOfStoredChannels = 0;
+    size_t m_numberOfStoredBytes = 0;
+};
+}  // namespace CubbyFlow
+
+#include <Core/Utils/Checkpoint-Impl.hpp>
+
+#endif
\ No newline at end of file
@@ -99,13 +99,37 @@ void ParallelForEachIndex(const Vector<IndexType, N>& begin,
                           const Vector<IndexType, N>& end, const Func& func,
                           ExecutionPolicy policy)
 {
-    ParallelFor(
-        begin[N - 1], end[N - 1],
-        [&](IndexType i) {
-            Internal::ForEachIndex<IndexType, N, N - 1>::Call(begin, end, func,
-                                                              i);
-        },
-        policy);
+    if constexpr (N == 3)
+    {
+        // Split 3-D ranges into tiles so that thin domains are also divided
+        // along X and Y, and neighboring cells are visited by the same thread.
+        ParallelTiledRangeFor(
+            begin[0], end[0], begin[1], end[1], begin[2], end[2],
+            [&](IndexType iBegin, IndexType iEnd, IndexType jBegin,
+                IndexType jEnd, IndexType kBegin, IndexType kEnd) {
+                for (IndexType k = kBegin; k < kEnd; ++k)
+                {
+                    for (IndexType j = jBegin; j < jEnd; ++j)
+                    {
+                        for (IndexType i = iBegin; i < iEnd; ++i)
+                        {
+                            func(i, j, k);
+                        }
+                    }
+                }
+            },
+            TileParameters{}, policy);
+    }
+    else
+    {
+        ParallelFor(
+            begin[N - 1], end[N - 1],
+            [&](IndexType i) {
+                Internal::ForEachIndex<IndexType, N, N - 1>::Call(begin, end,
+                                                                  func, i);
+            },
+            policy);
+    }
 }
 
 template <typename IndexType, typename Func>
@@ -11,7 +11,10 @@
 #ifndef CUBBYFLOW_LOGGER_HPP
 #define CUBBYFLOW_LOGGER_HPP
 
+#include <cstdint>
 #include <sstream>
+#include <string>
+#include <utility>
 
 namespace CubbyFlow
 {
@@ -27,11 +30,46 @@ enum class LogLevel : uint8_t
     Off = 5
 };
 
+//!
+//! \brief Key/value field of a structured log message.
+//!
+//! Writing a field to the logger appends " key=value" to the message, so the
+//! logs can be parsed by the tools, e.g.
+//! CUBBYFLOW_INFO << "Solved" << LogField{ "iterations", n };
+//!
+template <typename T>
+struct LogField
+{
+    //! Constructs a field with the key and a copy of the value.
+    LogField(const char* _key, T _value)
+        : key{ _key }, value{ std::move(_value) }
+    {
+        // Do nothing
+    }
+
+    const char* key;
+    T value;
+};
+
+//! Deduces the value type of a log field, decaying the arrays to pointers.
+template <typename T>
+LogField(const char*, T) -> LogField<T>;
+
+//! Writes the log field to the stream.
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const LogField<T>& field)
+{
+    return stream << ' ' << field.key << '=' << field.value;
+}
+
 //!
 //! \brief Super simple logger implementation.
 //!
 //! This is a super simple logger implementation that has minimal logging
-//! capability. Currently, the class doesn't support multi-thread logging.
+//! capability. A logger buffers a single message and writes it when it is
+//! destroyed. In the asynchronous mode (see Logging::SetAsyncMode), the
+//! message is pushed to the ring buffer of the calling thread instead and
+//! written by the background thread.
 //!
 class Logger final
 {
@@ -92,6 +130,26 @@ class Logging
     //! Sets the log level.
     static void SetLevel(LogLevel level);
 
+    //! Returns true if the logs of the given level are written.
+    [[nodiscard]] static bool IsEnabled(LogLevel level);
+
+    //!
+    //! \brief Sets true to write the logs asynchronously.
+    //!
+    //! In the asynchronous mode, each thread pushes its messages to its own
+    //! lock-free ring buffer and a background thread drains the buffers to
+    //! the output streams. The messages of a thread keep their order, but the
+    //! messages of different threads can be interleaved. Setting false, or
+    //! the program shutdown, writes all the pending messages.
+    //!
+    static void SetAsyncMode(bool isOn);
+
+    //! Returns true if the logs are written asynchronously.
+    [[nodiscard]] static bool IsAsyncMode();
+
+    //! Blocks until all the pending asynchronous logs are written and flushed.
+    static void Flush();
+
     //! Mutes the logger.
     static void Mute();
 
@@ -111,22 +169,29 @@ extern Logger errorLogger;
 //! Debug-level logger.
 extern Logger debugLogger;
 
-#define CUBBYFLOW_INFO                                               \
-    (Logger(LogLevel::Info)                                          \
-     << Logging::GetHeader(LogLevel::Info) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_WARN                                               \
-    (Logger(LogLevel::Warn)                                          \
-     << Logging::GetHeader(LogLevel::Warn) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_ERROR                                               \
-    (Logger(LogLevel::Error)                                          \
-     << Logging::GetHeader(LogLevel::Error) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
-#define CUBBYFLOW_DEBUG                                               \
-    (Logger(LogLevel::Debug)                                          \
-     << Logging::GetHeader(LogLevel::Debug) << "[" << __FILE__ << ":" \
-     << __LINE__ << " (" << __func__ << ")] ")
+//! Discards the result of the logging expression in CUBBYFLOW_LOG.
+struct LogVoidify
+{
+    //! Takes the logger so that both branches of the macro are void.
+    void operator&(const Logger&) const
+    {
+        // Do nothing
+    }
+};
+
+//! Writes a log of the given level. The message is not formatted at all if
+//! the level is filtered out. The macro is a single expression, so it is safe
+//! in unbraced if/else statements.
+#define CUBBYFLOW_LOG(level)                                              \
+    !Logging::IsEnabled(level)                                            \
+        ? static_cast<void>(0)                                            \
+        : LogVoidify{} & Logger(level) << Logging::GetHeader(level) << "[" \
+                                        << __FILE__ << ":" << __LINE__     \
+                                        << " (" << __func__ << ")] "
+#define CUBBYFLOW_INFO CUBBYFLOW_LOG(LogLevel::Info)
+#define CUBBYFLOW_WARN CUBBYFLOW_LOG(LogLevel::Warn)
+#define CUBBYFLOW_ERROR CUBBYFLOW_LOG(LogLevel::Error)
+#define CUBBYFLOW_DEBUG CUBBYFLOW_LOG(LogLevel::Debug)
 }  // namespace CubbyFlow
 
 #endif
\ No newline at end of file
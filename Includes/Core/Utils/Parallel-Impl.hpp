@@ -33,8 +33,11 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <future>
+#include <utility>
 #include <vector>
 
 #undef max
@@ -86,8 +89,10 @@ inline auto Async(TASK&& fn) -> future<operator_return_t<TASK>>
         delete task;
     });
 
+    // The task deletes itself once executed, so get the future first.
+    auto future = task->get_future();
     tbb::task::enqueue(*tbbNode);
-    return task.get_future();
+    return future;
 
 #elif defined(CUBBYFLOW_TASKING_CPP11THREAD)
     return std::async(std::launch::async, fn);
@@ -185,6 +190,74 @@ void ParallelMergeSort(RandomIterator a, size_t size, RandomIterator2 temp,
         Merge(a, size, temp, compareFunction);
     }
 }
+
+// Spreads the lower 21 bits of x so that there are two zero bits between each
+// bit.
+inline uint64_t SpreadBitsBy2(uint64_t x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+
+    return x;
+}
+
+// Calls function(taskIndex) for [0, numberOfTasks) while the idle workers
+// grab the next task, so that unevenly loaded tasks are balanced.
+template <typename Function>
+void ParallelForDynamic(size_t numberOfTasks, const Function& function)
+{
+#if defined(CUBBYFLOW_TASKING_TBB)
+    tbb::parallel_for(ZERO_SIZE, numberOfTasks, function);
+#elif defined(CUBBYFLOW_TASKING_HPX)
+    hpx::parallel::for_loop(hpx::parallel::execution::par, ZERO_SIZE,
+                            numberOfTasks, function);
+#elif defined(CUBBYFLOW_TASKING_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t i = 0; i < static_cast<int64_t>(numberOfTasks); ++i)
+    {
+        function(static_cast<size_t>(i));
+    }
+#elif defined(CUBBYFLOW_TASKING_CPP11THREAD)
+    const unsigned int numThreadsHint = GetMaxNumberOfThreads();
+    const auto numThreads = static_cast<unsigned int>(std::min<size_t>(
+        (numThreadsHint == 0u) ? 8u : numThreadsHint, numberOfTasks));
+
+    std::atomic<size_t> nextTask{ 0 };
+    auto worker = [&]() {
+        for (size_t i = nextTask++; i < numberOfTasks; i = nextTask++)
+        {
+            function(i);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(numThreads);
+
+    for (unsigned int i = 1; i < numThreads; ++i)
+    {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread& t : pool)
+    {
+        if (t.joinable())
+        {
+            t.join();
+        }
+    }
+#else
+    for (size_t i = 0; i < numberOfTasks; ++i)
+    {
+        function(i);
+    }
+#endif
+}
 }  // namespace Internal
 
 template <typename RandomIterator, typename T>
@@ -431,6 +504,94 @@ void ParallelRangeFor(IndexType beginIndexX, IndexType endIndexX,
         policy);
 }
 
+template <typename IndexType, typename Function>
+void ParallelTiledRangeFor(IndexType beginIndexX, IndexType endIndexX,
+                           IndexType beginIndexY, IndexType endIndexY,
+                           IndexType beginIndexZ, IndexType endIndexZ,
+                           const Function& function,
+                           const TileParameters& params, ExecutionPolicy policy)
+{
+    if (beginIndexX >= endIndexX || beginIndexY >= endIndexY ||
+        beginIndexZ >= endIndexZ)
+    {
+        return;
+    }
+
+    const auto tileX = static_cast<IndexType>(std::max(params.sizeX, ONE_SIZE));
+    const auto tileY = static_cast<IndexType>(std::max(params.sizeY, ONE_SIZE));
+    const auto tileZ = static_cast<IndexType>(std::max(params.sizeZ, ONE_SIZE));
+
+    const auto numTilesX =
+        static_cast<size_t>((endIndexX - beginIndexX + tileX - 1) / tileX);
+    const auto numTilesY =
+        static_cast<size_t>((endIndexY - beginIndexY + tileY - 1) / tileY);
+    const auto numTilesZ =
+        static_cast<size_t>((endIndexZ - beginIndexZ + tileZ - 1) / tileZ);
+    const size_t numTiles = numTilesX * numTilesY * numTilesZ;
+
+    auto launchTile = [&](size_t tileI, size_t tileJ, size_t tileK) {
+        const IndexType iBegin =
+            beginIndexX + static_cast<IndexType>(tileI) * tileX;
+        const IndexType jBegin =
+            beginIndexY + static_cast<IndexType>(tileJ) * tileY;
+        const IndexType kBegin =
+            beginIndexZ + static_cast<IndexType>(tileK) * tileZ;
+
+        function(iBegin, std::min(iBegin + tileX, endIndexX), jBegin,
+                 std::min(jBegin + tileY, endIndexY), kBegin,
+                 std::min(kBegin + tileZ, endIndexZ));
+    };
+
+    if (policy == ExecutionPolicy::Serial || numTiles == 1)
+    {
+        for (size_t k = 0; k < numTilesZ; ++k)
+        {
+            for (size_t j = 0; j < numTilesY; ++j)
+            {
+                for (size_t i = 0; i < numTilesX; ++i)
+                {
+                    launchTile(i, j, k);
+                }
+            }
+        }
+
+        return;
+    }
+
+    if (params.order == TileOrder::Morton)
+    {
+        // Sort the tiles along the Z-order curve so that the tiles dispatched
+        // at the same time are spatially close to each other.
+        std::vector<std::pair<uint64_t, size_t>> tiles(numTiles);
+        for (size_t t = 0; t < numTiles; ++t)
+        {
+            const size_t i = t % numTilesX;
+            const size_t j = (t / numTilesX) % numTilesY;
+            const size_t k = t / (numTilesX * numTilesY);
+
+            tiles[t] = { Internal::SpreadBitsBy2(i) |
+                             Internal::SpreadBitsBy2(j) << 1 |
+                             Internal::SpreadBitsBy2(k) << 2,
+                         t };
+        }
+
+        std::sort(tiles.begin(), tiles.end());
+
+        Internal::ParallelForDynamic(numTiles, [&](size_t n) {
+            const size_t t = tiles[n].second;
+            launchTile(t % numTilesX, (t / numTilesX) % numTilesY,
+                       t / (numTilesX * numTilesY));
+        });
+    }
+    else
+    {
+        Internal::ParallelForDynamic(numTiles, [&](size_t t) {
+            launchTile(t % numTilesX, (t / numTilesX) % numTilesY,
+                       t / (numTilesX * numTilesY));
+        });
+    }
+}
+
 template <typename IndexType, typename Value, typename Function,
           typename Reduce>
 Value ParallelReduce(IndexType beginIndex, IndexType endIndex,
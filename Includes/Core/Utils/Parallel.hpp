@@ -11,6 +11,8 @@
 #ifndef CUBBYFLOW_PARALLEL_HPP
 #define CUBBYFLOW_PARALLEL_HPP
 
+#include <cstddef>
+
 namespace CubbyFlow
 {
 //! Execution policy tag.
@@ -20,6 +22,32 @@ enum class ExecutionPolicy
     Parallel
 };
 
+//! Traversal order of the tiles for ParallelTiledRangeFor.
+enum class TileOrder
+{
+    //! Tiles are dispatched in X-major, then Y and Z order.
+    Linear,
+
+    //! Tiles are dispatched along the Z-order (Morton) curve.
+    Morton
+};
+
+//! Tiling parameters for ParallelTiledRangeFor.
+struct TileParameters
+{
+    //! Size of a tile in X dimension.
+    size_t sizeX = 64;
+
+    //! Size of a tile in Y dimension.
+    size_t sizeY = 8;
+
+    //! Size of a tile in Z dimension.
+    size_t sizeZ = 8;
+
+    //! Dispatch order of the tiles.
+    TileOrder order = TileOrder::Linear;
+};
+
 //!
 //! \brief      Fills from \p begin to \p end with \p value in parallel.
 //!
@@ -186,6 +214,39 @@ void ParallelRangeFor(IndexType beginIndexX, IndexType endIndexX,
                       const Function& function,
                       ExecutionPolicy policy = ExecutionPolicy::Parallel);
 
+//!
+//! \brief      Makes a 3D tiled range-loop in parallel.
+//!
+//! This function splits the 3D index range into tiles and schedules the tiles
+//! dynamically over the worker threads. Unlike ParallelRangeFor, the range is
+//! split along every dimension, so thin domains still expose enough
+//! parallelism. The input function object takes the index range of a tile, so
+//! that the working set of a stencil kernel stays in cache and the inner-most
+//! loop over X can be vectorized. The order of the visit is not guaranteed due
+//! to the nature of parallel execution.
+//!
+//! \param[in]  beginIndexX The begin index in X dimension.
+//! \param[in]  endIndexX   The end index in X dimension.
+//! \param[in]  beginIndexY The begin index in Y dimension.
+//! \param[in]  endIndexY   The end index in Y dimension.
+//! \param[in]  beginIndexZ The begin index in Z dimension.
+//! \param[in]  endIndexZ   The end index in Z dimension.
+//! \param[in]  function    The function to call for each tile (iBegin, iEnd,
+//!                         jBegin, jEnd, kBegin, kEnd).
+//! \param[in]  params      The tile size and the dispatch order of the tiles.
+//! \param[in]  policy      The execution policy (parallel or serial).
+//!
+//! \tparam     IndexType   Index type.
+//! \tparam     Function    Function type.
+//!
+template <typename IndexType, typename Function>
+void ParallelTiledRangeFor(IndexType beginIndexX, IndexType endIndexX,
+                           IndexType beginIndexY, IndexType endIndexY,
+                           IndexType beginIndexZ, IndexType endIndexZ,
+                           const Function& function,
+                           const TileParameters& params = TileParameters{},
+                           ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
 //!
 //! \brief      Performs reduce operation in parallel.
 //!
@@ -0,0 +1,44 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SIMD_HPP
+#define CUBBYFLOW_SIMD_HPP
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CUBBYFLOW_SIMD_X86_64
+#endif
+
+namespace CubbyFlow
+{
+//! Instruction set levels of the vectorized kernels.
+enum class SIMDLevel
+{
+    Scalar = 0,
+    SSE4 = 1,
+    AVX2 = 2,
+    AVX512 = 3
+};
+
+//! Returns the highest instruction set level supported by the CPU.
+[[nodiscard]] SIMDLevel GetSupportedSIMDLevel();
+
+//! Returns the instruction set level used by the vectorized kernels.
+[[nodiscard]] SIMDLevel GetSIMDLevel();
+
+//!
+//! \brief Sets the instruction set level used by the vectorized kernels.
+//!
+//! The level is clamped to GetSupportedSIMDLevel(). By default, the highest
+//! supported level is used.
+//!
+void SetSIMDLevel(SIMDLevel level);
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
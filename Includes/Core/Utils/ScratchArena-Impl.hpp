@@ -0,0 +1,68 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SCRATCH_ARENA_IMPL_HPP
+#define CUBBYFLOW_SCRATCH_ARENA_IMPL_HPP
+
+#include <memory>
+#include <type_traits>
+
+namespace CubbyFlow
+{
+template <typename T, size_t N>
+ArrayView<T, N> ScratchArena::AcquireUninitialized(
+    const Vector<size_t, N>& size)
+{
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "ScratchArena never runs destructors.");
+
+    const size_t length = Product<size_t, N>(size, 1);
+    T* ptr = static_cast<T*>(Allocate(length * sizeof(T)));
+
+    if constexpr (!std::is_trivially_default_constructible_v<T>)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            new (ptr + i) T;
+        }
+    }
+
+    return ArrayView<T, N>(ptr, size);
+}
+
+template <typename T>
+ArrayView1<T> ScratchArena::AcquireUninitialized(size_t size)
+{
+    return AcquireUninitialized<T, 1>(Vector1UZ{ size });
+}
+
+template <typename T, size_t N>
+ArrayView<T, N> ScratchArena::Acquire(const Vector<size_t, N>& size,
+                                      const T& initVal)
+{
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "ScratchArena never runs destructors.");
+
+    const size_t length = Product<size_t, N>(size, 1);
+    T* ptr = static_cast<T*>(Allocate(length * sizeof(T)));
+
+    std::uninitialized_fill_n(ptr, length, initVal);
+
+    return ArrayView<T, N>(ptr, size);
+}
+
+template <typename T>
+ArrayView1<T> ScratchArena::Acquire(size_t size, const T& initVal)
+{
+    return Acquire<T, 1>(Vector1UZ{ size }, initVal);
+}
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
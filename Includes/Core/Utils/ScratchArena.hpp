@@ -0,0 +1,159 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_SCRATCH_ARENA_HPP
+#define CUBBYFLOW_SCRATCH_ARENA_HPP
+
+#include <Core/Array/ArrayView.hpp>
+
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Scratch memory arena for temporary arrays.
+//!
+//! This class hands out array views of the requested shape from a few large
+//! memory blocks using a bump pointer. The memory is given back by
+//! ScratchArena::Scope, which rewinds the arena to the point where the scope
+//! began. When the arena becomes empty after using more than one block, the
+//! blocks are merged into a single block as large as the high-water mark, so
+//! that the following steps with the same workload do not touch the heap.
+//!
+//! Only trivially destructible types can be acquired since the arena never
+//! runs destructors. The arena is not thread-safe; each solver (or thread)
+//! should own its own instance. In particular, tasks of a TaskGraph that run
+//! concurrently must not acquire from the same arena, so a solver phase that
+//! is run as such a task needs an arena of its own.
+//!
+class ScratchArena
+{
+ public:
+    //! Alignment of every acquired array in bytes.
+    static constexpr size_t ALIGNMENT = 64;
+
+    //! Minimum size of a memory block in bytes.
+    static constexpr size_t MIN_BLOCK_SIZE = 1 << 16;
+
+    //!
+    //! \brief RAII helper which releases everything acquired during its
+    //!        lifetime.
+    //!
+    class Scope
+    {
+     public:
+        //! Marks the current state of \p arena.
+        explicit Scope(ScratchArena& arena);
+
+        //! Deleted copy constructor.
+        Scope(const Scope&) = delete;
+
+        //! Deleted move constructor.
+        Scope(Scope&&) noexcept = delete;
+
+        //! Rewinds the arena to the marked state.
+        ~Scope();
+
+        //! Deleted copy assignment operator.
+        Scope& operator=(const Scope&) = delete;
+
+        //! Deleted move assignment operator.
+        Scope& operator=(Scope&&) noexcept = delete;
+
+     private:
+        ScratchArena& m_arena;
+        size_t m_block;
+        size_t m_offset;
+        size_t m_numberOfBytesInUse;
+    };
+
+    //! Default constructor.
+    ScratchArena() = default;
+
+    //! Deleted copy constructor.
+    ScratchArena(const ScratchArena&) = delete;
+
+    //! Move constructor.
+    ScratchArena(ScratchArena&& other) noexcept;
+
+    //! Destructor.
+    ~ScratchArena();
+
+    //! Deleted copy assignment operator.
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    //! Move assignment operator.
+    ScratchArena& operator=(ScratchArena&& other) noexcept;
+
+    //! Returns an array of \p size without initializing trivial types.
+    template <typename T, size_t N>
+    [[nodiscard]] ArrayView<T, N> AcquireUninitialized(
+        const Vector<size_t, N>& size);
+
+    //! Returns a 1-D array of \p size without initializing trivial types.
+    template <typename T>
+    [[nodiscard]] ArrayView1<T> AcquireUninitialized(size_t size);
+
+    //! Returns an array of \p size filled with \p initVal.
+    template <typename T, size_t N>
+    [[nodiscard]] ArrayView<T, N> Acquire(const Vector<size_t, N>& size,
+                                          const T& initVal = T{});
+
+    //! Returns a 1-D array of \p size filled with \p initVal.
+    template <typename T>
+    [[nodiscard]] ArrayView1<T> Acquire(size_t size, const T& initVal = T{});
+
+    //! Makes sure that \p numberOfBytes can be acquired without allocation.
+    //! \warning The arena must be empty.
+    void Reserve(size_t numberOfBytes);
+
+    //! Frees all the memory blocks and resets the statistics.
+    //! \warning The arena must be empty.
+    void Clear();
+
+    //! Returns the number of bytes currently handed out.
+    [[nodiscard]] size_t GetNumberOfBytesInUse() const;
+
+    //! Returns the largest number of bytes handed out at once.
+    [[nodiscard]] size_t GetHighWaterMark() const;
+
+    //! Returns the total size of the memory blocks in bytes.
+    [[nodiscard]] size_t GetCapacity() const;
+
+    //! Returns the number of memory blocks allocated so far.
+    [[nodiscard]] size_t GetNumberOfHeapAllocations() const;
+
+ private:
+    struct Block
+    {
+        std::byte* data = nullptr;
+        size_t capacity = 0;
+        size_t offset = 0;
+    };
+
+    [[nodiscard]] void* Allocate(size_t numberOfBytes);
+
+    void Rewind(size_t block, size_t offset, size_t numberOfBytesInUse);
+
+    void AddBlock(size_t capacity);
+
+    void FreeBlocks();
+
+    std::vector<Block> m_blocks;
+    size_t m_currentBlock = 0;
+    size_t m_numberOfBytesInUse = 0;
+    size_t m_highWaterMark = 0;
+    size_t m_numberOfHeapAllocations = 0;
+};
+}  // namespace CubbyFlow
+
+#include <Core/Utils/ScratchArena-Impl.hpp>
+
+#endif
\ No newline at end of file
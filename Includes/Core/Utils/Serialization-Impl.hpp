@@ -25,10 +25,10 @@ void Serialize(const ConstArrayView1<T>& array, std::vector<uint8_t>* buffer)
 template <typename T>
 void Deserialize(const std::vector<uint8_t>& buffer, Array1<T>* array)
 {
-    std::vector<uint8_t> data;
+    ConstArrayView1<uint8_t> data;
     Deserialize(buffer, &data);
-    array->Resize(data.size() / sizeof(T));
-    std::memcpy(array->data(), data.data(), data.size());
+    array->Resize(data.Length() / sizeof(T));
+    std::memcpy(array->data(), data.data(), data.Length());
 }
 }  // namespace CubbyFlow
 
@@ -13,6 +13,8 @@
 
 #include <Core/Array/ArrayView.hpp>
 
+#include <iosfwd>
+#include <string>
 #include <vector>
 
 namespace CubbyFlow
@@ -56,6 +58,18 @@ void Serialize(const uint8_t* data, size_t size, std::vector<uint8_t>* buffer);
 template <typename T>
 void Serialize(const ConstArrayView1<T>& array, std::vector<uint8_t>* buffer);
 
+//!
+//! \brief Serializes \p serializable and writes the result to \p stream.
+//!
+//! Serializable produces a single flat buffer, so the whole object is
+//! serialized in memory before it is written. Use ChannelStreamWriter to
+//! write large particle or grid data channel by channel instead.
+//!
+void Serialize(const Serializable* serializable, std::ostream* stream);
+
+//! Serializes \p serializable and writes the result to the file.
+void Serialize(const Serializable* serializable, const std::string& filename);
+
 //! Deserializes buffer to serializable object.
 void Deserialize(const std::vector<uint8_t>& buffer,
                  Serializable* serializable);
@@ -64,9 +78,25 @@ void Deserialize(const std::vector<uint8_t>& buffer,
 void Deserialize(const std::vector<uint8_t>& buffer,
                  std::vector<uint8_t>* data);
 
+//! Returns the view of the data stored in \p buffer without copying.
+void Deserialize(const std::vector<uint8_t>& buffer,
+                 ConstArrayView1<uint8_t>* data);
+
 //! Deserializes buffer to data chunk using common schema.
 template <typename T>
 void Deserialize(const std::vector<uint8_t>& buffer, Array1<T>* array);
+
+//!
+//! \brief Reads the remaining content of \p stream and deserializes
+//!        \p serializable.
+//!
+//! The content is read into a single flat buffer first. Use
+//! MappedChannelReader to read large particle or grid data without copying.
+//!
+void Deserialize(std::istream* stream, Serializable* serializable);
+
+//! Reads the file and deserializes \p serializable.
+void Deserialize(const std::string& filename, Serializable* serializable);
 }  // namespace CubbyFlow
 
 #include <Core/Utils/Serialization-Impl.hpp>
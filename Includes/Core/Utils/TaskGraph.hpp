@@ -0,0 +1,88 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_TASK_GRAPH_HPP
+#define CUBBYFLOW_TASK_GRAPH_HPP
+
+#include <Core/Utils/Parallel.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace CubbyFlow
+{
+//!
+//! \brief Directed acyclic graph of tasks.
+//!
+//! Solvers declare the phases of a step as tasks along with the phases they
+//! depend on, and Run() executes the independent phases concurrently on the
+//! tasking backend. A task can only depend on the tasks added before it, so
+//! the graph never has a cycle and the insertion order is always a valid
+//! serial order. Under OpenMP and in serial builds, the tasks simply run in
+//! insertion order, since a parallel loop inside an OpenMP task would be a
+//! nested parallel region and run on a single thread.
+//!
+class TaskGraph
+{
+ public:
+    //! Task ID type.
+    using TaskID = size_t;
+
+    //! Task function type.
+    using Task = std::function<void()>;
+
+    //!
+    //! \brief Adds a task and returns its ID.
+    //!
+    //! The task runs after all the tasks in \p dependencies are finished.
+    //!
+    //! \exception std::invalid_argument if a dependency is not added yet.
+    //!
+    TaskID AddTask(Task task, const std::vector<TaskID>& dependencies = {});
+
+    //!
+    //! \brief Makes \p task run after \p dependency is finished.
+    //!
+    //! \exception std::invalid_argument if \p dependency is not added before
+    //!            \p task.
+    //!
+    void AddDependency(TaskID task, TaskID dependency);
+
+    //!
+    //! \brief Runs all the tasks and waits for them to finish.
+    //!
+    //! If a task throws, the tasks which have not started yet are skipped and
+    //! the first exception is rethrown. The graph can be run again.
+    //!
+    void Run(ExecutionPolicy policy = ExecutionPolicy::Parallel);
+
+    //! Removes all the tasks.
+    void Clear();
+
+    //! Returns the number of tasks.
+    [[nodiscard]] size_t NumberOfTasks() const;
+
+ private:
+    struct Node
+    {
+        Task task;
+        std::vector<TaskID> successors;
+        size_t numberOfDependencies = 0;
+    };
+
+    void RunSerial();
+
+    void RunParallel();
+
+    std::vector<Node> m_nodes;
+};
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <API/Python/Animation/Animation.hpp>
+#include <API/Python/Animation/AnimationFuture.hpp>
 #include <Core/Animation/Animation.hpp>
 
 #include <pybind11/pybind11.h>
@@ -42,6 +43,28 @@ void AddAnimation(pybind11::module& m)
              R"pbdoc(
 			Updates animation state for given `frame`.
 
+			The GIL is released while updating, so that other Python threads
+			can run in the meantime.
+
+			Parameters
+			----------
+			- frame : Number of frames to advance.
+		)pbdoc",
+             pybind11::arg("frame"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "UpdateAsync",
+            [](const pybind11::object& self, const Frame& frame) {
+                auto animation = self.cast<AnimationPtr>();
+                return std::make_shared<AnimationFuture>(
+                    self, [animation, frame] { animation->Update(frame); });
+            },
+            R"pbdoc(
+			Updates animation state for given `frame` on a background thread.
+
+			Returns an AnimationFuture. The animation must not be accessed until
+			the future is ready.
+
 			Parameters
 			----------
 			- frame : Number of frames to advance.
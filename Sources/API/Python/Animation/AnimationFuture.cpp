@@ -0,0 +1,67 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <API/Python/Animation/AnimationFuture.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include <chrono>
+
+AnimationFuture::AnimationFuture(pybind11::object owner,
+                                 std::function<void()> func)
+    : m_owner{ std::move(owner) },
+      m_future{ std::async(std::launch::async, std::move(func)).share() }
+{
+    // Do nothing
+}
+
+AnimationFuture::~AnimationFuture()
+{
+    // The step may call back into Python, so the GIL must not be held while
+    // waiting. The owner is released after the GIL is acquired again.
+    pybind11::gil_scoped_release release;
+    m_future.wait();
+}
+
+bool AnimationFuture::IsReady() const
+{
+    return m_future.wait_for(std::chrono::seconds(0)) ==
+           std::future_status::ready;
+}
+
+void AnimationFuture::Wait() const
+{
+    {
+        pybind11::gil_scoped_release release;
+        m_future.wait();
+    }
+
+    m_future.get();
+}
+
+void AddAnimationFuture(pybind11::module& m)
+{
+    pybind11::class_<AnimationFuture, AnimationFuturePtr>(m, "AnimationFuture",
+                                                          R"pbdoc(
+			Handle of an animation step running on a background thread.
+
+			The step runs without holding the GIL, so that Python can do other
+			work such as exporting the last frame in the meantime. The animation
+			must not be accessed until the step has finished.
+		)pbdoc")
+        .def("IsReady", &AnimationFuture::IsReady,
+             R"pbdoc(
+			Returns true if the step has finished.
+		)pbdoc")
+        .def("Wait", &AnimationFuture::Wait,
+             R"pbdoc(
+			Waits for the step to finish and re-raises its exception, if any.
+		)pbdoc");
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <API/Python/Animation/AnimationFuture.hpp>
 #include <API/Python/Animation/PhysicsAnimation.hpp>
 #include <Core/Animation/Animation.hpp>
 #include <Core/Animation/PhysicsAnimation.hpp>
@@ -52,7 +53,27 @@ void AddPhysicsAnimation(pybind11::module& m)
         .def_property("numberOfFixedSubTimeSteps",
                       &PhysicsAnimation::GetNumberOfFixedSubTimeSteps,
                       &PhysicsAnimation::SetNumberOfFixedSubTimeSteps)
-        .def("AdvanceSingleFrame", &PhysicsAnimation::AdvanceSingleFrame)
+        .def("AdvanceSingleFrame", &PhysicsAnimation::AdvanceSingleFrame,
+             R"pbdoc(
+			Advances a single frame.
+
+			The GIL is released while advancing, so that other Python threads
+			can run in the meantime.
+		)pbdoc",
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "AdvanceSingleFrameAsync",
+            [](const pybind11::object& self) {
+                auto animation = self.cast<PhysicsAnimationPtr>();
+                return std::make_shared<AnimationFuture>(
+                    self, [animation] { animation->AdvanceSingleFrame(); });
+            },
+            R"pbdoc(
+			Advances a single frame on a background thread.
+
+			Returns an AnimationFuture. The animation must not be accessed until
+			the future is ready.
+		)pbdoc")
         .def_property("currentFrame", &PhysicsAnimation::GetCurrentFrame,
                       &PhysicsAnimation::SetCurrentFrame)
         .def_property_readonly("currentTimeInSeconds",
@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <API/Python/Field/ScalarField.hpp>
+#include <API/Python/Utils/NumPyUtils.hpp>
+#include <Core/Field/CustomScalarField.hpp>
 #include <Core/Field/ScalarField.hpp>
 
 #include <pybind11/pybind11.h>
@@ -21,7 +23,67 @@ void AddScalarField2(pybind11::module& m)
         static_cast<pybind11::handle>(m), "ScalarField2",
         R"pbdoc(
 			Abstract base class for 2-D scalar field.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SampleMany",
+            [](const ScalarField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomScalarField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.SampleMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Samples the field at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "GradientMany",
+            [](const ScalarField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyVectorArray<2>(points.Length());
+                EvaluateMany<CustomScalarField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.GradientMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the gradients at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n, 2).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "LaplacianMany",
+            [](const ScalarField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomScalarField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.LaplacianMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the Laplacians at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"));
 }
 
 void AddScalarField3(pybind11::module& m)
@@ -30,5 +92,65 @@ void AddScalarField3(pybind11::module& m)
         static_cast<pybind11::handle>(m), "ScalarField3",
         R"pbdoc(
 			Abstract base class for 3-D scalar field.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SampleMany",
+            [](const ScalarField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomScalarField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.SampleMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Samples the field at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "GradientMany",
+            [](const ScalarField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyVectorArray<3>(points.Length());
+                EvaluateMany<CustomScalarField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.GradientMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the gradients at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n, 3).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "LaplacianMany",
+            [](const ScalarField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomScalarField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.LaplacianMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the Laplacians at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"));
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 // property of any third parties.
 
 #include <API/Python/Field/VectorField.hpp>
+#include <API/Python/Utils/NumPyUtils.hpp>
+#include <Core/Field/CustomVectorField.hpp>
 #include <Core/Field/VectorField.hpp>
 
 #include <pybind11/pybind11.h>
@@ -21,7 +23,67 @@ void AddVectorField2(pybind11::module& m)
         static_cast<pybind11::handle>(m), "VectorField2",
         R"pbdoc(
 			Abstract base class for 2-D vector field.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SampleMany",
+            [](const VectorField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyVectorArray<2>(points.Length());
+                EvaluateMany<CustomVectorField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.SampleMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Samples the field at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n, 2).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "DivergenceMany",
+            [](const VectorField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomVectorField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.DivergenceMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the divergences at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "CurlMany",
+            [](const VectorField2& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<2>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomVectorField2>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.CurlMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the curls at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 2).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"));
 }
 
 void AddVectorField3(pybind11::module& m)
@@ -30,5 +92,65 @@ void AddVectorField3(pybind11::module& m)
         static_cast<pybind11::handle>(m), "VectorField3",
         R"pbdoc(
 			Abstract base class for 3-D vector field.
-		)pbdoc");
+		)pbdoc")
+        .def(
+            "SampleMany",
+            [](const VectorField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyVectorArray<3>(points.Length());
+                EvaluateMany<CustomVectorField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.SampleMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Samples the field at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n, 3).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "DivergenceMany",
+            [](const VectorField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyArray(points.Length());
+                EvaluateMany<CustomVectorField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.DivergenceMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the divergences at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n,).
+		)pbdoc",
+            pybind11::arg("x"))
+        .def(
+            "CurlMany",
+            [](const VectorField3& instance, const NumPyArrayD& x) {
+                const auto points = NumPyArrayToVectorView<3>(x);
+                auto result = MakeNumPyVectorArray<3>(points.Length());
+                EvaluateMany<CustomVectorField3>(
+                    instance, [&](ExecutionPolicy policy) {
+                        instance.CurlMany(points, result.second, policy);
+                    });
+                return result.first;
+            },
+            R"pbdoc(
+			Computes the curls at given positions in parallel.
+
+			Parameters
+			----------
+			- x : NumPy array of shape (n, 3).
+			Returns NumPy array of shape (n, 3).
+		)pbdoc",
+            pybind11::arg("x"));
 }
\ No newline at end of file
@@ -41,6 +41,19 @@ void AddCollider2(pybind11::module& m)
                                R"pbdoc(
 			The surface instance.
 		)pbdoc")
+        .def_property_readonly("shapeRevision", &Collider2::GetShapeRevision,
+                               R"pbdoc(
+			The shape revision which changes when the surface geometry changes.
+		)pbdoc")
+        .def_property_readonly("transformRevision",
+                               &Collider2::GetTransformRevision,
+                               R"pbdoc(
+			The transform revision which changes when the surface has moved.
+		)pbdoc")
+        .def("MarkShapeChanged", &Collider2::MarkShapeChanged,
+             R"pbdoc(
+			Notifies that the surface geometry has been changed in place.
+		)pbdoc")
         .def(
             "VelocityAt",
             [](const Collider2& instance, pybind11::object obj) {
@@ -74,6 +87,19 @@ void AddCollider3(pybind11::module& m)
                                R"pbdoc(
 			The surface instance.
 		)pbdoc")
+        .def_property_readonly("shapeRevision", &Collider3::GetShapeRevision,
+                               R"pbdoc(
+			The shape revision which changes when the surface geometry changes.
+		)pbdoc")
+        .def_property_readonly("transformRevision",
+                               &Collider3::GetTransformRevision,
+                               R"pbdoc(
+			The transform revision which changes when the surface has moved.
+		)pbdoc")
+        .def("MarkShapeChanged", &Collider3::MarkShapeChanged,
+             R"pbdoc(
+			Notifies that the surface geometry has been changed in place.
+		)pbdoc")
         .def(
             "VelocityAt",
             [](const Collider3& instance, pybind11::object obj) {
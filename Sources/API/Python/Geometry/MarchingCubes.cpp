@@ -25,9 +25,12 @@ void AddMarchingCubes(pybind11::module& m)
            pybind11::object origin, double isoValue, int bndClose,
            int bndConnectivity) -> TriangleMesh3Ptr {
             auto mesh = TriangleMesh3::Builder().MakeShared();
-            MarchingCubes(grid->DataView(), ObjectToVector3D(gridSize),
-                          ObjectToVector3D(origin), mesh.get(), isoValue,
-                          bndClose, bndConnectivity);
+            const Vector3D gridSize_ = ObjectToVector3D(gridSize);
+            const Vector3D origin_ = ObjectToVector3D(origin);
+
+            pybind11::gil_scoped_release release;
+            MarchingCubes(grid->DataView(), gridSize_, origin_, mesh.get(),
+                          isoValue, bndClose, bndConnectivity);
             return mesh;
         },
         R"pbdoc(
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <API/Python/Grid/CollocatedVectorGrid.hpp>
+#include <API/Python/Utils/NumPyUtils.hpp>
 #include <API/Python/Utils/pybind11Utils.hpp>
 #include <Core/Grid/CollocatedVectorGrid.hpp>
 
@@ -72,6 +73,7 @@ void AddCollocatedVectorGrid2(pybind11::module& m)
         .def("DataView",
              static_cast<ArrayView2<Vector2D> (CollocatedVectorGrid2::*)()>(
                  &CollocatedVectorGrid2::DataView),
+             pybind11::keep_alive<0, 1>(),
              R"pbdoc(
 			Returns the data array view.
 		)pbdoc")
@@ -79,6 +81,23 @@ void AddCollocatedVectorGrid2(pybind11::module& m)
              R"pbdoc(
 			Returns the function that maps data point to its position.
 		)pbdoc")
+        .def(
+            "FillFromArray",
+            [](CollocatedVectorGrid2& instance, const NumPyArrayD& array) {
+                CopyNumPyArrayToView<Vector2D, 2, 2>(array,
+                                                      instance.DataView());
+            },
+            R"pbdoc(
+			Fills the grid with given NumPy array in parallel.
+
+			The shape of the array must be (size.y, size.x, 2) where size is the
+			data size of the grid.
+
+			Parameters
+			----------
+			- array : NumPy array of the data points.
+		)pbdoc",
+            pybind11::arg("array"))
         .def(
             "ForEachDataPointIndex",
             [](CollocatedVectorGrid2& instance, pybind11::function func) {
@@ -188,6 +207,7 @@ void AddCollocatedVectorGrid3(pybind11::module& m)
         .def("DataView",
              static_cast<ArrayView3<Vector3D> (CollocatedVectorGrid3::*)()>(
                  &CollocatedVectorGrid3::DataView),
+             pybind11::keep_alive<0, 1>(),
              R"pbdoc(
 			Returns the data array view.
 		)pbdoc")
@@ -195,6 +215,23 @@ void AddCollocatedVectorGrid3(pybind11::module& m)
              R"pbdoc(
 			Returns the function that maps data point to its position.
 		)pbdoc")
+        .def(
+            "FillFromArray",
+            [](CollocatedVectorGrid3& instance, const NumPyArrayD& array) {
+                CopyNumPyArrayToView<Vector3D, 3, 3>(array,
+                                                      instance.DataView());
+            },
+            R"pbdoc(
+			Fills the grid with given NumPy array in parallel.
+
+			The shape of the array must be (size.z, size.y, size.x, 3) where size is the
+			data size of the grid.
+
+			Parameters
+			----------
+			- array : NumPy array of the data points.
+		)pbdoc",
+            pybind11::arg("array"))
         .def(
             "ForEachDataPointIndex",
             [](CollocatedVectorGrid3& instance, pybind11::function func) {
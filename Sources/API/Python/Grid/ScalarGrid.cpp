@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <API/Python/Grid/ScalarGrid.hpp>
+#include <API/Python/Utils/NumPyUtils.hpp>
 #include <API/Python/Utils/pybind11Utils.hpp>
 #include <Core/Grid/ScalarGrid.hpp>
 
@@ -115,6 +116,7 @@ void AddScalarGrid2(pybind11::module& m)
         .def("DataView",
              static_cast<ArrayView2<double> (ScalarGrid2::*)()>(
                  &ScalarGrid2::DataView),
+             pybind11::keep_alive<0, 1>(),
              R"pbdoc(Returns the data array view.)pbdoc")
         .def("DataPosition", &ScalarGrid2::DataPosition,
              R"pbdoc(The function that maps data point to its position.)pbdoc")
@@ -146,6 +148,22 @@ void AddScalarGrid2(pybind11::module& m)
             R"pbdoc(
 			Fills the grid with given function.
 		)pbdoc")
+        .def(
+            "FillFromArray",
+            [](ScalarGrid2& instance, const NumPyArrayD& array) {
+                CopyNumPyArrayToView(array, instance.DataView());
+            },
+            R"pbdoc(
+			Fills the grid with given NumPy array in parallel.
+
+			The shape of the array must be the reversed data size, i.e.
+			(resolution.y, resolution.x) for cell-centered grids.
+
+			Parameters
+			----------
+			- array : NumPy array of the data points.
+		)pbdoc",
+            pybind11::arg("array"))
         .def(
             "ForEachDataPointIndex",
             [](ScalarGrid2& instance, pybind11::function func) {
@@ -286,6 +304,7 @@ void AddScalarGrid3(pybind11::module& m)
         .def("DataView",
              static_cast<ArrayView3<double> (ScalarGrid3::*)()>(
                  &ScalarGrid3::DataView),
+             pybind11::keep_alive<0, 1>(),
              R"pbdoc(Returns the data array view.)pbdoc")
         .def("DataPosition", &ScalarGrid3::DataPosition,
              R"pbdoc(The function that maps data point to its position.)pbdoc")
@@ -317,6 +336,22 @@ void AddScalarGrid3(pybind11::module& m)
             R"pbdoc(
 			Fills the grid with given function.
 		)pbdoc")
+        .def(
+            "FillFromArray",
+            [](ScalarGrid3& instance, const NumPyArrayD& array) {
+                CopyNumPyArrayToView(array, instance.DataView());
+            },
+            R"pbdoc(
+			Fills the grid with given NumPy array in parallel.
+
+			The shape of the array must be the reversed data size, i.e.
+			(resolution.z, resolution.y, resolution.x) for cell-centered grids.
+
+			Parameters
+			----------
+			- array : NumPy array of the data points.
+		)pbdoc",
+            pybind11::arg("array"))
         .def(
             "ForEachDataPointIndex",
             [](ScalarGrid3& instance, pybind11::function func) {
@@ -0,0 +1,208 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <API/Python/Particle/ParticleCache.hpp>
+#include <Core/Particle/ParticleCache.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddParticleCache2(pybind11::module& m)
+{
+    pybind11::class_<ParticleCacheWriter2, ParticleCacheWriter2Ptr>(
+        static_cast<pybind11::handle>(m), "ParticleCacheWriter2",
+        R"pbdoc(
+			2-D particle cache writer.
+
+			This class writes one particle system data frame per file. Positions
+			are quantized relative to the bounding box of the particles and can
+			be delta-encoded against the previous frame. Velocities, forces and
+			custom data are optional and can be downcast to float.
+		)pbdoc")
+        .def(pybind11::init([](unsigned int positionBits, bool storeVelocities,
+                               bool storeForces, bool storeCustomData,
+                               bool downcastToFloat, bool useDeltaEncoding,
+                               size_t keyFrameInterval) {
+                 ParticleCacheParameters params;
+                 params.positionBits = positionBits;
+                 params.storeVelocities = storeVelocities;
+                 params.storeForces = storeForces;
+                 params.storeCustomData = storeCustomData;
+                 params.downcastToFloat = downcastToFloat;
+                 params.useDeltaEncoding = useDeltaEncoding;
+                 params.keyFrameInterval = keyFrameInterval;
+
+                 return std::make_shared<ParticleCacheWriter2>(params);
+             }),
+             pybind11::arg("positionBits") = 16,
+             pybind11::arg("storeVelocities") = false,
+             pybind11::arg("storeForces") = false,
+             pybind11::arg("storeCustomData") = false,
+             pybind11::arg("downcastToFloat") = true,
+             pybind11::arg("useDeltaEncoding") = false,
+             pybind11::arg("keyFrameInterval") = 30)
+        .def(
+            "Write",
+            [](ParticleCacheWriter2& instance, const std::string& fileName,
+               const ParticleSystemData2Ptr& particles) {
+                instance.Write(fileName, *particles);
+            },
+            R"pbdoc(
+			Writes the particles as the next frame of the cache.
+
+			The GIL is released while writing.
+
+			Parameters
+			----------
+			- fileName : The file name.
+			- particles : The particle system data.
+		)pbdoc",
+            pybind11::arg("fileName"), pybind11::arg("particles"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("Reset", &ParticleCacheWriter2::Reset,
+             R"pbdoc(
+			Makes the next frame a key frame.
+		)pbdoc")
+        .def_property_readonly("isLastFrameKeyFrame",
+                               &ParticleCacheWriter2::IsLastFrameKeyFrame,
+                               R"pbdoc(
+			True if the last written frame is a key frame.
+		)pbdoc");
+
+    pybind11::class_<ParticleCacheReader2, ParticleCacheReader2Ptr>(
+        static_cast<pybind11::handle>(m), "ParticleCacheReader2",
+        R"pbdoc(
+			2-D particle cache reader.
+
+			Delta-encoded frames should be read in order, starting from a key
+			frame.
+		)pbdoc")
+        .def(pybind11::init<>())
+        .def(
+            "Read",
+            [](ParticleCacheReader2& instance, const std::string& fileName,
+               const ParticleSystemData2Ptr& particles) {
+                instance.Read(fileName, particles.get());
+            },
+            R"pbdoc(
+			Reads the frame in the file into the particles.
+
+			The GIL is released while reading.
+
+			Parameters
+			----------
+			- fileName : The file name.
+			- particles : The particle system data.
+		)pbdoc",
+            pybind11::arg("fileName"), pybind11::arg("particles"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def_property_readonly("isLastFrameKeyFrame",
+                               &ParticleCacheReader2::IsLastFrameKeyFrame,
+                               R"pbdoc(
+			True if the last read frame is a key frame.
+		)pbdoc");
+}
+
+void AddParticleCache3(pybind11::module& m)
+{
+    pybind11::class_<ParticleCacheWriter3, ParticleCacheWriter3Ptr>(
+        static_cast<pybind11::handle>(m), "ParticleCacheWriter3",
+        R"pbdoc(
+			3-D particle cache writer.
+
+			This class writes one particle system data frame per file. Positions
+			are quantized relative to the bounding box of the particles and can
+			be delta-encoded against the previous frame. Velocities, forces and
+			custom data are optional and can be downcast to float.
+		)pbdoc")
+        .def(pybind11::init([](unsigned int positionBits, bool storeVelocities,
+                               bool storeForces, bool storeCustomData,
+                               bool downcastToFloat, bool useDeltaEncoding,
+                               size_t keyFrameInterval) {
+                 ParticleCacheParameters params;
+                 params.positionBits = positionBits;
+                 params.storeVelocities = storeVelocities;
+                 params.storeForces = storeForces;
+                 params.storeCustomData = storeCustomData;
+                 params.downcastToFloat = downcastToFloat;
+                 params.useDeltaEncoding = useDeltaEncoding;
+                 params.keyFrameInterval = keyFrameInterval;
+
+                 return std::make_shared<ParticleCacheWriter3>(params);
+             }),
+             pybind11::arg("positionBits") = 16,
+             pybind11::arg("storeVelocities") = false,
+             pybind11::arg("storeForces") = false,
+             pybind11::arg("storeCustomData") = false,
+             pybind11::arg("downcastToFloat") = true,
+             pybind11::arg("useDeltaEncoding") = false,
+             pybind11::arg("keyFrameInterval") = 30)
+        .def(
+            "Write",
+            [](ParticleCacheWriter3& instance, const std::string& fileName,
+               const ParticleSystemData3Ptr& particles) {
+                instance.Write(fileName, *particles);
+            },
+            R"pbdoc(
+			Writes the particles as the next frame of the cache.
+
+			The GIL is released while writing.
+
+			Parameters
+			----------
+			- fileName : The file name.
+			- particles : The particle system data.
+		)pbdoc",
+            pybind11::arg("fileName"), pybind11::arg("particles"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("Reset", &ParticleCacheWriter3::Reset,
+             R"pbdoc(
+			Makes the next frame a key frame.
+		)pbdoc")
+        .def_property_readonly("isLastFrameKeyFrame",
+                               &ParticleCacheWriter3::IsLastFrameKeyFrame,
+                               R"pbdoc(
+			True if the last written frame is a key frame.
+		)pbdoc");
+
+    pybind11::class_<ParticleCacheReader3, ParticleCacheReader3Ptr>(
+        static_cast<pybind11::handle>(m), "ParticleCacheReader3",
+        R"pbdoc(
+			3-D particle cache reader.
+
+			Delta-encoded frames should be read in order, starting from a key
+			frame.
+		)pbdoc")
+        .def(pybind11::init<>())
+        .def(
+            "Read",
+            [](ParticleCacheReader3& instance, const std::string& fileName,
+               const ParticleSystemData3Ptr& particles) {
+                instance.Read(fileName, particles.get());
+            },
+            R"pbdoc(
+			Reads the frame in the file into the particles.
+
+			The GIL is released while reading.
+
+			Parameters
+			----------
+			- fileName : The file name.
+			- particles : The particle system data.
+		)pbdoc",
+            pybind11::arg("fileName"), pybind11::arg("particles"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def_property_readonly("isLastFrameKeyFrame",
+                               &ParticleCacheReader3::IsLastFrameKeyFrame,
+                               R"pbdoc(
+			True if the last read frame is a key frame.
+		)pbdoc");
+}
\ No newline at end of file
@@ -255,6 +255,69 @@ void AddParticleSystemData2(pybind11::module& m)
 			PointParallelHashGridSearcher2::GetBuildNeighborLists. Each list stores
 			indices of the neighbors.
 		)pbdoc")
+        .def("BuildNeighborSearcher",
+             &ParticleSystemData2::BuildNeighborSearcher,
+             R"pbdoc(
+			Builds neighbor searcher with given search radius.
+
+			The GIL is released while building.
+
+			Parameters
+			----------
+			- maxSearchRadius : Max search radius.
+		)pbdoc",
+             pybind11::arg("maxSearchRadius"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("BuildNeighborLists", &ParticleSystemData2::BuildNeighborLists,
+             R"pbdoc(
+			Builds neighbor lists with given search radius.
+
+			The GIL is released while building.
+
+			Parameters
+			----------
+			- maxSearchRadius : Max search radius.
+		)pbdoc",
+             pybind11::arg("maxSearchRadius"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "SerializeChannelsToFile",
+            [](const ParticleSystemData2& instance,
+               const std::string& fileName) {
+                ChannelStreamWriter writer(fileName);
+                instance.Serialize(&writer);
+            },
+            R"pbdoc(
+			Writes the particle data into the file channel by channel.
+
+			Each channel is written directly from the particle arrays without
+			building an intermediate buffer. The neighbor searcher and the
+			neighbor lists are not written. The GIL is released while writing.
+
+			Parameters
+			----------
+			- fileName : The file name.
+		)pbdoc",
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "DeserializeChannelsFromFile",
+            [](ParticleSystemData2& instance, const std::string& fileName) {
+                const MappedChannelReader reader(fileName);
+                instance.Deserialize(reader);
+            },
+            R"pbdoc(
+			Reads the particle data from the memory-mapped file.
+
+			The file should be written by SerializeChannelsToFile. The GIL is
+			released while reading.
+
+			Parameters
+			----------
+			- fileName : The file name.
+		)pbdoc",
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
         .def(
             "Set",
             [](ParticleSystemData2& instance,
@@ -503,6 +566,69 @@ void AddParticleSystemData3(pybind11::module& m)
 			PointParallelHashGridSearcher2::buildNeighborLists. Each list stores
 			indices of the neighbors.
 		)pbdoc")
+        .def("BuildNeighborSearcher",
+             &ParticleSystemData3::BuildNeighborSearcher,
+             R"pbdoc(
+			Builds neighbor searcher with given search radius.
+
+			The GIL is released while building.
+
+			Parameters
+			----------
+			- maxSearchRadius : Max search radius.
+		)pbdoc",
+             pybind11::arg("maxSearchRadius"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("BuildNeighborLists", &ParticleSystemData3::BuildNeighborLists,
+             R"pbdoc(
+			Builds neighbor lists with given search radius.
+
+			The GIL is released while building.
+
+			Parameters
+			----------
+			- maxSearchRadius : Max search radius.
+		)pbdoc",
+             pybind11::arg("maxSearchRadius"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "SerializeChannelsToFile",
+            [](const ParticleSystemData3& instance,
+               const std::string& fileName) {
+                ChannelStreamWriter writer(fileName);
+                instance.Serialize(&writer);
+            },
+            R"pbdoc(
+			Writes the particle data into the file channel by channel.
+
+			Each channel is written directly from the particle arrays without
+			building an intermediate buffer. The neighbor searcher and the
+			neighbor lists are not written. The GIL is released while writing.
+
+			Parameters
+			----------
+			- fileName : The file name.
+		)pbdoc",
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def(
+            "DeserializeChannelsFromFile",
+            [](ParticleSystemData3& instance, const std::string& fileName) {
+                const MappedChannelReader reader(fileName);
+                instance.Deserialize(reader);
+            },
+            R"pbdoc(
+			Reads the particle data from the memory-mapped file.
+
+			The file should be written by SerializeChannelsToFile. The GIL is
+			released while reading.
+
+			Parameters
+			----------
+			- fileName : The file name.
+		)pbdoc",
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
         .def(
             "Set",
             [](ParticleSystemData3& instance,
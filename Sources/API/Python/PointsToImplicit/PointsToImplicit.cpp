@@ -36,6 +36,8 @@ void AddPointsToImplicit2(pybind11::module& m)
 
                 ConstArrayView1<Vector2D> pointsAcc(points_.data(),
                                                     points_.size());
+
+                pybind11::gil_scoped_release release;
                 instance.Convert(pointsAcc, output.get());
             },
             R"pbdoc(
@@ -68,6 +70,8 @@ void AddPointsToImplicit3(pybind11::module& m)
 
                 ConstArrayView1<Vector3D> pointsAcc(points_.data(),
                                                     points_.size());
+
+                pybind11::gil_scoped_release release;
                 instance.Convert(pointsAcc, output.get());
             },
             R"pbdoc(
@@ -40,7 +40,13 @@ void AddSPHPointsToImplicit2(pybind11::module& m)
 		)pbdoc",
              pybind11::arg("kernelRadius") = 1.0,
              pybind11::arg("cutOffDensity") = 0.5,
-             pybind11::arg("isOutputSDF") = true);
+             pybind11::arg("isOutputSDF") = true)
+        .def_property("useSplatting", &SPHPointsToImplicit2::GetUseSplatting,
+                      &SPHPointsToImplicit2::SetUseSplatting,
+                      R"pbdoc(
+			True if the points are splatted onto the grid instead of gathering
+			the neighbors of every grid point. Disabled by default.
+		)pbdoc");
 }
 
 void AddSPHPointsToImplicit3(pybind11::module& m)
@@ -67,5 +73,11 @@ void AddSPHPointsToImplicit3(pybind11::module& m)
 		)pbdoc",
              pybind11::arg("kernelRadius") = 1.0,
              pybind11::arg("cutOffDensity") = 0.5,
-             pybind11::arg("isOutputSDF") = true);
+             pybind11::arg("isOutputSDF") = true)
+        .def_property("useSplatting", &SPHPointsToImplicit3::GetUseSplatting,
+                      &SPHPointsToImplicit3::SetUseSplatting,
+                      R"pbdoc(
+			True if the points are splatted onto the grid instead of gathering
+			the neighbors of every grid point. Disabled by default.
+		)pbdoc");
 }
\ No newline at end of file
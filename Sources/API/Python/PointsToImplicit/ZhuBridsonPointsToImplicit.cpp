@@ -39,7 +39,14 @@ void AddZhuBridsonPointsToImplicit2(pybind11::module& m)
 		)pbdoc",
              pybind11::arg("kernelRadius") = 1.0,
              pybind11::arg("cutOffThreshold") = 0.25,
-             pybind11::arg("isOutputSDF") = true);
+             pybind11::arg("isOutputSDF") = true)
+        .def_property("useSplatting",
+                      &ZhuBridsonPointsToImplicit2::GetUseSplatting,
+                      &ZhuBridsonPointsToImplicit2::SetUseSplatting,
+                      R"pbdoc(
+			True if the points are splatted onto the grid instead of gathering
+			the neighbors of every grid point. Disabled by default.
+		)pbdoc");
 }
 
 void AddZhuBridsonPointsToImplicit3(pybind11::module& m)
@@ -65,5 +72,12 @@ void AddZhuBridsonPointsToImplicit3(pybind11::module& m)
 		)pbdoc",
              pybind11::arg("kernelRadius") = 1.0,
              pybind11::arg("cutOffThreshold") = 0.25,
-             pybind11::arg("isOutputSDF") = true);
+             pybind11::arg("isOutputSDF") = true)
+        .def_property("useSplatting",
+                      &ZhuBridsonPointsToImplicit3::GetUseSplatting,
+                      &ZhuBridsonPointsToImplicit3::SetUseSplatting,
+                      R"pbdoc(
+			True if the points are splatted onto the grid instead of gathering
+			the neighbors of every grid point. Disabled by default.
+		)pbdoc");
 }
\ No newline at end of file
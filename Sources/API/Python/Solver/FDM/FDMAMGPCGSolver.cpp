@@ -0,0 +1,113 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <API/Python/Solver/FDM/FDMAMGPCGSolver.hpp>
+#include <Core/Solver/FDM/FDMAMGPCGSolver2.hpp>
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace CubbyFlow;
+
+void AddFDMAMGPCGSolver2(pybind11::module& m)
+{
+    pybind11::class_<FDMAMGPCGSolver2, FDMAMGPCGSolver2Ptr,
+                     FDMLinearSystemSolver2>(m, "FDMAMGPCGSolver2",
+                                             R"pbdoc(
+			2-D finite difference-type linear system solver using AMGPCG.
+		)pbdoc")
+        .def(pybind11::init([](uint32_t maxNumberOfIterations, double tolerance,
+                               size_t maxNumberOfLevels, size_t coarsestSize,
+                               double strengthThreshold) {
+                 AMGParameters params;
+                 params.maxNumberOfLevels = maxNumberOfLevels;
+                 params.coarsestSize = coarsestSize;
+                 params.strengthThreshold = strengthThreshold;
+
+                 return std::make_shared<FDMAMGPCGSolver2>(
+                     maxNumberOfIterations, tolerance, params);
+             }),
+             pybind11::arg("maxNumberOfIterations"), pybind11::arg("tolerance"),
+             pybind11::arg("maxNumberOfLevels") = 10,
+             pybind11::arg("coarsestSize") = 64,
+             pybind11::arg("strengthThreshold") = 0.08)
+        .def_property_readonly("maxNumberOfIterations",
+                               &FDMAMGPCGSolver2::GetMaxNumberOfIterations,
+                               R"pbdoc(
+			Max number of AMGPCG iterations.
+		)pbdoc")
+        .def_property_readonly("lastNumberOfIterations",
+                               &FDMAMGPCGSolver2::GetLastNumberOfIterations,
+                               R"pbdoc(
+			The last number of AMGPCG iterations the solver made.
+		)pbdoc")
+        .def_property_readonly("tolerance", &FDMAMGPCGSolver2::GetTolerance,
+                               R"pbdoc(
+			The max residual tolerance for the AMGPCG method.
+		)pbdoc")
+        .def_property_readonly("lastResidual",
+                               &FDMAMGPCGSolver2::GetLastResidual,
+                               R"pbdoc(
+			The last residual after the AMGPCG iterations.
+		)pbdoc")
+        .def_property_readonly("numberOfLevels",
+                               &FDMAMGPCGSolver2::GetNumberOfLevels,
+                               R"pbdoc(
+			The number of levels of the last multigrid hierarchy.
+		)pbdoc");
+}
+
+void AddFDMAMGPCGSolver3(pybind11::module& m)
+{
+    pybind11::class_<FDMAMGPCGSolver3, FDMAMGPCGSolver3Ptr,
+                     FDMLinearSystemSolver3>(m, "FDMAMGPCGSolver3",
+                                             R"pbdoc(
+			3-D finite difference-type linear system solver using AMGPCG.
+		)pbdoc")
+        .def(pybind11::init([](uint32_t maxNumberOfIterations, double tolerance,
+                               size_t maxNumberOfLevels, size_t coarsestSize,
+                               double strengthThreshold) {
+                 AMGParameters params;
+                 params.maxNumberOfLevels = maxNumberOfLevels;
+                 params.coarsestSize = coarsestSize;
+                 params.strengthThreshold = strengthThreshold;
+
+                 return std::make_shared<FDMAMGPCGSolver3>(
+                     maxNumberOfIterations, tolerance, params);
+             }),
+             pybind11::arg("maxNumberOfIterations"), pybind11::arg("tolerance"),
+             pybind11::arg("maxNumberOfLevels") = 10,
+             pybind11::arg("coarsestSize") = 64,
+             pybind11::arg("strengthThreshold") = 0.08)
+        .def_property_readonly("maxNumberOfIterations",
+                               &FDMAMGPCGSolver3::GetMaxNumberOfIterations,
+                               R"pbdoc(
+			Max number of AMGPCG iterations.
+		)pbdoc")
+        .def_property_readonly("lastNumberOfIterations",
+                               &FDMAMGPCGSolver3::GetLastNumberOfIterations,
+                               R"pbdoc(
+			The last number of AMGPCG iterations the solver made.
+		)pbdoc")
+        .def_property_readonly("tolerance", &FDMAMGPCGSolver3::GetTolerance,
+                               R"pbdoc(
+			The max residual tolerance for the AMGPCG method.
+		)pbdoc")
+        .def_property_readonly("lastResidual",
+                               &FDMAMGPCGSolver3::GetLastResidual,
+                               R"pbdoc(
+			The last residual after the AMGPCG iterations.
+		)pbdoc")
+        .def_property_readonly("numberOfLevels",
+                               &FDMAMGPCGSolver3::GetNumberOfLevels,
+                               R"pbdoc(
+			The number of levels of the last multigrid hierarchy.
+		)pbdoc");
+}
\ No newline at end of file
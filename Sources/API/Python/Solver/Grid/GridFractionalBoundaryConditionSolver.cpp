@@ -103,5 +103,17 @@ void AddGridFractionalBoundaryConditionSolver3(pybind11::module& m)
             &GridFractionalBoundaryConditionSolver3::GetColliderVelocityField,
             R"pbdoc(
 			Velocity field of the collider.
+		)pbdoc")
+        .def_property(
+            "useIncrementalUpdate",
+            &GridFractionalBoundaryConditionSolver3::GetUseIncrementalUpdate,
+            &GridFractionalBoundaryConditionSolver3::SetUseIncrementalUpdate,
+            R"pbdoc(
+			True if the collider SDF is updated incrementally.
+
+			When enabled, the collider SDF is not re-rasterized if the collider is
+			unchanged, and only the swept region is re-rasterized if the collider
+			has only moved. Surface edits are only detected through
+			Collider.MarkShapeChanged, so it is disabled by default.
 		)pbdoc");
 }
\ No newline at end of file
@@ -93,5 +93,24 @@ void AddGridFractionalSinglePhasePressureSolver3(pybind11::module& m)
             &GridFractionalSinglePhasePressureSolver3::SetLinearSystemSolver,
             R"pbdoc(
 			"The linear system solver."
+		)pbdoc")
+        .def_property(
+            "useWarmStart",
+            &GridFractionalSinglePhasePressureSolver3::GetUseWarmStart,
+            &GridFractionalSinglePhasePressureSolver3::SetUseWarmStart,
+            R"pbdoc(
+			True if the solver is warm started from the last pressure.
+		)pbdoc")
+        .def_property_readonly(
+            "lastNumberOfIterations",
+            &GridFractionalSinglePhasePressureSolver3::GetLastNumberOfIterations,
+            R"pbdoc(
+			The number of iterations of the last linear system solve.
+		)pbdoc")
+        .def_property_readonly(
+            "lastResidual",
+            &GridFractionalSinglePhasePressureSolver3::GetLastResidual,
+            R"pbdoc(
+			The residual of the last linear system solve.
 		)pbdoc");
 }
\ No newline at end of file
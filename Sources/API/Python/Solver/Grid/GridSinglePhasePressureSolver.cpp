@@ -69,5 +69,35 @@ void AddGridSinglePhasePressureSolver3(pybind11::module& m)
                       &GridSinglePhasePressureSolver3::SetLinearSystemSolver,
                       R"pbdoc(
 			"The linear system solver."
+		)pbdoc")
+        .def_property("useWarmStart",
+                      &GridSinglePhasePressureSolver3::GetUseWarmStart,
+                      &GridSinglePhasePressureSolver3::SetUseWarmStart,
+                      R"pbdoc(
+			True if the solver is warm started from the last pressure.
+		)pbdoc")
+        .def_property("useMatrixFree",
+                      &GridSinglePhasePressureSolver3::GetUseMatrixFree,
+                      &GridSinglePhasePressureSolver3::SetUseMatrixFree,
+                      R"pbdoc(
+			True if the solver evaluates the matrix from the cell markers
+			instead of assembling it.
+		)pbdoc")
+        .def_property_readonly(
+            "lastNumberOfIterations",
+            &GridSinglePhasePressureSolver3::GetLastNumberOfIterations,
+            R"pbdoc(
+			The number of iterations of the last linear system solve.
+		)pbdoc")
+        .def_property_readonly("lastResidual",
+                               &GridSinglePhasePressureSolver3::GetLastResidual,
+                               R"pbdoc(
+			The residual of the last linear system solve.
+		)pbdoc")
+        .def_property_readonly(
+            "isLastSystemReused",
+            &GridSinglePhasePressureSolver3::IsLastSystemReused,
+            R"pbdoc(
+			True if the last solve reused the previous system matrix.
 		)pbdoc");
 }
\ No newline at end of file
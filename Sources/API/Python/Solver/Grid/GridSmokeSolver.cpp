@@ -228,6 +228,38 @@ void AddGridSmokeSolver3(pybind11::module& m)
 			In addition to the diffusion, the temperature also can fade-out over
 			time by setting the decay factor between 0 and 1.
 		)pbdoc")
+        .def_property("useActiveRegion", &GridSmokeSolver3::GetUseActiveRegion,
+                      &GridSmokeSolver3::SetUseActiveRegion,
+                      R"pbdoc(
+			True if the smoke is only updated within the active region.
+
+			The domain is divided into tiles of 8x8x8 cells and a tile becomes
+			active if it has smoke density or temperature above the active region
+			threshold. Advection, diffusion, decay and buoyancy of the smoke only
+			run on the (dilated) active tiles.
+		)pbdoc")
+        .def_property("activeRegionThreshold",
+                      &GridSmokeSolver3::GetActiveRegionThreshold,
+                      &GridSmokeSolver3::SetActiveRegionThreshold,
+                      R"pbdoc(
+			The threshold of smoke density and temperature to activate the tiles.
+		)pbdoc")
+        .def_property("useActiveRegionForPressure",
+                      &GridSmokeSolver3::GetUseActiveRegionForPressure,
+                      &GridSmokeSolver3::SetUseActiveRegionForPressure,
+                      R"pbdoc(
+			True if the pressure is only solved within the active region.
+		)pbdoc")
+        .def_property_readonly("numberOfActiveTiles",
+                               &GridSmokeSolver3::GetNumberOfActiveTiles,
+                               R"pbdoc(
+			Returns the number of active tiles of the last time-step.
+		)pbdoc")
+        .def_property_readonly("activeRegion",
+                               &GridSmokeSolver3::GetActiveRegion,
+                               R"pbdoc(
+			Returns the bounding box of the active tiles of the last time-step.
+		)pbdoc")
         .def_property_readonly("smokeDensity",
                                &GridSmokeSolver3::GetSmokeDensity,
                                R"pbdoc(
@@ -193,5 +193,11 @@ void AddIterativeLevelSetSolver3(pybind11::module& m)
                       &IterativeLevelSetSolver3::SetMaxCFL,
                       R"pbdoc(
 			The maximum CFL limit.
+		)pbdoc")
+        .def_property("useNarrowBand",
+                      &IterativeLevelSetSolver3::GetUseNarrowBand,
+                      &IterativeLevelSetSolver3::SetUseNarrowBand,
+                      R"pbdoc(
+			True if the solver only updates the narrow band around the interface.
 		)pbdoc");
 }
\ No newline at end of file
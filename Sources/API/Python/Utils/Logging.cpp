@@ -29,5 +29,8 @@ void AddLogging(pybind11::module& m)
     pybind11::class_<Logging>(m, "Logging")
         .def_static("SetLevel", &Logging::SetLevel)
         .def_static("Mute", &Logging::Mute)
-        .def_static("Unmute", &Logging::Unmute);
+        .def_static("Unmute", &Logging::Unmute)
+        .def_static("SetAsyncMode", &Logging::SetAsyncMode)
+        .def_static("IsAsyncMode", &Logging::IsAsyncMode)
+        .def_static("Flush", &Logging::Flush);
 }
\ No newline at end of file
@@ -14,8 +14,6 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
-#include <fstream>
-
 using namespace CubbyFlow;
 
 void AddSerializable(pybind11::module& m)
@@ -38,25 +36,13 @@ void AddSerializable(pybind11::module& m)
         .def(
             "SerializeToFile",
             [](const Serializable& instance, const std::string& fileName) {
-                std::vector<uint8_t> buffer;
-                instance.Serialize(&buffer);
-                std::ofstream file(fileName.c_str(), std::ios::binary);
-
-                if (file)
-                {
-                    file.write(reinterpret_cast<char*>(buffer.data()),
-                               buffer.size());
-                    file.close();
-                }
-                else
-                {
-                    throw std::invalid_argument("Cannot write to file.");
-                }
+                Serialize(&instance, fileName);
             },
             R"pbdoc(
 			Serializes this instance into the file.
 		)pbdoc",
-            pybind11::arg("fileName"))
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>())
         .def("Deserialize", &Serializable::Deserialize,
              R"pbdoc(
 			Deserializes this instance from the flat buffer.
@@ -65,22 +51,11 @@ void AddSerializable(pybind11::module& m)
         .def(
             "DeserializeFromFile",
             [](Serializable& instance, const std::string& fileName) {
-                std::ifstream file(fileName.c_str(), std::ios::binary);
-                if (file)
-                {
-                    std::vector<uint8_t> buffer(
-                        (std::istreambuf_iterator<char>(file)),
-                        (std::istreambuf_iterator<char>()));
-                    instance.Deserialize(buffer);
-                    file.close();
-                }
-                else
-                {
-                    throw std::invalid_argument("Cannot write to file.");
-                }
+                Deserialize(fileName, &instance);
             },
             R"pbdoc(
-			Deserializes this instance from the flat buffer.
+			Deserializes this instance from the file.
 		)pbdoc",
-            pybind11::arg("fileName"));
+            pybind11::arg("fileName"),
+            pybind11::call_guard<pybind11::gil_scoped_release>());
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <API/Python/Animation/Animation.hpp>
+#include <API/Python/Animation/AnimationFuture.hpp>
 #include <API/Python/Animation/Frame.hpp>
 #include <API/Python/Animation/PhysicsAnimation.hpp>
 #include <API/Python/Array/ArrayView.hpp>
@@ -54,6 +55,7 @@
 #include <API/Python/Grid/VertexCenteredScalarGrid.hpp>
 #include <API/Python/Grid/VertexCenteredVectorGrid.hpp>
 #include <API/Python/Math/Quaternion.hpp>
+#include <API/Python/Particle/ParticleCache.hpp>
 #include <API/Python/Particle/ParticleSystemData.hpp>
 #include <API/Python/Particle/SPH/SPHSystemData.hpp>
 #include <API/Python/PointsToImplicit/AnisotropicPointsToImplicit.hpp>
@@ -64,6 +66,7 @@
 #include <API/Python/Solver/Advection/AdvectionSolver.hpp>
 #include <API/Python/Solver/Advection/CubicSemiLagrangian.hpp>
 #include <API/Python/Solver/Advection/SemiLagrangian.hpp>
+#include <API/Python/Solver/FDM/FDMAMGPCGSolver.hpp>
 #include <API/Python/Solver/FDM/FDMCGSolver.hpp>
 #include <API/Python/Solver/FDM/FDMGaussSeidelSolver.hpp>
 #include <API/Python/Solver/FDM/FDMICCGSolver.hpp>
@@ -220,6 +223,8 @@ PYBIND11_MODULE(pyCubbyFlow, m)
     AddParticleSystemData3(m);
     AddSPHSystemData2(m);
     AddSPHSystemData3(m);
+    AddParticleCache2(m);
+    AddParticleCache3(m);
 
     // Emitters
     AddGridEmitter2(m);
@@ -268,6 +273,8 @@ PYBIND11_MODULE(pyCubbyFlow, m)
     AddFDMMGSolver3(m);
     AddFDMMGPCGSolver2(m);
     AddFDMMGPCGSolver3(m);
+    AddFDMAMGPCGSolver2(m);
+    AddFDMAMGPCGSolver3(m);
     AddGridDiffusionSolver2(m);
     AddGridDiffusionSolver3(m);
     AddGridForwardEulerDiffusionSolver2(m);
@@ -310,6 +317,7 @@ PYBIND11_MODULE(pyCubbyFlow, m)
     AddZhuBridsonPointsToImplicit3(m);
 
     // Animations
+    AddAnimationFuture(m);
     AddAnimation(m);
     AddPhysicsAnimation(m);
 
@@ -0,0 +1,257 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Utils/Logging.hpp>
+
+#include <stdexcept>
+
+namespace CubbyFlow
+{
+FrameExporter::FrameExporter(Writer writer, size_t maxQueueDepth)
+    : m_writer{ std::move(writer) }, m_maxQueueDepth{ maxQueueDepth }
+{
+    if (!m_writer)
+    {
+        throw std::invalid_argument{ "The writer must not be empty." };
+    }
+
+    if (m_maxQueueDepth == 0)
+    {
+        throw std::invalid_argument{
+            "The max queue depth must be greater than 0."
+        };
+    }
+
+    m_thread = std::thread{ [this]() { Run(); } };
+}
+
+FrameExporter::~FrameExporter()
+{
+    Stop();
+
+    if (m_error)
+    {
+        try
+        {
+            std::rethrow_exception(m_error);
+        }
+        catch (const std::exception& e)
+        {
+            CUBBYFLOW_ERROR << "Unreported frame exporter error: " << e.what();
+        }
+        catch (...)
+        {
+            CUBBYFLOW_ERROR << "Unreported frame exporter error.";
+        }
+    }
+}
+
+size_t FrameExporter::AddScalarChannel(ScalarChannelSource source)
+{
+    m_scalarChannelSources.push_back(std::move(source));
+    return m_scalarChannelSources.size() - 1;
+}
+
+size_t FrameExporter::AddVectorChannel(VectorChannelSource source)
+{
+    m_vectorChannelSources.push_back(std::move(source));
+    return m_vectorChannelSources.size() - 1;
+}
+
+size_t FrameExporter::AddScalarGrid(ScalarGridSource source)
+{
+    m_scalarGridSources.push_back(std::move(source));
+    return m_scalarGridSources.size() - 1;
+}
+
+size_t FrameExporter::AddVectorGrid(VectorGridSource source)
+{
+    m_vectorGridSources.push_back(std::move(source));
+    return m_vectorGridSources.size() - 1;
+}
+
+void FrameExporter::Capture(const Frame& frame)
+{
+    Snapshot snapshot;
+
+    {
+        std::unique_lock<std::mutex> lock{ m_mutex };
+
+        if (m_isStopped)
+        {
+            throw std::logic_error{ "The frame exporter has been stopped." };
+        }
+
+        // Backpressure: wait until the writer takes a snapshot off the queue.
+        m_doneCondition.wait(lock, [this]() {
+            return m_queue.size() < m_maxQueueDepth || m_error;
+        });
+
+        RethrowIfFailed();
+
+        if (!m_freeSnapshots.empty())
+        {
+            snapshot = std::move(m_freeSnapshots.back());
+            m_freeSnapshots.pop_back();
+        }
+    }
+
+    // Copying into a recycled snapshot reuses its storage, and it does not
+    // need the lock since the writer never touches the snapshot being filled.
+    snapshot.frame = frame;
+
+    snapshot.scalarChannels.resize(m_scalarChannelSources.size());
+    for (size_t i = 0; i < m_scalarChannelSources.size(); ++i)
+    {
+        snapshot.scalarChannels[i].CopyFrom(m_scalarChannelSources[i]());
+    }
+
+    snapshot.vectorChannels.resize(m_vectorChannelSources.size());
+    for (size_t i = 0; i < m_vectorChannelSources.size(); ++i)
+    {
+        snapshot.vectorChannels[i].CopyFrom(m_vectorChannelSources[i]());
+    }
+
+    snapshot.scalarGrids.resize(m_scalarGridSources.size());
+    for (size_t i = 0; i < m_scalarGridSources.size(); ++i)
+    {
+        snapshot.scalarGrids[i].CopyFrom(m_scalarGridSources[i]());
+    }
+
+    snapshot.vectorGrids.resize(m_vectorGridSources.size());
+    for (size_t i = 0; i < m_vectorGridSources.size(); ++i)
+    {
+        snapshot.vectorGrids[i].CopyFrom(m_vectorGridSources[i]());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_queue.push_back(std::move(snapshot));
+    }
+
+    m_queueCondition.notify_one();
+}
+
+void FrameExporter::Flush()
+{
+    std::unique_lock<std::mutex> lock{ m_mutex };
+
+    m_doneCondition.wait(lock, [this]() {
+        return (m_queue.empty() && !m_isWriting) || m_error;
+    });
+
+    RethrowIfFailed();
+}
+
+void FrameExporter::Wait()
+{
+    Stop();
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    RethrowIfFailed();
+}
+
+size_t FrameExporter::GetMaxQueueDepth() const
+{
+    return m_maxQueueDepth;
+}
+
+size_t FrameExporter::NumberOfPendingFrames() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_queue.size() + (m_isWriting ? 1 : 0);
+}
+
+size_t FrameExporter::NumberOfExportedFrames() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_numberOfExportedFrames;
+}
+
+void FrameExporter::Run()
+{
+    std::unique_lock<std::mutex> lock{ m_mutex };
+
+    while (true)
+    {
+        m_queueCondition.wait(
+            lock, [this]() { return m_isStopped || !m_queue.empty(); });
+
+        // Drain the queue before stopping so no frame is lost.
+        if (m_queue.empty())
+        {
+            break;
+        }
+
+        Snapshot snapshot = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_isWriting = true;
+
+        // Let Capture() queue the next frame while this one is written.
+        m_doneCondition.notify_all();
+
+        lock.unlock();
+
+        std::exception_ptr error;
+        try
+        {
+            m_writer(snapshot);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+
+        if (error)
+        {
+            if (!m_error)
+            {
+                m_error = error;
+            }
+        }
+        else
+        {
+            ++m_numberOfExportedFrames;
+        }
+
+        m_isWriting = false;
+        m_freeSnapshots.push_back(std::move(snapshot));
+        m_doneCondition.notify_all();
+    }
+}
+
+void FrameExporter::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_isStopped = true;
+    }
+
+    m_queueCondition.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void FrameExporter::RethrowIfFailed()
+{
+    if (m_error)
+    {
+        const std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+}  // namespace CubbyFlow
\ No newline at end of file
@@ -61,6 +61,16 @@ double PhysicsAnimation::GetCurrentTimeInSeconds() const
     return m_currentTime;
 }
 
+const FrameExporterPtr& PhysicsAnimation::GetFrameExporter() const
+{
+    return m_frameExporter;
+}
+
+void PhysicsAnimation::SetFrameExporter(const FrameExporterPtr& exporter)
+{
+    m_frameExporter = exporter;
+}
+
 unsigned int PhysicsAnimation::GetNumberOfSubTimeSteps(
     double timeIntervalInSeconds) const
 {
@@ -70,6 +80,34 @@ unsigned int PhysicsAnimation::GetNumberOfSubTimeSteps(
     return m_numberOfFixedSubTimeSteps;
 }
 
+void PhysicsAnimation::SaveCheckpoint(Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue("animation/frameIndex", m_currentFrame.index);
+    checkpoint->WriteValue("animation/frameTimeInterval",
+                           m_currentFrame.timeIntervalInSeconds);
+    checkpoint->WriteValue("animation/isUsingFixedSubTimeSteps",
+                           m_isUsingFixedSubTimeSteps);
+    checkpoint->WriteValue("animation/numberOfFixedSubTimeSteps",
+                           m_numberOfFixedSubTimeSteps);
+    checkpoint->WriteValue("animation/currentTime", m_currentTime);
+
+    OnSaveCheckpoint(checkpoint);
+}
+
+void PhysicsAnimation::LoadCheckpoint(const Checkpoint& checkpoint)
+{
+    m_currentFrame.index = checkpoint.Value<int>("animation/frameIndex");
+    m_currentFrame.timeIntervalInSeconds =
+        checkpoint.Value<double>("animation/frameTimeInterval");
+    m_isUsingFixedSubTimeSteps =
+        checkpoint.Value<bool>("animation/isUsingFixedSubTimeSteps");
+    m_numberOfFixedSubTimeSteps =
+        checkpoint.Value<unsigned int>("animation/numberOfFixedSubTimeSteps");
+    m_currentTime = checkpoint.Value<double>("animation/currentTime");
+
+    OnLoadCheckpoint(checkpoint);
+}
+
 void PhysicsAnimation::OnUpdate(const Frame& frame)
 {
     if (frame.index > m_currentFrame.index)
@@ -87,6 +125,11 @@ void PhysicsAnimation::OnUpdate(const Frame& frame)
         }
 
         m_currentFrame = frame;
+
+        if (m_frameExporter)
+        {
+            m_frameExporter->Capture(frame);
+        }
     }
 }
 
@@ -156,4 +199,14 @@ void PhysicsAnimation::OnInitialize()
 {
     // Do nothing
 }
+
+void PhysicsAnimation::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    UNUSED_VARIABLE(checkpoint);
+}
+
+void PhysicsAnimation::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    UNUSED_VARIABLE(checkpoint);
+}
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Emitter/GridEmitter3.hpp>
+#include <Core/Utils/Macros.hpp>
 
 namespace CubbyFlow
 {
@@ -40,9 +41,39 @@ void GridEmitter3::SetOnBeginUpdateCallback(
     m_onBeginUpdateCallback = callback;
 }
 
+void GridEmitter3::SaveCheckpoint(const std::string& prefix,
+                                  Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/isEnabled", m_isEnabled);
+
+    OnSaveCheckpoint(prefix, checkpoint);
+}
+
+void GridEmitter3::LoadCheckpoint(const std::string& prefix,
+                                  const Checkpoint& checkpoint)
+{
+    m_isEnabled = checkpoint.Value<bool>(prefix + "/isEnabled");
+
+    OnLoadCheckpoint(prefix, checkpoint);
+}
+
 void GridEmitter3::CallOnBeginUpdateCallback(double currentTimeInSeconds,
                                              double timeIntervalInSeconds)
 {
     m_onBeginUpdateCallback(this, currentTimeInSeconds, timeIntervalInSeconds);
 }
+
+void GridEmitter3::OnSaveCheckpoint(const std::string& prefix,
+                                    Checkpoint* checkpoint) const
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
+void GridEmitter3::OnLoadCheckpoint(const std::string& prefix,
+                                    const Checkpoint& checkpoint)
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -10,6 +10,9 @@
 
 #include <Core/Emitter/GridEmitterSet3.hpp>
 
+#include <stdexcept>
+#include <string>
+
 namespace CubbyFlow
 {
 GridEmitterSet3::GridEmitterSet3(const std::vector<GridEmitter3Ptr>& emitters)
@@ -39,6 +42,35 @@ void GridEmitterSet3::OnUpdate(double currentTimeInSeconds,
     }
 }
 
+void GridEmitterSet3::OnSaveCheckpoint(const std::string& prefix,
+                                       Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfEmitters",
+                                     m_emitters.size());
+
+    for (size_t i = 0; i < m_emitters.size(); ++i)
+    {
+        m_emitters[i]->SaveCheckpoint(prefix + "/" + std::to_string(i),
+                                      checkpoint);
+    }
+}
+
+void GridEmitterSet3::OnLoadCheckpoint(const std::string& prefix,
+                                       const Checkpoint& checkpoint)
+{
+    if (checkpoint.Value<uint64_t>(prefix + "/numberOfEmitters") !=
+        m_emitters.size())
+    {
+        throw std::invalid_argument{ "Number of emitters mismatch." };
+    }
+
+    for (size_t i = 0; i < m_emitters.size(); ++i)
+    {
+        m_emitters[i]->LoadCheckpoint(prefix + "/" + std::to_string(i),
+                                      checkpoint);
+    }
+}
+
 GridEmitterSet3::Builder GridEmitterSet3::GetBuilder()
 {
     return Builder();
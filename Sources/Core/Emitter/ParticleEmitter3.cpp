@@ -53,8 +53,38 @@ void ParticleEmitter3::SetOnBeginUpdateCallback(
     m_onBeginUpdateCallback = callback;
 }
 
+void ParticleEmitter3::SaveCheckpoint(const std::string& prefix,
+                                      Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/isEnabled", m_isEnabled);
+
+    OnSaveCheckpoint(prefix, checkpoint);
+}
+
+void ParticleEmitter3::LoadCheckpoint(const std::string& prefix,
+                                      const Checkpoint& checkpoint)
+{
+    m_isEnabled = checkpoint.Value<bool>(prefix + "/isEnabled");
+
+    OnLoadCheckpoint(prefix, checkpoint);
+}
+
 void ParticleEmitter3::OnSetTarget(const ParticleSystemData3Ptr& particles)
 {
     UNUSED_VARIABLE(particles);
 }
+
+void ParticleEmitter3::OnSaveCheckpoint(const std::string& prefix,
+                                        Checkpoint* checkpoint) const
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
+void ParticleEmitter3::OnLoadCheckpoint(const std::string& prefix,
+                                        const Checkpoint& checkpoint)
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
 }  // namespace CubbyFlow
@@ -10,6 +10,8 @@
 
 #include <Core/Emitter/ParticleEmitterSet3.hpp>
 
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace CubbyFlow
@@ -48,6 +50,35 @@ void ParticleEmitterSet3::OnUpdate(double currentTimeInSeconds,
     }
 }
 
+void ParticleEmitterSet3::OnSaveCheckpoint(const std::string& prefix,
+                                           Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfEmitters",
+                                     m_emitters.size());
+
+    for (size_t i = 0; i < m_emitters.size(); ++i)
+    {
+        m_emitters[i]->SaveCheckpoint(prefix + "/" + std::to_string(i),
+                                      checkpoint);
+    }
+}
+
+void ParticleEmitterSet3::OnLoadCheckpoint(const std::string& prefix,
+                                           const Checkpoint& checkpoint)
+{
+    if (checkpoint.Value<uint64_t>(prefix + "/numberOfEmitters") !=
+        m_emitters.size())
+    {
+        throw std::invalid_argument{ "Number of emitters mismatch." };
+    }
+
+    for (size_t i = 0; i < m_emitters.size(); ++i)
+    {
+        m_emitters[i]->LoadCheckpoint(prefix + "/" + std::to_string(i),
+                                      checkpoint);
+    }
+}
+
 ParticleEmitterSet3::Builder ParticleEmitterSet3::GetBuilder()
 {
     return Builder();
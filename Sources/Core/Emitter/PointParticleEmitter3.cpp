@@ -12,6 +12,8 @@
 #include <Core/Matrix/Matrix.hpp>
 #include <Core/Utils/Samplers.hpp>
 
+#include <sstream>
+
 namespace CubbyFlow
 {
 PointParticleEmitter3::PointParticleEmitter3(
@@ -94,6 +96,31 @@ void PointParticleEmitter3::OnUpdate(double currentTimeInSeconds,
     }
 }
 
+void PointParticleEmitter3::OnSaveCheckpoint(const std::string& prefix,
+                                             Checkpoint* checkpoint) const
+{
+    std::ostringstream rngState;
+    rngState << m_rng;
+
+    checkpoint->WriteString(prefix + "/rng", rngState.str());
+    checkpoint->WriteValue(prefix + "/firstFrameTimeInSeconds",
+                           m_firstFrameTimeInSeconds);
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfEmittedParticles",
+                                     m_numberOfEmittedParticles);
+}
+
+void PointParticleEmitter3::OnLoadCheckpoint(const std::string& prefix,
+                                             const Checkpoint& checkpoint)
+{
+    std::istringstream rngState{ checkpoint.String(prefix + "/rng") };
+    rngState >> m_rng;
+
+    m_firstFrameTimeInSeconds =
+        checkpoint.Value<double>(prefix + "/firstFrameTimeInSeconds");
+    m_numberOfEmittedParticles = static_cast<size_t>(
+        checkpoint.Value<uint64_t>(prefix + "/numberOfEmittedParticles"));
+}
+
 void PointParticleEmitter3::Emit(Array1<Vector3D>* newPositions,
                                  Array1<Vector3D>* newVelocities,
                                  size_t maxNewNumberOfParticles)
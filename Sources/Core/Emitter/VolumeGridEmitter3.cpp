@@ -92,6 +92,18 @@ void VolumeGridEmitter3::OnUpdate(double currentTimeInSeconds,
     m_hasEmitted = true;
 }
 
+void VolumeGridEmitter3::OnSaveCheckpoint(const std::string& prefix,
+                                          Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/hasEmitted", m_hasEmitted);
+}
+
+void VolumeGridEmitter3::OnLoadCheckpoint(const std::string& prefix,
+                                          const Checkpoint& checkpoint)
+{
+    m_hasEmitted = checkpoint.Value<bool>(prefix + "/hasEmitted");
+}
+
 void VolumeGridEmitter3::Emit()
 {
     if (m_sourceRegion == nullptr)
@@ -15,6 +15,7 @@
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Samplers.hpp>
 
+#include <sstream>
 #include <utility>
 
 namespace CubbyFlow
@@ -72,6 +73,27 @@ void VolumeParticleEmitter3::OnUpdate(double currentTimeInSeconds,
     }
 }
 
+void VolumeParticleEmitter3::OnSaveCheckpoint(const std::string& prefix,
+                                              Checkpoint* checkpoint) const
+{
+    std::ostringstream rngState;
+    rngState << m_rng;
+
+    checkpoint->WriteString(prefix + "/rng", rngState.str());
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfEmittedParticles",
+                                     m_numberOfEmittedParticles);
+}
+
+void VolumeParticleEmitter3::OnLoadCheckpoint(const std::string& prefix,
+                                              const Checkpoint& checkpoint)
+{
+    std::istringstream rngState{ checkpoint.String(prefix + "/rng") };
+    rngState >> m_rng;
+
+    m_numberOfEmittedParticles = static_cast<size_t>(
+        checkpoint.Value<uint64_t>(prefix + "/numberOfEmittedParticles"));
+}
+
 void VolumeParticleEmitter3::Emit(const ParticleSystemData3Ptr& particles,
                                   Array1<Vector3D>* newPositions,
                                   Array1<Vector3D>* newVelocities)
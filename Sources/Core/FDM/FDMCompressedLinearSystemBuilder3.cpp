@@ -0,0 +1,31 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3.hpp>
+
+namespace CubbyFlow
+{
+size_t FDMCompressedLinearSystemBuilder3::GetNumberOfRows() const
+{
+    return m_stencils.size();
+}
+
+size_t FDMCompressedLinearSystemBuilder3::GetIndex(size_t i, size_t j,
+                                                   size_t k) const
+{
+    return m_coordToIndex(i, j, k);
+}
+
+const Array3<size_t>& FDMCompressedLinearSystemBuilder3::GetCoordToIndex()
+    const
+{
+    return m_coordToIndex;
+}
+}  // namespace CubbyFlow
@@ -12,10 +12,117 @@
 #include <Core/Math/MathUtils.hpp>
 #include <Core/Utils/IterationUtils.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 namespace CubbyFlow
 {
+namespace
+{
+// Visits the grid tile by tile. interiorFunc(i, j, k) is called for the cells
+// whose 7-point stencil lies inside the grid, so that it can skip the boundary
+// checks, and boundaryFunc(i, j, k) is called for the rest.
+template <typename InteriorFunc, typename BoundaryFunc>
+void ForEachStencilIndex(const Vector3UZ& size,
+                         const InteriorFunc& interiorFunc,
+                         const BoundaryFunc& boundaryFunc)
+{
+    ParallelTiledRangeFor(
+        ZERO_SIZE, size.x, ZERO_SIZE, size.y, ZERO_SIZE, size.z,
+        [&](size_t iBegin, size_t iEnd, size_t jBegin, size_t jEnd,
+            size_t kBegin, size_t kEnd) {
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                for (size_t j = jBegin; j < jEnd; ++j)
+                {
+                    if (j == 0 || j + 1 >= size.y || k == 0 || k + 1 >= size.z)
+                    {
+                        for (size_t i = iBegin; i < iEnd; ++i)
+                        {
+                            boundaryFunc(i, j, k);
+                        }
+                        continue;
+                    }
+
+                    const size_t iInteriorBegin = std::max(iBegin, ONE_SIZE);
+                    const size_t iInteriorEnd =
+                        std::max(std::min(iEnd, size.x - 1), iInteriorBegin);
+
+                    for (size_t i = iBegin; i < iInteriorBegin; ++i)
+                    {
+                        boundaryFunc(i, j, k);
+                    }
+                    for (size_t i = iInteriorBegin; i < iInteriorEnd; ++i)
+                    {
+                        interiorFunc(i, j, k);
+                    }
+                    for (size_t i = iInteriorEnd; i < iEnd; ++i)
+                    {
+                        boundaryFunc(i, j, k);
+                    }
+                }
+            }
+        });
+}
+
+double MarkerMatrixRowDot(const FDMMarkerMatrix3& m, const FDMVector3& v,
+                          size_t i, size_t j, size_t k)
+{
+    const Array3<char>& markers = m.markers;
+    const Vector3UZ& size = markers.Size();
+    const Vector3D& invHSqr = m.invGridSpacingSqr;
+
+    if (markers(i, j, k) != FDMMarkerMatrix3::FLUID)
+    {
+        return v(i, j, k);
+    }
+
+    double center = 0.0;
+    double sum = 0.0;
+
+    const auto addNeighbor = [&](size_t ni, size_t nj, size_t nk, double c) {
+        const char marker = markers(ni, nj, nk);
+
+        if (marker != FDMMarkerMatrix3::BOUNDARY)
+        {
+            center += c;
+
+            if (marker == FDMMarkerMatrix3::FLUID)
+            {
+                sum -= c * v(ni, nj, nk);
+            }
+        }
+    };
+
+    if (i > 0)
+    {
+        addNeighbor(i - 1, j, k, invHSqr.x);
+    }
+    if (i + 1 < size.x)
+    {
+        addNeighbor(i + 1, j, k, invHSqr.x);
+    }
+    if (j > 0)
+    {
+        addNeighbor(i, j - 1, k, invHSqr.y);
+    }
+    if (j + 1 < size.y)
+    {
+        addNeighbor(i, j + 1, k, invHSqr.y);
+    }
+    if (k > 0)
+    {
+        addNeighbor(i, j, k - 1, invHSqr.z);
+    }
+    if (k + 1 < size.z)
+    {
+        addNeighbor(i, j, k + 1, invHSqr.z);
+    }
+
+    return center * v(i, j, k) + sum;
+}
+}  // namespace
+
 void FDMLinearSystem3::Clear()
 {
     A.Clear();
@@ -37,6 +144,91 @@ void FDMCompressedLinearSystem3::Clear()
     b.Clear();
 }
 
+void FDMMarkerMatrix3::Clear()
+{
+    markers.Clear();
+}
+
+void FDMMarkerMatrix3::Resize(const Vector3UZ& size)
+{
+    markers.Resize(size);
+}
+
+Vector3UZ FDMMarkerMatrix3::Size() const
+{
+    return markers.Size();
+}
+
+FDMMatrixRow3 FDMMarkerMatrix3::operator()(size_t i, size_t j, size_t k) const
+{
+    const Vector3UZ& size = markers.Size();
+    FDMMatrixRow3 row;
+
+    if (markers(i, j, k) != FLUID)
+    {
+        row.center = 1.0;
+        return row;
+    }
+
+    if (i + 1 < size.x && markers(i + 1, j, k) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.x;
+        if (markers(i + 1, j, k) == FLUID)
+        {
+            row.right -= invGridSpacingSqr.x;
+        }
+    }
+
+    if (i > 0 && markers(i - 1, j, k) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.x;
+    }
+
+    if (j + 1 < size.y && markers(i, j + 1, k) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.y;
+        if (markers(i, j + 1, k) == FLUID)
+        {
+            row.up -= invGridSpacingSqr.y;
+        }
+    }
+
+    if (j > 0 && markers(i, j - 1, k) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.y;
+    }
+
+    if (k + 1 < size.z && markers(i, j, k + 1) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.z;
+        if (markers(i, j, k + 1) == FLUID)
+        {
+            row.front -= invGridSpacingSqr.z;
+        }
+    }
+
+    if (k > 0 && markers(i, j, k - 1) != BOUNDARY)
+    {
+        row.center += invGridSpacingSqr.z;
+    }
+
+    return row;
+}
+
+void FDMMatrixFreeLinearSystem3::Clear()
+{
+    A.Clear();
+    x.Clear();
+    b.Clear();
+}
+
+void FDMMatrixFreeLinearSystem3::Resize(const Vector3UZ& size)
+{
+    A.Resize(size);
+    x.Resize(size);
+    b.Resize(size);
+}
+
 void FDMBLAS3::Set(double s, FDMVector3* result)
 {
     result->Fill(s);
@@ -89,9 +281,28 @@ void FDMBLAS3::AXPlusY(double a, const FDMVector3& x, const FDMVector3& y,
     assert(x.Size() == y.Size());
     assert(x.Size() == result->Size());
 
-    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
-        (*result)(i, j, k) = a * x(i, j, k) + y(i, j, k);
-    });
+    const double* xData = x.data();
+    const double* yData = y.data();
+    double* resultData = result->data();
+
+    ParallelTiledRangeFor(
+        ZERO_SIZE, size.x, ZERO_SIZE, size.y, ZERO_SIZE, size.z,
+        [&](size_t iBegin, size_t iEnd, size_t jBegin, size_t jEnd,
+            size_t kBegin, size_t kEnd) {
+            for (size_t k = kBegin; k < kEnd; ++k)
+            {
+                for (size_t j = jBegin; j < jEnd; ++j)
+                {
+                    const size_t offset = size.x * (j + size.y * k);
+
+                    for (size_t i = iBegin; i < iEnd; ++i)
+                    {
+                        resultData[offset + i] =
+                            a * xData[offset + i] + yData[offset + i];
+                    }
+                }
+            }
+        });
 }
 
 void FDMBLAS3::MVM(const FDMMatrix3& m, const FDMVector3& v, FDMVector3* result)
@@ -101,16 +312,36 @@ void FDMBLAS3::MVM(const FDMMatrix3& m, const FDMVector3& v, FDMVector3* result)
     assert(size == v.Size());
     assert(size == result->Size());
 
-    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
-        (*result)(i, j, k) =
-            m(i, j, k).center * v(i, j, k) +
-            ((i > 0) ? m(i - 1, j, k).right * v(i - 1, j, k) : 0.0) +
-            ((i + 1 < size.x) ? m(i, j, k).right * v(i + 1, j, k) : 0.0) +
-            ((j > 0) ? m(i, j - 1, k).up * v(i, j - 1, k) : 0.0) +
-            ((j + 1 < size.y) ? m(i, j, k).up * v(i, j + 1, k) : 0.0) +
-            ((k > 0) ? m(i, j, k - 1).front * v(i, j, k - 1) : 0.0) +
-            ((k + 1 < size.z) ? m(i, j, k).front * v(i, j, k + 1) : 0.0);
-    });
+    const FDMMatrixRow3* mData = m.data();
+    const double* vData = v.data();
+    double* resultData = result->data();
+    const size_t strideY = size.x;
+    const size_t strideZ = size.x * size.y;
+
+    ForEachStencilIndex(
+        size,
+        [&](size_t i, size_t j, size_t k) {
+            const size_t idx = i + strideY * j + strideZ * k;
+
+            resultData[idx] = mData[idx].center * vData[idx] +
+                              mData[idx - 1].right * vData[idx - 1] +
+                              mData[idx].right * vData[idx + 1] +
+                              mData[idx - strideY].up * vData[idx - strideY] +
+                              mData[idx].up * vData[idx + strideY] +
+                              mData[idx - strideZ].front *
+                                  vData[idx - strideZ] +
+                              mData[idx].front * vData[idx + strideZ];
+        },
+        [&](size_t i, size_t j, size_t k) {
+            (*result)(i, j, k) =
+                m(i, j, k).center * v(i, j, k) +
+                ((i > 0) ? m(i - 1, j, k).right * v(i - 1, j, k) : 0.0) +
+                ((i + 1 < size.x) ? m(i, j, k).right * v(i + 1, j, k) : 0.0) +
+                ((j > 0) ? m(i, j - 1, k).up * v(i, j - 1, k) : 0.0) +
+                ((j + 1 < size.y) ? m(i, j, k).up * v(i, j + 1, k) : 0.0) +
+                ((k > 0) ? m(i, j, k - 1).front * v(i, j, k - 1) : 0.0) +
+                ((k + 1 < size.z) ? m(i, j, k).front * v(i, j, k + 1) : 0.0);
+        });
 }
 
 void FDMBLAS3::Residual(const FDMMatrix3& a, const FDMVector3& x,
@@ -122,16 +353,37 @@ void FDMBLAS3::Residual(const FDMMatrix3& a, const FDMVector3& x,
     assert(size == b.Size());
     assert(size == result->Size());
 
-    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
-        (*result)(i, j, k) =
-            b(i, j, k) - a(i, j, k).center * x(i, j, k) -
-            ((i > 0) ? a(i - 1, j, k).right * x(i - 1, j, k) : 0.0) -
-            ((i + 1 < size.x) ? a(i, j, k).right * x(i + 1, j, k) : 0.0) -
-            ((j > 0) ? a(i, j - 1, k).up * x(i, j - 1, k) : 0.0) -
-            ((j + 1 < size.y) ? a(i, j, k).up * x(i, j + 1, k) : 0.0) -
-            ((k > 0) ? a(i, j, k - 1).front * x(i, j, k - 1) : 0.0) -
-            ((k + 1 < size.z) ? a(i, j, k).front * x(i, j, k + 1) : 0.0);
-    });
+    const FDMMatrixRow3* aData = a.data();
+    const double* xData = x.data();
+    const double* bData = b.data();
+    double* resultData = result->data();
+    const size_t strideY = size.x;
+    const size_t strideZ = size.x * size.y;
+
+    ForEachStencilIndex(
+        size,
+        [&](size_t i, size_t j, size_t k) {
+            const size_t idx = i + strideY * j + strideZ * k;
+
+            resultData[idx] = bData[idx] - aData[idx].center * xData[idx] -
+                              aData[idx - 1].right * xData[idx - 1] -
+                              aData[idx].right * xData[idx + 1] -
+                              aData[idx - strideY].up * xData[idx - strideY] -
+                              aData[idx].up * xData[idx + strideY] -
+                              aData[idx - strideZ].front *
+                                  xData[idx - strideZ] -
+                              aData[idx].front * xData[idx + strideZ];
+        },
+        [&](size_t i, size_t j, size_t k) {
+            (*result)(i, j, k) =
+                b(i, j, k) - a(i, j, k).center * x(i, j, k) -
+                ((i > 0) ? a(i - 1, j, k).right * x(i - 1, j, k) : 0.0) -
+                ((i + 1 < size.x) ? a(i, j, k).right * x(i + 1, j, k) : 0.0) -
+                ((j > 0) ? a(i, j - 1, k).up * x(i, j - 1, k) : 0.0) -
+                ((j + 1 < size.y) ? a(i, j, k).up * x(i, j + 1, k) : 0.0) -
+                ((k > 0) ? a(i, j, k - 1).front * x(i, j, k - 1) : 0.0) -
+                ((k + 1 < size.z) ? a(i, j, k).front * x(i, j, k + 1) : 0.0);
+        });
 }
 
 double FDMBLAS3::L2Norm(const FDMVector3& v)
@@ -158,6 +410,34 @@ double FDMBLAS3::LInfNorm(const FDMVector3& v)
     return std::fabs(result);
 }
 
+void FDMMatrixFreeBLAS3::MVM(const FDMMarkerMatrix3& m, const FDMVector3& v,
+                             FDMVector3* result)
+{
+    const Vector3UZ& size = m.Size();
+
+    assert(size == v.Size());
+    assert(size == result->Size());
+
+    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        (*result)(i, j, k) = MarkerMatrixRowDot(m, v, i, j, k);
+    });
+}
+
+void FDMMatrixFreeBLAS3::Residual(const FDMMarkerMatrix3& a,
+                                  const FDMVector3& x, const FDMVector3& b,
+                                  FDMVector3* result)
+{
+    const Vector3UZ& size = a.Size();
+
+    assert(size == x.Size());
+    assert(size == b.Size());
+    assert(size == result->Size());
+
+    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        (*result)(i, j, k) = b(i, j, k) - MarkerMatrixRowDot(a, x, i, j, k);
+    });
+}
+
 void FDMCompressedBLAS3::Set(double s, VectorND* result)
 {
     result->Fill(s);
@@ -244,4 +524,16 @@ double FDMCompressedBLAS3::LInfNorm(const VectorND& v)
 {
     return std::fabs(v.AbsMax());
 }
+
+void FDMCompressedSELLBLAS3::MVM(const MatrixSELLD& m, const VectorND& v,
+                                 VectorND* result)
+{
+    m.Multiply(v, result);
+}
+
+void FDMCompressedSELLBLAS3::Residual(const MatrixSELLD& a, const VectorND& x,
+                                      const VectorND& b, VectorND* result)
+{
+    a.Residual(x, b, result);
+}
 }  // namespace CubbyFlow
\ No newline at end of file
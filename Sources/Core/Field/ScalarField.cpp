@@ -9,6 +9,9 @@
 // property of any third parties.
 
 #include <Core/Field/ScalarField.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+#include <cassert>
 
 namespace CubbyFlow
 {
@@ -33,6 +36,42 @@ std::function<double(const Vector<double, N>&)> ScalarField<N>::Sampler() const
     };
 }
 
+template <size_t N>
+void ScalarField<N>::SampleMany(const ConstArrayView1<Vector<double, N>>& x,
+                                ArrayView1<double> result,
+                                ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(x.Length(),
+                         [&](size_t i) { result[i] = Sample(x[i]); },
+                         policy);
+}
+
+template <size_t N>
+void ScalarField<N>::GradientMany(const ConstArrayView1<Vector<double, N>>& x,
+                                  ArrayView1<Vector<double, N>> result,
+                                  ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(x.Length(),
+                         [&](size_t i) { result[i] = Gradient(x[i]); },
+                         policy);
+}
+
+template <size_t N>
+void ScalarField<N>::LaplacianMany(const ConstArrayView1<Vector<double, N>>& x,
+                                   ArrayView1<double> result,
+                                   ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(x.Length(),
+                         [&](size_t i) { result[i] = Laplacian(x[i]); },
+                         policy);
+}
+
 template class ScalarField<2>;
 
 template class ScalarField<3>;
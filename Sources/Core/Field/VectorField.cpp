@@ -9,6 +9,9 @@
 // property of any third parties.
 
 #include <Core/Field/VectorField.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+#include <cassert>
 
 namespace CubbyFlow
 {
@@ -34,6 +37,42 @@ VectorField<N>::Sampler() const
     };
 }
 
+template <size_t N>
+void VectorField<N>::SampleMany(const ConstArrayView1<Vector<double, N>>& x,
+                                ArrayView1<Vector<double, N>> result,
+                                ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(x.Length(),
+                         [&](size_t i) { result[i] = Sample(x[i]); },
+                         policy);
+}
+
+template <size_t N>
+void VectorField<N>::DivergenceMany(
+    const ConstArrayView1<Vector<double, N>>& x,
+    ArrayView1<double> result, ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(x.Length(),
+                         [&](size_t i) { result[i] = Divergence(x[i]); },
+                         policy);
+}
+
+template <size_t N>
+void VectorField<N>::CurlMany(
+    const ConstArrayView1<Vector<double, N>>& x,
+    ArrayView1<typename GetCurl<N>::Type> result,
+    ExecutionPolicy policy) const
+{
+    assert(x.Length() == result.Length());
+
+    ParallelForEachIndex(
+        x.Length(), [&](size_t i) { result[i] = Curl(x[i]); }, policy);
+}
+
 template class VectorField<2>;
 
 template class VectorField<3>;
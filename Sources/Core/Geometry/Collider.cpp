@@ -9,8 +9,11 @@
 // property of any third parties.
 
 #include <Core/Geometry/Collider.hpp>
+#include <Core/Utils/Macros.hpp>
 
 #include <cassert>
+#include <type_traits>
+#include <utility>
 
 namespace CubbyFlow
 {
@@ -101,6 +104,14 @@ template <size_t N>
 void Collider<N>::SetSurface(const std::shared_ptr<Surface<N>>& newSurface)
 {
     m_surface = newSurface;
+
+    if (m_surface != nullptr)
+    {
+        m_lastTransform = m_surface->transform;
+        m_lastIsNormalFlipped = m_surface->isNormalFlipped;
+    }
+
+    ++m_shapeRevision;
 }
 
 template <size_t N>
@@ -143,6 +154,51 @@ void Collider<N>::Update(double currentTimeInSeconds,
     {
         m_onUpdateCallback(this, currentTimeInSeconds, timeIntervalInSeconds);
     }
+
+    UpdateRevisions();
+}
+
+template <size_t N>
+size_t Collider<N>::GetShapeRevision() const
+{
+    return m_shapeRevision;
+}
+
+template <size_t N>
+size_t Collider<N>::GetTransformRevision() const
+{
+    return m_transformRevision;
+}
+
+template <size_t N>
+void Collider<N>::MarkShapeChanged()
+{
+    ++m_shapeRevision;
+}
+
+template <size_t N>
+void Collider<N>::UpdateRevisions()
+{
+    const Transform<N>& transform = m_surface->transform;
+    if (transform.GetTranslation() != m_lastTransform.GetTranslation() ||
+        !(transform.GetOrientation().GetRotation() ==
+          m_lastTransform.GetOrientation().GetRotation()))
+    {
+        m_lastTransform = transform;
+        MarkTransformChanged();
+    }
+
+    if (m_surface->isNormalFlipped != m_lastIsNormalFlipped)
+    {
+        m_lastIsNormalFlipped = m_surface->isNormalFlipped;
+        MarkShapeChanged();
+    }
+}
+
+template <size_t N>
+void Collider<N>::MarkTransformChanged()
+{
+    ++m_transformRevision;
 }
 
 template <size_t N>
@@ -152,6 +208,81 @@ void Collider<N>::SetOnBeginUpdateCallback(
     m_onUpdateCallback = callback;
 }
 
+template <size_t N>
+void Collider<N>::SaveCheckpoint(const std::string& prefix,
+                                 Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/frictionCoefficient",
+                           m_frictionCoefficient);
+    checkpoint->WriteValue<uint64_t>(prefix + "/shapeRevision",
+                                     m_shapeRevision);
+    checkpoint->WriteValue<uint64_t>(prefix + "/transformRevision",
+                                     m_transformRevision);
+
+    if (m_surface != nullptr)
+    {
+        const Transform<N>& transform = m_surface->transform;
+        checkpoint->WriteValue(prefix + "/translation",
+                               transform.GetTranslation());
+        checkpoint->WriteValue(prefix + "/rotation",
+                               transform.GetOrientation().GetRotation());
+        checkpoint->WriteValue(prefix + "/isNormalFlipped",
+                               m_surface->isNormalFlipped);
+    }
+
+    OnSaveCheckpoint(prefix, checkpoint);
+}
+
+template <size_t N>
+void Collider<N>::LoadCheckpoint(const std::string& prefix,
+                                 const Checkpoint& checkpoint)
+{
+    using Rotation =
+        std::decay_t<decltype(std::declval<Orientation<N>>().GetRotation())>;
+
+    m_frictionCoefficient =
+        checkpoint.Value<double>(prefix + "/frictionCoefficient");
+
+    // The revisions are restored as well, so the caches built from this
+    // collider by the solvers can be restored and stay in sync with it.
+    m_shapeRevision = static_cast<size_t>(
+        checkpoint.Value<uint64_t>(prefix + "/shapeRevision"));
+    m_transformRevision = static_cast<size_t>(
+        checkpoint.Value<uint64_t>(prefix + "/transformRevision"));
+
+    if (m_surface != nullptr)
+    {
+        Transform<N>& transform = m_surface->transform;
+        transform.SetTranslation(
+            checkpoint.Value<Vector<double, N>>(prefix + "/translation"));
+        transform.SetOrientation(Orientation<N>{
+            checkpoint.Value<Rotation>(prefix + "/rotation") });
+        m_surface->isNormalFlipped =
+            checkpoint.Value<bool>(prefix + "/isNormalFlipped");
+
+        m_lastTransform = transform;
+        m_lastIsNormalFlipped = m_surface->isNormalFlipped;
+    }
+
+    OnLoadCheckpoint(prefix, checkpoint);
+}
+
+template <size_t N>
+void Collider<N>::OnSaveCheckpoint(const std::string& prefix,
+                                   Checkpoint* checkpoint) const
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
+template <size_t N>
+void Collider<N>::OnLoadCheckpoint(const std::string& prefix,
+                                   const Checkpoint& checkpoint)
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
 template class Collider<2>;
 
 template class Collider<3>;
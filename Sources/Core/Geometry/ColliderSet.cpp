@@ -12,6 +12,8 @@
 #include <Core/Geometry/SurfaceSet.hpp>
 
 #include <limits>
+#include <stdexcept>
+#include <string>
 
 namespace CubbyFlow
 {
@@ -67,6 +69,11 @@ void ColliderSet<N>::AddCollider(const std::shared_ptr<Collider<N>>& collider)
         std::dynamic_pointer_cast<SurfaceSet<N>>(GetSurface());
     m_colliders.Append(collider);
     surfaceSet->AddSurface(collider->GetSurface());
+
+    m_lastTransforms.Append(collider->GetSurface()->transform);
+    m_lastIsNormalFlipped.Append(
+        static_cast<char>(collider->GetSurface()->isNormalFlipped));
+    Collider<N>::MarkShapeChanged();
 }
 
 template <size_t N>
@@ -81,6 +88,67 @@ std::shared_ptr<Collider<N>> ColliderSet<N>::GetCollider(size_t i) const
     return m_colliders[i];
 }
 
+template <size_t N>
+void ColliderSet<N>::UpdateRevisions()
+{
+    Collider<N>::UpdateRevisions();
+
+    for (size_t i = 0; i < m_colliders.Length(); ++i)
+    {
+        const std::shared_ptr<Surface<N>>& surface =
+            m_colliders[i]->GetSurface();
+        const Transform<N>& transform = surface->transform;
+
+        if (transform.GetTranslation() !=
+                m_lastTransforms[i].GetTranslation() ||
+            !(transform.GetOrientation().GetRotation() ==
+              m_lastTransforms[i].GetOrientation().GetRotation()))
+        {
+            m_lastTransforms[i] = transform;
+            Collider<N>::MarkTransformChanged();
+        }
+
+        if (const auto isNormalFlipped =
+                static_cast<char>(surface->isNormalFlipped);
+            isNormalFlipped != m_lastIsNormalFlipped[i])
+        {
+            m_lastIsNormalFlipped[i] = isNormalFlipped;
+            Collider<N>::MarkShapeChanged();
+        }
+    }
+}
+
+template <size_t N>
+void ColliderSet<N>::OnSaveCheckpoint(const std::string& prefix,
+                                      Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfColliders",
+                                     m_colliders.Length());
+
+    for (size_t i = 0; i < m_colliders.Length(); ++i)
+    {
+        m_colliders[i]->SaveCheckpoint(prefix + "/" + std::to_string(i),
+                                       checkpoint);
+    }
+}
+
+template <size_t N>
+void ColliderSet<N>::OnLoadCheckpoint(const std::string& prefix,
+                                      const Checkpoint& checkpoint)
+{
+    if (checkpoint.Value<uint64_t>(prefix + "/numberOfColliders") !=
+        m_colliders.Length())
+    {
+        throw std::invalid_argument{ "Number of colliders mismatch." };
+    }
+
+    for (size_t i = 0; i < m_colliders.Length(); ++i)
+    {
+        m_colliders[i]->LoadCheckpoint(prefix + "/" + std::to_string(i),
+                                       checkpoint);
+    }
+}
+
 template <size_t N>
 typename ColliderSet<N>::Builder ColliderSet<N>::GetBuilder()
 {
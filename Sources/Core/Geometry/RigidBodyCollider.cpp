@@ -37,6 +37,24 @@ Vector<double, N> RigidBodyCollider<N>::VelocityAt(
     return linearVelocity + angularVelocity.Cross(r);
 }
 
+template <size_t N>
+void RigidBodyCollider<N>::OnSaveCheckpoint(const std::string& prefix,
+                                            Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/linearVelocity", linearVelocity);
+    checkpoint->WriteValue(prefix + "/angularVelocity", angularVelocity.value);
+}
+
+template <size_t N>
+void RigidBodyCollider<N>::OnLoadCheckpoint(const std::string& prefix,
+                                            const Checkpoint& checkpoint)
+{
+    linearVelocity =
+        checkpoint.Value<Vector<double, N>>(prefix + "/linearVelocity");
+    angularVelocity.value = checkpoint.Value<decltype(angularVelocity.value)>(
+        prefix + "/angularVelocity");
+}
+
 template <size_t N>
 typename RigidBodyCollider<N>::Builder RigidBodyCollider<N>::GetBuilder()
 {
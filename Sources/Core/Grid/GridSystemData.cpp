@@ -8,15 +8,175 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Grid/CollocatedVectorGrid.hpp>
 #include <Core/Grid/GridSystemData.hpp>
 #include <Core/Utils/Factory.hpp>
 #include <Core/Utils/FlatbuffersHelper.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 #include <Flatbuffers/generated/GridSystemData2_generated.h>
 #include <Flatbuffers/generated/GridSystemData3_generated.h>
 
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
 namespace CubbyFlow
 {
+namespace
+{
+template <typename GridPtr>
+void SaveGridLayers(const std::string& name,
+                    const std::vector<GridPtr>& layers,
+                    Checkpoint* checkpoint)
+{
+    checkpoint->WriteValue<uint64_t>(name + "/count", layers.size());
+
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        checkpoint->WriteSerializable(name + "/" + std::to_string(i),
+                                      *layers[i]);
+    }
+}
+
+template <typename GridPtr>
+void LoadGridLayers(const std::string& name,
+                    const std::vector<GridPtr>& layers,
+                    const Checkpoint& checkpoint)
+{
+    if (checkpoint.Value<uint64_t>(name + "/count") != layers.size())
+    {
+        throw std::invalid_argument{ "Number of grid layers mismatch for " +
+                                     name };
+    }
+
+    // Deserializes into the existing grids so that the pointers held by the
+    // other objects stay valid.
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        checkpoint.ReadSerializable(name + "/" + std::to_string(i),
+                                    layers[i].get());
+    }
+}
+
+// Calls \p func with the name suffix, data pointer, element size and number
+// of elements of each data array of \p grid.
+template <size_t N, typename GridType, typename Callback>
+void ForEachGridDataArray(GridType& grid, const Callback& func)
+{
+    using ScalarGridType =
+        std::conditional_t<std::is_const<GridType>::value, const ScalarGrid<N>,
+                           ScalarGrid<N>>;
+    using CollocatedGridType =
+        std::conditional_t<std::is_const<GridType>::value,
+                           const CollocatedVectorGrid<N>,
+                           CollocatedVectorGrid<N>>;
+    using FaceCenteredGridType =
+        std::conditional_t<std::is_const<GridType>::value,
+                           const FaceCenteredGrid<N>, FaceCenteredGrid<N>>;
+
+    if (auto scalarGrid = dynamic_cast<ScalarGridType*>(&grid))
+    {
+        auto data = scalarGrid->DataView();
+        func("", data.data(), sizeof(double), data.Length());
+    }
+    else if (auto collocatedGrid = dynamic_cast<CollocatedGridType*>(&grid))
+    {
+        auto data = collocatedGrid->DataView();
+        func("", data.data(), sizeof(Vector<double, N>), data.Length());
+    }
+    else if (auto faceCenteredGrid = dynamic_cast<FaceCenteredGridType*>(&grid))
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            auto data = faceCenteredGrid->DataView(i);
+            func("/" + std::to_string(i), data.data(), sizeof(double),
+                 data.Length());
+        }
+    }
+    else
+    {
+        throw std::invalid_argument{ "Unsupported grid type " +
+                                     grid.TypeName() };
+    }
+}
+
+template <size_t N, typename GridPtr>
+void WriteGridLayers(const std::string& name,
+                     const std::vector<GridPtr>& layers,
+                     ChannelStreamWriter* writer)
+{
+    writer->WriteValue<uint64_t>(name + "/count", layers.size());
+
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        const std::string layerName = name + "/" + std::to_string(i);
+        const std::string typeName = layers[i]->TypeName();
+        writer->WriteRaw(layerName + "/type", typeName.data(), 1,
+                         typeName.size());
+
+        ForEachGridDataArray<N>(
+            static_cast<const Grid<N>&>(*layers[i]),
+            [&](const std::string& suffix, const void* data,
+                size_t elementSize, size_t numberOfElements) {
+                writer->WriteRaw(layerName + suffix, data, elementSize,
+                                 numberOfElements);
+            });
+    }
+}
+
+template <size_t N, typename GridPtr>
+void ReadGridLayers(const std::string& name,
+                    const std::vector<GridPtr>& layers,
+                    const MappedChannelReader& reader)
+{
+    if (reader.Value<uint64_t>(name + "/count") != layers.size())
+    {
+        throw std::invalid_argument{ "Number of grid layers mismatch for " +
+                                     name };
+    }
+
+    // Copies into the existing grids so that the pointers held by the other
+    // objects stay valid.
+    for (size_t i = 0; i < layers.size(); ++i)
+    {
+        const std::string layerName = name + "/" + std::to_string(i);
+        const ConstArrayView1<uint8_t> typeName =
+            reader.RawView(layerName + "/type");
+        if (std::string(typeName.data(),
+                        typeName.data() + typeName.Length()) !=
+            layers[i]->TypeName())
+        {
+            throw std::invalid_argument{ "Grid type mismatch for " +
+                                         layerName };
+        }
+
+        ForEachGridDataArray<N>(
+            static_cast<Grid<N>&>(*layers[i]),
+            [&](const std::string& suffix, void* data, size_t elementSize,
+                size_t numberOfElements) {
+                const std::string channelName = layerName + suffix;
+                const ConstArrayView1<uint8_t> channel =
+                    reader.RawView(channelName);
+                if (reader.ElementSize(channelName) != elementSize ||
+                    channel.Length() != elementSize * numberOfElements)
+                {
+                    throw std::invalid_argument{ "Grid size mismatch for " +
+                                                 channelName };
+                }
+
+                ParallelRangeFor(
+                    ZERO_SIZE, channel.Length(),
+                    [&](size_t begin, size_t end) {
+                        std::memcpy(static_cast<uint8_t*>(data) + begin,
+                                    channel.data() + begin, end - begin);
+                    });
+            });
+    }
+}
+}  // namespace
+
 template <size_t N>
 GridSystemData<N>::GridSystemData()
     : GridSystemData(Vector<size_t, N>{}, Vector<double, N>::MakeConstant(1.0),
@@ -499,6 +659,82 @@ std::enable_if_t<M == 3, void> GridSystemData<N>::Deserialize(
         grid.m_advectableVectorDataList[grid.m_velocityIdx]);
 }
 
+template <size_t N>
+void GridSystemData<N>::SaveCheckpoint(const std::string& prefix,
+                                       Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/resolution", m_resolution);
+    checkpoint->WriteValue(prefix + "/gridSpacing", m_gridSpacing);
+    checkpoint->WriteValue(prefix + "/origin", m_origin);
+
+    SaveGridLayers(prefix + "/scalarData", m_scalarDataList, checkpoint);
+    SaveGridLayers(prefix + "/vectorData", m_vectorDataList, checkpoint);
+    SaveGridLayers(prefix + "/advectableScalarData",
+                   m_advectableScalarDataList, checkpoint);
+    SaveGridLayers(prefix + "/advectableVectorData",
+                   m_advectableVectorDataList, checkpoint);
+}
+
+template <size_t N>
+void GridSystemData<N>::LoadCheckpoint(const std::string& prefix,
+                                       const Checkpoint& checkpoint)
+{
+    const auto resolution =
+        checkpoint.Value<Vector<size_t, N>>(prefix + "/resolution");
+    const auto gridSpacing =
+        checkpoint.Value<Vector<double, N>>(prefix + "/gridSpacing");
+    const auto origin = checkpoint.Value<Vector<double, N>>(prefix + "/origin");
+
+    if (resolution != m_resolution || gridSpacing != m_gridSpacing ||
+        origin != m_origin)
+    {
+        Resize(resolution, gridSpacing, origin);
+    }
+
+    LoadGridLayers(prefix + "/scalarData", m_scalarDataList, checkpoint);
+    LoadGridLayers(prefix + "/vectorData", m_vectorDataList, checkpoint);
+    LoadGridLayers(prefix + "/advectableScalarData",
+                   m_advectableScalarDataList, checkpoint);
+    LoadGridLayers(prefix + "/advectableVectorData",
+                   m_advectableVectorDataList, checkpoint);
+}
+
+template <size_t N>
+void GridSystemData<N>::Serialize(ChannelStreamWriter* writer) const
+{
+    writer->WriteValue("resolution", m_resolution);
+    writer->WriteValue("gridSpacing", m_gridSpacing);
+    writer->WriteValue("origin", m_origin);
+
+    WriteGridLayers<N>("scalarData", m_scalarDataList, writer);
+    WriteGridLayers<N>("vectorData", m_vectorDataList, writer);
+    WriteGridLayers<N>("advectableScalarData", m_advectableScalarDataList,
+                       writer);
+    WriteGridLayers<N>("advectableVectorData", m_advectableVectorDataList,
+                       writer);
+}
+
+template <size_t N>
+void GridSystemData<N>::Deserialize(const MappedChannelReader& reader)
+{
+    const auto resolution = reader.Value<Vector<size_t, N>>("resolution");
+    const auto gridSpacing = reader.Value<Vector<double, N>>("gridSpacing");
+    const auto origin = reader.Value<Vector<double, N>>("origin");
+
+    if (resolution != m_resolution || gridSpacing != m_gridSpacing ||
+        origin != m_origin)
+    {
+        Resize(resolution, gridSpacing, origin);
+    }
+
+    ReadGridLayers<N>("scalarData", m_scalarDataList, reader);
+    ReadGridLayers<N>("vectorData", m_vectorDataList, reader);
+    ReadGridLayers<N>("advectableScalarData", m_advectableScalarDataList,
+                      reader);
+    ReadGridLayers<N>("advectableVectorData", m_advectableVectorDataList,
+                      reader);
+}
+
 template class GridSystemData<2>;
 
 template class GridSystemData<3>;
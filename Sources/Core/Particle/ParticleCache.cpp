@@ -0,0 +1,481 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Particle/ParticleCache.hpp>
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/Macros.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace CubbyFlow
+{
+namespace
+{
+uint32_t MaxQuantizedValue(unsigned int bits)
+{
+    return (bits >= 32) ? std::numeric_limits<uint32_t>::max()
+                        : (1u << bits) - 1u;
+}
+
+template <size_t N>
+BoundingBox<double, N> ComputeBoundingBox(
+    const ConstArrayView1<Vector<double, N>>& positions)
+{
+    return ParallelReduce(
+        ZERO_SIZE, positions.Length(), BoundingBox<double, N>{},
+        [&](size_t begin, size_t end, BoundingBox<double, N> box) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                box.Merge(positions[i]);
+            }
+            return box;
+        },
+        [](BoundingBox<double, N> a, const BoundingBox<double, N>& b) {
+            a.Merge(b);
+            return a;
+        });
+}
+
+// Quantizes the positions relative to the box and returns false if any of the
+// positions is clamped to the box.
+template <size_t N>
+bool Quantize(const ConstArrayView1<Vector<double, N>>& positions,
+              const BoundingBox<double, N>& box, uint32_t maxValue,
+              Array1<uint32_t>* quantized)
+{
+    Vector<double, N> scale;
+    for (size_t d = 0; d < N; ++d)
+    {
+        const double extent = box.upperCorner[d] - box.lowerCorner[d];
+        scale[d] = (extent > 0.0) ? maxValue / extent : 0.0;
+    }
+
+    quantized->Resize(positions.Length() * N);
+
+    std::atomic<bool> isInside{ true };
+    ParallelRangeFor(
+        ZERO_SIZE, positions.Length(), [&](size_t begin, size_t end) {
+            bool isChunkInside = true;
+            for (size_t i = begin; i < end; ++i)
+            {
+                for (size_t d = 0; d < N; ++d)
+                {
+                    double q = std::round(
+                        (positions[i][d] - box.lowerCorner[d]) * scale[d]);
+                    if (q < 0.0 || q > maxValue)
+                    {
+                        q = Clamp(q, 0.0, static_cast<double>(maxValue));
+                        isChunkInside = false;
+                    }
+                    (*quantized)[N * i + d] = static_cast<uint32_t>(q);
+                }
+            }
+
+            if (!isChunkInside)
+            {
+                isInside = false;
+            }
+        });
+
+    return isInside;
+}
+
+int64_t MaxAbsDelta(const Array1<uint32_t>& a, const Array1<uint32_t>& b)
+{
+    return ParallelReduce(
+        ZERO_SIZE, a.Length(), int64_t{ 0 },
+        [&](size_t begin, size_t end, int64_t maxDelta) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const int64_t delta = static_cast<int64_t>(a[i]) - b[i];
+                maxDelta = std::max(maxDelta, std::abs(delta));
+            }
+            return maxDelta;
+        },
+        [](int64_t x, int64_t y) { return std::max(x, y); });
+}
+
+template <typename T, typename Function>
+void WriteConverted(ChannelStreamWriter* writer, const std::string& name,
+                    size_t count, const Function& func)
+{
+    Array1<T> data(count);
+    ParallelForEachIndex(count,
+                         [&](size_t i) { data[i] = static_cast<T>(func(i)); });
+
+    writer->Write(name, ConstArrayView1<T>(data));
+}
+
+template <typename T, typename Function>
+void ReadConverted(const MappedChannelReader& reader, const std::string& name,
+                   size_t count, const Function& func)
+{
+    const ConstArrayView1<T> data = reader.View<T>(name);
+    if (data.Length() != count)
+    {
+        throw std::invalid_argument{ "Invalid length of channel " + name };
+    }
+
+    ParallelForEachIndex(count, [&](size_t i) { func(i, data[i]); });
+}
+
+void WriteRealChannel(ChannelStreamWriter* writer, const std::string& name,
+                      const double* data, size_t count, bool downcast)
+{
+    if (downcast)
+    {
+        WriteConverted<float>(writer, name, count,
+                              [&](size_t i) { return data[i]; });
+    }
+    else
+    {
+        writer->Write(name, ConstArrayView1<double>(data, count));
+    }
+}
+
+void ReadRealChannel(const MappedChannelReader& reader, const std::string& name,
+                     size_t count, size_t bytes, double* data)
+{
+    if (bytes == sizeof(float))
+    {
+        ReadConverted<float>(reader, name, count,
+                             [&](size_t i, float value) { data[i] = value; });
+    }
+    else
+    {
+        ReadConverted<double>(reader, name, count,
+                              [&](size_t i, double value) { data[i] = value; });
+    }
+}
+
+template <size_t N>
+const double* ToDoubles(const ConstArrayView1<Vector<double, N>>& data)
+{
+    return reinterpret_cast<const double*>(data.data());
+}
+
+template <size_t N>
+double* ToDoubles(ArrayView1<Vector<double, N>> data)
+{
+    return reinterpret_cast<double*>(data.data());
+}
+}  // namespace
+
+template <size_t N>
+ParticleCacheWriter<N>::ParticleCacheWriter(
+    const ParticleCacheParameters& params)
+    : m_params{ params }
+{
+    if (m_params.positionBits < 1 || m_params.positionBits > 32)
+    {
+        throw std::invalid_argument{ "Position bits should be in [1, 32]." };
+    }
+}
+
+template <size_t N>
+const ParticleCacheParameters& ParticleCacheWriter<N>::GetParams() const
+{
+    return m_params;
+}
+
+template <size_t N>
+void ParticleCacheWriter<N>::Write(const std::string& filename,
+                                   const ParticleSystemData<N>& particles)
+{
+    const size_t numberOfParticles = particles.NumberOfParticles();
+    const ConstArrayView1<Vector<double, N>> positions = particles.Positions();
+    const uint32_t maxValue = MaxQuantizedValue(m_params.positionBits);
+
+    // Try to encode the positions as a delta frame first
+    Array1<uint32_t> quantized;
+    bool isKeyFrame = !m_params.useDeltaEncoding || !m_hasKeyFrame ||
+                      m_frame - m_lastKeyFrame >= m_params.keyFrameInterval ||
+                      m_lastQuantized.Length() != numberOfParticles * N;
+    int64_t maxDelta = 0;
+
+    if (!isKeyFrame)
+    {
+        isKeyFrame = !Quantize(positions, m_box, maxValue, &quantized);
+    }
+    if (!isKeyFrame)
+    {
+        maxDelta = MaxAbsDelta(quantized, m_lastQuantized);
+        isKeyFrame = maxDelta > std::numeric_limits<int32_t>::max();
+    }
+
+    if (isKeyFrame)
+    {
+        m_box = ComputeBoundingBox(positions);
+        if (m_params.useDeltaEncoding && !m_box.IsEmpty())
+        {
+            const Vector<double, N> padding =
+                m_params.keyFramePadding *
+                (m_box.upperCorner - m_box.lowerCorner);
+            m_box.lowerCorner -= padding;
+            m_box.upperCorner += padding;
+        }
+
+        Quantize(positions, m_box, maxValue, &quantized);
+        m_lastKeyFrame = m_frame;
+        m_hasKeyFrame = true;
+    }
+
+    ChannelStreamWriter writer(filename);
+    writer.WriteValue<uint64_t>("frame", m_frame);
+    writer.WriteValue<uint8_t>("isKeyFrame", isKeyFrame ? 1 : 0);
+    writer.WriteValue<uint64_t>("numberOfParticles", numberOfParticles);
+    writer.WriteValue("radius", particles.Radius());
+    writer.WriteValue("mass", particles.Mass());
+    writer.WriteValue<uint32_t>("positionBits", m_params.positionBits);
+    writer.WriteValue("lowerCorner", m_box.lowerCorner);
+    writer.WriteValue("upperCorner", m_box.upperCorner);
+
+    const size_t count = numberOfParticles * N;
+    if (isKeyFrame)
+    {
+        const uint8_t bytes = (m_params.positionBits <= 16) ? 2 : 4;
+        writer.WriteValue("positionBytes", bytes);
+
+        if (bytes == 2)
+        {
+            WriteConverted<uint16_t>(&writer, "positions", count,
+                                     [&](size_t i) { return quantized[i]; });
+        }
+        else
+        {
+            writer.Write("positions", ConstArrayView1<uint32_t>(quantized));
+        }
+    }
+    else
+    {
+        const uint8_t bytes =
+            (maxDelta <= std::numeric_limits<int8_t>::max())    ? 1
+            : (maxDelta <= std::numeric_limits<int16_t>::max()) ? 2
+                                                                : 4;
+        writer.WriteValue("positionBytes", bytes);
+
+        const auto delta = [&](size_t i) {
+            return static_cast<int64_t>(quantized[i]) - m_lastQuantized[i];
+        };
+        if (bytes == 1)
+        {
+            WriteConverted<int8_t>(&writer, "positions", count, delta);
+        }
+        else if (bytes == 2)
+        {
+            WriteConverted<int16_t>(&writer, "positions", count, delta);
+        }
+        else
+        {
+            WriteConverted<int32_t>(&writer, "positions", count, delta);
+        }
+    }
+
+    // Optional channels
+    const bool downcast = m_params.downcastToFloat;
+    writer.WriteValue(
+        "channelBytes",
+        static_cast<uint8_t>(downcast ? sizeof(float) : sizeof(double)));
+
+    writer.WriteValue<uint8_t>("hasVelocities", m_params.storeVelocities);
+    if (m_params.storeVelocities)
+    {
+        WriteRealChannel(&writer, "velocities",
+                         ToDoubles(particles.Velocities()), count, downcast);
+    }
+
+    writer.WriteValue<uint8_t>("hasForces", m_params.storeForces);
+    if (m_params.storeForces)
+    {
+        WriteRealChannel(&writer, "forces", ToDoubles(particles.Forces()),
+                         count, downcast);
+    }
+
+    const size_t numberOfScalarData =
+        m_params.storeCustomData ? particles.NumberOfScalarData() : 0;
+    const size_t numberOfVectorData =
+        m_params.storeCustomData ? particles.NumberOfVectorData() - 3 : 0;
+    writer.WriteValue<uint64_t>("numberOfScalarData", numberOfScalarData);
+    writer.WriteValue<uint64_t>("numberOfVectorData", numberOfVectorData);
+
+    for (size_t i = 0; i < numberOfScalarData; ++i)
+    {
+        WriteRealChannel(&writer, "scalarData" + std::to_string(i),
+                         particles.ScalarDataAt(i).data(), numberOfParticles,
+                         downcast);
+    }
+
+    for (size_t i = 0; i < numberOfVectorData; ++i)
+    {
+        WriteRealChannel(&writer, "vectorData" + std::to_string(i),
+                         ToDoubles(particles.VectorDataAt(i + 3)), count,
+                         downcast);
+    }
+
+    m_lastQuantized.Swap(quantized);
+    m_isLastFrameKeyFrame = isKeyFrame;
+    ++m_frame;
+}
+
+template <size_t N>
+void ParticleCacheWriter<N>::Reset()
+{
+    m_hasKeyFrame = false;
+}
+
+template <size_t N>
+bool ParticleCacheWriter<N>::IsLastFrameKeyFrame() const
+{
+    return m_isLastFrameKeyFrame;
+}
+
+template <size_t N>
+void ParticleCacheReader<N>::Read(const std::string& filename,
+                                  ParticleSystemData<N>* particles)
+{
+    const MappedChannelReader reader(filename);
+
+    const auto frame = static_cast<size_t>(reader.Value<uint64_t>("frame"));
+    const bool isKeyFrame = reader.Value<uint8_t>("isKeyFrame") != 0;
+    const auto numberOfParticles =
+        static_cast<size_t>(reader.Value<uint64_t>("numberOfParticles"));
+    const size_t count = numberOfParticles * N;
+
+    if (!isKeyFrame && (!m_hasFrame || frame != m_frame + 1 ||
+                        m_lastQuantized.Length() != count))
+    {
+        throw std::invalid_argument{
+            "Delta frame should be read right after its previous frame."
+        };
+    }
+
+    // Decode the quantized positions
+    const size_t positionBytes = reader.Value<uint8_t>("positionBytes");
+    Array1<uint32_t> quantized(count);
+    const auto setKey = [&](size_t i, auto value) {
+        quantized[i] = static_cast<uint32_t>(value);
+    };
+    const auto setDelta = [&](size_t i, auto value) {
+        quantized[i] = static_cast<uint32_t>(
+            static_cast<int64_t>(m_lastQuantized[i]) + value);
+    };
+
+    if (isKeyFrame && positionBytes == 2)
+    {
+        ReadConverted<uint16_t>(reader, "positions", count, setKey);
+    }
+    else if (isKeyFrame)
+    {
+        ReadConverted<uint32_t>(reader, "positions", count, setKey);
+    }
+    else if (positionBytes == 1)
+    {
+        ReadConverted<int8_t>(reader, "positions", count, setDelta);
+    }
+    else if (positionBytes == 2)
+    {
+        ReadConverted<int16_t>(reader, "positions", count, setDelta);
+    }
+    else
+    {
+        ReadConverted<int32_t>(reader, "positions", count, setDelta);
+    }
+
+    particles->Resize(numberOfParticles);
+    particles->SetRadius(reader.Value<double>("radius"));
+    particles->SetMass(reader.Value<double>("mass"));
+
+    // Dequantize the positions
+    const uint32_t maxValue =
+        MaxQuantizedValue(reader.Value<uint32_t>("positionBits"));
+    const auto lowerCorner = reader.Value<Vector<double, N>>("lowerCorner");
+    const auto upperCorner = reader.Value<Vector<double, N>>("upperCorner");
+    const Vector<double, N> scale =
+        (upperCorner - lowerCorner) / static_cast<double>(maxValue);
+
+    ArrayView1<Vector<double, N>> positions = particles->Positions();
+    ParallelForEachIndex(numberOfParticles, [&](size_t i) {
+        for (size_t d = 0; d < N; ++d)
+        {
+            positions[i][d] = lowerCorner[d] + quantized[N * i + d] * scale[d];
+        }
+    });
+
+    // Optional channels
+    const size_t bytes = reader.Value<uint8_t>("channelBytes");
+
+    if (reader.Value<uint8_t>("hasVelocities") != 0)
+    {
+        ReadRealChannel(reader, "velocities", count, bytes,
+                        ToDoubles(particles->Velocities()));
+    }
+
+    if (reader.Value<uint8_t>("hasForces") != 0)
+    {
+        ReadRealChannel(reader, "forces", count, bytes,
+                        ToDoubles(particles->Forces()));
+    }
+
+    const auto numberOfScalarData =
+        static_cast<size_t>(reader.Value<uint64_t>("numberOfScalarData"));
+    for (size_t i = 0; i < numberOfScalarData; ++i)
+    {
+        if (i >= particles->NumberOfScalarData())
+        {
+            const size_t idx = particles->AddScalarData();
+            UNUSED_VARIABLE(idx);
+        }
+
+        ReadRealChannel(reader, "scalarData" + std::to_string(i),
+                        numberOfParticles, bytes,
+                        particles->ScalarDataAt(i).data());
+    }
+
+    const auto numberOfVectorData =
+        static_cast<size_t>(reader.Value<uint64_t>("numberOfVectorData"));
+    for (size_t i = 0; i < numberOfVectorData; ++i)
+    {
+        if (i + 3 >= particles->NumberOfVectorData())
+        {
+            const size_t idx = particles->AddVectorData();
+            UNUSED_VARIABLE(idx);
+        }
+
+        ReadRealChannel(reader, "vectorData" + std::to_string(i), count, bytes,
+                        ToDoubles(particles->VectorDataAt(i + 3)));
+    }
+
+    m_lastQuantized.Swap(quantized);
+    m_frame = frame;
+    m_hasFrame = true;
+    m_isLastFrameKeyFrame = isKeyFrame;
+}
+
+template <size_t N>
+bool ParticleCacheReader<N>::IsLastFrameKeyFrame() const
+{
+    return m_isLastFrameKeyFrame;
+}
+
+template class ParticleCacheWriter<2>;
+
+template class ParticleCacheWriter<3>;
+
+template class ParticleCacheReader<2>;
+
+template class ParticleCacheReader<3>;
+}  // namespace CubbyFlow
\ No newline at end of file
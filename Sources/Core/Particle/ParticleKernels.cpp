@@ -0,0 +1,196 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Particle/ParticleKernels.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/Parallel.hpp>
+#include <Core/Utils/SIMD.hpp>
+
+#include "ParticleKernelsSIMD.hpp"
+
+#include <limits>
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+const ParticleKernelTable* GetScalarParticleKernelTable()
+{
+    return MakeParticleKernelTable<ScalarOps>();
+}
+}  // namespace Internal
+
+namespace
+{
+const Internal::ParticleKernelTable* GetParticleKernelTable()
+{
+    const SIMDLevel level = GetSIMDLevel();
+    const Internal::ParticleKernelTable* table = nullptr;
+
+    // Fall back to the next lower level if the library was built without
+    // the instruction set flags for the requested one.
+    if (level >= SIMDLevel::AVX512)
+    {
+        table = Internal::GetAVX512ParticleKernelTable();
+    }
+    if (table == nullptr && level >= SIMDLevel::AVX2)
+    {
+        table = Internal::GetAVX2ParticleKernelTable();
+    }
+    if (table == nullptr && level >= SIMDLevel::SSE4)
+    {
+        table = Internal::GetSSE4ParticleKernelTable();
+    }
+
+    return (table != nullptr) ? table
+                              : Internal::GetScalarParticleKernelTable();
+}
+
+const double* ToDoubles(const ConstArrayView1<Vector3D>& data)
+{
+    return reinterpret_cast<const double*>(data.data());
+}
+
+double* ToDoubles(ArrayView1<Vector3D> data)
+{
+    return reinterpret_cast<double*>(data.data());
+}
+}  // namespace
+
+void IntegrateParticles(const ConstArrayView1<Vector3D>& positions,
+                        const ConstArrayView1<Vector3D>& velocities,
+                        const ConstArrayView1<Vector3D>& forces, double mass,
+                        double timeStepInSeconds,
+                        ArrayView1<Vector3D> newPositions,
+                        ArrayView1<Vector3D> newVelocities)
+{
+    const Internal::ParticleKernelTable* table = GetParticleKernelTable();
+    const double* x = ToDoubles(positions);
+    const double* v = ToDoubles(velocities);
+    const double* f = ToDoubles(forces);
+    double* newX = ToDoubles(newPositions);
+    double* newV = ToDoubles(newVelocities);
+
+    ParallelRangeFor(ZERO_SIZE, positions.Length(),
+                     [&](size_t begin, size_t end) {
+                         const size_t offset = 3 * begin;
+                         table->integrate(x + offset, v + offset, f + offset,
+                                          3 * (end - begin), timeStepInSeconds,
+                                          mass, newX + offset, newV + offset);
+                     });
+}
+
+void ClampParticlesToBox(const BoundingBox3D& boundingBox, int boundaryFlags,
+                         ArrayView1<Vector3D> positions,
+                         ArrayView1<Vector3D> velocities)
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    constexpr int lowerFlags[3] = { DIRECTION_LEFT, DIRECTION_DOWN,
+                                    DIRECTION_BACK };
+    constexpr int upperFlags[3] = { DIRECTION_RIGHT, DIRECTION_UP,
+                                    DIRECTION_FRONT };
+
+    // Open sides never clamp.
+    double lower[3];
+    double upper[3];
+    for (size_t c = 0; c < 3; ++c)
+    {
+        lower[c] = (boundaryFlags & lowerFlags[c]) ? boundingBox.lowerCorner[c]
+                                                   : -inf;
+        upper[c] = (boundaryFlags & upperFlags[c]) ? boundingBox.upperCorner[c]
+                                                   : inf;
+    }
+
+    const Internal::ParticleKernelTable* table = GetParticleKernelTable();
+    double* x = ToDoubles(positions);
+    double* v = ToDoubles(velocities);
+
+    ParallelRangeFor(ZERO_SIZE, positions.Length(),
+                     [&](size_t begin, size_t end) {
+                         const size_t offset = 3 * begin;
+                         table->clampToBox(x + offset, v + offset,
+                                           3 * (end - begin), lower, upper);
+                     });
+}
+
+void ComputeSPHStdKernelDensities(const ConstArrayView1<Vector3D>& positions,
+                                  const Array1<Array1<size_t>>& neighborLists,
+                                  double kernelRadius, double mass,
+                                  ArrayView1<double> densities)
+{
+    const Internal::ParticleKernelTable* table = GetParticleKernelTable();
+    const double* x = ToDoubles(positions);
+
+    // Self contribution is W(0) = 315 / (64 pi h^3).
+    const double scale =
+        mass * 315.0 / (64.0 * PI_DOUBLE * Cubic(kernelRadius));
+
+    ParallelFor(ZERO_SIZE, positions.Length(), [&](size_t i) {
+        const Array1<size_t>& neighbors = neighborLists[i];
+        const double sum = table->sumStdKernel(x, i, neighbors.data(),
+                                               neighbors.Length(),
+                                               kernelRadius);
+        densities[i] = scale * (1.0 + sum);
+    });
+}
+
+void AccumulateSPHPressureForces(const ConstArrayView1<Vector3D>& positions,
+                                 const ConstArrayView1<double>& pressureTerms,
+                                 const Array1<Array1<size_t>>& neighborLists,
+                                 double kernelRadius, double mass,
+                                 ArrayView1<Vector3D> pressureForces)
+{
+    const Internal::ParticleKernelTable* table = GetParticleKernelTable();
+    const double* x = ToDoubles(positions);
+    const double* q = pressureTerms.data();
+
+    // Gradient of the spiky kernel is 45 / (pi h^4) (1 - r / h)^2 (x_j - x_i)
+    // / r, which is accumulated without the constant factor.
+    const double scale =
+        Square(mass) * 45.0 / (PI_DOUBLE * Square(Square(kernelRadius)));
+
+    ParallelFor(ZERO_SIZE, positions.Length(), [&](size_t i) {
+        const Array1<size_t>& neighbors = neighborLists[i];
+        Vector3D sum;
+        table->sumSpikyPressureGradient(x, q, i, neighbors.data(),
+                                        neighbors.Length(), kernelRadius,
+                                        &sum.x);
+        pressureForces[i] -= scale * sum;
+    });
+}
+
+void AccumulateSPHViscosityForces(const ConstArrayView1<Vector3D>& positions,
+                                  const ConstArrayView1<Vector3D>& velocities,
+                                  const ConstArrayView1<double>& densities,
+                                  const Array1<Array1<size_t>>& neighborLists,
+                                  double kernelRadius, double mass,
+                                  double viscosityCoefficient,
+                                  ArrayView1<Vector3D> forces)
+{
+    const Internal::ParticleKernelTable* table = GetParticleKernelTable();
+    const double* x = ToDoubles(positions);
+    const double* v = ToDoubles(velocities);
+    const double* d = densities.data();
+
+    // Second derivative of the spiky kernel is 90 / (pi h^5) (1 - r / h).
+    const double scale = viscosityCoefficient * Square(mass) * 90.0 /
+                         (PI_DOUBLE * Square(kernelRadius) *
+                          Cubic(kernelRadius));
+
+    ParallelFor(ZERO_SIZE, positions.Length(), [&](size_t i) {
+        const Array1<size_t>& neighbors = neighborLists[i];
+        Vector3D sum;
+        table->sumSpikyViscosity(x, v, d, i, neighbors.data(),
+                                 neighbors.Length(), kernelRadius, &sum.x);
+        forces[i] += scale * sum;
+    });
+}
+}  // namespace CubbyFlow
\ No newline at end of file
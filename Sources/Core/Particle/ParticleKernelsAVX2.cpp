@@ -0,0 +1,143 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "ParticleKernelsSIMD.hpp"
+
+#if defined(__AVX2__)
+#define CUBBYFLOW_PARTICLE_KERNELS_AVX2
+#include <immintrin.h>
+#endif
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+#ifdef CUBBYFLOW_PARTICLE_KERNELS_AVX2
+namespace
+{
+struct AVX2Ops
+{
+    using Reg = __m256d;
+    using Mask = __m256d;
+
+    static constexpr size_t WIDTH = 4;
+
+    static Reg Load(const double* p)
+    {
+        return _mm256_loadu_pd(p);
+    }
+
+    static void Store(double* p, Reg a)
+    {
+        _mm256_storeu_pd(p, a);
+    }
+
+    static Reg Set1(double a)
+    {
+        return _mm256_set1_pd(a);
+    }
+
+    static Reg Zero()
+    {
+        return _mm256_setzero_pd();
+    }
+
+    static Reg Add(Reg a, Reg b)
+    {
+        return _mm256_add_pd(a, b);
+    }
+
+    static Reg Sub(Reg a, Reg b)
+    {
+        return _mm256_sub_pd(a, b);
+    }
+
+    static Reg Mul(Reg a, Reg b)
+    {
+        return _mm256_mul_pd(a, b);
+    }
+
+    static Reg Div(Reg a, Reg b)
+    {
+        return _mm256_div_pd(a, b);
+    }
+
+    static Reg Sqrt(Reg a)
+    {
+        return _mm256_sqrt_pd(a);
+    }
+
+    static Mask LessThan(Reg a, Reg b)
+    {
+        return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+    }
+
+    static Mask LessEqual(Reg a, Reg b)
+    {
+        return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+    }
+
+    static Mask GreaterThan(Reg a, Reg b)
+    {
+        return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask GreaterEqual(Reg a, Reg b)
+    {
+        return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+    }
+
+    static Mask And(Mask a, Mask b)
+    {
+        return _mm256_and_pd(a, b);
+    }
+
+    static Mask Or(Mask a, Mask b)
+    {
+        return _mm256_or_pd(a, b);
+    }
+
+    static Reg Select(Mask mask, Reg a, Reg b)
+    {
+        return _mm256_blendv_pd(b, a, mask);
+    }
+
+    // Composed from scalar loads rather than _mm256_i64gather_pd, which is
+    // not faster on most CPUs and much slower with the Gather Data Sampling
+    // microcode mitigation.
+    template <size_t STRIDE>
+    static Reg Gather(const double* base, const size_t* indices)
+    {
+        return _mm256_set_pd(
+            base[indices[3] * STRIDE], base[indices[2] * STRIDE],
+            base[indices[1] * STRIDE], base[indices[0] * STRIDE]);
+    }
+
+    static double ReduceAdd(Reg a)
+    {
+        const __m128d sum =
+            _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+};
+}  // namespace
+
+const ParticleKernelTable* GetAVX2ParticleKernelTable()
+{
+    return MakeParticleKernelTable<AVX2Ops>();
+}
+#else
+const ParticleKernelTable* GetAVX2ParticleKernelTable()
+{
+    return nullptr;
+}
+#endif
+}  // namespace Internal
+}  // namespace CubbyFlow
\ No newline at end of file
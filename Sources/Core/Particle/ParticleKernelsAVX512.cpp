@@ -0,0 +1,149 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "ParticleKernelsSIMD.hpp"
+
+#if defined(__AVX512F__)
+#define CUBBYFLOW_PARTICLE_KERNELS_AVX512
+#include <immintrin.h>
+#endif
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+#ifdef CUBBYFLOW_PARTICLE_KERNELS_AVX512
+namespace
+{
+struct AVX512Ops
+{
+    using Reg = __m512d;
+    using Mask = __mmask8;
+
+    static constexpr size_t WIDTH = 8;
+
+    static Reg Load(const double* p)
+    {
+        return _mm512_loadu_pd(p);
+    }
+
+    static void Store(double* p, Reg a)
+    {
+        _mm512_storeu_pd(p, a);
+    }
+
+    static Reg Set1(double a)
+    {
+        return _mm512_set1_pd(a);
+    }
+
+    static Reg Zero()
+    {
+        return _mm512_setzero_pd();
+    }
+
+    static Reg Add(Reg a, Reg b)
+    {
+        return _mm512_add_pd(a, b);
+    }
+
+    static Reg Sub(Reg a, Reg b)
+    {
+        return _mm512_sub_pd(a, b);
+    }
+
+    static Reg Mul(Reg a, Reg b)
+    {
+        return _mm512_mul_pd(a, b);
+    }
+
+    static Reg Div(Reg a, Reg b)
+    {
+        return _mm512_div_pd(a, b);
+    }
+
+    // _mm512_sqrt_pd leaves the masked-off destination undefined, which
+    // triggers false uninitialized warnings on some GCC versions.
+    static Reg Sqrt(Reg a)
+    {
+        return _mm512_maskz_sqrt_pd(0xff, a);
+    }
+
+    static Mask LessThan(Reg a, Reg b)
+    {
+        return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+    }
+
+    static Mask LessEqual(Reg a, Reg b)
+    {
+        return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ);
+    }
+
+    static Mask GreaterThan(Reg a, Reg b)
+    {
+        return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+    }
+
+    static Mask GreaterEqual(Reg a, Reg b)
+    {
+        return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ);
+    }
+
+    static Mask And(Mask a, Mask b)
+    {
+        return static_cast<Mask>(a & b);
+    }
+
+    static Mask Or(Mask a, Mask b)
+    {
+        return static_cast<Mask>(a | b);
+    }
+
+    static Reg Select(Mask mask, Reg a, Reg b)
+    {
+        return _mm512_mask_blend_pd(mask, b, a);
+    }
+
+    // Composed from scalar loads rather than _mm512_i64gather_pd, which is
+    // not faster on most CPUs and much slower with the Gather Data Sampling
+    // microcode mitigation.
+    template <size_t STRIDE>
+    static Reg Gather(const double* base, const size_t* indices)
+    {
+        return _mm512_set_pd(
+            base[indices[7] * STRIDE], base[indices[6] * STRIDE],
+            base[indices[5] * STRIDE], base[indices[4] * STRIDE],
+            base[indices[3] * STRIDE], base[indices[2] * STRIDE],
+            base[indices[1] * STRIDE], base[indices[0] * STRIDE]);
+    }
+
+    static double ReduceAdd(Reg a)
+    {
+        alignas(64) double lanes[WIDTH];
+        _mm512_store_pd(lanes, a);
+
+        return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+               ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+};
+}  // namespace
+
+const ParticleKernelTable* GetAVX512ParticleKernelTable()
+{
+    return MakeParticleKernelTable<AVX512Ops>();
+}
+#else
+const ParticleKernelTable* GetAVX512ParticleKernelTable()
+{
+    return nullptr;
+}
+#endif
+}  // namespace Internal
+}  // namespace CubbyFlow
\ No newline at end of file
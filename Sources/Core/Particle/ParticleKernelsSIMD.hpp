@@ -0,0 +1,462 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef CUBBYFLOW_PARTICLE_KERNELS_SIMD_HPP
+#define CUBBYFLOW_PARTICLE_KERNELS_SIMD_HPP
+
+// This header is shared by the translation units compiled with different
+// instruction set flags. It must not include the Core headers, otherwise the
+// inline functions of those headers could be emitted with AVX instructions and
+// picked up by the linker for the whole library.
+
+#include <cmath>
+#include <cstddef>
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+//! Particle kernels operating on the flattened 3-D particle channels.
+struct ParticleKernelTable
+{
+    void (*integrate)(const double* x, const double* v, const double* f,
+                      size_t count, double dt, double mass, double* newX,
+                      double* newV);
+
+    void (*clampToBox)(double* x, double* v, size_t count,
+                       const double* lower, const double* upper);
+
+    double (*sumStdKernel)(const double* x, size_t i,
+                           const size_t* neighbors, size_t numberOfNeighbors,
+                           double h);
+
+    void (*sumSpikyPressureGradient)(const double* x, const double* q,
+                                     size_t i, const size_t* neighbors,
+                                     size_t numberOfNeighbors, double h,
+                                     double* sum);
+
+    void (*sumSpikyViscosity)(const double* x, const double* v,
+                              const double* d, size_t i,
+                              const size_t* neighbors,
+                              size_t numberOfNeighbors, double h,
+                              double* sum);
+};
+
+//! Returns the scalar kernel table.
+const ParticleKernelTable* GetScalarParticleKernelTable();
+
+//! Returns the SSE4.1 kernel table, or nullptr if it is not compiled.
+const ParticleKernelTable* GetSSE4ParticleKernelTable();
+
+//! Returns the AVX2 kernel table, or nullptr if it is not compiled.
+const ParticleKernelTable* GetAVX2ParticleKernelTable();
+
+//! Returns the AVX-512 kernel table, or nullptr if it is not compiled.
+const ParticleKernelTable* GetAVX512ParticleKernelTable();
+
+namespace
+{
+struct ScalarOps
+{
+    using Reg = double;
+    using Mask = bool;
+
+    static constexpr size_t WIDTH = 1;
+
+    static Reg Load(const double* p)
+    {
+        return *p;
+    }
+
+    static void Store(double* p, Reg a)
+    {
+        *p = a;
+    }
+
+    static Reg Set1(double a)
+    {
+        return a;
+    }
+
+    static Reg Zero()
+    {
+        return 0.0;
+    }
+
+    static Reg Add(Reg a, Reg b)
+    {
+        return a + b;
+    }
+
+    static Reg Sub(Reg a, Reg b)
+    {
+        return a - b;
+    }
+
+    static Reg Mul(Reg a, Reg b)
+    {
+        return a * b;
+    }
+
+    static Reg Div(Reg a, Reg b)
+    {
+        return a / b;
+    }
+
+    static Reg Sqrt(Reg a)
+    {
+        return std::sqrt(a);
+    }
+
+    static Mask LessThan(Reg a, Reg b)
+    {
+        return a < b;
+    }
+
+    static Mask LessEqual(Reg a, Reg b)
+    {
+        return a <= b;
+    }
+
+    static Mask GreaterThan(Reg a, Reg b)
+    {
+        return a > b;
+    }
+
+    static Mask GreaterEqual(Reg a, Reg b)
+    {
+        return a >= b;
+    }
+
+    static Mask And(Mask a, Mask b)
+    {
+        return a && b;
+    }
+
+    static Mask Or(Mask a, Mask b)
+    {
+        return a || b;
+    }
+
+    static Reg Select(Mask mask, Reg a, Reg b)
+    {
+        return mask ? a : b;
+    }
+
+    template <size_t STRIDE>
+    static Reg Gather(const double* base, const size_t* indices)
+    {
+        return base[indices[0] * STRIDE];
+    }
+
+    static double ReduceAdd(Reg a)
+    {
+        return a;
+    }
+};
+
+// Each kernel is split into a range function, which processes as many
+// full-width blocks as possible and returns where it stopped, and a driver
+// which finishes the remainder with ScalarOps.
+
+template <typename Ops>
+size_t IntegrateRange(const double* x, const double* v, const double* f,
+                      size_t begin, size_t end, double dt, double mass,
+                      double* newX, double* newV)
+{
+    using Reg = typename Ops::Reg;
+
+    const Reg dtReg = Ops::Set1(dt);
+    const Reg massReg = Ops::Set1(mass);
+
+    size_t k = begin;
+    for (; k + Ops::WIDTH <= end; k += Ops::WIDTH)
+    {
+        // Same operation order as v + dt * f / m and x + dt * v of Vector3D,
+        // so that every level produces identical results. This relies on the
+        // floating-point contraction being disabled for the kernel sources.
+        const Reg vel =
+            Ops::Add(Ops::Load(v + k),
+                     Ops::Div(Ops::Mul(dtReg, Ops::Load(f + k)), massReg));
+        Ops::Store(newV + k, vel);
+        Ops::Store(newX + k, Ops::Add(Ops::Load(x + k), Ops::Mul(dtReg, vel)));
+    }
+
+    return k;
+}
+
+template <typename Ops>
+void Integrate(const double* x, const double* v, const double* f, size_t count,
+               double dt, double mass, double* newX, double* newV)
+{
+    const size_t k =
+        IntegrateRange<Ops>(x, v, f, 0, count, dt, mass, newX, newV);
+    IntegrateRange<ScalarOps>(x, v, f, k, count, dt, mass, newX, newV);
+}
+
+template <typename Ops>
+size_t ClampToBoxRange(double* x, double* v, size_t begin, size_t end,
+                       const double* lower, const double* upper)
+{
+    using Reg = typename Ops::Reg;
+    using Mask = typename Ops::Mask;
+    constexpr size_t W = Ops::WIDTH;
+
+    // Three registers hold W particles, so the x/y/z pattern of the bounds
+    // repeats every three registers. begin must be a multiple of three.
+    double lowerPattern[3 * W];
+    double upperPattern[3 * W];
+    for (size_t c = 0; c < 3 * W; ++c)
+    {
+        lowerPattern[c] = lower[c % 3];
+        upperPattern[c] = upper[c % 3];
+    }
+
+    Reg lowerReg[3];
+    Reg upperReg[3];
+    for (size_t r = 0; r < 3; ++r)
+    {
+        lowerReg[r] = Ops::Load(lowerPattern + r * W);
+        upperReg[r] = Ops::Load(upperPattern + r * W);
+    }
+
+    const Reg zero = Ops::Zero();
+
+    size_t k = begin;
+    for (; k + 3 * W <= end; k += 3 * W)
+    {
+        for (size_t r = 0; r < 3; ++r)
+        {
+            double* xr = x + k + r * W;
+            double* vr = v + k + r * W;
+
+            Reg p = Ops::Load(xr);
+            const Mask below = Ops::LessEqual(p, lowerReg[r]);
+            p = Ops::Select(below, lowerReg[r], p);
+            const Mask above = Ops::GreaterEqual(p, upperReg[r]);
+            p = Ops::Select(above, upperReg[r], p);
+
+            Ops::Store(xr, p);
+            Ops::Store(vr, Ops::Select(Ops::Or(below, above), zero,
+                                       Ops::Load(vr)));
+        }
+    }
+
+    return k;
+}
+
+template <typename Ops>
+void ClampToBox(double* x, double* v, size_t count, const double* lower,
+                const double* upper)
+{
+    const size_t k = ClampToBoxRange<Ops>(x, v, 0, count, lower, upper);
+    ClampToBoxRange<ScalarOps>(x, v, k, count, lower, upper);
+}
+
+template <typename Ops>
+size_t SumStdKernelRange(const double* x, size_t i, const size_t* neighbors,
+                         size_t begin, size_t end, double h, double* sum)
+{
+    using Reg = typename Ops::Reg;
+    using Mask = typename Ops::Mask;
+
+    const Reg xi = Ops::Set1(x[3 * i]);
+    const Reg yi = Ops::Set1(x[3 * i + 1]);
+    const Reg zi = Ops::Set1(x[3 * i + 2]);
+    const Reg h2 = Ops::Set1(h * h);
+    const Reg one = Ops::Set1(1.0);
+    const Reg zero = Ops::Zero();
+
+    Reg acc = zero;
+
+    size_t k = begin;
+    for (; k + Ops::WIDTH <= end; k += Ops::WIDTH)
+    {
+        const size_t* idx = neighbors + k;
+        const Reg dx = Ops::Sub(Ops::template Gather<3>(x, idx), xi);
+        const Reg dy = Ops::Sub(Ops::template Gather<3>(x + 1, idx), yi);
+        const Reg dz = Ops::Sub(Ops::template Gather<3>(x + 2, idx), zi);
+        const Reg r2 = Ops::Add(Ops::Add(Ops::Mul(dx, dx), Ops::Mul(dy, dy)),
+                                Ops::Mul(dz, dz));
+
+        const Mask inside = Ops::LessThan(r2, h2);
+        const Reg t = Ops::Sub(one, Ops::Div(r2, h2));
+        acc = Ops::Add(
+            acc, Ops::Select(inside, Ops::Mul(Ops::Mul(t, t), t), zero));
+    }
+
+    *sum += Ops::ReduceAdd(acc);
+
+    return k;
+}
+
+template <typename Ops>
+double SumStdKernel(const double* x, size_t i, const size_t* neighbors,
+                    size_t numberOfNeighbors, double h)
+{
+    double sum = 0.0;
+    const size_t k =
+        SumStdKernelRange<Ops>(x, i, neighbors, 0, numberOfNeighbors, h, &sum);
+    SumStdKernelRange<ScalarOps>(x, i, neighbors, k, numberOfNeighbors, h,
+                                 &sum);
+
+    return sum;
+}
+
+template <typename Ops>
+size_t SumSpikyPressureGradientRange(const double* x, const double* q,
+                                     size_t i, const size_t* neighbors,
+                                     size_t begin, size_t end, double h,
+                                     double* sum)
+{
+    using Reg = typename Ops::Reg;
+    using Mask = typename Ops::Mask;
+
+    const Reg xi = Ops::Set1(x[3 * i]);
+    const Reg yi = Ops::Set1(x[3 * i + 1]);
+    const Reg zi = Ops::Set1(x[3 * i + 2]);
+    const Reg qi = Ops::Set1(q[i]);
+    const Reg hReg = Ops::Set1(h);
+    const Reg one = Ops::Set1(1.0);
+    const Reg zero = Ops::Zero();
+
+    Reg accX = zero;
+    Reg accY = zero;
+    Reg accZ = zero;
+
+    size_t k = begin;
+    for (; k + Ops::WIDTH <= end; k += Ops::WIDTH)
+    {
+        const size_t* idx = neighbors + k;
+        const Reg dx = Ops::Sub(Ops::template Gather<3>(x, idx), xi);
+        const Reg dy = Ops::Sub(Ops::template Gather<3>(x + 1, idx), yi);
+        const Reg dz = Ops::Sub(Ops::template Gather<3>(x + 2, idx), zi);
+        const Reg r = Ops::Sqrt(
+            Ops::Add(Ops::Add(Ops::Mul(dx, dx), Ops::Mul(dy, dy)),
+                     Ops::Mul(dz, dz)));
+
+        // Coincident particles have no direction and are skipped.
+        const Mask inside =
+            Ops::And(Ops::GreaterThan(r, zero), Ops::LessThan(r, hReg));
+        const Reg t = Ops::Sub(one, Ops::Div(r, hReg));
+        const Reg qSum = Ops::Add(qi, Ops::template Gather<1>(q, idx));
+        const Reg w = Ops::Select(
+            inside, Ops::Div(Ops::Mul(qSum, Ops::Mul(t, t)), r), zero);
+
+        accX = Ops::Add(accX, Ops::Mul(w, dx));
+        accY = Ops::Add(accY, Ops::Mul(w, dy));
+        accZ = Ops::Add(accZ, Ops::Mul(w, dz));
+    }
+
+    sum[0] += Ops::ReduceAdd(accX);
+    sum[1] += Ops::ReduceAdd(accY);
+    sum[2] += Ops::ReduceAdd(accZ);
+
+    return k;
+}
+
+template <typename Ops>
+void SumSpikyPressureGradient(const double* x, const double* q, size_t i,
+                              const size_t* neighbors,
+                              size_t numberOfNeighbors, double h, double* sum)
+{
+    sum[0] = sum[1] = sum[2] = 0.0;
+
+    const size_t k = SumSpikyPressureGradientRange<Ops>(
+        x, q, i, neighbors, 0, numberOfNeighbors, h, sum);
+    SumSpikyPressureGradientRange<ScalarOps>(x, q, i, neighbors, k,
+                                             numberOfNeighbors, h, sum);
+}
+
+template <typename Ops>
+size_t SumSpikyViscosityRange(const double* x, const double* v,
+                              const double* d, size_t i,
+                              const size_t* neighbors, size_t begin,
+                              size_t end, double h, double* sum)
+{
+    using Reg = typename Ops::Reg;
+    using Mask = typename Ops::Mask;
+
+    const Reg xi = Ops::Set1(x[3 * i]);
+    const Reg yi = Ops::Set1(x[3 * i + 1]);
+    const Reg zi = Ops::Set1(x[3 * i + 2]);
+    const Reg vxi = Ops::Set1(v[3 * i]);
+    const Reg vyi = Ops::Set1(v[3 * i + 1]);
+    const Reg vzi = Ops::Set1(v[3 * i + 2]);
+    const Reg hReg = Ops::Set1(h);
+    const Reg one = Ops::Set1(1.0);
+    const Reg zero = Ops::Zero();
+
+    Reg accX = zero;
+    Reg accY = zero;
+    Reg accZ = zero;
+
+    size_t k = begin;
+    for (; k + Ops::WIDTH <= end; k += Ops::WIDTH)
+    {
+        const size_t* idx = neighbors + k;
+        const Reg dx = Ops::Sub(Ops::template Gather<3>(x, idx), xi);
+        const Reg dy = Ops::Sub(Ops::template Gather<3>(x + 1, idx), yi);
+        const Reg dz = Ops::Sub(Ops::template Gather<3>(x + 2, idx), zi);
+        const Reg r = Ops::Sqrt(
+            Ops::Add(Ops::Add(Ops::Mul(dx, dx), Ops::Mul(dy, dy)),
+                     Ops::Mul(dz, dz)));
+
+        const Mask inside = Ops::LessThan(r, hReg);
+        const Reg t = Ops::Sub(one, Ops::Div(r, hReg));
+        const Reg w = Ops::Select(
+            inside, Ops::Div(t, Ops::template Gather<1>(d, idx)), zero);
+
+        accX = Ops::Add(
+            accX,
+            Ops::Mul(w, Ops::Sub(Ops::template Gather<3>(v, idx), vxi)));
+        accY = Ops::Add(
+            accY,
+            Ops::Mul(w, Ops::Sub(Ops::template Gather<3>(v + 1, idx), vyi)));
+        accZ = Ops::Add(
+            accZ,
+            Ops::Mul(w, Ops::Sub(Ops::template Gather<3>(v + 2, idx), vzi)));
+    }
+
+    sum[0] += Ops::ReduceAdd(accX);
+    sum[1] += Ops::ReduceAdd(accY);
+    sum[2] += Ops::ReduceAdd(accZ);
+
+    return k;
+}
+
+template <typename Ops>
+void SumSpikyViscosity(const double* x, const double* v, const double* d,
+                       size_t i, const size_t* neighbors,
+                       size_t numberOfNeighbors, double h, double* sum)
+{
+    sum[0] = sum[1] = sum[2] = 0.0;
+
+    const size_t k = SumSpikyViscosityRange<Ops>(x, v, d, i, neighbors, 0,
+                                                 numberOfNeighbors, h, sum);
+    SumSpikyViscosityRange<ScalarOps>(x, v, d, i, neighbors, k,
+                                      numberOfNeighbors, h, sum);
+}
+
+template <typename Ops>
+const ParticleKernelTable* MakeParticleKernelTable()
+{
+    static const ParticleKernelTable s_table{
+        Integrate<Ops>, ClampToBox<Ops>, SumStdKernel<Ops>,
+        SumSpikyPressureGradient<Ops>, SumSpikyViscosity<Ops>
+    };
+
+    return &s_table;
+}
+}  // namespace
+}  // namespace Internal
+}  // namespace CubbyFlow
+
+#endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "ParticleKernelsSIMD.hpp"
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(_M_X64))
+#define CUBBYFLOW_PARTICLE_KERNELS_SSE4
+#include <smmintrin.h>
+#endif
+
+namespace CubbyFlow
+{
+namespace Internal
+{
+#ifdef CUBBYFLOW_PARTICLE_KERNELS_SSE4
+namespace
+{
+struct SSE4Ops
+{
+    using Reg = __m128d;
+    using Mask = __m128d;
+
+    static constexpr size_t WIDTH = 2;
+
+    static Reg Load(const double* p)
+    {
+        return _mm_loadu_pd(p);
+    }
+
+    static void Store(double* p, Reg a)
+    {
+        _mm_storeu_pd(p, a);
+    }
+
+    static Reg Set1(double a)
+    {
+        return _mm_set1_pd(a);
+    }
+
+    static Reg Zero()
+    {
+        return _mm_setzero_pd();
+    }
+
+    static Reg Add(Reg a, Reg b)
+    {
+        return _mm_add_pd(a, b);
+    }
+
+    static Reg Sub(Reg a, Reg b)
+    {
+        return _mm_sub_pd(a, b);
+    }
+
+    static Reg Mul(Reg a, Reg b)
+    {
+        return _mm_mul_pd(a, b);
+    }
+
+    static Reg Div(Reg a, Reg b)
+    {
+        return _mm_div_pd(a, b);
+    }
+
+    static Reg Sqrt(Reg a)
+    {
+        return _mm_sqrt_pd(a);
+    }
+
+    static Mask LessThan(Reg a, Reg b)
+    {
+        return _mm_cmplt_pd(a, b);
+    }
+
+    static Mask LessEqual(Reg a, Reg b)
+    {
+        return _mm_cmple_pd(a, b);
+    }
+
+    static Mask GreaterThan(Reg a, Reg b)
+    {
+        return _mm_cmpgt_pd(a, b);
+    }
+
+    static Mask GreaterEqual(Reg a, Reg b)
+    {
+        return _mm_cmpge_pd(a, b);
+    }
+
+    static Mask And(Mask a, Mask b)
+    {
+        return _mm_and_pd(a, b);
+    }
+
+    static Mask Or(Mask a, Mask b)
+    {
+        return _mm_or_pd(a, b);
+    }
+
+    static Reg Select(Mask mask, Reg a, Reg b)
+    {
+        return _mm_blendv_pd(b, a, mask);
+    }
+
+    // SSE has no gather instruction.
+    template <size_t STRIDE>
+    static Reg Gather(const double* base, const size_t* indices)
+    {
+        return _mm_set_pd(base[indices[1] * STRIDE],
+                          base[indices[0] * STRIDE]);
+    }
+
+    static double ReduceAdd(Reg a)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+    }
+};
+}  // namespace
+
+const ParticleKernelTable* GetSSE4ParticleKernelTable()
+{
+    return MakeParticleKernelTable<SSE4Ops>();
+}
+#else
+const ParticleKernelTable* GetSSE4ParticleKernelTable()
+{
+    return nullptr;
+}
+#endif
+}  // namespace Internal
+}  // namespace CubbyFlow
\ No newline at end of file
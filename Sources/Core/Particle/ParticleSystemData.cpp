@@ -20,6 +20,11 @@
 #include <Flatbuffers/generated/ParticleSystemData2_generated.h>
 #include <Flatbuffers/generated/ParticleSystemData3_generated.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 namespace CubbyFlow
 {
 static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
@@ -54,6 +59,30 @@ struct GetFlatbuffersParticleSystemData<3>
     }
 };
 
+template <size_t N>
+struct GetPointNeighborSearcher
+{
+    // Do nothing
+};
+
+template <>
+struct GetPointNeighborSearcher<2>
+{
+    static PointNeighborSearcher2Ptr Build(const std::string& name)
+    {
+        return Factory::BuildPointNeighborSearcher2(name);
+    }
+};
+
+template <>
+struct GetPointNeighborSearcher<3>
+{
+    static PointNeighborSearcher3Ptr Build(const std::string& name)
+    {
+        return Factory::BuildPointNeighborSearcher3(name);
+    }
+};
+
 template <size_t N>
 ParticleSystemData<N>::ParticleSystemData() : ParticleSystemData{ 0 }
 {
@@ -188,6 +217,18 @@ size_t ParticleSystemData<N>::NumberOfParticles() const
     return m_numberOfParticles;
 }
 
+template <size_t N>
+size_t ParticleSystemData<N>::NumberOfScalarData() const
+{
+    return m_scalarDataList.Length();
+}
+
+template <size_t N>
+size_t ParticleSystemData<N>::NumberOfVectorData() const
+{
+    return m_vectorDataList.Length();
+}
+
 template <size_t N>
 size_t ParticleSystemData<N>::AddScalarData(double initialVal)
 {
@@ -439,6 +480,210 @@ void ParticleSystemData<N>::Deserialize(const std::vector<uint8_t>& buffer)
     Deserialize(fbsParticleSystemData, *this);
 }
 
+template <size_t N>
+void ParticleSystemData<N>::Serialize(ChannelStreamWriter* writer) const
+{
+    writer->WriteValue("radius", m_radius);
+    writer->WriteValue("mass", m_mass);
+    writer->WriteValue<uint64_t>("positionIdx", m_positionIdx);
+    writer->WriteValue<uint64_t>("velocityIdx", m_velocityIdx);
+    writer->WriteValue<uint64_t>("forceIdx", m_forceIdx);
+    writer->WriteValue<uint64_t>("numberOfScalarData",
+                                 m_scalarDataList.Length());
+    writer->WriteValue<uint64_t>("numberOfVectorData",
+                                 m_vectorDataList.Length());
+
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        writer->Write("scalarData" + std::to_string(i),
+                      m_scalarDataList[i].View());
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        writer->Write("vectorData" + std::to_string(i),
+                      m_vectorDataList[i].View());
+    }
+
+    // The neighbor searcher and lists are stored as well, so that the
+    // particles read back can be simulated without rebuilding them.
+    const std::string neighborSearcherType = m_neighborSearcher->TypeName();
+    std::vector<uint8_t> neighborSearcher;
+    m_neighborSearcher->Serialize(&neighborSearcher);
+    writer->WriteRaw("neighborSearcherType", neighborSearcherType.data(), 1,
+                     neighborSearcherType.size());
+    writer->WriteRaw("neighborSearcher", neighborSearcher.data(), 1,
+                     neighborSearcher.size());
+
+    // The neighbor lists are flattened into the offsets of each list and
+    // the concatenated neighbor indices.
+    Array1<uint64_t> neighborListOffsets(m_neighborLists.Length() + 1, 0);
+    for (size_t i = 0; i < m_neighborLists.Length(); ++i)
+    {
+        neighborListOffsets[i + 1] =
+            neighborListOffsets[i] + m_neighborLists[i].Length();
+    }
+
+    Array1<uint64_t> neighbors(
+        static_cast<size_t>(neighborListOffsets[m_neighborLists.Length()]));
+    ParallelFor(ZERO_SIZE, m_neighborLists.Length(), [&](size_t i) {
+        std::copy(m_neighborLists[i].begin(), m_neighborLists[i].end(),
+                  neighbors.begin() + neighborListOffsets[i]);
+    });
+
+    writer->Write("neighborListOffsets",
+                  ConstArrayView1<uint64_t>(neighborListOffsets));
+    writer->Write("neighbors", ConstArrayView1<uint64_t>(neighbors));
+}
+
+template <size_t N>
+void ParticleSystemData<N>::Deserialize(const MappedChannelReader& reader)
+{
+    m_radius = reader.Value<double>("radius");
+    m_mass = reader.Value<double>("mass");
+    m_positionIdx = static_cast<size_t>(reader.Value<uint64_t>("positionIdx"));
+    m_velocityIdx = static_cast<size_t>(reader.Value<uint64_t>("velocityIdx"));
+    m_forceIdx = static_cast<size_t>(reader.Value<uint64_t>("forceIdx"));
+
+    m_scalarDataList.Resize(
+        static_cast<size_t>(reader.Value<uint64_t>("numberOfScalarData")));
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        reader.Read("scalarData" + std::to_string(i), &m_scalarDataList[i]);
+    }
+
+    m_vectorDataList.Resize(
+        static_cast<size_t>(reader.Value<uint64_t>("numberOfVectorData")));
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        reader.Read("vectorData" + std::to_string(i), &m_vectorDataList[i]);
+    }
+
+    if (m_vectorDataList.IsEmpty() ||
+        m_positionIdx >= m_vectorDataList.Length() ||
+        m_velocityIdx >= m_vectorDataList.Length() ||
+        m_forceIdx >= m_vectorDataList.Length())
+    {
+        throw std::invalid_argument{ "Invalid particle data index." };
+    }
+
+    m_numberOfParticles = m_vectorDataList[0].Length();
+    for (const ScalarData& data : m_scalarDataList)
+    {
+        if (data.Length() != m_numberOfParticles)
+        {
+            throw std::invalid_argument{ "Particle data length mismatch." };
+        }
+    }
+    for (const VectorData& data : m_vectorDataList)
+    {
+        if (data.Length() != m_numberOfParticles)
+        {
+            throw std::invalid_argument{ "Particle data length mismatch." };
+        }
+    }
+
+    const ConstArrayView1<uint8_t> neighborSearcherType =
+        reader.View<uint8_t>("neighborSearcherType");
+    const ConstArrayView1<uint8_t> neighborSearcher =
+        reader.View<uint8_t>("neighborSearcher");
+    m_neighborSearcher = GetPointNeighborSearcher<N>::Build(std::string(
+        neighborSearcherType.data(),
+        neighborSearcherType.data() + neighborSearcherType.Length()));
+    if (m_neighborSearcher == nullptr)
+    {
+        throw std::invalid_argument{ "Invalid neighbor searcher type." };
+    }
+    m_neighborSearcher->Deserialize(std::vector<uint8_t>(
+        neighborSearcher.data(),
+        neighborSearcher.data() + neighborSearcher.Length()));
+
+    const ConstArrayView1<uint64_t> neighborListOffsets =
+        reader.View<uint64_t>("neighborListOffsets");
+    const ConstArrayView1<uint64_t> neighbors =
+        reader.View<uint64_t>("neighbors");
+    if (neighborListOffsets.IsEmpty() || neighborListOffsets[0] != 0 ||
+        neighborListOffsets[neighborListOffsets.Length() - 1] !=
+            neighbors.Length())
+    {
+        throw std::invalid_argument{ "Invalid neighbor lists." };
+    }
+    for (size_t i = 1; i < neighborListOffsets.Length(); ++i)
+    {
+        if (neighborListOffsets[i] < neighborListOffsets[i - 1])
+        {
+            throw std::invalid_argument{ "Invalid neighbor lists." };
+        }
+    }
+
+    m_neighborLists.Resize(neighborListOffsets.Length() - 1);
+    ParallelFor(ZERO_SIZE, m_neighborLists.Length(), [&](size_t i) {
+        const auto begin = static_cast<size_t>(neighborListOffsets[i]);
+        const auto end = static_cast<size_t>(neighborListOffsets[i + 1]);
+        m_neighborLists[i].Resize(end - begin);
+        std::copy(neighbors.data() + begin, neighbors.data() + end,
+                  m_neighborLists[i].begin());
+    });
+}
+
+template <size_t N>
+void ParticleSystemData<N>::SaveCheckpoint(const std::string& prefix,
+                                           Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue(prefix + "/radius", m_radius);
+    checkpoint->WriteValue(prefix + "/mass", m_mass);
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfParticles",
+                                     m_numberOfParticles);
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfScalarData",
+                                     m_scalarDataList.Length());
+    checkpoint->WriteValue<uint64_t>(prefix + "/numberOfVectorData",
+                                     m_vectorDataList.Length());
+
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        checkpoint->Write(prefix + "/scalarData" + std::to_string(i),
+                          m_scalarDataList[i].View());
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        checkpoint->Write(prefix + "/vectorData" + std::to_string(i),
+                          m_vectorDataList[i].View());
+    }
+}
+
+template <size_t N>
+void ParticleSystemData<N>::LoadCheckpoint(const std::string& prefix,
+                                           const Checkpoint& checkpoint)
+{
+    if (checkpoint.Value<uint64_t>(prefix + "/numberOfScalarData") !=
+            m_scalarDataList.Length() ||
+        checkpoint.Value<uint64_t>(prefix + "/numberOfVectorData") !=
+            m_vectorDataList.Length())
+    {
+        throw std::invalid_argument{ "Number of particle data mismatch." };
+    }
+
+    m_radius = checkpoint.Value<double>(prefix + "/radius");
+    m_mass = checkpoint.Value<double>(prefix + "/mass");
+    m_numberOfParticles = static_cast<size_t>(
+        checkpoint.Value<uint64_t>(prefix + "/numberOfParticles"));
+
+    for (size_t i = 0; i < m_scalarDataList.Length(); ++i)
+    {
+        checkpoint.Read(prefix + "/scalarData" + std::to_string(i),
+                        &m_scalarDataList[i]);
+    }
+
+    for (size_t i = 0; i < m_vectorDataList.Length(); ++i)
+    {
+        checkpoint.Read(prefix + "/vectorData" + std::to_string(i),
+                        &m_vectorDataList[i]);
+    }
+
+    m_neighborLists.Clear();
+}
+
 template <size_t N>
 void ParticleSystemData<N>::Set(const ParticleSystemData& other)
 {
@@ -657,6 +902,10 @@ std::enable_if_t<M == 2, void> ParticleSystemData<N>::Deserialize(
         }
     }
 
+    if (particles.m_vectorDataList.IsEmpty())
+    {
+        throw std::invalid_argument{ "Particle system has no vector data." };
+    }
     particles.m_numberOfParticles = particles.m_vectorDataList[0].Length();
 
     // Copy neighbor searcher
@@ -732,6 +981,10 @@ std::enable_if_t<M == 3, void> ParticleSystemData<N>::Deserialize(
         }
     }
 
+    if (particles.m_vectorDataList.IsEmpty())
+    {
+        throw std::invalid_argument{ "Particle system has no vector data." };
+    }
     particles.m_numberOfParticles = particles.m_vectorDataList[0].Length();
 
     // Copy neighbor searcher
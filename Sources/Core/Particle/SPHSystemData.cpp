@@ -497,6 +497,42 @@ void SPHSystemData<N>::Deserialize(const std::vector<uint8_t>& buffer)
     m_densityIdx = static_cast<size_t>(fbsSPHSystemData->densityIdx());
 }
 
+template <size_t N>
+void SPHSystemData<N>::Serialize(ChannelStreamWriter* writer) const
+{
+    Base::Serialize(writer);
+
+    // SPH specific
+    writer->WriteValue("targetDensity", m_targetDensity);
+    writer->WriteValue("targetSpacing", m_targetSpacing);
+    writer->WriteValue("kernelRadiusOverTargetSpacing",
+                       m_kernelRadiusOverTargetSpacing);
+    writer->WriteValue("kernelRadius", m_kernelRadius);
+    writer->WriteValue<uint64_t>("pressureIdx", m_pressureIdx);
+    writer->WriteValue<uint64_t>("densityIdx", m_densityIdx);
+}
+
+template <size_t N>
+void SPHSystemData<N>::Deserialize(const MappedChannelReader& reader)
+{
+    Base::Deserialize(reader);
+
+    // SPH specific
+    m_targetDensity = reader.Value<double>("targetDensity");
+    m_targetSpacing = reader.Value<double>("targetSpacing");
+    m_kernelRadiusOverTargetSpacing =
+        reader.Value<double>("kernelRadiusOverTargetSpacing");
+    m_kernelRadius = reader.Value<double>("kernelRadius");
+    m_pressureIdx = static_cast<size_t>(reader.Value<uint64_t>("pressureIdx"));
+    m_densityIdx = static_cast<size_t>(reader.Value<uint64_t>("densityIdx"));
+
+    if (m_pressureIdx >= Base::NumberOfScalarData() ||
+        m_densityIdx >= Base::NumberOfScalarData())
+    {
+        throw std::invalid_argument{ "Invalid particle data index." };
+    }
+}
+
 template <size_t N>
 void SPHSystemData<N>::Set(const SPHSystemData& other)
 {
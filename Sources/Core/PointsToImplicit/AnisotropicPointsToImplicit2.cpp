@@ -8,7 +8,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
-#include <Core/Math/SVD.hpp>
+#include <Core/Math/SymmetricEigen.hpp>
 #include <Core/Matrix/Matrix.hpp>
 #include <Core/Particle/SPHSystemData.hpp>
 #include <Core/PointsToImplicit/AnisotropicPointsToImplicit2.hpp>
@@ -106,6 +106,8 @@ void AnisotropicPointsToImplicit2::Convert(
     // Compute G and xMean
     std::vector<Matrix2x2D> gs(points.Length());
     Array1<Vector2D> xMeans{ points.Length() };
+    SymmetricEigenBatch2<double> covs{ points.Length() };
+    Array1<char> isAnisotropic(points.Length(), 0);
 
     ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
         const Vector2D& x = points[i];
@@ -149,30 +151,41 @@ void AnisotropicPointsToImplicit2::Convert(
 
             cov /= wSum;
 
-            // SVD
-            Matrix2x2D u;
-            Vector2D v;
-            Matrix2x2D w;
-            SVD(cov, u, v, w);
+            covs.SetMatrix(i, cov);
+            isAnisotropic[i] = 1;
+        }
+    });
+
+    // Since the covariance matrices are symmetric positive definite, their
+    // eigen-decomposition is the same as the SVD.
+    covs.Compute();
+
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
+        if (!isAnisotropic[i])
+        {
+            return;
+        }
 
-            // Take off the sign
-            v.x = std::fabs(v.x);
-            v.y = std::fabs(v.y);
+        Vector2D v = covs.EigenValues(i);
+        const Matrix2x2D w = covs.EigenVectors(i);
 
-            // Constrain Sigma
-            const double maxSingularVal = v.Max();
-            const double kr = 4.0;
-            v.x = std::max(v.x, maxSingularVal / kr);
-            v.y = std::max(v.y, maxSingularVal / kr);
+        // Take off the sign
+        v.x = std::fabs(v.x);
+        v.y = std::fabs(v.y);
 
-            const Matrix2x2D invSigma = Matrix2x2D::MakeScaleMatrix(1.0 / v);
+        // Constrain Sigma
+        const double maxSingularVal = v.Max();
+        const double kr = 4.0;
+        v.x = std::max(v.x, maxSingularVal / kr);
+        v.y = std::max(v.y, maxSingularVal / kr);
 
-            // Compute G
-            // Area preservation
-            const double scale = std::sqrt(v.x * v.y);
-            const Matrix2x2D g = invH * scale * (w * invSigma * u.Transposed());
-            gs[i] = g;
-        }
+        const Matrix2x2D invSigma = Matrix2x2D::MakeScaleMatrix(1.0 / v);
+
+        // Compute G
+        // Area preservation
+        const double scale = std::sqrt(v.x * v.y);
+        const Matrix2x2D g = invH * scale * (w * invSigma * w.Transposed());
+        gs[i] = g;
     });
 
     CUBBYFLOW_INFO << "Computed G and means.";
@@ -8,7 +8,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
-#include <Core/Math/SVD.hpp>
+#include <Core/Math/SymmetricEigen.hpp>
 #include <Core/Matrix/Matrix.hpp>
 #include <Core/Particle/SPHSystemData.hpp>
 #include <Core/PointsToImplicit/AnisotropicPointsToImplicit3.hpp>
@@ -107,6 +107,8 @@ void AnisotropicPointsToImplicit3::Convert(
     // Compute G and xMean
     std::vector<Matrix3x3D> gs(points.Length());
     Array1<Vector3D> xMeans{ points.Length() };
+    SymmetricEigenBatch3<double> covs{ points.Length() };
+    Array1<char> isAnisotropic(points.Length(), 0);
 
     ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
         const Vector3D& x = points[i];
@@ -150,32 +152,43 @@ void AnisotropicPointsToImplicit3::Convert(
 
             cov /= wSum;
 
-            // SVD
-            Matrix3x3D u;
-            Vector3D v;
-            Matrix3x3D w;
-            SVD(cov, u, v, w);
-
-            // Take off the sign
-            v.x = std::fabs(v.x);
-            v.y = std::fabs(v.y);
-            v.z = std::fabs(v.z);
-
-            // Constrain Sigma
-            const double maxSingularVal = v.Max();
-            const double kr = 4.0;
-            v.x = std::max(v.x, maxSingularVal / kr);
-            v.y = std::max(v.y, maxSingularVal / kr);
-            v.z = std::max(v.z, maxSingularVal / kr);
-
-            const Matrix3x3D invSigma = Matrix3x3D::MakeScaleMatrix(1.0 / v);
-
-            // Compute G
-            // Volume preservation
-            const double scale = std::pow(v.x * v.y * v.z, 1.0 / 3.0);
-            const Matrix3x3D g = invH * scale * (w * invSigma * u.Transposed());
-            gs[i] = g;
+            covs.SetMatrix(i, cov);
+            isAnisotropic[i] = 1;
+        }
+    });
+
+    // Since the covariance matrices are symmetric positive definite, their
+    // eigen-decomposition is the same as the SVD.
+    covs.Compute();
+
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
+        if (!isAnisotropic[i])
+        {
+            return;
         }
+
+        Vector3D v = covs.EigenValues(i);
+        const Matrix3x3D w = covs.EigenVectors(i);
+
+        // Take off the sign
+        v.x = std::fabs(v.x);
+        v.y = std::fabs(v.y);
+        v.z = std::fabs(v.z);
+
+        // Constrain Sigma
+        const double maxSingularVal = v.Max();
+        const double kr = 4.0;
+        v.x = std::max(v.x, maxSingularVal / kr);
+        v.y = std::max(v.y, maxSingularVal / kr);
+        v.z = std::max(v.z, maxSingularVal / kr);
+
+        const Matrix3x3D invSigma = Matrix3x3D::MakeScaleMatrix(1.0 / v);
+
+        // Compute G
+        // Volume preservation
+        const double scale = std::pow(v.x * v.y * v.z, 1.0 / 3.0);
+        const Matrix3x3D g = invH * scale * (w * invSigma * w.Transposed());
+        gs[i] = g;
     });
 
     CUBBYFLOW_INFO << "Computed G and means.";
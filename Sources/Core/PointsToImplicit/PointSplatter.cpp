@@ -0,0 +1,187 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/PointsToImplicit/PointSplatter.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace CubbyFlow
+{
+template <size_t N>
+PointSplatter<N>::PointSplatter(const Vector<size_t, N>& dataSize,
+                                const Vector<double, N>& dataOrigin,
+                                const Vector<double, N>& gridSpacing,
+                                double kernelRadius)
+    : m_dataSize{ dataSize },
+      m_dataOrigin{ dataOrigin },
+      m_gridSpacing{ gridSpacing },
+      m_kernelRadius{ kernelRadius }
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        m_tileResolution[i] = (m_dataSize[i] + TILE_SIZE - 1) / TILE_SIZE;
+    }
+}
+
+template <size_t N>
+void PointSplatter<N>::Build(const ConstArrayView1<Vector<double, N>>& points)
+{
+    const size_t numTiles = NumberOfTiles();
+
+    // Counting sort of the points by the tiles their kernel overlaps with
+    const auto forEachTile = [&](size_t pointIdx, const auto& func) {
+        Vector<size_t, N> begin;
+        Vector<size_t, N> end;
+        if (!GetSplatRange(points[pointIdx], &begin, &end))
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            begin[i] /= TILE_SIZE;
+            end[i] = (end[i] - 1) / TILE_SIZE + 1;
+        }
+
+        ForEachIndex(begin, end, [&](auto... indices) {
+            func(TileIndex(Vector<size_t, N>{ indices... }));
+        });
+    };
+
+    // Zero-initialized by the value-initialization of the vector
+    std::vector<std::atomic<size_t>> counters(numTiles);
+
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t p) {
+        forEachTile(p, [&](size_t tile) {
+            counters[tile].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    // The counters are reused as the write cursors of the tiles
+    m_tileOffsets.Resize(numTiles + 1);
+    for (size_t tile = 0; tile < numTiles; ++tile)
+    {
+        const size_t count = counters[tile].load(std::memory_order_relaxed);
+        counters[tile].store(m_tileOffsets[tile], std::memory_order_relaxed);
+        m_tileOffsets[tile + 1] = m_tileOffsets[tile] + count;
+    }
+
+    m_pointIndices.ResizeUninitialized(m_tileOffsets[numTiles]);
+
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t p) {
+        forEachTile(p, [&](size_t tile) {
+            m_pointIndices[counters[tile].fetch_add(
+                1, std::memory_order_relaxed)] = p;
+        });
+    });
+
+    // Restore the point order within each tile so that the accumulation
+    // order, and thus the round-off, is the same for every run.
+    ParallelFor(ZERO_SIZE, numTiles, [&](size_t tile) {
+        std::sort(m_pointIndices.data() + m_tileOffsets[tile],
+                  m_pointIndices.data() + m_tileOffsets[tile + 1]);
+    });
+}
+
+template <size_t N>
+void PointSplatter<N>::ParallelForEachTile(const TileCallback& callback) const
+{
+    ParallelFor(ZERO_SIZE, NumberOfTiles(), [&](size_t tile) {
+        Vector<size_t, N> begin;
+        size_t remainder = tile;
+        for (size_t i = 0; i < N; ++i)
+        {
+            begin[i] = (remainder % m_tileResolution[i]) * TILE_SIZE;
+            remainder /= m_tileResolution[i];
+        }
+
+        const Vector<size_t, N> end = Min(
+            begin + Vector<size_t, N>::MakeConstant(TILE_SIZE), m_dataSize);
+
+        const size_t offset = m_tileOffsets[tile];
+        const ConstArrayView1<size_t> pointIndices{
+            m_pointIndices.data() + offset,
+            Vector1UZ{ m_tileOffsets[tile + 1] - offset }
+        };
+
+        callback(begin, end, pointIndices);
+    });
+}
+
+template <size_t N>
+bool PointSplatter<N>::GetSplatRange(const Vector<double, N>& point,
+                                     Vector<size_t, N>* begin,
+                                     Vector<size_t, N>* end) const
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        const double lower = std::ceil(
+            (point[i] - m_kernelRadius - m_dataOrigin[i]) / m_gridSpacing[i]);
+        const double upper = std::floor(
+            (point[i] + m_kernelRadius - m_dataOrigin[i]) / m_gridSpacing[i]);
+
+        if (upper < 0.0 || lower >= static_cast<double>(m_dataSize[i]) ||
+            lower > upper)
+        {
+            return false;
+        }
+
+        (*begin)[i] = static_cast<size_t>(std::max(lower, 0.0));
+        (*end)[i] = std::min(static_cast<size_t>(upper) + 1, m_dataSize[i]);
+    }
+
+    return true;
+}
+
+template <size_t N>
+Vector<double, N> PointSplatter<N>::DataPosition(
+    const Vector<size_t, N>& idx) const
+{
+    return m_dataOrigin + ElemMul(m_gridSpacing, idx.template CastTo<double>());
+}
+
+template <size_t N>
+double PointSplatter<N>::KernelRadius() const
+{
+    return m_kernelRadius;
+}
+
+template <size_t N>
+size_t PointSplatter<N>::NumberOfTiles() const
+{
+    size_t numTiles = 1;
+    for (size_t i = 0; i < N; ++i)
+    {
+        numTiles *= m_tileResolution[i];
+    }
+
+    return numTiles;
+}
+
+template <size_t N>
+size_t PointSplatter<N>::TileIndex(const Vector<size_t, N>& tile) const
+{
+    size_t index = tile[N - 1];
+    for (size_t i = N - 1; i > 0; --i)
+    {
+        index = tile[i - 1] + m_tileResolution[i - 1] * index;
+    }
+
+    return index;
+}
+
+template class PointSplatter<2>;
+
+template class PointSplatter<3>;
+}  // namespace CubbyFlow
\ No newline at end of file
@@ -8,13 +8,19 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Particle/SPHKernels.hpp>
 #include <Core/Particle/SPHSystemData.hpp>
+#include <Core/PointsToImplicit/PointSplatter.hpp>
 #include <Core/PointsToImplicit/SPHPointsToImplicit2.hpp>
+#include <Core/Searcher/PointParallelHashGridSearcher.hpp>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 namespace CubbyFlow
 {
+static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
+
 SPHPointsToImplicit2::SPHPointsToImplicit2(double kernelRadius,
                                            double cutOffDensity,
                                            bool isOutputSDF)
@@ -48,18 +54,26 @@ void SPHPointsToImplicit2::Convert(const ConstArrayView1<Vector2D>& points,
         return;
     }
 
-    SPHSystemData2 sphParticles;
-    sphParticles.AddParticles(points);
-    sphParticles.SetKernelRadius(m_kernelRadius);
-    sphParticles.BuildNeighborSearcher();
-    sphParticles.UpdateDensities();
-
-    Array1<double> constData(sphParticles.NumberOfParticles(), 1.0);
     std::shared_ptr<ScalarGrid2> temp = output->Clone();
-    temp->Fill([&](const Vector2D& x) {
-        const double d = sphParticles.Interpolate(x, constData);
-        return m_cutOffDensity - d;
-    });
+
+    if (m_useSplatting)
+    {
+        Splat(points, temp.get());
+    }
+    else
+    {
+        SPHSystemData2 sphParticles;
+        sphParticles.AddParticles(points);
+        sphParticles.SetKernelRadius(m_kernelRadius);
+        sphParticles.BuildNeighborSearcher();
+        sphParticles.UpdateDensities();
+
+        Array1<double> constData(sphParticles.NumberOfParticles(), 1.0);
+        temp->Fill([&](const Vector2D& x) {
+            const double d = sphParticles.Interpolate(x, constData);
+            return m_cutOffDensity - d;
+        });
+    }
 
     if (m_isOutputSDF)
     {
@@ -71,4 +85,69 @@ void SPHPointsToImplicit2::Convert(const ConstArrayView1<Vector2D>& points,
         temp->Swap(output);
     }
 }
+
+bool SPHPointsToImplicit2::GetUseSplatting() const
+{
+    return m_useSplatting;
+}
+
+void SPHPointsToImplicit2::SetUseSplatting(bool useSplatting)
+{
+    m_useSplatting = useSplatting;
+}
+
+void SPHPointsToImplicit2::Splat(const ConstArrayView1<Vector2D>& points,
+                                 ScalarGrid2* output) const
+{
+    const SPHStdKernel2 kernel{ m_kernelRadius };
+
+    // Interpolation weight of each point, which is m / rho in SPHSystemData2
+    // where the mass cancels out.
+    PointParallelHashGridSearcher2 searcher{
+        Vector2UZ::MakeConstant(DEFAULT_HASH_GRID_RESOLUTION),
+        2.0 * m_kernelRadius
+    };
+    searcher.Build(points, m_kernelRadius);
+
+    Array1<double> weights(points.Length());
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
+        double sum = 0.0;
+        searcher.ForEachNearbyPoint(
+            points[i], m_kernelRadius, [&](size_t, const Vector2D& neighbor) {
+                sum += kernel(points[i].DistanceTo(neighbor));
+            });
+        weights[i] = 1.0 / sum;
+    });
+
+    PointSplatter2 splatter{ output->DataSize(), output->DataOrigin(),
+                             output->GridSpacing(), m_kernelRadius };
+    splatter.Build(points);
+
+    ArrayView2<double> data = output->DataView();
+    splatter.ParallelForEachTile([&](const Vector2UZ& begin,
+                                     const Vector2UZ& end,
+                                     const ConstArrayView1<size_t>& indices) {
+        // Each tile is owned by a single thread, so the densities are
+        // accumulated in place.
+        ForEachIndex(begin, end, [&](size_t i, size_t j) { data(i, j) = 0.0; });
+
+        for (const size_t p : indices)
+        {
+            Vector2UZ splatBegin;
+            Vector2UZ splatEnd;
+            splatter.GetSplatRange(points[p], &splatBegin, &splatEnd);
+            splatBegin = Max(begin, splatBegin);
+            splatEnd = Min(end, splatEnd);
+
+            ForEachIndex(splatBegin, splatEnd, [&](size_t i, size_t j) {
+                const Vector2D x = splatter.DataPosition(Vector2UZ{ i, j });
+                data(i, j) += weights[p] * kernel(x.DistanceTo(points[p]));
+            });
+        }
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j) {
+            data(i, j) = m_cutOffDensity - data(i, j);
+        });
+    });
+}
 }  // namespace CubbyFlow
@@ -8,13 +8,19 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Particle/SPHKernels.hpp>
 #include <Core/Particle/SPHSystemData.hpp>
+#include <Core/PointsToImplicit/PointSplatter.hpp>
 #include <Core/PointsToImplicit/SPHPointsToImplicit3.hpp>
+#include <Core/Searcher/PointParallelHashGridSearcher.hpp>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
 
 namespace CubbyFlow
 {
+static const size_t DEFAULT_HASH_GRID_RESOLUTION = 64;
+
 SPHPointsToImplicit3::SPHPointsToImplicit3(double kernelRadius,
                                            double cutOffDensity,
                                            bool isOutputSDF)
@@ -48,18 +54,26 @@ void SPHPointsToImplicit3::Convert(const ConstArrayView1<Vector3D>& points,
         return;
     }
 
-    SPHSystemData3 sphParticles;
-    sphParticles.AddParticles(points);
-    sphParticles.SetKernelRadius(m_kernelRadius);
-    sphParticles.BuildNeighborSearcher();
-    sphParticles.UpdateDensities();
-
-    Array1<double> constData(sphParticles.NumberOfParticles(), 1.0);
     std::shared_ptr<ScalarGrid3> temp = output->Clone();
-    temp->Fill([&](const Vector3D& x) {
-        const double d = sphParticles.Interpolate(x, constData);
-        return m_cutOffDensity - d;
-    });
+
+    if (m_useSplatting)
+    {
+        Splat(points, temp.get());
+    }
+    else
+    {
+        SPHSystemData3 sphParticles;
+        sphParticles.AddParticles(points);
+        sphParticles.SetKernelRadius(m_kernelRadius);
+        sphParticles.BuildNeighborSearcher();
+        sphParticles.UpdateDensities();
+
+        Array1<double> constData(sphParticles.NumberOfParticles(), 1.0);
+        temp->Fill([&](const Vector3D& x) {
+            const double d = sphParticles.Interpolate(x, constData);
+            return m_cutOffDensity - d;
+        });
+    }
 
     if (m_isOutputSDF)
     {
@@ -71,4 +85,74 @@ void SPHPointsToImplicit3::Convert(const ConstArrayView1<Vector3D>& points,
         temp->Swap(output);
     }
 }
+
+bool SPHPointsToImplicit3::GetUseSplatting() const
+{
+    return m_useSplatting;
+}
+
+void SPHPointsToImplicit3::SetUseSplatting(bool useSplatting)
+{
+    m_useSplatting = useSplatting;
+}
+
+void SPHPointsToImplicit3::Splat(const ConstArrayView1<Vector3D>& points,
+                                 ScalarGrid3* output) const
+{
+    const SPHStdKernel3 kernel{ m_kernelRadius };
+
+    // Interpolation weight of each point, which is m / rho in SPHSystemData3
+    // where the mass cancels out.
+    PointParallelHashGridSearcher3 searcher{
+        Vector3UZ::MakeConstant(DEFAULT_HASH_GRID_RESOLUTION),
+        2.0 * m_kernelRadius
+    };
+    searcher.Build(points, m_kernelRadius);
+
+    Array1<double> weights(points.Length());
+    ParallelFor(ZERO_SIZE, points.Length(), [&](size_t i) {
+        double sum = 0.0;
+        searcher.ForEachNearbyPoint(
+            points[i], m_kernelRadius, [&](size_t, const Vector3D& neighbor) {
+                sum += kernel(points[i].DistanceTo(neighbor));
+            });
+        weights[i] = 1.0 / sum;
+    });
+
+    PointSplatter3 splatter{ output->DataSize(), output->DataOrigin(),
+                             output->GridSpacing(), m_kernelRadius };
+    splatter.Build(points);
+
+    ArrayView3<double> data = output->DataView();
+    splatter.ParallelForEachTile([&](const Vector3UZ& begin,
+                                     const Vector3UZ& end,
+                                     const ConstArrayView1<size_t>& indices) {
+        // Each tile is owned by a single thread, so the densities are
+        // accumulated in place.
+        ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            data(i, j, k) = 0.0;
+        });
+
+        for (const size_t p : indices)
+        {
+            Vector3UZ splatBegin;
+            Vector3UZ splatEnd;
+            splatter.GetSplatRange(points[p], &splatBegin, &splatEnd);
+            splatBegin = Max(begin, splatBegin);
+            splatEnd = Min(end, splatEnd);
+
+            ForEachIndex(splatBegin, splatEnd,
+                         [&](size_t i, size_t j, size_t k) {
+                             const Vector3D x =
+                                 splatter.DataPosition(Vector3UZ{ i, j, k });
+                             data(i, j, k) +=
+                                 weights[p] * kernel(x.DistanceTo(points[p]));
+                         });
+        }
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            data(i, j, k) = m_cutOffDensity - data(i, j, k);
+        });
+    });
+}
 }  // namespace CubbyFlow
\ No newline at end of file
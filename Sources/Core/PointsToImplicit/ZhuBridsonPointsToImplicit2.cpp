@@ -9,10 +9,13 @@
 // property of any third parties.
 
 #include <Core/Particle/ParticleSystemData.hpp>
+#include <Core/PointsToImplicit/PointSplatter.hpp>
 #include <Core/PointsToImplicit/ZhuBridsonPointsToImplicit2.hpp>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver2.hpp>
 #include <Core/Utils/Logging.hpp>
 
+#include <array>
+
 namespace CubbyFlow
 {
 inline double k(double s)
@@ -53,35 +56,43 @@ void ZhuBridsonPointsToImplicit2::Convert(
         return;
     }
 
-    ParticleSystemData2 particles;
-    particles.AddParticles(points);
-    particles.BuildNeighborSearcher(m_kernelRadius);
+    auto temp = output->Clone();
 
-    const auto neighborSearcher = particles.NeighborSearcher();
-    const double isoContValue = m_cutOffThreshold * m_kernelRadius;
+    if (m_useSplatting)
+    {
+        Splat(points, temp.get());
+    }
+    else
+    {
+        ParticleSystemData2 particles;
+        particles.AddParticles(points);
+        particles.BuildNeighborSearcher(m_kernelRadius);
 
-    auto temp = output->Clone();
-    temp->Fill([&](const Vector2D& x) -> double {
-        Vector2D xAvg;
-        double wSum = 0.0;
-        const auto func = [&](size_t, const Vector2D& xi) {
-            const double wi = k((x - xi).Length() / m_kernelRadius);
-
-            wSum += wi;
-            xAvg += wi * xi;
-        };
-        neighborSearcher->ForEachNearbyPoint(x, m_kernelRadius, func);
+        const auto neighborSearcher = particles.NeighborSearcher();
+        const double isoContValue = m_cutOffThreshold * m_kernelRadius;
 
-        if (wSum > 0.0)
-        {
-            xAvg /= wSum;
-            return (x - xAvg).Length() - isoContValue;
-        }
-        else
-        {
-            return output->GetBoundingBox().DiagonalLength();
-        }
-    });
+        temp->Fill([&](const Vector2D& x) -> double {
+            Vector2D xAvg;
+            double wSum = 0.0;
+            const auto func = [&](size_t, const Vector2D& xi) {
+                const double wi = k((x - xi).Length() / m_kernelRadius);
+
+                wSum += wi;
+                xAvg += wi * xi;
+            };
+            neighborSearcher->ForEachNearbyPoint(x, m_kernelRadius, func);
+
+            if (wSum > 0.0)
+            {
+                xAvg /= wSum;
+                return (x - xAvg).Length() - isoContValue;
+            }
+            else
+            {
+                return output->GetBoundingBox().DiagonalLength();
+            }
+        });
+    }
 
     if (m_isOutputSDF)
     {
@@ -93,4 +104,79 @@ void ZhuBridsonPointsToImplicit2::Convert(
         temp->Swap(output);
     }
 }
+
+bool ZhuBridsonPointsToImplicit2::GetUseSplatting() const
+{
+    return m_useSplatting;
+}
+
+void ZhuBridsonPointsToImplicit2::SetUseSplatting(bool useSplatting)
+{
+    m_useSplatting = useSplatting;
+}
+
+void ZhuBridsonPointsToImplicit2::Splat(
+    const ConstArrayView1<Vector2D>& points, ScalarGrid2* output) const
+{
+    constexpr size_t tileLength =
+        PointSplatter2::TILE_SIZE * PointSplatter2::TILE_SIZE;
+
+    const double isoContValue = m_cutOffThreshold * m_kernelRadius;
+    const double farValue = output->GetBoundingBox().DiagonalLength();
+
+    PointSplatter2 splatter{ output->DataSize(), output->DataOrigin(),
+                             output->GridSpacing(), m_kernelRadius };
+    splatter.Build(points);
+
+    ArrayView2<double> data = output->DataView();
+    splatter.ParallelForEachTile([&](const Vector2UZ& begin,
+                                     const Vector2UZ& end,
+                                     const ConstArrayView1<size_t>& indices) {
+        if (indices.Length() == 0)
+        {
+            ForEachIndex(begin, end,
+                         [&](size_t i, size_t j) { data(i, j) = farValue; });
+            return;
+        }
+
+        // Tile-local accumulators for the weights and the weighted positions
+        std::array<double, tileLength> wSums{};
+        std::array<Vector2D, tileLength> xSums{};
+        const auto localIndex = [&](size_t i, size_t j) {
+            return (i - begin.x) + PointSplatter2::TILE_SIZE * (j - begin.y);
+        };
+
+        for (const size_t p : indices)
+        {
+            Vector2UZ splatBegin;
+            Vector2UZ splatEnd;
+            splatter.GetSplatRange(points[p], &splatBegin, &splatEnd);
+            splatBegin = Max(begin, splatBegin);
+            splatEnd = Min(end, splatEnd);
+
+            const Vector2D& xi = points[p];
+            ForEachIndex(splatBegin, splatEnd, [&](size_t i, size_t j) {
+                const Vector2D x = splatter.DataPosition(Vector2UZ{ i, j });
+                const double wi = k((x - xi).Length() / m_kernelRadius);
+                const size_t idx = localIndex(i, j);
+                wSums[idx] += wi;
+                xSums[idx] += wi * xi;
+            });
+        }
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j) {
+            const size_t idx = localIndex(i, j);
+            if (wSums[idx] > 0.0)
+            {
+                const Vector2D x = splatter.DataPosition(Vector2UZ{ i, j });
+                data(i, j) =
+                    (x - xSums[idx] / wSums[idx]).Length() - isoContValue;
+            }
+            else
+            {
+                data(i, j) = farValue;
+            }
+        });
+    });
+}
 }  // namespace CubbyFlow
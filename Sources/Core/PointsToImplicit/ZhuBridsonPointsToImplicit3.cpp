@@ -9,10 +9,13 @@
 // property of any third parties.
 
 #include <Core/Particle/ParticleSystemData.hpp>
+#include <Core/PointsToImplicit/PointSplatter.hpp>
 #include <Core/PointsToImplicit/ZhuBridsonPointsToImplicit3.hpp>
 #include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
 
+#include <array>
+
 namespace CubbyFlow
 {
 inline double k(double s)
@@ -53,35 +56,43 @@ void ZhuBridsonPointsToImplicit3::Convert(
         return;
     }
 
-    ParticleSystemData3 particles;
-    particles.AddParticles(points);
-    particles.BuildNeighborSearcher(m_kernelRadius);
+    auto temp = output->Clone();
 
-    const PointNeighborSearcher3Ptr neighborSearcher =
-        particles.NeighborSearcher();
-    const double isoContValue = m_cutOffThreshold * m_kernelRadius;
+    if (m_useSplatting)
+    {
+        Splat(points, temp.get());
+    }
+    else
+    {
+        ParticleSystemData3 particles;
+        particles.AddParticles(points);
+        particles.BuildNeighborSearcher(m_kernelRadius);
 
-    auto temp = output->Clone();
-    temp->Fill([&](const Vector3D& x) -> double {
-        Vector3D xAvg;
-        double wSum = 0.0;
-        const auto func = [&](size_t, const Vector3D& xi) {
-            const double wi = k((x - xi).Length() / m_kernelRadius);
-            wSum += wi;
-            xAvg += wi * xi;
-        };
-        neighborSearcher->ForEachNearbyPoint(x, m_kernelRadius, func);
+        const PointNeighborSearcher3Ptr neighborSearcher =
+            particles.NeighborSearcher();
+        const double isoContValue = m_cutOffThreshold * m_kernelRadius;
 
-        if (wSum > 0.0)
-        {
-            xAvg /= wSum;
-            return (x - xAvg).Length() - isoContValue;
-        }
-        else
-        {
-            return output->GetBoundingBox().DiagonalLength();
-        }
-    });
+        temp->Fill([&](const Vector3D& x) -> double {
+            Vector3D xAvg;
+            double wSum = 0.0;
+            const auto func = [&](size_t, const Vector3D& xi) {
+                const double wi = k((x - xi).Length() / m_kernelRadius);
+                wSum += wi;
+                xAvg += wi * xi;
+            };
+            neighborSearcher->ForEachNearbyPoint(x, m_kernelRadius, func);
+
+            if (wSum > 0.0)
+            {
+                xAvg /= wSum;
+                return (x - xAvg).Length() - isoContValue;
+            }
+            else
+            {
+                return output->GetBoundingBox().DiagonalLength();
+            }
+        });
+    }
 
     if (m_isOutputSDF)
     {
@@ -93,4 +104,87 @@ void ZhuBridsonPointsToImplicit3::Convert(
         temp->Swap(output);
     }
 }
+
+bool ZhuBridsonPointsToImplicit3::GetUseSplatting() const
+{
+    return m_useSplatting;
+}
+
+void ZhuBridsonPointsToImplicit3::SetUseSplatting(bool useSplatting)
+{
+    m_useSplatting = useSplatting;
+}
+
+void ZhuBridsonPointsToImplicit3::Splat(
+    const ConstArrayView1<Vector3D>& points, ScalarGrid3* output) const
+{
+    constexpr size_t tileLength = PointSplatter3::TILE_SIZE *
+                                  PointSplatter3::TILE_SIZE *
+                                  PointSplatter3::TILE_SIZE;
+
+    const double isoContValue = m_cutOffThreshold * m_kernelRadius;
+    const double farValue = output->GetBoundingBox().DiagonalLength();
+
+    PointSplatter3 splatter{ output->DataSize(), output->DataOrigin(),
+                             output->GridSpacing(), m_kernelRadius };
+    splatter.Build(points);
+
+    ArrayView3<double> data = output->DataView();
+    splatter.ParallelForEachTile([&](const Vector3UZ& begin,
+                                     const Vector3UZ& end,
+                                     const ConstArrayView1<size_t>& indices) {
+        if (indices.Length() == 0)
+        {
+            ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+                data(i, j, k) = farValue;
+            });
+            return;
+        }
+
+        // Tile-local accumulators for the weights and the weighted positions
+        std::array<double, tileLength> wSums{};
+        std::array<Vector3D, tileLength> xSums{};
+        const auto localIndex = [&](size_t i, size_t j, size_t k) {
+            constexpr size_t n = PointSplatter3::TILE_SIZE;
+            return (i - begin.x) + n * ((j - begin.y) + n * (k - begin.z));
+        };
+
+        for (const size_t p : indices)
+        {
+            Vector3UZ splatBegin;
+            Vector3UZ splatEnd;
+            splatter.GetSplatRange(points[p], &splatBegin, &splatEnd);
+            splatBegin = Max(begin, splatBegin);
+            splatEnd = Min(end, splatEnd);
+
+            const Vector3D& xi = points[p];
+            const auto weight = [&](const Vector3D& x) {
+                return k((x - xi).Length() / m_kernelRadius);
+            };
+
+            ForEachIndex(splatBegin, splatEnd,
+                         [&](size_t i, size_t j, size_t k) {
+                             const double wi = weight(
+                                 splatter.DataPosition(Vector3UZ{ i, j, k }));
+                             const size_t idx = localIndex(i, j, k);
+                             wSums[idx] += wi;
+                             xSums[idx] += wi * xi;
+                         });
+        }
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            const size_t idx = localIndex(i, j, k);
+            if (wSums[idx] > 0.0)
+            {
+                const Vector3D x = splatter.DataPosition(Vector3UZ{ i, j, k });
+                data(i, j, k) =
+                    (x - xSums[idx] / wSums[idx]).Length() - isoContValue;
+            }
+            else
+            {
+                data(i, j, k) = farValue;
+            }
+        });
+    });
+}
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -74,6 +74,22 @@ bool PointKdTreeSearcher<N>::HasNearbyPoint(const Vector<double, N>& origin,
     return m_tree.HasNearbyPoint(origin, radius);
 }
 
+template <size_t N>
+void PointKdTreeSearcher<N>::GetKNearestPoints(const Vector<double, N>& origin,
+                                               size_t k,
+                                               Array1<size_t>* indices) const
+{
+    m_tree.GetKNearestPoints(origin, k, indices);
+}
+
+template <size_t N>
+void PointKdTreeSearcher<N>::GetKNearestPoints(
+    const ConstArrayView1<Vector<double, N>>& origins, size_t k,
+    Array2<size_t>* indices) const
+{
+    m_tree.GetKNearestPoints(origins, k, indices);
+}
+
 template <size_t N>
 std::shared_ptr<PointNeighborSearcher<N>> PointKdTreeSearcher<N>::Clone() const
 {
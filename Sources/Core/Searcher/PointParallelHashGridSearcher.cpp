@@ -95,29 +95,24 @@ template <size_t N>
 void PointParallelHashGridSearcher<N>::Build(
     const ConstArrayView1<Vector<double, N>>& points)
 {
-    m_points.Clear();
-    m_keys.Clear();
-    m_startIndexTable.Clear();
-    m_endIndexTable.Clear();
-    m_sortedIndices.Clear();
-
-    // Allocate memory chunks
+    // Allocate memory chunks. Every element is overwritten below, so the
+    // storage of the previous build is reused as is.
     size_t numberOfPoints = points.Length();
-    Array1<size_t> tempKeys(numberOfPoints);
     const auto tableSize =
         static_cast<size_t>(Product(m_resolution, static_cast<ssize_t>(1)));
 
-    m_startIndexTable.Resize(tableSize);
-    m_endIndexTable.Resize(tableSize);
+    m_startIndexTable.ResizeUninitialized(tableSize);
+    m_endIndexTable.ResizeUninitialized(tableSize);
 
     ParallelFill(m_startIndexTable.begin(), m_startIndexTable.end(),
                  std::numeric_limits<size_t>::max());
     ParallelFill(m_endIndexTable.begin(), m_endIndexTable.end(),
                  std::numeric_limits<size_t>::max());
 
-    m_keys.Resize(numberOfPoints);
-    m_sortedIndices.Resize(numberOfPoints);
-    m_points.Resize(numberOfPoints);
+    m_keys.ResizeUninitialized(numberOfPoints);
+    m_sortedIndices.ResizeUninitialized(numberOfPoints);
+    m_points.ResizeUninitialized(numberOfPoints);
+    m_tempKeys.ResizeUninitialized(numberOfPoints);
 
     if (numberOfPoints == 0)
     {
@@ -128,20 +123,20 @@ void PointParallelHashGridSearcher<N>::Build(
     ParallelFor(static_cast<size_t>(0), numberOfPoints, [&](size_t i) {
         m_sortedIndices[i] = i;
         m_points[i] = points[i];
-        tempKeys[i] = PointHashGridUtils<N>::GetHashKeyFromPosition(
+        m_tempKeys[i] = PointHashGridUtils<N>::GetHashKeyFromPosition(
             points[i], m_gridSpacing, m_resolution);
     });
 
     // Sort indices based on hash key
     ParallelSort(m_sortedIndices.begin(), m_sortedIndices.end(),
-                 [&tempKeys](size_t indexA, size_t indexB) {
-                     return tempKeys[indexA] < tempKeys[indexB];
+                 [this](size_t indexA, size_t indexB) {
+                     return m_tempKeys[indexA] < m_tempKeys[indexB];
                  });
 
     // Re-order point and key arrays
     ParallelFor(static_cast<size_t>(0), numberOfPoints, [&](size_t i) {
         m_points[i] = points[m_sortedIndices[i]];
-        m_keys[i] = tempKeys[m_sortedIndices[i]];
+        m_keys[i] = m_tempKeys[m_sortedIndices[i]];
     });
 
     // Now m_points and m_keys are sorted by points' hash key values.
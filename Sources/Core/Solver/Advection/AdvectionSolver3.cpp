@@ -35,4 +35,17 @@ void AdvectionSolver3::Advect(const FaceCenteredGrid3& input,
     UNUSED_VARIABLE(output);
     UNUSED_VARIABLE(boundarySDF);
 }
+
+void AdvectionSolver3::AdvectTiles(const ScalarGrid3& input,
+                                   const VectorField3& flow, double dt,
+                                   const ConstArrayView1<Vector3UZ>& tiles,
+                                   const Vector3UZ& tileSize,
+                                   ScalarGrid3* output,
+                                   const ScalarField3& boundarySDF)
+{
+    UNUSED_VARIABLE(tiles);
+    UNUSED_VARIABLE(tileSize);
+
+    Advect(input, flow, dt, output, boundarySDF);
+}
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Advection/SemiLagrangian3.hpp>
+#include <Core/Utils/TaskGraph.hpp>
 
 namespace CubbyFlow
 {
@@ -66,43 +67,86 @@ void SemiLagrangian3::Advect(const FaceCenteredGrid3& input,
         GetVectorSamplerFunc(input);
     double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
 
-    auto uSourceDataPos = input.UPosition();
-    auto uTargetDataPos = output->UPosition();
-    ArrayView<double, 3> uTargetDataAcc = output->UView();
-
-    output->ParallelForEachUIndex([&](const Vector3UZ& idx) {
-        if (boundarySDF.Sample(uSourceDataPos(idx)) > 0.0)
-        {
-            const Vector3D pt =
-                BackTrace(flow, dt, h, uTargetDataPos(idx), boundarySDF);
-            uTargetDataAcc(idx) = inputSamplerFunc(pt).x;
-        }
+    // The components are independent, so they are advected concurrently.
+    TaskGraph graph;
+
+    graph.AddTask([&]() {
+        auto uSourceDataPos = input.UPosition();
+        auto uTargetDataPos = output->UPosition();
+        ArrayView<double, 3> uTargetDataAcc = output->UView();
+
+        output->ParallelForEachUIndex([&](const Vector3UZ& idx) {
+            if (boundarySDF.Sample(uSourceDataPos(idx)) > 0.0)
+            {
+                const Vector3D pt =
+                    BackTrace(flow, dt, h, uTargetDataPos(idx), boundarySDF);
+                uTargetDataAcc(idx) = inputSamplerFunc(pt).x;
+            }
+        });
     });
 
-    auto vSourceDataPos = input.VPosition();
-    auto vTargetDataPos = output->VPosition();
-    ArrayView<double, 3> vTargetDataAcc = output->VView();
+    graph.AddTask([&]() {
+        auto vSourceDataPos = input.VPosition();
+        auto vTargetDataPos = output->VPosition();
+        ArrayView<double, 3> vTargetDataAcc = output->VView();
+
+        output->ParallelForEachVIndex([&](const Vector3UZ& idx) {
+            if (boundarySDF.Sample(vSourceDataPos(idx)) > 0.0)
+            {
+                const Vector3D pt =
+                    BackTrace(flow, dt, h, vTargetDataPos(idx), boundarySDF);
+                vTargetDataAcc(idx) = inputSamplerFunc(pt).y;
+            }
+        });
+    });
 
-    output->ParallelForEachVIndex([&](const Vector3UZ& idx) {
-        if (boundarySDF.Sample(vSourceDataPos(idx)) > 0.0)
-        {
-            const Vector3D pt =
-                BackTrace(flow, dt, h, vTargetDataPos(idx), boundarySDF);
-            vTargetDataAcc(idx) = inputSamplerFunc(pt).y;
-        }
+    graph.AddTask([&]() {
+        auto wSourceDataPos = input.WPosition();
+        auto wTargetDataPos = output->WPosition();
+        ArrayView<double, 3> wTargetDataAcc = output->WView();
+
+        output->ParallelForEachWIndex([&](const Vector3UZ& idx) {
+            if (boundarySDF.Sample(wSourceDataPos(idx)) > 0.0)
+            {
+                const Vector3D pt =
+                    BackTrace(flow, dt, h, wTargetDataPos(idx), boundarySDF);
+                wTargetDataAcc(idx) = inputSamplerFunc(pt).z;
+            }
+        });
     });
 
-    auto wSourceDataPos = input.WPosition();
-    auto wTargetDataPos = output->WPosition();
-    ArrayView<double, 3> wTargetDataAcc = output->WView();
+    graph.Run();
+}
 
-    output->ParallelForEachWIndex([&](const Vector3UZ& idx) {
-        if (boundarySDF.Sample(wSourceDataPos(idx)) > 0.0)
-        {
-            const Vector3D pt =
-                BackTrace(flow, dt, h, wTargetDataPos(idx), boundarySDF);
-            wTargetDataAcc(idx) = inputSamplerFunc(pt).z;
-        }
+void SemiLagrangian3::AdvectTiles(const ScalarGrid3& input,
+                                  const VectorField3& flow, double dt,
+                                  const ConstArrayView1<Vector3UZ>& tiles,
+                                  const Vector3UZ& tileSize,
+                                  ScalarGrid3* output,
+                                  const ScalarField3& boundarySDF)
+{
+    std::function<double(const Vector3D&)> inputSamplerFunc =
+        GetScalarSamplerFunc(input);
+    double h = std::min(output->GridSpacing().x, output->GridSpacing().y);
+
+    GridDataPositionFunc<3> inputDataPos = input.DataPosition();
+    GridDataPositionFunc<3> outputDataPos = output->DataPosition();
+    ArrayView<double, 3> outputDataAcc = output->DataView();
+    const Vector3UZ size = outputDataAcc.Size();
+
+    ParallelFor(ZERO_SIZE, tiles.Length(), [&](size_t n) {
+        const Vector3UZ& begin = tiles[n];
+        const Vector3UZ end = Min(begin + tileSize, size);
+
+        ForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            if (boundarySDF.Sample(inputDataPos(i, j, k)) > 0.0)
+            {
+                const Vector3D pt = BackTrace(flow, dt, h,
+                                              outputDataPos(i, j, k),
+                                              boundarySDF);
+                outputDataAcc(i, j, k) = inputSamplerFunc(pt);
+            }
+        });
     });
 }
 
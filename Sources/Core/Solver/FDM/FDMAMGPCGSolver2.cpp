@@ -0,0 +1,196 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Math/CG.hpp>
+#include <Core/Solver/FDM/FDMAMGPCGSolver2.hpp>
+#include <Core/Utils/Logging.hpp>
+
+namespace CubbyFlow
+{
+void FDMAMGPCGSolver2::Preconditioner::Build(const MatrixCSRD& matrix,
+                                             const AMGParameters& params)
+{
+    hierarchy.Build(matrix, params);
+}
+
+void FDMAMGPCGSolver2::Preconditioner::Solve(const VectorND& b, VectorND* x)
+{
+    hierarchy.VCycle(b, x);
+}
+
+FDMAMGPCGSolver2::FDMAMGPCGSolver2(unsigned int maxNumberOfIterations,
+                                   double tolerance,
+                                   const AMGParameters& params)
+    : m_maxNumberOfIterations{ maxNumberOfIterations },
+      m_lastNumberOfIterations{ 0 },
+      m_tolerance{ tolerance },
+      m_lastResidualNorm{ std::numeric_limits<double>::max() },
+      m_params{ params }
+{
+    // Do nothing
+}
+
+bool FDMAMGPCGSolver2::Solve(FDMLinearSystem2* system)
+{
+    assert(system->A.Size() == system->b.Size());
+    assert(system->A.Size() == system->x.Size());
+
+    Compress(*system);
+
+    const bool result = SolveCompressed(&m_compSystem);
+
+    ParallelForEachIndex(system->x.Length(), [&](size_t i) {
+        system->x[i] = m_compSystem.x[i];
+    });
+
+    return result;
+}
+
+bool FDMAMGPCGSolver2::SolveCompressed(FDMCompressedLinearSystem2* system)
+{
+    MatrixCSRD& matrix = system->A;
+    VectorND& solution = system->x;
+    VectorND& rhs = system->b;
+
+    const size_t size = solution.GetRows();
+    m_r.Resize(size);
+    m_d.Resize(size);
+    m_q.Resize(size);
+    m_s.Resize(size);
+
+    system->x.Fill(0.0);
+    m_r.Fill(0.0);
+    m_d.Fill(0.0);
+    m_q.Fill(0.0);
+    m_s.Fill(0.0);
+
+    m_precond.Build(matrix, m_params);
+
+    PCG<FDMCompressedBLAS2, Preconditioner>(
+        matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precond,
+        &solution, &m_r, &m_d, &m_q, &m_s, &m_lastNumberOfIterations,
+        &m_lastResidualNorm);
+
+    CUBBYFLOW_INFO << "Residual after solving AMGPCG: " << m_lastResidualNorm
+                   << " Number of AMGPCG iterations: "
+                   << m_lastNumberOfIterations << " Number of AMG levels: "
+                   << m_precond.hierarchy.GetNumberOfLevels();
+
+    return (m_lastResidualNorm <= m_tolerance) ||
+           (m_lastNumberOfIterations < m_maxNumberOfIterations);
+}
+
+unsigned int FDMAMGPCGSolver2::GetMaxNumberOfIterations() const
+{
+    return m_maxNumberOfIterations;
+}
+
+unsigned int FDMAMGPCGSolver2::GetLastNumberOfIterations() const
+{
+    return m_lastNumberOfIterations;
+}
+
+double FDMAMGPCGSolver2::GetTolerance() const
+{
+    return m_tolerance;
+}
+
+double FDMAMGPCGSolver2::GetLastResidual() const
+{
+    return m_lastResidualNorm;
+}
+
+const AMGParameters& FDMAMGPCGSolver2::GetParams() const
+{
+    return m_params;
+}
+
+size_t FDMAMGPCGSolver2::GetNumberOfLevels() const
+{
+    return m_precond.hierarchy.GetNumberOfLevels();
+}
+
+bool FDMAMGPCGSolver2::IsLastHierarchyReused() const
+{
+    return m_precond.hierarchy.IsLastBuildReused();
+}
+
+void FDMAMGPCGSolver2::Compress(const FDMLinearSystem2& system)
+{
+    const FDMMatrix2& a = system.A;
+    const Vector2UZ size = a.Size();
+    const size_t numRows = a.Length();
+    const size_t strideY = size.x;
+
+    // Row index of the compressed system equals to the linear index of the
+    // grid point, so the column indices are visited in ascending order.
+    const auto forEachEntry = [&](size_t i, size_t j, const auto& func) {
+        const size_t row = i + strideY * j;
+
+        if (j > 0 && a(i, j - 1).up != 0.0)
+        {
+            func(row - strideY, a(i, j - 1).up);
+        }
+        if (i > 0 && a(i - 1, j).right != 0.0)
+        {
+            func(row - 1, a(i - 1, j).right);
+        }
+
+        func(row, a(i, j).center);
+
+        if (i + 1 < size.x && a(i, j).right != 0.0)
+        {
+            func(row + 1, a(i, j).right);
+        }
+        if (j + 1 < size.y && a(i, j).up != 0.0)
+        {
+            func(row + strideY, a(i, j).up);
+        }
+    };
+
+    std::vector<size_t> rowPointers(numRows + 1, 0);
+
+    ParallelForEachIndex(size, [&](size_t i, size_t j) {
+        size_t count = 0;
+        forEachEntry(i, j, [&](size_t, double) { ++count; });
+        rowPointers[i + strideY * j + 1] = count;
+    });
+
+    for (size_t row = 0; row < numRows; ++row)
+    {
+        rowPointers[row + 1] += rowPointers[row];
+    }
+
+    MatrixCSRD& compA = m_compSystem.A;
+    compA.Reserve(numRows, numRows, rowPointers[numRows]);
+
+    std::copy(rowPointers.begin(), rowPointers.end(), compA.RowPointersBegin());
+
+    auto ci = compA.ColumnIndicesBegin();
+    auto nnz = compA.NonZeroBegin();
+
+    ParallelForEachIndex(size, [&](size_t i, size_t j) {
+        size_t dst = rowPointers[i + strideY * j];
+
+        forEachEntry(i, j, [&](size_t col, double value) {
+            ci[dst] = col;
+            nnz[dst] = value;
+            ++dst;
+        });
+    });
+
+    m_compSystem.x.Resize(numRows, 0.0);
+    m_compSystem.b.Resize(numRows, 0.0);
+
+    ParallelForEachIndex(numRows, [&](size_t row) {
+        m_compSystem.b[row] = system.b[row];
+    });
+}
+}  // namespace CubbyFlow
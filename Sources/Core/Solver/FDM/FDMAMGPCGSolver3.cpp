@@ -0,0 +1,186 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Math/CG.hpp>
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.hpp>
+#include <Core/Utils/Logging.hpp>
+
+namespace CubbyFlow
+{
+void FDMAMGPCGSolver3::Preconditioner::Build(const MatrixCSRD& matrix,
+                                             const AMGParameters& params)
+{
+    A = &matrix;
+    hierarchy.Build(matrix, params);
+}
+
+bool FDMAMGPCGSolver3::Preconditioner::IsBuiltFor(
+    const MatrixCSRD& matrix) const
+{
+    return hierarchy.GetNumberOfLevels() > 0 &&
+           hierarchy.GetNumberOfRows(0) == matrix.GetRows() &&
+           A == &matrix;
+}
+
+void FDMAMGPCGSolver3::Preconditioner::Solve(const VectorND& b, VectorND* x)
+{
+    hierarchy.VCycle(b, x);
+}
+
+FDMAMGPCGSolver3::FDMAMGPCGSolver3(unsigned int maxNumberOfIterations,
+                                   double tolerance,
+                                   const AMGParameters& params)
+    : m_maxNumberOfIterations{ maxNumberOfIterations },
+      m_lastNumberOfIterations{ 0 },
+      m_tolerance{ tolerance },
+      m_lastResidualNorm{ std::numeric_limits<double>::max() },
+      m_params{ params }
+{
+    // Do nothing
+}
+
+bool FDMAMGPCGSolver3::Solve(FDMLinearSystem3* system)
+{
+    assert(system->A.Size() == system->b.Size());
+    assert(system->A.Size() == system->x.Size());
+
+    Compress(*system);
+
+    const bool result = SolveCompressed(&m_compSystem);
+
+    ParallelForEachIndex(system->x.Length(), [&](size_t i) {
+        system->x[i] = m_compSystem.x[i];
+    });
+
+    return result;
+}
+
+bool FDMAMGPCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
+{
+    MatrixCSRD& matrix = system->A;
+    VectorND& solution = system->x;
+    VectorND& rhs = system->b;
+
+    const size_t size = solution.GetRows();
+    m_r.Resize(size);
+    m_d.Resize(size);
+    m_q.Resize(size);
+    m_s.Resize(size);
+
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
+    m_r.Fill(0.0);
+    m_d.Fill(0.0);
+    m_q.Fill(0.0);
+    m_s.Fill(0.0);
+
+    if (!GetReusePreconditioner() || !m_precond.IsBuiltFor(matrix))
+    {
+        m_precond.Build(matrix, m_params);
+    }
+
+    if (GetUseSlicedEllpack())
+    {
+        PCG<FDMCompressedSELLBLAS3, Preconditioner>(
+            GetSlicedEllpackMatrix(matrix), rhs, m_maxNumberOfIterations,
+            m_tolerance, &m_precond, &solution, &m_r, &m_d, &m_q, &m_s,
+            &m_lastNumberOfIterations, &m_lastResidualNorm);
+    }
+    else
+    {
+        PCG<FDMCompressedBLAS3, Preconditioner>(
+            matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precond,
+            &solution, &m_r, &m_d, &m_q, &m_s, &m_lastNumberOfIterations,
+            &m_lastResidualNorm);
+    }
+
+    CUBBYFLOW_INFO << "Residual after solving AMGPCG: " << m_lastResidualNorm
+                   << " Number of AMGPCG iterations: "
+                   << m_lastNumberOfIterations << " Number of AMG levels: "
+                   << m_precond.hierarchy.GetNumberOfLevels();
+
+    return (m_lastResidualNorm <= m_tolerance) ||
+           (m_lastNumberOfIterations < m_maxNumberOfIterations);
+}
+
+unsigned int FDMAMGPCGSolver3::GetMaxNumberOfIterations() const
+{
+    return m_maxNumberOfIterations;
+}
+
+unsigned int FDMAMGPCGSolver3::GetLastNumberOfIterations() const
+{
+    return m_lastNumberOfIterations;
+}
+
+double FDMAMGPCGSolver3::GetTolerance() const
+{
+    return m_tolerance;
+}
+
+double FDMAMGPCGSolver3::GetLastResidual() const
+{
+    return m_lastResidualNorm;
+}
+
+const AMGParameters& FDMAMGPCGSolver3::GetParams() const
+{
+    return m_params;
+}
+
+size_t FDMAMGPCGSolver3::GetNumberOfLevels() const
+{
+    return m_precond.hierarchy.GetNumberOfLevels();
+}
+
+bool FDMAMGPCGSolver3::IsLastHierarchyReused() const
+{
+    return m_precond.hierarchy.IsLastBuildReused();
+}
+
+void FDMAMGPCGSolver3::Compress(const FDMLinearSystem3& system)
+{
+    const FDMMatrix3& a = system.A;
+
+    // Every grid point is a row, so the row index of the compressed system
+    // equals to the linear index of the grid point.
+    m_compSystemBuilder.Build(
+        a.Size(), [](size_t, size_t, size_t) { return true; },
+        [&](size_t i, size_t j, size_t k, FDMStencil3& row) {
+            row.center = a(i, j, k).center;
+            row.right = a(i, j, k).right;
+            row.up = a(i, j, k).up;
+            row.front = a(i, j, k).front;
+
+            if (i > 0)
+            {
+                row.left = a(i - 1, j, k).right;
+            }
+            if (j > 0)
+            {
+                row.down = a(i, j - 1, k).up;
+            }
+            if (k > 0)
+            {
+                row.back = a(i, j, k - 1).front;
+            }
+
+            return system.b(i, j, k);
+        },
+        &m_compSystem);
+
+    ParallelForEachIndex(a.Length(), [&](size_t row) {
+        m_compSystem.x[row] = system.x[row];
+    });
+}
+}  // namespace CubbyFlow
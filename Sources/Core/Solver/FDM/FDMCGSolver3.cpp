@@ -39,7 +39,11 @@ bool FDMCGSolver3::Solve(FDMLinearSystem3* system)
     m_q.Resize(size);
     m_s.Resize(size);
 
-    system->x.Fill(0.0);
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
     m_r.Fill(0.0);
     m_d.Fill(0.0);
     m_q.Fill(0.0);
@@ -67,14 +71,64 @@ bool FDMCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
     m_qComp.Resize(size);
     m_sComp.Resize(size);
 
-    system->x.Fill(0.0);
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
     m_rComp.Fill(0.0);
     m_dComp.Fill(0.0);
     m_qComp.Fill(0.0);
     m_sComp.Fill(0.0);
 
-    CG<FDMCompressedBLAS3>(matrix, rhs, m_maxNumberOfIterations, m_tolerance,
-                           &solution, &m_rComp, &m_dComp, &m_qComp, &m_sComp,
+    if (GetUseSlicedEllpack())
+    {
+        CG<FDMCompressedSELLBLAS3>(
+            GetSlicedEllpackMatrix(matrix), rhs, m_maxNumberOfIterations,
+            m_tolerance, &solution, &m_rComp, &m_dComp, &m_qComp, &m_sComp,
+            &m_lastNumberOfIterations, &m_lastResidual);
+    }
+    else
+    {
+        CG<FDMCompressedBLAS3>(matrix, rhs, m_maxNumberOfIterations,
+                               m_tolerance, &solution, &m_rComp, &m_dComp,
+                               &m_qComp, &m_sComp, &m_lastNumberOfIterations,
+                               &m_lastResidual);
+    }
+
+    return (m_lastResidual <= m_tolerance) ||
+           (m_lastNumberOfIterations < m_maxNumberOfIterations);
+}
+
+bool FDMCGSolver3::SolveMatrixFree(FDMMatrixFreeLinearSystem3* system)
+{
+    FDMMarkerMatrix3& matrix = system->A;
+    FDMVector3& solution = system->x;
+    FDMVector3& rhs = system->b;
+
+    assert(matrix.Size() == rhs.Size());
+    assert(matrix.Size() == solution.Size());
+
+    ClearCompressedVectors();
+
+    const Vector3UZ& size = matrix.Size();
+    m_r.Resize(size);
+    m_d.Resize(size);
+    m_q.Resize(size);
+    m_s.Resize(size);
+
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
+    m_r.Fill(0.0);
+    m_d.Fill(0.0);
+    m_q.Fill(0.0);
+    m_s.Fill(0.0);
+
+    CG<FDMMatrixFreeBLAS3>(matrix, rhs, m_maxNumberOfIterations, m_tolerance,
+                           &solution, &m_r, &m_d, &m_q, &m_s,
                            &m_lastNumberOfIterations, &m_lastResidual);
 
     return (m_lastResidual <= m_tolerance) ||
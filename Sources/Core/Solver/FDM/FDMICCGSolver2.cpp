@@ -266,9 +266,9 @@ void FDMICCGSolver2::ClearUncompressedVectors()
 
 void FDMICCGSolver2::ClearCompressedVectors()
 {
-    m_r.Clear();
-    m_d.Clear();
-    m_q.Clear();
-    m_s.Clear();
+    m_rComp.Clear();
+    m_dComp.Clear();
+    m_qComp.Clear();
+    m_sComp.Clear();
 }
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -11,25 +11,52 @@
 #include <Core/Math/CG.hpp>
 #include <Core/Solver/FDM/FDMICCGSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <type_traits>
 
 namespace CubbyFlow
 {
-void FDMICCGSolver3::Preconditioner::Build(const FDMMatrix3& matrix)
+template <typename MatrixType>
+void FDMICCGSolver3::Preconditioner<MatrixType>::Build(const MatrixType& matrix)
 {
     const Vector3UZ size = matrix.Size();
-    A = matrix.View();
+    A = &matrix;
 
     d.Resize(size, 0.0);
     y.Resize(size, 0.0);
 
+    if constexpr (std::is_same_v<MatrixType, FDMMarkerMatrix3>)
+    {
+        // Evaluate the off-diagonal pattern once so that each application of
+        // the preconditioner reads a byte per neighbor instead of evaluating
+        // the whole row from the markers.
+        const Array3<char>& markers = matrix.markers;
+        const auto isFluid = [&](size_t i, size_t j, size_t k) {
+            return markers(i, j, k) == FDMMarkerMatrix3::FLUID;
+        };
+
+        couplings.Resize(size);
+        ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            char flags = 0;
+
+            if (isFluid(i, j, k))
+            {
+                flags |= (i + 1 < size.x && isFluid(i + 1, j, k)) ? 1 : 0;
+                flags |= (j + 1 < size.y && isFluid(i, j + 1, k)) ? 2 : 0;
+                flags |= (k + 1 < size.z && isFluid(i, j, k + 1)) ? 4 : 0;
+            }
+
+            couplings(i, j, k) = flags;
+        });
+    }
+
     ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
         const double denom =
             matrix(i, j, k).center -
-            ((i > 0) ? Square(matrix(i - 1, j, k).right) * d(i - 1, j, k)
-                     : 0.0) -
-            ((j > 0) ? Square(matrix(i, j - 1, k).up) * d(i, j - 1, k) : 0.0) -
-            ((k > 0) ? Square(matrix(i, j, k - 1).front) * d(i, j, k - 1)
-                     : 0.0);
+            ((i > 0) ? Square(Upper(i - 1, j, k).x) * d(i - 1, j, k) : 0.0) -
+            ((j > 0) ? Square(Upper(i, j - 1, k).y) * d(i, j - 1, k) : 0.0) -
+            ((k > 0) ? Square(Upper(i, j, k - 1).z) * d(i, j, k - 1) : 0.0);
 
         if (std::fabs(denom) > 0.0)
         {
@@ -42,7 +69,16 @@ void FDMICCGSolver3::Preconditioner::Build(const FDMMatrix3& matrix)
     });
 }
 
-void FDMICCGSolver3::Preconditioner::Solve(const FDMVector3& b, FDMVector3* x)
+template <typename MatrixType>
+bool FDMICCGSolver3::Preconditioner<MatrixType>::IsBuiltFor(
+    const MatrixType& matrix) const
+{
+    return A == &matrix && d.Size() == matrix.Size();
+}
+
+template <typename MatrixType>
+void FDMICCGSolver3::Preconditioner<MatrixType>::Solve(const FDMVector3& b,
+                                                       FDMVector3* x)
 {
     const Vector3UZ size = b.Size();
     const auto sx = static_cast<ssize_t>(size.x);
@@ -51,9 +87,9 @@ void FDMICCGSolver3::Preconditioner::Solve(const FDMVector3& b, FDMVector3* x)
 
     ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
         y(i, j, k) = (b(i, j, k) -
-                      ((i > 0) ? A(i - 1, j, k).right * y(i - 1, j, k) : 0.0) -
-                      ((j > 0) ? A(i, j - 1, k).up * y(i, j - 1, k) : 0.0) -
-                      ((k > 0) ? A(i, j, k - 1).front * y(i, j, k - 1) : 0.0)) *
+                      ((i > 0) ? Upper(i - 1, j, k).x * y(i - 1, j, k) : 0.0) -
+                      ((j > 0) ? Upper(i, j - 1, k).y * y(i, j - 1, k) : 0.0) -
+                      ((k > 0) ? Upper(i, j, k - 1).z * y(i, j, k - 1) : 0.0)) *
                      d(i, j, k);
     });
 
@@ -63,19 +99,40 @@ void FDMICCGSolver3::Preconditioner::Solve(const FDMVector3& b, FDMVector3* x)
         {
             for (ssize_t i = sx - 1; i >= 0; --i)
             {
+                const Vector3D upper = Upper(i, j, k);
+
                 (*x)(i, j, k) =
                     (y(i, j, k) -
-                     ((i + 1 < sx) ? A(i, j, k).right * (*x)(i + 1, j, k)
-                                   : 0.0) -
-                     ((j + 1 < sy) ? A(i, j, k).up * (*x)(i, j + 1, k) : 0.0) -
-                     ((k + 1 < sz) ? A(i, j, k).front * (*x)(i, j, k + 1)
-                                   : 0.0)) *
+                     ((i + 1 < sx) ? upper.x * (*x)(i + 1, j, k) : 0.0) -
+                     ((j + 1 < sy) ? upper.y * (*x)(i, j + 1, k) : 0.0) -
+                     ((k + 1 < sz) ? upper.z * (*x)(i, j, k + 1) : 0.0)) *
                     d(i, j, k);
             }
         }
     }
 }
 
+template <typename MatrixType>
+Vector3D FDMICCGSolver3::Preconditioner<MatrixType>::Upper(size_t i, size_t j,
+                                                           size_t k) const
+{
+    if constexpr (std::is_same_v<MatrixType, FDMMarkerMatrix3>)
+    {
+        const char flags = couplings(i, j, k);
+        const Vector3D& invHSqr = A->invGridSpacingSqr;
+
+        return Vector3D{ (flags & 1) != 0 ? -invHSqr.x : 0.0,
+                         (flags & 2) != 0 ? -invHSqr.y : 0.0,
+                         (flags & 4) != 0 ? -invHSqr.z : 0.0 };
+    }
+    else
+    {
+        const FDMMatrixRow3& row = (*A)(i, j, k);
+
+        return Vector3D{ row.right, row.up, row.front };
+    }
+}
+
 void FDMICCGSolver3::PreconditionerCompressed::Build(const MatrixCSRD& matrix)
 {
     const size_t size = matrix.GetCols();
@@ -118,6 +175,12 @@ void FDMICCGSolver3::PreconditionerCompressed::Build(const MatrixCSRD& matrix)
     });
 }
 
+bool FDMICCGSolver3::PreconditionerCompressed::IsBuiltFor(
+    const MatrixCSRD& matrix) const
+{
+    return A == &matrix && d.GetRows() == matrix.GetCols();
+}
+
 void FDMICCGSolver3::PreconditionerCompressed::Solve(const VectorND& b,
                                                      VectorND* x)
 {
@@ -192,18 +255,25 @@ bool FDMICCGSolver3::Solve(FDMLinearSystem3* system)
     m_q.Resize(size);
     m_s.Resize(size);
 
-    system->x.Fill(0.0);
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
     m_r.Fill(0.0);
     m_d.Fill(0.0);
     m_q.Fill(0.0);
     m_s.Fill(0.0);
 
-    m_precond.Build(matrix);
+    if (!GetReusePreconditioner() || !m_precond.IsBuiltFor(matrix))
+    {
+        m_precond.Build(matrix);
+    }
 
-    PCG<FDMBLAS3, Preconditioner>(matrix, rhs, m_maxNumberOfIterations,
-                                  m_tolerance, &m_precond, &solution, &m_r,
-                                  &m_d, &m_q, &m_s, &m_lastNumberOfIterations,
-                                  &m_lastResidualNorm);
+    PCG<FDMBLAS3, Preconditioner<FDMMatrix3>>(
+        matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precond,
+        &solution, &m_r, &m_d, &m_q, &m_s, &m_lastNumberOfIterations,
+        &m_lastResidualNorm);
 
     CUBBYFLOW_INFO << "Residual norm after solving ICCG: " << m_lastResidualNorm
                    << " Number of ICCG iterations: "
@@ -227,18 +297,35 @@ bool FDMICCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
     m_qComp.Resize(size);
     m_sComp.Resize(size);
 
-    system->x.Fill(0.0);
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
     m_rComp.Fill(0.0);
     m_dComp.Fill(0.0);
     m_qComp.Fill(0.0);
     m_sComp.Fill(0.0);
 
-    m_precondComp.Build(matrix);
+    if (!GetReusePreconditioner() || !m_precondComp.IsBuiltFor(matrix))
+    {
+        m_precondComp.Build(matrix);
+    }
 
-    PCG<FDMCompressedBLAS3, PreconditionerCompressed>(
-        matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precondComp,
-        &solution, &m_rComp, &m_dComp, &m_qComp, &m_sComp,
-        &m_lastNumberOfIterations, &m_lastResidualNorm);
+    if (GetUseSlicedEllpack())
+    {
+        PCG<FDMCompressedSELLBLAS3, PreconditionerCompressed>(
+            GetSlicedEllpackMatrix(matrix), rhs, m_maxNumberOfIterations,
+            m_tolerance, &m_precondComp, &solution, &m_rComp, &m_dComp,
+            &m_qComp, &m_sComp, &m_lastNumberOfIterations, &m_lastResidualNorm);
+    }
+    else
+    {
+        PCG<FDMCompressedBLAS3, PreconditionerCompressed>(
+            matrix, rhs, m_maxNumberOfIterations, m_tolerance, &m_precondComp,
+            &solution, &m_rComp, &m_dComp, &m_qComp, &m_sComp,
+            &m_lastNumberOfIterations, &m_lastResidualNorm);
+    }
 
     CUBBYFLOW_INFO << "Residual after solving ICCG: " << m_lastResidualNorm
                    << " Number of ICCG iterations: "
@@ -248,6 +335,51 @@ bool FDMICCGSolver3::SolveCompressed(FDMCompressedLinearSystem3* system)
            (m_lastNumberOfIterations < m_maxNumberOfIterations);
 }
 
+bool FDMICCGSolver3::SolveMatrixFree(FDMMatrixFreeLinearSystem3* system)
+{
+    FDMMarkerMatrix3& matrix = system->A;
+    FDMVector3& solution = system->x;
+    FDMVector3& rhs = system->b;
+
+    ClearCompressedVectors();
+
+    assert(matrix.Size() == rhs.Size());
+    assert(matrix.Size() == solution.Size());
+
+    const Vector3UZ size = matrix.Size();
+    m_r.Resize(size);
+    m_d.Resize(size);
+    m_q.Resize(size);
+    m_s.Resize(size);
+
+    if (!GetUseInitialGuess())
+    {
+        system->x.Fill(0.0);
+    }
+
+    m_r.Fill(0.0);
+    m_d.Fill(0.0);
+    m_q.Fill(0.0);
+    m_s.Fill(0.0);
+
+    if (!GetReusePreconditioner() || !m_precondMatrixFree.IsBuiltFor(matrix))
+    {
+        m_precondMatrixFree.Build(matrix);
+    }
+
+    PCG<FDMMatrixFreeBLAS3, Preconditioner<FDMMarkerMatrix3>>(
+        matrix, rhs, m_maxNumberOfIterations, m_tolerance,
+        &m_precondMatrixFree, &solution, &m_r, &m_d, &m_q, &m_s,
+        &m_lastNumberOfIterations, &m_lastResidualNorm);
+
+    CUBBYFLOW_INFO << "Residual norm after solving ICCG: " << m_lastResidualNorm
+                   << " Number of ICCG iterations: "
+                   << m_lastNumberOfIterations;
+
+    return (m_lastResidualNorm <= m_tolerance) ||
+           (m_lastNumberOfIterations < m_maxNumberOfIterations);
+}
+
 unsigned int FDMICCGSolver3::GetMaxNumberOfIterations() const
 {
     return m_maxNumberOfIterations;
@@ -278,9 +410,9 @@ void FDMICCGSolver3::ClearUncompressedVectors()
 
 void FDMICCGSolver3::ClearCompressedVectors()
 {
-    m_r.Clear();
-    m_d.Clear();
-    m_q.Clear();
-    m_s.Clear();
+    m_rComp.Clear();
+    m_dComp.Clear();
+    m_qComp.Clear();
+    m_sComp.Clear();
 }
 }  // namespace CubbyFlow
\ No newline at end of file
@@ -0,0 +1,91 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Solver/FDM/FDMLinearSystemSolver3.hpp>
+#include <Core/Utils/IterationUtils.hpp>
+
+namespace CubbyFlow
+{
+bool FDMLinearSystemSolver3::SolveMatrixFree(FDMMatrixFreeLinearSystem3* system)
+{
+    const FDMMarkerMatrix3& matrix = system->A;
+
+    FDMLinearSystem3 assembled;
+    assembled.A.Resize(matrix.Size());
+
+    ParallelForEachIndex(matrix.Size(), [&](size_t i, size_t j, size_t k) {
+        assembled.A(i, j, k) = matrix(i, j, k);
+    });
+
+    // Borrow the vectors instead of copying them.
+    assembled.x.Swap(system->x);
+    assembled.b.Swap(system->b);
+
+    const bool result = Solve(&assembled);
+
+    system->x.Swap(assembled.x);
+    system->b.Swap(assembled.b);
+
+    return result;
+}
+
+unsigned int FDMLinearSystemSolver3::GetLastNumberOfIterations() const
+{
+    return 0;
+}
+
+double FDMLinearSystemSolver3::GetLastResidual() const
+{
+    return 0.0;
+}
+
+bool FDMLinearSystemSolver3::GetUseInitialGuess() const
+{
+    return m_useInitialGuess;
+}
+
+void FDMLinearSystemSolver3::SetUseInitialGuess(bool useInitialGuess)
+{
+    m_useInitialGuess = useInitialGuess;
+}
+
+bool FDMLinearSystemSolver3::GetReusePreconditioner() const
+{
+    return m_reusePreconditioner;
+}
+
+void FDMLinearSystemSolver3::SetReusePreconditioner(bool reusePreconditioner)
+{
+    m_reusePreconditioner = reusePreconditioner;
+}
+
+bool FDMLinearSystemSolver3::GetUseSlicedEllpack() const
+{
+    return m_useSlicedEllpack;
+}
+
+void FDMLinearSystemSolver3::SetUseSlicedEllpack(bool useSlicedEllpack)
+{
+    m_useSlicedEllpack = useSlicedEllpack;
+}
+
+const MatrixSELLD& FDMLinearSystemSolver3::GetSlicedEllpackMatrix(
+    const MatrixCSRD& matrix)
+{
+    if (!m_reusePreconditioner || m_sellSource != &matrix ||
+        m_sellMatrix.Size() != matrix.Size())
+    {
+        m_sellMatrix.Build(matrix);
+        m_sellSource = &matrix;
+    }
+
+    return m_sellMatrix;
+}
+}  // namespace CubbyFlow
@@ -70,7 +70,11 @@ bool FDMMGPCGSolver3::Solve(FDMMGLinearSystem3* system)
     m_q.Resize(size);
     m_s.Resize(size);
 
-    system->x.levels.front().Fill(0.0);
+    if (!GetUseInitialGuess())
+    {
+        system->x.levels.front().Fill(0.0);
+    }
+
     m_r.Fill(0.0);
     m_d.Fill(0.0);
     m_q.Fill(0.0);
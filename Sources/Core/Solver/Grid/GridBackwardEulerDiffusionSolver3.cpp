@@ -178,7 +178,10 @@ void GridBackwardEulerDiffusionSolver3::BuildMarkers(
     const std::function<Vector3D(size_t, size_t, size_t)>& pos,
     const ScalarField3& boundarySDF, const ScalarField3& fluidSDF)
 {
-    m_markers.Resize(size);
+    if (m_markers.Size() != size)
+    {
+        m_markers.Resize(size);
+    }
 
     ParallelForEachIndex(m_markers.Size(), [&](size_t i, size_t j, size_t k) {
         if (IsInsideSDF(boundarySDF.Sample(pos(i, j, k))))
@@ -199,7 +202,11 @@ void GridBackwardEulerDiffusionSolver3::BuildMarkers(
 void GridBackwardEulerDiffusionSolver3::BuildMatrix(const Vector3UZ& size,
                                                     const Vector3D& c)
 {
-    m_system.A.Resize(size);
+    // Keep the storage if possible since this is called for every component.
+    if (m_system.A.Size() != size)
+    {
+        m_system.A.Resize(size);
+    }
 
     bool isBoundaryType = (m_boundaryType == BoundaryType::Dirichlet);
 
@@ -281,8 +288,11 @@ void GridBackwardEulerDiffusionSolver3::BuildVectors(
 {
     Vector3UZ size = f.Size();
 
-    m_system.x.Resize(size, 0.0);
-    m_system.b.Resize(size, 0.0);
+    if (m_system.x.Size() != size || m_system.b.Size() != size)
+    {
+        m_system.x.Resize(size, 0.0);
+        m_system.b.Resize(size, 0.0);
+    }
 
     // Build linear system
     ParallelForEachIndex(m_system.x.Size(), [&](size_t i, size_t j, size_t k) {
@@ -329,8 +339,11 @@ void GridBackwardEulerDiffusionSolver3::BuildVectors(
 {
     Vector3UZ size = f.Size();
 
-    m_system.x.Resize(size, 0.0);
-    m_system.b.Resize(size, 0.0);
+    if (m_system.x.Size() != size || m_system.b.Size() != size)
+    {
+        m_system.x.Resize(size, 0.0);
+        m_system.b.Resize(size, 0.0);
+    }
 
     // Build linear system
     ParallelForEachIndex(m_system.x.Size(), [&](size_t i, size_t j, size_t k) {
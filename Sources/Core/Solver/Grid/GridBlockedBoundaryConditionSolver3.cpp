@@ -86,11 +86,36 @@ void GridBlockedBoundaryConditionSolver3::OnColliderUpdated(
     GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
         gridSize, gridSpacing, gridOrigin);
 
+    Vector3UZ begin = GetUpdatedRegionBegin();
+    Vector3UZ end = GetUpdatedRegionEnd();
+
+    if (m_marker.Size() != gridSize)
+    {
+        m_marker.Resize(gridSize);
+        begin = Vector3UZ{};
+        end = gridSize;
+    }
+
+    UpdateMarker(begin, end);
+}
+
+void GridBlockedBoundaryConditionSolver3::OnLoadCheckpoint(
+    const std::string& prefix, const Checkpoint& checkpoint)
+{
+    GridFractionalBoundaryConditionSolver3::OnLoadCheckpoint(prefix,
+                                                             checkpoint);
+
+    m_marker.Resize(GetGridSize());
+    UpdateMarker(Vector3UZ{}, GetGridSize());
+}
+
+void GridBlockedBoundaryConditionSolver3::UpdateMarker(const Vector3UZ& begin,
+                                                       const Vector3UZ& end)
+{
     const auto sdf =
         std::dynamic_pointer_cast<CellCenteredScalarGrid3>(GetColliderSDF());
 
-    m_marker.Resize(gridSize);
-    ParallelForEachIndex(m_marker.Size(), [&](size_t i, size_t j, size_t k) {
+    ParallelForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
         if (IsInsideSDF((*sdf)(i, j, k)))
         {
             m_marker(i, j, k) = COLLIDER;
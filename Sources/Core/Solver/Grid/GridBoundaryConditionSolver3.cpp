@@ -9,6 +9,7 @@
 // property of any third parties.
 
 #include <Core/Solver/Grid/GridBoundaryConditionSolver3.hpp>
+#include <Core/Utils/Macros.hpp>
 
 namespace CubbyFlow
 {
@@ -39,6 +40,32 @@ void GridBoundaryConditionSolver3::SetClosedDomainBoundaryFlag(int flag)
     m_closedDomainBoundaryFlag = flag;
 }
 
+void GridBoundaryConditionSolver3::SaveCheckpoint(const std::string& prefix,
+                                                  Checkpoint* checkpoint) const
+{
+    OnSaveCheckpoint(prefix, checkpoint);
+}
+
+void GridBoundaryConditionSolver3::LoadCheckpoint(const std::string& prefix,
+                                                  const Checkpoint& checkpoint)
+{
+    OnLoadCheckpoint(prefix, checkpoint);
+}
+
+void GridBoundaryConditionSolver3::OnSaveCheckpoint(
+    const std::string& prefix, Checkpoint* checkpoint) const
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
+void GridBoundaryConditionSolver3::OnLoadCheckpoint(
+    const std::string& prefix, const Checkpoint& checkpoint)
+{
+    UNUSED_VARIABLE(prefix);
+    UNUSED_VARIABLE(checkpoint);
+}
+
 const Vector3UZ& GridBoundaryConditionSolver3::GetGridSize() const
 {
     return m_gridSize;
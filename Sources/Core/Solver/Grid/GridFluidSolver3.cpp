@@ -9,14 +9,21 @@
 // property of any third parties.
 
 #include <Core/Array/ArrayUtils.hpp>
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/CellCenteredVectorGrid.hpp>
+#include <Core/Grid/VertexCenteredScalarGrid.hpp>
+#include <Core/Grid/VertexCenteredVectorGrid.hpp>
 #include <Core/Solver/Advection/CubicSemiLagrangian3.hpp>
 #include <Core/Solver/Grid/GridBackwardEulerDiffusionSolver3.hpp>
 #include <Core/Solver/Grid/GridFluidSolver3.hpp>
 #include <Core/Solver/Grid/GridFractionalSinglePhasePressureSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 #include <Core/Utils/Logging.hpp>
+#include <Core/Utils/TaskGraph.hpp>
 #include <Core/Utils/Timer.hpp>
 
+#include <typeinfo>
+
 namespace CubbyFlow
 {
 GridFluidSolver3::GridFluidSolver3()
@@ -96,6 +103,16 @@ void GridFluidSolver3::SetUseCompressedLinearSystem(bool isOn)
     m_useCompressedLinearSys = isOn;
 }
 
+bool GridFluidSolver3::GetUseConcurrentAdvection() const
+{
+    return m_useConcurrentAdvection;
+}
+
+void GridFluidSolver3::SetUseConcurrentAdvection(bool isOn)
+{
+    m_useConcurrentAdvection = isOn;
+}
+
 const AdvectionSolver3Ptr& GridFluidSolver3::GetAdvectionSolver() const
 {
     return m_advectionSolver;
@@ -259,6 +276,71 @@ unsigned int GridFluidSolver3::GetNumberOfSubTimeSteps(
         std::max(std::ceil(currentCFL / m_maxCFL), 1.0));
 }
 
+void GridFluidSolver3::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    checkpoint->WriteValue("solver/gravity", m_gravity);
+    checkpoint->WriteValue("solver/viscosityCoefficient",
+                           m_viscosityCoefficient);
+    checkpoint->WriteValue("solver/maxCFL", m_maxCFL);
+    checkpoint->WriteValue("solver/closedDomainBoundaryFlag",
+                           m_closedDomainBoundaryFlag);
+    checkpoint->WriteValue("solver/useCompressedLinearSystem",
+                           m_useCompressedLinearSys);
+
+    m_grids->SaveCheckpoint("grids", checkpoint);
+
+    if (m_collider != nullptr)
+    {
+        m_collider->SaveCheckpoint("collider", checkpoint);
+    }
+
+    if (m_emitter != nullptr)
+    {
+        m_emitter->SaveCheckpoint("emitter", checkpoint);
+    }
+
+    if (m_boundaryConditionSolver != nullptr)
+    {
+        m_boundaryConditionSolver->SaveCheckpoint("boundaryConditionSolver",
+                                                  checkpoint);
+    }
+}
+
+void GridFluidSolver3::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    m_gravity = checkpoint.Value<Vector3D>("solver/gravity");
+    m_viscosityCoefficient =
+        checkpoint.Value<double>("solver/viscosityCoefficient");
+    m_maxCFL = checkpoint.Value<double>("solver/maxCFL");
+    m_useCompressedLinearSys =
+        checkpoint.Value<bool>("solver/useCompressedLinearSystem");
+    SetClosedDomainBoundaryFlag(
+        checkpoint.Value<int>("solver/closedDomainBoundaryFlag"));
+
+    m_grids->LoadCheckpoint("grids", checkpoint);
+
+    if (m_collider != nullptr)
+    {
+        m_collider->LoadCheckpoint("collider", checkpoint);
+    }
+
+    if (m_emitter != nullptr)
+    {
+        m_emitter->LoadCheckpoint("emitter", checkpoint);
+    }
+
+    // Binds the restored collider first, then overwrites the rebuilt cache
+    // with the saved one.
+    if (m_boundaryConditionSolver != nullptr)
+    {
+        m_boundaryConditionSolver->UpdateCollider(
+            m_collider, m_grids->Resolution(), m_grids->GridSpacing(),
+            m_grids->Origin());
+        m_boundaryConditionSolver->LoadCheckpoint("boundaryConditionSolver",
+                                                  checkpoint);
+    }
+}
+
 void GridFluidSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
 {
     UNUSED_VARIABLE(timeIntervalInSeconds);
@@ -280,10 +362,9 @@ void GridFluidSolver3::ComputeViscosity(double timeIntervalInSeconds)
         m_viscosityCoefficient > std::numeric_limits<double>::epsilon())
     {
         const FaceCenteredGrid3Ptr vel = GetVelocity();
-        const std::shared_ptr<FaceCenteredGrid3> vel0 =
-            std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+        m_velocity0.Set(*vel);
 
-        m_diffusionSolver->Solve(*vel0, m_viscosityCoefficient,
+        m_diffusionSolver->Solve(m_velocity0, m_viscosityCoefficient,
                                  timeIntervalInSeconds, vel.get(),
                                  *GetColliderSDF(), *GetFluidSDF());
         ApplyBoundaryCondition();
@@ -295,10 +376,9 @@ void GridFluidSolver3::ComputePressure(double timeIntervalInSeconds)
     if (m_pressureSolver != nullptr)
     {
         const FaceCenteredGrid3Ptr vel = GetVelocity();
-        const std::shared_ptr<FaceCenteredGrid3> vel0 =
-            std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+        m_velocity0.Set(*vel);
 
-        m_pressureSolver->Solve(*vel0, timeIntervalInSeconds, vel.get(),
+        m_pressureSolver->Solve(m_velocity0, timeIntervalInSeconds, vel.get(),
                                 *GetColliderSDF(), *GetColliderVelocityField(),
                                 *GetFluidSDF(), m_useCompressedLinearSys);
         ApplyBoundaryCondition();
@@ -311,22 +391,31 @@ void GridFluidSolver3::ComputeAdvection(double timeIntervalInSeconds)
 
     if (m_advectionSolver != nullptr)
     {
+        // The custom fields are independent of each other, so they can be
+        // advected concurrently if the advection is known to be thread-safe.
+        TaskGraph graph;
+
         // Solve advections for custom scalar fields.
         size_t n = m_grids->NumberOfAdvectableScalarData();
+        m_scalarData0.resize(n);
 
         for (size_t i = 0; i < n; ++i)
         {
-            ScalarGrid3Ptr grid = m_grids->AdvectableScalarDataAt(i);
-            std::shared_ptr<ScalarGrid3> grid0 = grid->Clone();
-
-            m_advectionSolver->Advect(*grid0, *vel, timeIntervalInSeconds,
-                                      grid.get(), *GetColliderSDF());
-            ExtrapolateIntoCollider(grid.get());
+            graph.AddTask([this, i, timeIntervalInSeconds]() {
+                ScalarGrid3Ptr grid = m_grids->AdvectableScalarDataAt(i);
+                ScalarGrid3Ptr& grid0 = m_scalarData0[i];
+                CopyGrid(*grid, &grid0);
+
+                ComputeScalarAdvection(*grid0, timeIntervalInSeconds,
+                                       grid.get());
+                ExtrapolateIntoCollider(grid.get());
+            });
         }
 
         // Solve advections for custom vector fields.
         n = m_grids->NumberOfAdvectableVectorData();
         const size_t velIdx = m_grids->VelocityIndex();
+        m_vectorData0.resize(n);
 
         for (size_t i = 0; i < n; ++i)
         {
@@ -336,47 +425,62 @@ void GridFluidSolver3::ComputeAdvection(double timeIntervalInSeconds)
                 continue;
             }
 
-            VectorGrid3Ptr grid = m_grids->AdvectableVectorDataAt(i);
-            std::shared_ptr<VectorGrid3> grid0 = grid->Clone();
-
-            std::shared_ptr<CollocatedVectorGrid3> collocated =
-                std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid);
-            std::shared_ptr<CollocatedVectorGrid3> collocated0 =
-                std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid0);
-
-            if (collocated != nullptr)
-            {
-                m_advectionSolver->Advect(*collocated0, *vel,
-                                          timeIntervalInSeconds,
-                                          collocated.get(), *GetColliderSDF());
-                ExtrapolateIntoCollider(collocated.get());
-                continue;
-            }
-
-            std::shared_ptr<FaceCenteredGrid3> faceCentered =
-                std::dynamic_pointer_cast<FaceCenteredGrid3>(grid);
-            std::shared_ptr<FaceCenteredGrid3> faceCentered0 =
-                std::dynamic_pointer_cast<FaceCenteredGrid3>(grid0);
-
-            if (faceCentered != nullptr && faceCentered0 != nullptr)
-            {
-                m_advectionSolver->Advect(
-                    *faceCentered0, *vel, timeIntervalInSeconds,
-                    faceCentered.get(), *GetColliderSDF());
-                ExtrapolateIntoCollider(faceCentered.get());
-            }
+            graph.AddTask([this, i, timeIntervalInSeconds, &vel]() {
+                VectorGrid3Ptr grid = m_grids->AdvectableVectorDataAt(i);
+                VectorGrid3Ptr& grid0 = m_vectorData0[i];
+                CopyGrid(*grid, &grid0);
+
+                std::shared_ptr<CollocatedVectorGrid3> collocated =
+                    std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid);
+                std::shared_ptr<CollocatedVectorGrid3> collocated0 =
+                    std::dynamic_pointer_cast<CollocatedVectorGrid3>(grid0);
+
+                if (collocated != nullptr)
+                {
+                    m_advectionSolver->Advect(
+                        *collocated0, *vel, timeIntervalInSeconds,
+                        collocated.get(), *GetColliderSDF());
+                    ExtrapolateIntoCollider(collocated.get());
+                    return;
+                }
+
+                std::shared_ptr<FaceCenteredGrid3> faceCentered =
+                    std::dynamic_pointer_cast<FaceCenteredGrid3>(grid);
+                std::shared_ptr<FaceCenteredGrid3> faceCentered0 =
+                    std::dynamic_pointer_cast<FaceCenteredGrid3>(grid0);
+
+                if (faceCentered != nullptr && faceCentered0 != nullptr)
+                {
+                    m_advectionSolver->Advect(
+                        *faceCentered0, *vel, timeIntervalInSeconds,
+                        faceCentered.get(), *GetColliderSDF());
+                    ExtrapolateIntoCollider(faceCentered.get());
+                }
+            });
         }
 
-        // Solve velocity advection
-        const std::shared_ptr<FaceCenteredGrid3> vel0 =
-            std::dynamic_pointer_cast<FaceCenteredGrid3>(vel->Clone());
+        graph.Run(m_useConcurrentAdvection ? ExecutionPolicy::Parallel
+                                           : ExecutionPolicy::Serial);
+
+        // Solve velocity advection after the custom fields which are
+        // advected by the velocity.
+        m_velocity0.Set(*vel);
 
-        m_advectionSolver->Advect(*vel0, *vel0, timeIntervalInSeconds,
-                                  vel.get(), *GetColliderSDF());
+        m_advectionSolver->Advect(m_velocity0, m_velocity0,
+                                  timeIntervalInSeconds, vel.get(),
+                                  *GetColliderSDF());
         ApplyBoundaryCondition();
     }
 }
 
+void GridFluidSolver3::ComputeScalarAdvection(const ScalarGrid3& input,
+                                              double timeIntervalInSeconds,
+                                              ScalarGrid3* output)
+{
+    m_advectionSolver->Advect(input, *GetVelocity(), timeIntervalInSeconds,
+                              output, *GetColliderSDF());
+}
+
 ScalarField3Ptr GridFluidSolver3::GetFluidSDF() const
 {
     return std::make_shared<ConstantScalarField3>(
@@ -430,105 +534,91 @@ void GridFluidSolver3::ApplyBoundaryCondition() const
 
 void GridFluidSolver3::ExtrapolateIntoCollider(ScalarGrid3* grid)
 {
-    Array3<char> marker(grid->DataSize());
-    GridDataPositionFunc<3> pos = grid->DataPosition();
-
-    ParallelForEachIndex(marker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(GetColliderSDF()->Sample(pos(i, j, k))))
-        {
-            marker(i, j, k) = 0;
-        }
-        else
-        {
-            marker(i, j, k) = 1;
-        }
-    });
-
-    const auto depth = static_cast<unsigned int>(std::ceil(m_maxCFL));
-    ExtrapolateToRegion(grid->DataView(), marker, depth, grid->DataView());
+    ExtrapolateDataIntoCollider(grid->DataView(), grid->DataPosition());
 }
 
 void GridFluidSolver3::ExtrapolateIntoCollider(CollocatedVectorGrid3* grid)
 {
-    Array3<char> marker(grid->DataSize());
-    GridDataPositionFunc<3> pos = grid->DataPosition();
-
-    ParallelForEachIndex(marker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(GetColliderSDF()->Sample(pos(i, j, k))))
-        {
-            marker(i, j, k) = 0;
-        }
-        else
-        {
-            marker(i, j, k) = 1;
-        }
-    });
-
-    const auto depth = static_cast<unsigned int>(std::ceil(m_maxCFL));
-    ExtrapolateToRegion(grid->DataView(), marker, depth, grid->DataView());
+    ExtrapolateDataIntoCollider(grid->DataView(), grid->DataPosition());
 }
 
 void GridFluidSolver3::ExtrapolateIntoCollider(FaceCenteredGrid3* grid)
 {
-    const ArrayView3<double> u = grid->UView();
-    const ArrayView3<double> v = grid->VView();
-    const ArrayView3<double> w = grid->WView();
+    // Each component is extrapolated independently.
+    TaskGraph graph;
+    graph.AddTask([&]() {
+        ExtrapolateDataIntoCollider(grid->UView(), grid->UPosition());
+    });
+    graph.AddTask([&]() {
+        ExtrapolateDataIntoCollider(grid->VView(), grid->VPosition());
+    });
+    graph.AddTask([&]() {
+        ExtrapolateDataIntoCollider(grid->WView(), grid->WPosition());
+    });
+    graph.Run();
+}
 
-    GridDataPositionFunc<3> uPos = grid->UPosition();
-    GridDataPositionFunc<3> vPos = grid->VPosition();
-    GridDataPositionFunc<3> wPos = grid->WPosition();
+ScalarField3Ptr GridFluidSolver3::GetColliderSDF() const
+{
+    return m_boundaryConditionSolver->GetColliderSDF();
+}
 
-    Array3<char> uMarker{ u.Size() };
-    Array3<char> vMarker{ v.Size() };
-    Array3<char> wMarker{ w.Size() };
+VectorField3Ptr GridFluidSolver3::GetColliderVelocityField() const
+{
+    return m_boundaryConditionSolver->GetColliderVelocityField();
+}
 
-    ParallelForEachIndex(uMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(GetColliderSDF()->Sample(uPos(i, j, k))))
-        {
-            uMarker(i, j, k) = 0;
-        }
-        else
+void GridFluidSolver3::CopyGrid(const ScalarGrid3& grid, ScalarGrid3Ptr* copy)
+{
+    if (*copy != nullptr && typeid(**copy) == typeid(grid))
+    {
+        if (const auto cellCentered =
+                dynamic_cast<const CellCenteredScalarGrid3*>(&grid))
         {
-            uMarker(i, j, k) = 1;
+            static_cast<CellCenteredScalarGrid3&>(**copy).Set(*cellCentered);
+            return;
         }
-    });
 
-    ParallelForEachIndex(vMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(GetColliderSDF()->Sample(vPos(i, j, k))))
+        if (const auto vertexCentered =
+                dynamic_cast<const VertexCenteredScalarGrid3*>(&grid))
         {
-            vMarker(i, j, k) = 0;
+            static_cast<VertexCenteredScalarGrid3&>(**copy).Set(
+                *vertexCentered);
+            return;
         }
-        else
+    }
+
+    *copy = grid.Clone();
+}
+
+void GridFluidSolver3::CopyGrid(const VectorGrid3& grid, VectorGrid3Ptr* copy)
+{
+    if (*copy != nullptr && typeid(**copy) == typeid(grid))
+    {
+        if (const auto cellCentered =
+                dynamic_cast<const CellCenteredVectorGrid3*>(&grid))
         {
-            vMarker(i, j, k) = 1;
+            static_cast<CellCenteredVectorGrid3&>(**copy).Set(*cellCentered);
+            return;
         }
-    });
 
-    ParallelForEachIndex(wMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(GetColliderSDF()->Sample(wPos(i, j, k))))
+        if (const auto vertexCentered =
+                dynamic_cast<const VertexCenteredVectorGrid3*>(&grid))
         {
-            wMarker(i, j, k) = 0;
+            static_cast<VertexCenteredVectorGrid3&>(**copy).Set(
+                *vertexCentered);
+            return;
         }
-        else
+
+        if (const auto faceCentered =
+                dynamic_cast<const FaceCenteredGrid3*>(&grid))
         {
-            wMarker(i, j, k) = 1;
+            static_cast<FaceCenteredGrid3&>(**copy).Set(*faceCentered);
+            return;
         }
-    });
-
-    const auto depth = static_cast<unsigned int>(std::ceil(m_maxCFL));
-    ExtrapolateToRegion(grid->UView(), uMarker, depth, u);
-    ExtrapolateToRegion(grid->VView(), vMarker, depth, v);
-    ExtrapolateToRegion(grid->WView(), wMarker, depth, w);
-}
-
-ScalarField3Ptr GridFluidSolver3::GetColliderSDF() const
-{
-    return m_boundaryConditionSolver->GetColliderSDF();
-}
+    }
 
-VectorField3Ptr GridFluidSolver3::GetColliderVelocityField() const
-{
-    return m_boundaryConditionSolver->GetColliderVelocityField();
+    *copy = grid.Clone();
 }
 
 void GridFluidSolver3::BeginAdvanceTimeStep(double timeIntervalInSeconds)
@@ -582,6 +672,57 @@ void GridFluidSolver3::UpdateEmitter(double timeIntervalInSeconds) const
     }
 }
 
+template <typename T>
+void GridFluidSolver3::ExtrapolateDataIntoCollider(
+    ArrayView3<T> data, const GridDataPositionFunc<3>& pos)
+{
+    std::unique_ptr<ExtrapolationScratch> scratch =
+        AcquireExtrapolationScratch();
+    Array3<char>& marker = scratch->marker;
+    marker.ResizeUninitialized(data.Size());
+
+    ParallelForEachIndex(marker.Size(), [&](size_t i, size_t j, size_t k) {
+        if (IsInsideSDF(GetColliderSDF()->Sample(pos(i, j, k))))
+        {
+            marker(i, j, k) = 0;
+        }
+        else
+        {
+            marker(i, j, k) = 1;
+        }
+    });
+
+    const auto depth = static_cast<unsigned int>(std::ceil(m_maxCFL));
+    ExtrapolateToRegion(data, marker, depth, data, scratch->buffers);
+
+    ReleaseExtrapolationScratch(std::move(scratch));
+}
+
+std::unique_ptr<GridFluidSolver3::ExtrapolationScratch>
+GridFluidSolver3::AcquireExtrapolationScratch()
+{
+    {
+        std::lock_guard<std::mutex> lock{ m_extrapolationScratchMutex };
+
+        if (!m_extrapolationScratch.empty())
+        {
+            std::unique_ptr<ExtrapolationScratch> scratch =
+                std::move(m_extrapolationScratch.back());
+            m_extrapolationScratch.pop_back();
+            return scratch;
+        }
+    }
+
+    return std::make_unique<ExtrapolationScratch>();
+}
+
+void GridFluidSolver3::ReleaseExtrapolationScratch(
+    std::unique_ptr<ExtrapolationScratch> scratch)
+{
+    std::lock_guard<std::mutex> lock{ m_extrapolationScratchMutex };
+    m_extrapolationScratch.push_back(std::move(scratch));
+}
+
 GridFluidSolver3::Builder GridFluidSolver3::GetBuilder()
 {
     return Builder{};
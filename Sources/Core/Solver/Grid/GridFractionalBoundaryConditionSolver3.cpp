@@ -10,6 +10,7 @@
 
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/Geometry/ImplicitSurface.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
 #include <Core/Geometry/SurfaceToImplicit.hpp>
 #include <Core/Solver/Grid/GridFractionalBoundaryConditionSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
@@ -17,6 +18,21 @@
 
 namespace CubbyFlow
 {
+// Number of cells around the swept box of a moving collider to re-rasterize.
+static const double SWEPT_REGION_BAND_WIDTH = 3.0;
+
+static ImplicitSurface3Ptr GetImplicitSurface(const Surface3Ptr& surface)
+{
+    ImplicitSurface3Ptr implicitSurface =
+        std::dynamic_pointer_cast<ImplicitSurface3>(surface);
+    if (implicitSurface == nullptr)
+    {
+        implicitSurface = std::make_shared<SurfaceToImplicit3>(surface);
+    }
+
+    return implicitSurface;
+}
+
 void GridFractionalBoundaryConditionSolver3::ConstrainVelocity(
     FaceCenteredGrid3* velocity, unsigned int extrapolationDepth)
 {
@@ -35,12 +51,20 @@ void GridFractionalBoundaryConditionSolver3::ConstrainVelocity(
     auto vPos = velocity->VPosition();
     auto wPos = velocity->WPosition();
 
-    Array3<double> uTemp{ u.Size() };
-    Array3<double> vTemp{ v.Size() };
-    Array3<double> wTemp{ w.Size() };
-    Array3<char> uMarker{ u.Size(), 1 };
-    Array3<char> vMarker{ v.Size(), 1 };
-    Array3<char> wMarker{ w.Size(), 1 };
+    // Every element of the buffers is written below, so they are reused
+    // without initialization.
+    Array3<double>& uTemp = m_uTemp;
+    Array3<double>& vTemp = m_vTemp;
+    Array3<double>& wTemp = m_wTemp;
+    Array3<char>& uMarker = m_uMarker;
+    Array3<char>& vMarker = m_vMarker;
+    Array3<char>& wMarker = m_wMarker;
+    uTemp.ResizeUninitialized(u.Size());
+    vTemp.ResizeUninitialized(v.Size());
+    wTemp.ResizeUninitialized(w.Size());
+    uMarker.ResizeUninitialized(u.Size());
+    vMarker.ResizeUninitialized(v.Size());
+    wMarker.ResizeUninitialized(w.Size());
 
     Vector3D h = velocity->GridSpacing();
 
@@ -109,9 +133,12 @@ void GridFractionalBoundaryConditionSolver3::ConstrainVelocity(
     });
 
     // Free-slip: Extrapolate fluid velocity into the collider
-    ExtrapolateToRegion(velocity->UView(), uMarker, extrapolationDepth, u);
-    ExtrapolateToRegion(velocity->VView(), vMarker, extrapolationDepth, v);
-    ExtrapolateToRegion(velocity->WView(), wMarker, extrapolationDepth, w);
+    ExtrapolateToRegion(velocity->UView(), uMarker, extrapolationDepth, u,
+                        m_extrapolationBuffers);
+    ExtrapolateToRegion(velocity->VView(), vMarker, extrapolationDepth, v,
+                        m_extrapolationBuffers);
+    ExtrapolateToRegion(velocity->WView(), wMarker, extrapolationDepth, w,
+                        m_extrapolationBuffers);
 
     // No-flux: project the extrapolated velocity to the collider's surface
     // normal
@@ -290,6 +317,16 @@ GridFractionalBoundaryConditionSolver3::GetColliderVelocityField() const
     return m_colliderVel;
 }
 
+bool GridFractionalBoundaryConditionSolver3::GetUseIncrementalUpdate() const
+{
+    return m_useIncrementalUpdate;
+}
+
+void GridFractionalBoundaryConditionSolver3::SetUseIncrementalUpdate(bool isOn)
+{
+    m_useIncrementalUpdate = isOn;
+}
+
 void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
     const Vector3UZ& gridSize, const Vector3D& gridSpacing,
     const Vector3D& gridOrigin)
@@ -299,21 +336,47 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
         m_colliderSDF = std::make_shared<CellCenteredScalarGrid3>();
     }
 
-    m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+    const Collider3Ptr& collider = GetCollider();
 
-    if (GetCollider() != nullptr)
+    if (m_useIncrementalUpdate && m_isColliderSDFValid &&
+        collider != nullptr && m_lastCollider.lock() == collider &&
+        collider->GetShapeRevision() == m_lastShapeRevision &&
+        !IsGridChanged(gridSize, gridSpacing, gridOrigin))
     {
-        Surface3Ptr surface = GetCollider()->GetSurface();
-        ImplicitSurface3Ptr implicitSurface =
-            std::dynamic_pointer_cast<ImplicitSurface3>(surface);
-        if (implicitSurface == nullptr)
+        // Nothing has changed since the last rasterization
+        if (collider->GetTransformRevision() == m_lastTransformRevision)
         {
-            implicitSurface = std::make_shared<SurfaceToImplicit3>(surface);
+            m_updatedRegionBegin = Vector3UZ{};
+            m_updatedRegionEnd = Vector3UZ{};
+            return;
         }
 
-        m_colliderSDF->Fill([&](const Vector3D& pt) {
-            return implicitSurface->SignedDistance(pt);
-        });
+        // The collider has only moved, so re-rasterize the region swept by
+        // the bounding box of the collider.
+        const Surface3Ptr& surface = collider->GetSurface();
+        if (surface->IsBounded() && !m_lastColliderBox.IsEmpty())
+        {
+            const BoundingBox3D colliderBox = surface->GetBoundingBox();
+
+            BoundingBox3D sweptBox = m_lastColliderBox;
+            sweptBox.Merge(colliderBox);
+            sweptBox.Expand(SWEPT_REGION_BAND_WIDTH * gridSpacing.Max());
+
+            UpdateSweptRegion(GetImplicitSurface(surface), sweptBox);
+
+            m_lastColliderBox = colliderBox;
+            m_lastTransformRevision = collider->GetTransformRevision();
+            return;
+        }
+    }
+
+    m_colliderSDF->Resize(gridSize, gridSpacing, gridOrigin);
+
+    if (collider != nullptr)
+    {
+        const Surface3Ptr& surface = collider->GetSurface();
+
+        RebuildColliderSDF(GetImplicitSurface(surface));
 
         m_colliderVel = CustomVectorField3::Builder{}
                             .WithFunction([&](const Vector3D& x) {
@@ -321,6 +384,11 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
                             })
                             .WithDerivativeResolution(gridSpacing.x)
                             .MakeShared();
+
+        m_lastShapeRevision = collider->GetShapeRevision();
+        m_lastTransformRevision = collider->GetTransformRevision();
+        m_lastColliderBox = surface->IsBounded() ? surface->GetBoundingBox()
+                                                 : BoundingBox3D{};
     }
     else
     {
@@ -332,5 +400,205 @@ void GridFractionalBoundaryConditionSolver3::OnColliderUpdated(
                 .WithDerivativeResolution(gridSpacing.x)
                 .MakeShared();
     }
+
+    m_lastCollider = collider;
+    m_isColliderSDFValid = true;
+    m_isLocalColliderSDFValid = false;
+    m_updatedRegionBegin = Vector3UZ{};
+    m_updatedRegionEnd = m_colliderSDF->DataSize();
+}
+
+void GridFractionalBoundaryConditionSolver3::OnSaveCheckpoint(
+    const std::string& prefix, Checkpoint* checkpoint) const
+{
+    // The incrementally updated SDF depends on the path the collider has
+    // taken, so it is saved as is instead of being rebuilt when restoring.
+    checkpoint->WriteValue(prefix + "/isColliderSDFValid",
+                           m_isColliderSDFValid);
+    if (m_isColliderSDFValid)
+    {
+        checkpoint->WriteSerializable(prefix + "/colliderSDF", *m_colliderSDF);
+        checkpoint->WriteValue<uint64_t>(prefix + "/lastShapeRevision",
+                                         m_lastShapeRevision);
+        checkpoint->WriteValue<uint64_t>(prefix + "/lastTransformRevision",
+                                         m_lastTransformRevision);
+        checkpoint->WriteValue(prefix + "/lastColliderBox", m_lastColliderBox);
+    }
+
+    checkpoint->WriteValue(prefix + "/isLocalColliderSDFValid",
+                           m_isLocalColliderSDFValid);
+    if (m_isLocalColliderSDFValid)
+    {
+        checkpoint->WriteSerializable(prefix + "/localColliderSDF",
+                                      m_localColliderSDF);
+    }
+}
+
+void GridFractionalBoundaryConditionSolver3::OnLoadCheckpoint(
+    const std::string& prefix, const Checkpoint& checkpoint)
+{
+    m_isColliderSDFValid =
+        checkpoint.Value<bool>(prefix + "/isColliderSDFValid");
+    if (m_isColliderSDFValid)
+    {
+        if (m_colliderSDF == nullptr)
+        {
+            m_colliderSDF = std::make_shared<CellCenteredScalarGrid3>();
+        }
+
+        checkpoint.ReadSerializable(prefix + "/colliderSDF",
+                                    m_colliderSDF.get());
+        m_lastShapeRevision = static_cast<size_t>(
+            checkpoint.Value<uint64_t>(prefix + "/lastShapeRevision"));
+        m_lastTransformRevision = static_cast<size_t>(
+            checkpoint.Value<uint64_t>(prefix + "/lastTransformRevision"));
+        m_lastColliderBox =
+            checkpoint.Value<BoundingBox3D>(prefix + "/lastColliderBox");
+
+        m_updatedRegionBegin = Vector3UZ{};
+        m_updatedRegionEnd = m_colliderSDF->DataSize();
+    }
+
+    m_isLocalColliderSDFValid =
+        checkpoint.Value<bool>(prefix + "/isLocalColliderSDFValid");
+    if (m_isLocalColliderSDFValid)
+    {
+        checkpoint.ReadSerializable(prefix + "/localColliderSDF",
+                                    &m_localColliderSDF);
+    }
+}
+
+const Vector3UZ& GridFractionalBoundaryConditionSolver3::GetUpdatedRegionBegin()
+    const
+{
+    return m_updatedRegionBegin;
+}
+
+const Vector3UZ& GridFractionalBoundaryConditionSolver3::GetUpdatedRegionEnd()
+    const
+{
+    return m_updatedRegionEnd;
+}
+
+bool GridFractionalBoundaryConditionSolver3::IsGridChanged(
+    const Vector3UZ& gridSize, const Vector3D& gridSpacing,
+    const Vector3D& gridOrigin) const
+{
+    return m_colliderSDF->Resolution() != gridSize ||
+           m_colliderSDF->GridSpacing() != gridSpacing ||
+           m_colliderSDF->Origin() != gridOrigin;
+}
+
+void GridFractionalBoundaryConditionSolver3::RebuildColliderSDF(
+    const ImplicitSurface3Ptr& implicitSurface)
+{
+    m_colliderSDF->Fill([&](const Vector3D& pt) {
+        return implicitSurface->SignedDistance(pt);
+    });
+}
+
+void GridFractionalBoundaryConditionSolver3::UpdateSweptRegion(
+    const ImplicitSurface3Ptr& implicitSurface, const BoundingBox3D& sweptBox)
+{
+    const Vector3UZ size = m_colliderSDF->DataSize();
+    const Vector3D origin = m_colliderSDF->DataOrigin();
+    const Vector3D& h = m_colliderSDF->GridSpacing();
+
+    Vector3UZ begin;
+    Vector3UZ end;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const double lower =
+            std::floor((sweptBox.lowerCorner[i] - origin[i]) / h[i]);
+        const double upper =
+            std::ceil((sweptBox.upperCorner[i] - origin[i]) / h[i]) + 1.0;
+        const auto maxIndex = static_cast<double>(size[i]);
+
+        begin[i] = static_cast<size_t>(std::clamp(lower, 0.0, maxIndex));
+        end[i] = static_cast<size_t>(std::clamp(upper, 0.0, maxIndex));
+    }
+
+    if (begin.x >= end.x || begin.y >= end.y || begin.z >= end.z)
+    {
+        m_updatedRegionBegin = Vector3UZ{};
+        m_updatedRegionEnd = Vector3UZ{};
+        return;
+    }
+
+    const GridDataPositionFunc<3> pos = m_colliderSDF->DataPosition();
+    ArrayView3<double> sdf = m_colliderSDF->DataView();
+
+    const Collider3Ptr& collider = GetCollider();
+    if (dynamic_cast<const RigidBodyCollider3*>(collider.get()) != nullptr)
+    {
+        // Rigid transform preserves distances, so the SDF cached in the local
+        // frame of the collider can be reused after moving it.
+        BuildLocalColliderSDF(implicitSurface);
+
+        const Transform3& transform = collider->GetSurface()->transform;
+        const Vector3D localLower = m_localColliderSDF.DataOrigin();
+        const Vector3D localUpper =
+            localLower + ElemMul(m_localColliderSDF.GridSpacing(),
+                                 (m_localColliderSDF.DataSize() -
+                                  Vector3UZ{ 1, 1, 1 })
+                                     .CastTo<double>());
+        const BoundingBox3D localBox{ localLower, localUpper };
+
+        ParallelForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            const Vector3D pt = pos(i, j, k);
+            const Vector3D localPt = transform.ToLocal(pt);
+
+            if (localBox.Contains(localPt))
+            {
+                sdf(i, j, k) = m_localColliderSDF.Sample(localPt);
+            }
+            else
+            {
+                sdf(i, j, k) = implicitSurface->SignedDistance(pt);
+            }
+        });
+    }
+    else
+    {
+        ParallelForEachIndex(begin, end, [&](size_t i, size_t j, size_t k) {
+            sdf(i, j, k) = implicitSurface->SignedDistance(pos(i, j, k));
+        });
+    }
+
+    m_updatedRegionBegin = begin;
+    m_updatedRegionEnd = end;
+}
+
+void GridFractionalBoundaryConditionSolver3::BuildLocalColliderSDF(
+    const ImplicitSurface3Ptr& implicitSurface)
+{
+    if (m_isLocalColliderSDFValid)
+    {
+        return;
+    }
+
+    const Surface3Ptr& surface = GetCollider()->GetSurface();
+    const Transform3& transform = surface->transform;
+    const Vector3D& h = m_colliderSDF->GridSpacing();
+
+    BoundingBox3D localBox = transform.ToLocal(surface->GetBoundingBox());
+    localBox.Expand(SWEPT_REGION_BAND_WIDTH * h.Max());
+
+    Vector3UZ resolution;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        resolution[i] = static_cast<size_t>(
+                            std::ceil((localBox.upperCorner[i] -
+                                       localBox.lowerCorner[i]) /
+                                      h[i])) +
+                        1;
+    }
+
+    m_localColliderSDF.Resize(resolution, h, localBox.lowerCorner);
+    m_localColliderSDF.Fill([&](const Vector3D& localPt) {
+        return implicitSurface->SignedDistance(transform.ToWorld(localPt));
+    });
+
+    m_isLocalColliderSDFValid = true;
 }
 }  // namespace CubbyFlow
\ No newline at end of file
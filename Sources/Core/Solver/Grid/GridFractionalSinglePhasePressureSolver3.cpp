@@ -339,7 +339,8 @@ void BuildSingleSystem(FDMMatrix3* A, FDMVector3* b,
     });
 }
 
-void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+void BuildSingleSystem(FDMCompressedLinearSystemBuilder3* builder,
+                       FDMCompressedLinearSystem3* system,
                        const Array3<double>& fluidSDF,
                        const Array3<double>& uWeights,
                        const Array3<double>& vWeights,
@@ -355,34 +356,15 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
     const Vector3D invH = 1.0 / input.GridSpacing();
     const Vector3D invHSqr = ElemMul(invH, invH);
 
-    ConstArrayView3<double> fluidSDFAcc{ fluidSDF };
-
-    A->Clear();
-    b->Clear();
-
-    size_t numRows = 0;
-    Array3<size_t> coordToIndex{ size };
-    ForEachIndex(fluidSDF.Size(), [&](size_t i, size_t j, size_t k) {
-        const size_t cIdx = fluidSDFAcc.Index(i, j, k);
-        const double centerPhi = fluidSDF[cIdx];
-
-        if (IsInsideSDF(centerPhi))
-        {
-            coordToIndex[cIdx] = numRows++;
-        }
-    });
-
-    ForEachIndex(fluidSDF.Size(), [&](size_t i, size_t j, size_t k) {
-        const size_t cIdx = fluidSDFAcc.Index(i, j, k);
-        const double centerPhi = fluidSDF[cIdx];
-
-        if (IsInsideSDF(centerPhi))
-        {
+    builder->Build(
+        fluidSDF.Size(),
+        [&](size_t i, size_t j, size_t k) {
+            return IsInsideSDF(fluidSDF(i, j, k));
+        },
+        [&](size_t i, size_t j, size_t k, FDMStencil3& row) {
+            const double centerPhi = fluidSDF(i, j, k);
             double bijk = 0.0;
 
-            std::vector<double> row(1, 0.0);
-            std::vector<size_t> colIdx(1, coordToIndex[cIdx]);
-
             double term;
 
             if (i + 1 < size.x)
@@ -392,15 +374,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(rightPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i + 1, j, k));
+                    row.center += term;
+                    row.right -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, rightPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk += uWeights(i + 1, j, k) * input.U(i + 1, j, k) * invH.x;
@@ -417,15 +398,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(leftPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i - 1, j, k));
+                    row.center += term;
+                    row.left -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, leftPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk -= uWeights(i, j, k) * input.U(i, j, k) * invH.x;
@@ -442,15 +422,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(upPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i, j + 1, k));
+                    row.center += term;
+                    row.up -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, upPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk += vWeights(i, j + 1, k) * input.V(i, j + 1, k) * invH.y;
@@ -467,15 +446,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(downPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i, j - 1, k));
+                    row.center += term;
+                    row.down -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, downPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk -= vWeights(i, j, k) * input.V(i, j, k) * invH.y;
@@ -492,15 +470,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(frontPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i, j, k + 1));
+                    row.center += term;
+                    row.front -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, frontPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk += wWeights(i, j, k + 1) * input.W(i, j, k + 1) * invH.z;
@@ -517,15 +494,14 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
                 if (IsInsideSDF(backPhi))
                 {
-                    row[0] += term;
-                    row.push_back(-term);
-                    colIdx.push_back(coordToIndex(i, j, k - 1));
+                    row.center += term;
+                    row.back -= term;
                 }
                 else
                 {
                     double theta = FractionInsideSDF(centerPhi, backPhi);
                     theta = std::max(theta, 0.01);
-                    row[0] += term / theta;
+                    row.center += term / theta;
                 }
 
                 bijk -= wWeights(i, j, k) * input.W(i, j, k) * invH.z;
@@ -553,18 +529,15 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
 
             // If row.center is near-zero, the cell is likely inside a solid
             // boundary.
-            if (row[0] < std::numeric_limits<double>::epsilon())
+            if (row.center < std::numeric_limits<double>::epsilon())
             {
-                row[0] = 1.0;
+                row.center = 1.0;
                 bijk = 0.0;
             }
 
-            A->AddRow(row, colIdx);
-            b->AddElement(bijk);
-        }
-    });
-
-    x->Resize(b->GetRows(), 0.0);
+            return bijk;
+        },
+        system);
 }
 }  // namespace
 
@@ -582,11 +555,28 @@ void GridFractionalSinglePhasePressureSolver3::Solve(
 {
     UNUSED_VARIABLE(timeIntervalInSeconds);
 
+    if (m_useWarmStart && !m_fluidSDF.empty())
+    {
+        m_prevFluidSDF = m_fluidSDF[0];
+    }
+    else
+    {
+        m_prevFluidSDF.Clear();
+    }
+
     BuildWeights(input, boundarySDF, boundaryVelocity, fluidSDF);
     BuildSystem(input, useCompressed);
 
     if (m_systemSolver != nullptr)
     {
+        if (m_useWarmStart)
+        {
+            BuildInitialGuess(useCompressed);
+        }
+
+        const bool useInitialGuess = m_systemSolver->GetUseInitialGuess();
+        m_systemSolver->SetUseInitialGuess(useInitialGuess || m_useWarmStart);
+
         // Solve the system
         if (m_mgSystemSolver == nullptr)
         {
@@ -606,6 +596,11 @@ void GridFractionalSinglePhasePressureSolver3::Solve(
         {
             m_mgSystemSolver->Solve(&m_mgSystem);
         }
+
+        m_systemSolver->SetUseInitialGuess(useInitialGuess);
+
+        m_lastNumberOfIterations = m_systemSolver->GetLastNumberOfIterations();
+        m_lastResidual = m_systemSolver->GetLastResidual();
     }
 
     // Apply pressure gradient
@@ -654,6 +649,28 @@ const FDMVector3& GridFractionalSinglePhasePressureSolver3::GetPressure() const
     return m_mgSystem.x.levels.front();
 }
 
+bool GridFractionalSinglePhasePressureSolver3::GetUseWarmStart() const
+{
+    return m_useWarmStart;
+}
+
+void GridFractionalSinglePhasePressureSolver3::SetUseWarmStart(
+    bool useWarmStart)
+{
+    m_useWarmStart = useWarmStart;
+}
+
+unsigned int
+GridFractionalSinglePhasePressureSolver3::GetLastNumberOfIterations() const
+{
+    return m_lastNumberOfIterations;
+}
+
+double GridFractionalSinglePhasePressureSolver3::GetLastResidual() const
+{
+    return m_lastResidual;
+}
+
 void GridFractionalSinglePhasePressureSolver3::BuildWeights(
     const FaceCenteredGrid3& input, const ScalarField3& boundarySDF,
     const VectorField3& boundaryVelocity, const ScalarField3& fluidSDF)
@@ -783,17 +800,55 @@ void GridFractionalSinglePhasePressureSolver3::BuildWeights(
     }
 }
 
+void GridFractionalSinglePhasePressureSolver3::BuildInitialGuess(
+    bool useCompressed)
+{
+    const Array3<double>& fluidSDF = m_fluidSDF[0];
+    FDMVector3& pressure = (m_mgSystemSolver == nullptr)
+                               ? m_system.x
+                               : m_mgSystem.x.levels.front();
+
+    // Only the cells that stay inside the fluid keep their last pressure.
+    const bool hasPrevPressure = m_prevFluidSDF.Size() == fluidSDF.Size() &&
+                                 pressure.Size() == fluidSDF.Size();
+
+    if (useCompressed && m_mgSystemSolver == nullptr)
+    {
+        ParallelForEachIndex(
+            fluidSDF.Size(), [&](size_t i, size_t j, size_t k) {
+                if (IsInsideSDF(fluidSDF(i, j, k)))
+                {
+                    m_compSystem.x[m_compSystemBuilder.GetIndex(i, j, k)] =
+                        (hasPrevPressure &&
+                         IsInsideSDF(m_prevFluidSDF(i, j, k)))
+                            ? pressure(i, j, k)
+                            : 0.0;
+                }
+            });
+    }
+    else
+    {
+        ParallelForEachIndex(
+            fluidSDF.Size(), [&](size_t i, size_t j, size_t k) {
+                if (!hasPrevPressure || !IsInsideSDF(fluidSDF(i, j, k)) ||
+                    !IsInsideSDF(m_prevFluidSDF(i, j, k)))
+                {
+                    pressure(i, j, k) = 0.0;
+                }
+            });
+    }
+}
+
 void GridFractionalSinglePhasePressureSolver3::DecompressSolution()
 {
     ConstArrayView3<double> acc{ m_fluidSDF[0] };
     m_system.x.Resize(acc.Size());
 
-    size_t row = 0;
-    ForEachIndex(m_fluidSDF[0].Size(), [&](size_t i, size_t j, size_t k) {
+    ParallelForEachIndex(acc.Size(), [&](size_t i, size_t j, size_t k) {
         if (IsInsideSDF(acc(i, j, k)))
         {
-            m_system.x(i, j, k) = m_compSystem.x[row];
-            ++row;
+            m_system.x(i, j, k) =
+                m_compSystem.x[m_compSystemBuilder.GetIndex(i, j, k)];
         }
     });
 }
@@ -832,7 +887,7 @@ void GridFractionalSinglePhasePressureSolver3::BuildSystem(
     {
         if (useCompressed)
         {
-            BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b,
+            BuildSingleSystem(&m_compSystemBuilder, &m_compSystem,
                               m_fluidSDF[0], m_uWeights[0], m_vWeights[0],
                               m_wWeights[0], m_boundaryVel, *finer);
         }
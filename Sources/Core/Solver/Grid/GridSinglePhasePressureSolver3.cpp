@@ -13,6 +13,8 @@
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 
+#include <algorithm>
+
 namespace CubbyFlow
 {
 const char FLUID = 0;
@@ -92,7 +94,8 @@ void BuildSingleSystem(FDMMatrix3* A, FDMVector3* b,
     });
 }
 
-void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
+void BuildSingleSystem(FDMCompressedLinearSystemBuilder3* builder,
+                       FDMCompressedLinearSystem3* system,
                        const Array3<char>& markers,
                        const FaceCenteredGrid3& input)
 {
@@ -100,109 +103,93 @@ void BuildSingleSystem(MatrixCSRD* A, VectorND* x, VectorND* b,
     const Vector3D invH = 1.0 / input.GridSpacing();
     Vector3D invHSqr = ElemMul(invH, invH);
 
-    ConstArrayView3<char> markerAcc{ markers };
-
-    A->Clear();
-    b->Clear();
-
-    size_t numRows = 0;
-    Array3<size_t> coordToIndex{ size };
-    ForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
-        const size_t cIdx = markerAcc.Index(i, j, k);
-
-        if (markerAcc[cIdx] == FLUID)
-        {
-            coordToIndex[cIdx] = numRows++;
-        }
-    });
-
-    ForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
-        const size_t cIdx = markerAcc.Index(i, j, k);
-
-        if (markerAcc[cIdx] == FLUID)
-        {
-            b->AddElement(input.DivergenceAtCellCenter(i, j, k));
-
-            std::vector<double> row(1, 0.0);
-            std::vector<size_t> colIdx(1, coordToIndex[cIdx]);
-
+    builder->Build(
+        markers.Size(),
+        [&](size_t i, size_t j, size_t k) { return markers(i, j, k) == FLUID; },
+        [&](size_t i, size_t j, size_t k, FDMStencil3& row) {
             if (i + 1 < size.x && markers(i + 1, j, k) != BOUNDARY)
             {
-                row[0] += invHSqr.x;
-                const size_t rIdx = markerAcc.Index(i + 1, j, k);
-
-                if (markers[rIdx] == FLUID)
+                row.center += invHSqr.x;
+                if (markers(i + 1, j, k) == FLUID)
                 {
-                    row.push_back(-invHSqr.x);
-                    colIdx.push_back(coordToIndex[rIdx]);
+                    row.right -= invHSqr.x;
                 }
             }
 
             if (i > 0 && markers(i - 1, j, k) != BOUNDARY)
             {
-                row[0] += invHSqr.x;
-                const size_t lIdx = markerAcc.Index(i - 1, j, k);
-
-                if (markers[lIdx] == FLUID)
+                row.center += invHSqr.x;
+                if (markers(i - 1, j, k) == FLUID)
                 {
-                    row.push_back(-invHSqr.x);
-                    colIdx.push_back(coordToIndex[lIdx]);
+                    row.left -= invHSqr.x;
                 }
             }
 
             if (j + 1 < size.y && markers(i, j + 1, k) != BOUNDARY)
             {
-                row[0] += invHSqr.y;
-                const size_t uIdx = markerAcc.Index(i, j + 1, k);
-
-                if (markers[uIdx] == FLUID)
+                row.center += invHSqr.y;
+                if (markers(i, j + 1, k) == FLUID)
                 {
-                    row.push_back(-invHSqr.y);
-                    colIdx.push_back(coordToIndex[uIdx]);
+                    row.up -= invHSqr.y;
                 }
             }
 
             if (j > 0 && markers(i, j - 1, k) != BOUNDARY)
             {
-                row[0] += invHSqr.y;
-                const size_t dIdx = markerAcc.Index(i, j - 1, k);
-
-                if (markers[dIdx] == FLUID)
+                row.center += invHSqr.y;
+                if (markers(i, j - 1, k) == FLUID)
                 {
-                    row.push_back(-invHSqr.y);
-                    colIdx.push_back(coordToIndex[dIdx]);
+                    row.down -= invHSqr.y;
                 }
             }
 
             if (k + 1 < size.z && markers(i, j, k + 1) != BOUNDARY)
             {
-                row[0] += invHSqr.z;
-                const size_t fIdx = markerAcc.Index(i, j, k + 1);
-
-                if (markers[fIdx] == FLUID)
+                row.center += invHSqr.z;
+                if (markers(i, j, k + 1) == FLUID)
                 {
-                    row.push_back(-invHSqr.z);
-                    colIdx.push_back(coordToIndex[fIdx]);
+                    row.front -= invHSqr.z;
                 }
             }
 
             if (k > 0 && markers(i, j, k - 1) != BOUNDARY)
             {
-                row[0] += invHSqr.z;
-                const size_t bIdx = markerAcc.Index(i, j, k - 1);
-
-                if (markers[bIdx] == FLUID)
+                row.center += invHSqr.z;
+                if (markers(i, j, k - 1) == FLUID)
                 {
-                    row.push_back(-invHSqr.z);
-                    colIdx.push_back(coordToIndex[bIdx]);
+                    row.back -= invHSqr.z;
                 }
             }
 
-            A->AddRow(row, colIdx);
-        }
+            return input.DivergenceAtCellCenter(i, j, k);
+        },
+        system);
+}
+
+void BuildSingleRhs(FDMVector3* b, const Array3<char>& markers,
+                    const FaceCenteredGrid3& input)
+{
+    ParallelForEachIndex(b->Size(), [&](size_t i, size_t j, size_t k) {
+        (*b)(i, j, k) = (markers(i, j, k) == FLUID)
+                            ? input.DivergenceAtCellCenter(i, j, k)
+                            : 0.0;
     });
+}
 
-    x->Resize(b->GetRows(), 0.0);
+void BuildSingleRhs(VectorND* b,
+                    const FDMCompressedLinearSystemBuilder3& builder,
+                    const FaceCenteredGrid3& input)
+{
+    const Array3<size_t>& coordToIndex = builder.GetCoordToIndex();
+
+    ParallelForEachIndex(
+        coordToIndex.Size(), [&](size_t i, size_t j, size_t k) {
+            const size_t row = coordToIndex(i, j, k);
+            if (row != FDMCompressedLinearSystemBuilder3::INVALID_INDEX)
+            {
+                (*b)[row] = input.DivergenceAtCellCenter(i, j, k);
+            }
+        });
 }
 }  // namespace
 
@@ -224,11 +211,44 @@ void GridSinglePhasePressureSolver3::Solve(const FaceCenteredGrid3& input,
 
     const GridDataPositionFunc<3> pos = input.CellCenterPosition();
 
+    if (m_useWarmStart && !m_markers.empty())
+    {
+        m_prevMarkers = m_markers[0];
+    }
+    else
+    {
+        m_prevMarkers.Clear();
+    }
+
     BuildMarkers(input.Resolution(), pos, boundarySDF, fluidSDF);
+
+    m_isLastSystemReused = m_useWarmStart && m_mgSystemSolver == nullptr &&
+                           IsSystemReusable(input, useCompressed);
+
     BuildSystem(input, useCompressed);
 
+    if (!m_useWarmStart || m_mgSystemSolver != nullptr)
+    {
+        m_systemLayout = SystemLayout::None;
+    }
+    else if (!m_isLastSystemReused)
+    {
+        m_systemLayout = GetSystemLayout(useCompressed);
+        m_systemMarkers.CopyFrom(m_markers[0]);
+        m_systemGridSpacing = input.GridSpacing();
+    }
+
     if (m_systemSolver != nullptr)
     {
+        if (m_useWarmStart)
+        {
+            BuildInitialGuess(useCompressed);
+        }
+
+        const bool useInitialGuess = m_systemSolver->GetUseInitialGuess();
+        m_systemSolver->SetUseInitialGuess(useInitialGuess || m_useWarmStart);
+        m_systemSolver->SetReusePreconditioner(m_isLastSystemReused);
+
         // Solve the system
         if (m_mgSystemSolver == nullptr)
         {
@@ -238,6 +258,11 @@ void GridSinglePhasePressureSolver3::Solve(const FaceCenteredGrid3& input,
                 m_systemSolver->SolveCompressed(&m_compSystem);
                 DecompressSolution();
             }
+            else if (IsMatrixFree(useCompressed))
+            {
+                m_compSystem.Clear();
+                SolveMatrixFree(input);
+            }
             else
             {
                 m_compSystem.Clear();
@@ -249,6 +274,12 @@ void GridSinglePhasePressureSolver3::Solve(const FaceCenteredGrid3& input,
             m_mgSystemSolver->Solve(&m_mgSystem);
         }
 
+        m_systemSolver->SetUseInitialGuess(useInitialGuess);
+        m_systemSolver->SetReusePreconditioner(false);
+
+        m_lastNumberOfIterations = m_systemSolver->GetLastNumberOfIterations();
+        m_lastResidual = m_systemSolver->GetLastResidual();
+
         // Apply pressure gradient
         ApplyPressureGradient(input, output);
     }
@@ -271,6 +302,7 @@ void GridSinglePhasePressureSolver3::SetLinearSystemSolver(
 {
     m_systemSolver = solver;
     m_mgSystemSolver = std::dynamic_pointer_cast<FDMMGSolver3>(m_systemSolver);
+    m_systemLayout = SystemLayout::None;
 
     if (m_mgSystemSolver == nullptr)
     {
@@ -295,6 +327,41 @@ const FDMVector3& GridSinglePhasePressureSolver3::GetPressure() const
     return m_mgSystem.x.levels.front();
 }
 
+bool GridSinglePhasePressureSolver3::GetUseWarmStart() const
+{
+    return m_useWarmStart;
+}
+
+void GridSinglePhasePressureSolver3::SetUseWarmStart(bool useWarmStart)
+{
+    m_useWarmStart = useWarmStart;
+}
+
+bool GridSinglePhasePressureSolver3::GetUseMatrixFree() const
+{
+    return m_useMatrixFree;
+}
+
+void GridSinglePhasePressureSolver3::SetUseMatrixFree(bool useMatrixFree)
+{
+    m_useMatrixFree = useMatrixFree;
+}
+
+unsigned int GridSinglePhasePressureSolver3::GetLastNumberOfIterations() const
+{
+    return m_lastNumberOfIterations;
+}
+
+double GridSinglePhasePressureSolver3::GetLastResidual() const
+{
+    return m_lastResidual;
+}
+
+bool GridSinglePhasePressureSolver3::IsLastSystemReused() const
+{
+    return m_isLastSystemReused;
+}
+
 void GridSinglePhasePressureSolver3::BuildMarkers(
     const Vector3UZ& size,
     const std::function<Vector3D(size_t, size_t, size_t)>& pos,
@@ -399,21 +466,108 @@ void GridSinglePhasePressureSolver3::BuildMarkers(
     }
 }
 
+GridSinglePhasePressureSolver3::SystemLayout
+GridSinglePhasePressureSolver3::GetSystemLayout(bool useCompressed) const
+{
+    if (useCompressed)
+    {
+        return SystemLayout::Compressed;
+    }
+
+    return IsMatrixFree(useCompressed) ? SystemLayout::MatrixFree
+                                       : SystemLayout::Uncompressed;
+}
+
+bool GridSinglePhasePressureSolver3::IsSystemReusable(
+    const FaceCenteredGrid3& input, bool useCompressed) const
+{
+    const Array3<char>& markers = m_markers[0];
+
+    // The kept matrix must have been built for this layout from the same
+    // markers; a changed collider or fluid shows up as changed markers.
+    if (m_systemLayout == SystemLayout::None ||
+        m_systemLayout != GetSystemLayout(useCompressed) ||
+        m_systemMarkers.Size() != markers.Size() ||
+        m_systemGridSpacing != input.GridSpacing())
+    {
+        return false;
+    }
+
+    return std::equal(markers.begin(), markers.end(), m_systemMarkers.begin());
+}
+
+void GridSinglePhasePressureSolver3::BuildInitialGuess(bool useCompressed)
+{
+    const Array3<char>& markers = m_markers[0];
+    FDMVector3& pressure = (m_mgSystemSolver == nullptr)
+                               ? m_system.x
+                               : m_mgSystem.x.levels.front();
+
+    // Only the cells that stay in the fluid keep their last pressure.
+    const bool hasPrevPressure = m_prevMarkers.Size() == markers.Size() &&
+                                 pressure.Size() == markers.Size();
+
+    if (useCompressed && m_mgSystemSolver == nullptr)
+    {
+        ParallelForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
+            if (markers(i, j, k) == FLUID)
+            {
+                m_compSystem.x[m_compSystemBuilder.GetIndex(i, j, k)] =
+                    (hasPrevPressure && m_prevMarkers(i, j, k) == FLUID)
+                        ? pressure(i, j, k)
+                        : 0.0;
+            }
+        });
+    }
+    else
+    {
+        ParallelForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
+            if (!hasPrevPressure || markers(i, j, k) != FLUID ||
+                m_prevMarkers(i, j, k) != FLUID)
+            {
+                pressure(i, j, k) = 0.0;
+            }
+        });
+    }
+}
+
 void GridSinglePhasePressureSolver3::DecompressSolution()
 {
     ConstArrayView3<char> acc{ m_markers[0] };
     m_system.x.Resize(acc.Size());
 
-    size_t row = 0;
-    ForEachIndex(m_markers[0].Size(), [&](size_t i, size_t j, size_t k) {
+    ParallelForEachIndex(acc.Size(), [&](size_t i, size_t j, size_t k) {
         if (acc(i, j, k) == FLUID)
         {
-            m_system.x(i, j, k) = m_compSystem.x[row];
-            ++row;
+            m_system.x(i, j, k) =
+                m_compSystem.x[m_compSystemBuilder.GetIndex(i, j, k)];
         }
     });
 }
 
+bool GridSinglePhasePressureSolver3::IsMatrixFree(bool useCompressed) const
+{
+    return m_useMatrixFree && !useCompressed && m_mgSystemSolver == nullptr;
+}
+
+void GridSinglePhasePressureSolver3::SolveMatrixFree(
+    const FaceCenteredGrid3& input)
+{
+    const Vector3D invH = 1.0 / input.GridSpacing();
+    m_matrixFreeSystem.A.invGridSpacingSqr = ElemMul(invH, invH);
+
+    // Lend the markers and the vectors to the matrix-free system.
+    m_matrixFreeSystem.A.markers.Swap(m_markers[0]);
+    m_matrixFreeSystem.x.Swap(m_system.x);
+    m_matrixFreeSystem.b.Swap(m_system.b);
+
+    m_systemSolver->SolveMatrixFree(&m_matrixFreeSystem);
+
+    m_matrixFreeSystem.A.markers.Swap(m_markers[0]);
+    m_matrixFreeSystem.x.Swap(m_system.x);
+    m_matrixFreeSystem.b.Swap(m_system.b);
+}
+
 void GridSinglePhasePressureSolver3::BuildSystem(const FaceCenteredGrid3& input,
                                                  bool useCompressed)
 {
@@ -422,7 +576,21 @@ void GridSinglePhasePressureSolver3::BuildSystem(const FaceCenteredGrid3& input,
 
     if (m_mgSystemSolver == nullptr)
     {
-        if (!useCompressed)
+        if (IsMatrixFree(useCompressed))
+        {
+            // The matrix is evaluated from the markers on the fly.
+            m_system.A.Clear();
+
+            if (m_system.x.Size() != size || m_system.b.Size() != size)
+            {
+                m_system.x.Resize(size);
+                m_system.b.Resize(size);
+            }
+        }
+        // Keep the storage if possible so that the matrix can be reused.
+        else if (!useCompressed &&
+                 (m_system.A.Size() != size || m_system.x.Size() != size ||
+                  m_system.b.Size() != size))
         {
             m_system.Resize(size);
         }
@@ -446,10 +614,21 @@ void GridSinglePhasePressureSolver3::BuildSystem(const FaceCenteredGrid3& input,
     const FaceCenteredGrid3* finer = &input;
     if (m_mgSystemSolver == nullptr)
     {
-        if (useCompressed)
+        if (m_isLastSystemReused || IsMatrixFree(useCompressed))
+        {
+            if (useCompressed)
+            {
+                BuildSingleRhs(&m_compSystem.b, m_compSystemBuilder, *finer);
+            }
+            else
+            {
+                BuildSingleRhs(&m_system.b, m_markers[0], *finer);
+            }
+        }
+        else if (useCompressed)
         {
-            BuildSingleSystem(&m_compSystem.A, &m_compSystem.x, &m_compSystem.b,
-                              m_markers[0], *finer);
+            BuildSingleSystem(&m_compSystemBuilder, &m_compSystem, m_markers[0],
+                              *finer);
         }
         else
         {
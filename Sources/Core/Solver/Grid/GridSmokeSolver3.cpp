@@ -8,11 +8,39 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Field/CustomScalarField.hpp>
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/Grid/GridSmokeSolver3.hpp>
+#include <Core/Utils/Logging.hpp>
+#include <Core/Utils/TaskGraph.hpp>
 
 namespace CubbyFlow
 {
+static const size_t ACTIVE_TILE_SIZE = 8;
+
+template <typename Callback>
+void GridSmokeSolver3::ParallelForEachActiveIndex(const Vector3UZ& size,
+                                                  const Callback& func) const
+{
+    const Vector3UZ res = GetResolution();
+
+    ParallelFor(ZERO_SIZE, m_activeTiles.Length(), [&](size_t n) {
+        const Vector3UZ& begin = m_activeTiles[n];
+        Vector3UZ end;
+
+        // The last tiles along each axis also cover the extra face-centered
+        // data points.
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            end[axis] = begin[axis] + ACTIVE_TILE_SIZE >= res[axis]
+                            ? size[axis]
+                            : begin[axis] + ACTIVE_TILE_SIZE;
+        }
+
+        ForEachIndex(begin, end, func);
+    });
+}
+
 GridSmokeSolver3::GridSmokeSolver3()
     : GridSmokeSolver3{ { 1, 1, 1 }, { 1, 1, 1 }, { 0, 0, 0 } }
 {
@@ -91,6 +119,62 @@ void GridSmokeSolver3::SetTemperatureDecayFactor(double newValue)
     m_temperatureDecayFactor = std::clamp(newValue, 0.0, 1.0);
 }
 
+bool GridSmokeSolver3::GetUseActiveRegion() const
+{
+    return m_useActiveRegion;
+}
+
+void GridSmokeSolver3::SetUseActiveRegion(bool isOn)
+{
+    m_useActiveRegion = isOn;
+
+    if (!m_useActiveRegion)
+    {
+        m_activeTiles.Clear();
+    }
+}
+
+double GridSmokeSolver3::GetActiveRegionThreshold() const
+{
+    return m_activeRegionThreshold;
+}
+
+void GridSmokeSolver3::SetActiveRegionThreshold(double newValue)
+{
+    m_activeRegionThreshold = std::max(newValue, 0.0);
+}
+
+bool GridSmokeSolver3::GetUseActiveRegionForPressure() const
+{
+    return m_useActiveRegionForPressure;
+}
+
+void GridSmokeSolver3::SetUseActiveRegionForPressure(bool isOn)
+{
+    m_useActiveRegionForPressure = isOn;
+}
+
+size_t GridSmokeSolver3::GetNumberOfActiveTiles() const
+{
+    return m_activeTiles.Length();
+}
+
+BoundingBox3D GridSmokeSolver3::GetActiveRegion() const
+{
+    if (m_activeTiles.Length() == 0)
+    {
+        return BoundingBox3D{};
+    }
+
+    const Vector3D h = GetGridSpacing();
+    const Vector3D origin = GetGridOrigin();
+
+    return BoundingBox3D{
+        origin + ElemMul(h, m_activeRegionLower.CastTo<double>()),
+        origin + ElemMul(h, m_activeRegionUpper.CastTo<double>())
+    };
+}
+
 ScalarGrid3Ptr GridSmokeSolver3::GetSmokeDensity() const
 {
     return GetGridSystemData()->AdvectableScalarDataAt(m_smokeDensityDataID);
@@ -101,6 +185,16 @@ ScalarGrid3Ptr GridSmokeSolver3::GetTemperature() const
     return GetGridSystemData()->AdvectableScalarDataAt(m_temperatureDataID);
 }
 
+void GridSmokeSolver3::OnBeginAdvanceTimeStep(double timeIntervalInSeconds)
+{
+    UNUSED_VARIABLE(timeIntervalInSeconds);
+
+    if (m_useActiveRegion)
+    {
+        UpdateActiveRegion();
+    }
+}
+
 void GridSmokeSolver3::OnEndAdvanceTimeStep(double timeIntervalInSeconds)
 {
     ComputeDiffusion(timeIntervalInSeconds);
@@ -111,47 +205,130 @@ void GridSmokeSolver3::ComputeExternalForces(double timeIntervalInSeconds)
     ComputeBuoyancyForce(timeIntervalInSeconds);
 }
 
+void GridSmokeSolver3::ComputeScalarAdvection(const ScalarGrid3& input,
+                                              double timeIntervalInSeconds,
+                                              ScalarGrid3* output)
+{
+    const GridSystemData3Ptr grids = GetGridSystemData();
+
+    if (m_useActiveRegion &&
+        (output == grids->AdvectableScalarDataAt(m_smokeDensityDataID).get() ||
+         output == grids->AdvectableScalarDataAt(m_temperatureDataID).get()))
+    {
+        GetAdvectionSolver()->AdvectTiles(
+            input, *GetVelocity(), timeIntervalInSeconds, m_activeTiles,
+            Vector3UZ{ ACTIVE_TILE_SIZE, ACTIVE_TILE_SIZE, ACTIVE_TILE_SIZE },
+            output, *GetColliderSDF());
+    }
+    else
+    {
+        GridFluidSolver3::ComputeScalarAdvection(input, timeIntervalInSeconds,
+                                                 output);
+    }
+}
+
+ScalarField3Ptr GridSmokeSolver3::GetFluidSDF() const
+{
+    if (m_useActiveRegion && m_useActiveRegionForPressure)
+    {
+        return GetActiveRegionSDF();
+    }
+
+    return GridFluidSolver3::GetFluidSDF();
+}
+
 void GridSmokeSolver3::ComputeDiffusion(double timeIntervalInSeconds)
 {
-    if (GetDiffusionSolver() != nullptr)
+    const GridDiffusionSolver3Ptr& diffusionSolver = GetDiffusionSolver();
+    const ScalarGrid3Ptr den = GetSmokeDensity();
+    const ScalarGrid3Ptr temp = GetTemperature();
+
+    ScalarField3Ptr fluidSDF;
+    if (diffusionSolver != nullptr)
+    {
+        fluidSDF = m_useActiveRegion ? GetActiveRegionSDF()
+                                     : GridFluidSolver3::GetFluidSDF();
+    }
+
+    auto diffuse = [&](const ScalarGrid3Ptr& grid, double coefficient) {
+        CopyGrid(*grid, &m_diffusionInput);
+
+        diffusionSolver->Solve(*m_diffusionInput, coefficient,
+                               timeIntervalInSeconds, grid.get(),
+                               *GetColliderSDF(), *fluidSDF);
+    };
+
+    // The diffusion solver keeps per-solve state, so the two solves stay
+    // ordered. The extrapolation and the decay of one field overlap with the
+    // diffusion of the other.
+    TaskGraph graph;
+    std::vector<TaskGraph::TaskID> lastSolve;
+    std::vector<TaskGraph::TaskID> denDependencies;
+    std::vector<TaskGraph::TaskID> tempDependencies;
+
+    if (diffusionSolver != nullptr)
     {
         if (m_smokeDiffusionCoefficient >
             std::numeric_limits<double>::epsilon())
         {
-            const ScalarGrid3Ptr den = GetSmokeDensity();
-            const std::shared_ptr<CellCenteredScalarGrid3> den0 =
-                std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
-                    den->Clone());
-
-            GetDiffusionSolver()->Solve(*den0, m_smokeDiffusionCoefficient,
-                                        timeIntervalInSeconds, den.get(),
-                                        *GetColliderSDF());
-            ExtrapolateIntoCollider(den.get());
+            const TaskGraph::TaskID solve = graph.AddTask(
+                [&]() { diffuse(den, m_smokeDiffusionCoefficient); });
+            denDependencies.push_back(graph.AddTask(
+                [&]() { ExtrapolateIntoCollider(den.get()); }, { solve }));
+            lastSolve.push_back(solve);
         }
 
         if (m_temperatureDiffusionCoefficient >
             std::numeric_limits<double>::epsilon())
         {
-            const ScalarGrid3Ptr temp = GetTemperature();
-            const std::shared_ptr<CellCenteredScalarGrid3> temp0 =
-                std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
-                    temp->Clone());
-
-            GetDiffusionSolver()->Solve(
-                *temp0, m_temperatureDiffusionCoefficient,
-                timeIntervalInSeconds, temp.get(), *GetColliderSDF());
-            ExtrapolateIntoCollider(temp.get());
+            const TaskGraph::TaskID solve = graph.AddTask(
+                [&]() { diffuse(temp, m_temperatureDiffusionCoefficient); },
+                lastSolve);
+            tempDependencies.push_back(graph.AddTask(
+                [&]() { ExtrapolateIntoCollider(temp.get()); }, { solve }));
         }
     }
 
-    ScalarGrid3Ptr den = GetSmokeDensity();
-    den->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
-        (*den)(i, j, k) *= 1.0 - m_smokeDecayFactor;
-    });
-    ScalarGrid3Ptr temp = GetTemperature();
-    temp->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
-        (*temp)(i, j, k) *= 1.0 - m_temperatureDecayFactor;
-    });
+    if (m_useActiveRegion)
+    {
+        std::vector<TaskGraph::TaskID> dependencies = denDependencies;
+        dependencies.insert(dependencies.end(), tempDependencies.begin(),
+                            tempDependencies.end());
+
+        graph.AddTask(
+            [&]() {
+                ArrayView3<double> denAcc = den->DataView();
+                ArrayView3<double> tempAcc = temp->DataView();
+
+                ParallelForEachActiveIndex(
+                    den->DataSize(), [&](size_t i, size_t j, size_t k) {
+                        denAcc(i, j, k) *= 1.0 - m_smokeDecayFactor;
+                        tempAcc(i, j, k) *= 1.0 - m_temperatureDecayFactor;
+                    });
+            },
+            dependencies);
+    }
+    else
+    {
+        graph.AddTask(
+            [&]() {
+                den->ParallelForEachDataPointIndex(
+                    [&](size_t i, size_t j, size_t k) {
+                        (*den)(i, j, k) *= 1.0 - m_smokeDecayFactor;
+                    });
+            },
+            denDependencies);
+        graph.AddTask(
+            [&]() {
+                temp->ParallelForEachDataPointIndex(
+                    [&](size_t i, size_t j, size_t k) {
+                        (*temp)(i, j, k) *= 1.0 - m_temperatureDecayFactor;
+                    });
+            },
+            tempDependencies);
+    }
+
+    graph.Run();
 }
 
 void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
@@ -174,8 +351,31 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
         ScalarGrid3Ptr temp = GetTemperature();
 
         double tAmb = 0.0;
-        temp->ForEachCellIndex(
-            [&](size_t i, size_t j, size_t k) { tAmb += (*temp)(i, j, k); });
+        if (m_useActiveRegion)
+        {
+            // The cells outside of the active tiles have negligible
+            // temperature, so they are left out of the sum. The sum is still
+            // averaged over the entire grid, which keeps the ambient
+            // temperature the same as without the active region.
+            ConstArrayView3<double> tempAcc = temp->DataView();
+            for (const Vector3UZ& tile : m_activeTiles)
+            {
+                const Vector3UZ end =
+                    Min(tile + Vector3UZ{ ACTIVE_TILE_SIZE, ACTIVE_TILE_SIZE,
+                                          ACTIVE_TILE_SIZE },
+                        temp->Resolution());
+
+                ForEachIndex(tile, end, [&](size_t i, size_t j, size_t k) {
+                    tAmb += tempAcc(i, j, k);
+                });
+            }
+        }
+        else
+        {
+            temp->ForEachCellIndex([&](size_t i, size_t j, size_t k) {
+                tAmb += (*temp)(i, j, k);
+            });
+        }
 
         tAmb /= static_cast<double>(
             temp->Resolution().x * temp->Resolution().y * temp->Resolution().z);
@@ -187,9 +387,26 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
         auto vPos = vel->VPosition();
         auto wPos = vel->WPosition();
 
+        const auto forEachIndex = [&](const Vector3UZ& size,
+                                      const auto& func) {
+            if (m_useActiveRegion)
+            {
+                ParallelForEachActiveIndex(
+                    size, [&](size_t i, size_t j, size_t k) {
+                        func(Vector3UZ{ i, j, k });
+                    });
+            }
+            else
+            {
+                ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+                    func(Vector3UZ{ i, j, k });
+                });
+            }
+        };
+
         if (std::abs(up.x) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachUIndex([&](const Vector3UZ& idx) {
+            forEachIndex(vel->USize(), [&](const Vector3UZ& idx) {
                 const Vector3D pt = uPos(idx);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
@@ -200,7 +417,7 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
 
         if (std::abs(up.y) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachVIndex([&](const Vector3UZ& idx) {
+            forEachIndex(vel->VSize(), [&](const Vector3UZ& idx) {
                 const Vector3D pt = vPos(idx);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
@@ -211,7 +428,7 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
 
         if (std::abs(up.z) > std::numeric_limits<double>::epsilon())
         {
-            vel->ParallelForEachWIndex([&](const Vector3UZ& idx) {
+            forEachIndex(vel->WSize(), [&](const Vector3UZ& idx) {
                 const Vector3D pt = wPos(idx);
                 const double fBuoy =
                     m_buoyancySmokeDensityFactor * den->Sample(pt) +
@@ -224,6 +441,105 @@ void GridSmokeSolver3::ComputeBuoyancyForce(double timeIntervalInSeconds)
     }
 }
 
+void GridSmokeSolver3::UpdateActiveRegion()
+{
+    const Vector3UZ res = GetResolution();
+    const Vector3UZ tileRes{
+        (res.x + ACTIVE_TILE_SIZE - 1) / ACTIVE_TILE_SIZE,
+        (res.y + ACTIVE_TILE_SIZE - 1) / ACTIVE_TILE_SIZE,
+        (res.z + ACTIVE_TILE_SIZE - 1) / ACTIVE_TILE_SIZE
+    };
+    const Vector3UZ tileSize{ ACTIVE_TILE_SIZE, ACTIVE_TILE_SIZE,
+                              ACTIVE_TILE_SIZE };
+
+    ConstArrayView3<double> den = GetSmokeDensity()->DataView();
+    ConstArrayView3<double> temp = GetTemperature()->DataView();
+
+    // Find the tiles with non-negligible smoke
+    Array3<char> seeds{ tileRes, 0 };
+    ParallelForEachIndex(tileRes, [&](size_t ti, size_t tj, size_t tk) {
+        const Vector3UZ begin = ElemMul(Vector3UZ{ ti, tj, tk }, tileSize);
+        const Vector3UZ end = Min(begin + tileSize, res);
+
+        for (size_t k = begin.z; k < end.z; ++k)
+        {
+            for (size_t j = begin.y; j < end.y; ++j)
+            {
+                for (size_t i = begin.x; i < end.x; ++i)
+                {
+                    if (std::abs(den(i, j, k)) > m_activeRegionThreshold ||
+                        std::abs(temp(i, j, k)) > m_activeRegionThreshold)
+                    {
+                        seeds(ti, tj, tk) = 1;
+                        return;
+                    }
+                }
+            }
+        }
+    });
+
+    // Dilate the tiles so that the smoke cannot be advected out of them
+    // within a sub-step.
+    const size_t radius =
+        (static_cast<size_t>(std::ceil(GetMaxCFL())) + ACTIVE_TILE_SIZE) /
+        ACTIVE_TILE_SIZE;
+
+    m_activeTileMarkers.Resize(tileRes);
+    ParallelForEachIndex(tileRes, [&](size_t ti, size_t tj, size_t tk) {
+        const Vector3UZ lower{ ti > radius ? ti - radius : 0,
+                               tj > radius ? tj - radius : 0,
+                               tk > radius ? tk - radius : 0 };
+        const Vector3UZ upper =
+            Min(Vector3UZ{ ti + radius + 1, tj + radius + 1, tk + radius + 1 },
+                tileRes);
+
+        char isActive = 0;
+        ForEachIndex(lower, upper, [&](size_t i, size_t j, size_t k) {
+            isActive |= seeds(i, j, k);
+        });
+
+        m_activeTileMarkers(ti, tj, tk) = isActive;
+    });
+
+    m_activeTiles.Clear();
+    m_activeRegionLower = res;
+    m_activeRegionUpper = Vector3UZ{};
+
+    ForEachIndex(tileRes, [&](size_t ti, size_t tj, size_t tk) {
+        if (m_activeTileMarkers(ti, tj, tk) == 1)
+        {
+            const Vector3UZ begin = ElemMul(Vector3UZ{ ti, tj, tk }, tileSize);
+            const Vector3UZ end = Min(begin + tileSize, res);
+
+            m_activeTiles.Append(begin);
+            m_activeRegionLower = Min(m_activeRegionLower, begin);
+            m_activeRegionUpper = Max(m_activeRegionUpper, end);
+        }
+    });
+
+    CUBBYFLOW_INFO << "Number of active tiles: " << m_activeTiles.Length()
+                   << " / " << m_activeTileMarkers.Length();
+}
+
+ScalarField3Ptr GridSmokeSolver3::GetActiveRegionSDF() const
+{
+    if (m_activeTiles.Length() == 0)
+    {
+        return std::make_shared<ConstantScalarField3>(
+            std::numeric_limits<double>::max());
+    }
+
+    const BoundingBox3D region = GetActiveRegion();
+
+    return std::make_shared<CustomScalarField3>([region](const Vector3D& x) {
+        // Signed distance to the axis-aligned box
+        const Vector3D q = Max(region.lowerCorner - x, x - region.upperCorner);
+        const Vector3D outside = Max(q, Vector3D{});
+
+        return outside.Length() + std::min(q.Max(), 0.0);
+    });
+}
+
 GridSmokeSolver3::Builder GridSmokeSolver3::GetBuilder()
 {
     return Builder{};
@@ -49,8 +49,8 @@ void APICSolver2::TransferFromParticlesToGrids()
     const auto vPos = flow->VPosition();
     Array2<double> uWeight{ u.Size() };
     Array2<double> vWeight{ v.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
+    m_uMarkers.ResizeUninitialized(u.Size());
+    m_vMarkers.ResizeUninitialized(v.Size());
     m_uMarkers.Fill(0);
     m_vMarkers.Fill(0);
 
@@ -120,8 +120,8 @@ void APICSolver2::TransferFromGridsToParticles()
     const BoundingBox2D& bbox = flow->GetBoundingBox();
 
     // Allocate buffers
-    m_cX.Resize(numberOfParticles);
-    m_cY.Resize(numberOfParticles);
+    m_cX.ResizeUninitialized(numberOfParticles);
+    m_cY.ResizeUninitialized(numberOfParticles);
     m_cX.Fill(Vector2D{});
     m_cY.Fill(Vector2D{});
 
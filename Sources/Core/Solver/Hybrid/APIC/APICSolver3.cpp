@@ -51,12 +51,13 @@ void APICSolver3::TransferFromParticlesToGrids()
     const auto uPos = flow->UPosition();
     const auto vPos = flow->VPosition();
     const auto wPos = flow->WPosition();
-    Array3<double> uWeight{ u.Size() };
-    Array3<double> vWeight{ v.Size() };
-    Array3<double> wWeight{ w.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
-    m_wMarkers.Resize(w.Size());
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> uWeight = m_scratchArena.Acquire(u.Size(), 0.0);
+    ArrayView3<double> vWeight = m_scratchArena.Acquire(v.Size(), 0.0);
+    ArrayView3<double> wWeight = m_scratchArena.Acquire(w.Size(), 0.0);
+    m_uMarkers.ResizeUninitialized(u.Size());
+    m_vMarkers.ResizeUninitialized(v.Size());
+    m_wMarkers.ResizeUninitialized(w.Size());
     m_uMarkers.Fill(0);
     m_vMarkers.Fill(0);
     m_wMarkers.Fill(0);
@@ -156,9 +157,9 @@ void APICSolver3::TransferFromGridsToParticles()
     const BoundingBox3D& bbox = flow->GetBoundingBox();
 
     // Allocate buffers
-    m_cX.Resize(numberOfParticles);
-    m_cY.Resize(numberOfParticles);
-    m_cZ.Resize(numberOfParticles);
+    m_cX.ResizeUninitialized(numberOfParticles);
+    m_cY.ResizeUninitialized(numberOfParticles);
+    m_cZ.ResizeUninitialized(numberOfParticles);
     m_cX.Fill(Vector3D{});
     m_cY.Fill(Vector3D{});
     m_cZ.Fill(Vector3D{});
@@ -224,6 +225,26 @@ void APICSolver3::TransferFromGridsToParticles()
     });
 }
 
+void APICSolver3::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    PICSolver3::OnSaveCheckpoint(checkpoint);
+
+    // The affine velocities are computed at the end of a time-step and used
+    // at the beginning of the next one, so they are a part of the state.
+    checkpoint->Write("solver/cX", m_cX.View());
+    checkpoint->Write("solver/cY", m_cY.View());
+    checkpoint->Write("solver/cZ", m_cZ.View());
+}
+
+void APICSolver3::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    PICSolver3::OnLoadCheckpoint(checkpoint);
+
+    checkpoint.Read("solver/cX", &m_cX);
+    checkpoint.Read("solver/cY", &m_cY);
+    checkpoint.Read("solver/cZ", &m_cZ);
+}
+
 APICSolver3::Builder APICSolver3::GetBuilder()
 {
     return Builder{};
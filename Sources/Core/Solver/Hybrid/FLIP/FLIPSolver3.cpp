@@ -112,6 +112,20 @@ void FLIPSolver3::TransferFromGridsToParticles()
     });
 }
 
+void FLIPSolver3::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    PICSolver3::OnSaveCheckpoint(checkpoint);
+
+    checkpoint->WriteValue("solver/picBlendingFactor", m_picBlendingFactor);
+}
+
+void FLIPSolver3::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    PICSolver3::OnLoadCheckpoint(checkpoint);
+
+    m_picBlendingFactor = checkpoint.Value<double>("solver/picBlendingFactor");
+}
+
 FLIPSolver3::Builder FLIPSolver3::GetBuilder()
 {
     return Builder{};
@@ -131,8 +131,8 @@ void PICSolver2::TransferFromParticlesToGrids()
     ArrayView2<double> v = flow->VView();
     Array2<double> uWeight{ u.Size() };
     Array2<double> vWeight{ v.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
+    m_uMarkers.ResizeUninitialized(u.Size());
+    m_vMarkers.ResizeUninitialized(v.Size());
     m_uMarkers.Fill(0);
     m_vMarkers.Fill(0);
 
@@ -10,6 +10,7 @@
 
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Particle/ParticleKernels.hpp>
 #include <Core/Solver/Hybrid/PIC/PICSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Timer.hpp>
@@ -53,6 +54,11 @@ void PICSolver3::SetParticleEmitter(const ParticleEmitter3Ptr& newEmitter)
     newEmitter->SetTarget(m_particles);
 }
 
+const ScratchArena& PICSolver3::GetScratchArena() const
+{
+    return m_scratchArena;
+}
+
 void PICSolver3::OnInitialize()
 {
     GridFluidSolver3::OnInitialize();
@@ -133,12 +139,13 @@ void PICSolver3::TransferFromParticlesToGrids()
     ArrayView3<double> u = flow->UView();
     ArrayView3<double> v = flow->VView();
     ArrayView3<double> w = flow->WView();
-    Array3<double> uWeight{ u.Size() };
-    Array3<double> vWeight{ v.Size() };
-    Array3<double> wWeight{ w.Size() };
-    m_uMarkers.Resize(u.Size());
-    m_vMarkers.Resize(v.Size());
-    m_wMarkers.Resize(w.Size());
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> uWeight = m_scratchArena.Acquire(u.Size(), 0.0);
+    ArrayView3<double> vWeight = m_scratchArena.Acquire(v.Size(), 0.0);
+    ArrayView3<double> wWeight = m_scratchArena.Acquire(w.Size(), 0.0);
+    m_uMarkers.ResizeUninitialized(u.Size());
+    m_vMarkers.ResizeUninitialized(v.Size());
+    m_wMarkers.ResizeUninitialized(w.Size());
     m_uMarkers.Fill(0);
     m_vMarkers.Fill(0);
     m_wMarkers.Fill(0);
@@ -223,7 +230,6 @@ void PICSolver3::MoveParticles(double timeIntervalInSeconds)
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
         Vector3D pt0 = positions[i];
         Vector3D pt1 = pt0;
-        Vector3D vel = velocities[i];
 
         // Adaptive time-stepping
         const unsigned int numSubSteps =
@@ -241,47 +247,11 @@ void PICSolver3::MoveParticles(double timeIntervalInSeconds)
             pt0 = pt1;
         }
 
-        if ((domainBoundaryFlag & DIRECTION_LEFT) &&
-            pt1.x <= boundingBox.lowerCorner.x)
-        {
-            pt1.x = boundingBox.lowerCorner.x;
-            vel.x = 0.0;
-        }
-        if ((domainBoundaryFlag & DIRECTION_RIGHT) &&
-            pt1.x >= boundingBox.upperCorner.x)
-        {
-            pt1.x = boundingBox.upperCorner.x;
-            vel.x = 0.0;
-        }
-        if ((domainBoundaryFlag & DIRECTION_DOWN) &&
-            pt1.y <= boundingBox.lowerCorner.y)
-        {
-            pt1.y = boundingBox.lowerCorner.y;
-            vel.y = 0.0;
-        }
-        if ((domainBoundaryFlag & DIRECTION_UP) &&
-            pt1.y >= boundingBox.upperCorner.y)
-        {
-            pt1.y = boundingBox.upperCorner.y;
-            vel.y = 0.0;
-        }
-        if ((domainBoundaryFlag & DIRECTION_BACK) &&
-            pt1.z <= boundingBox.lowerCorner.z)
-        {
-            pt1.z = boundingBox.lowerCorner.z;
-            vel.z = 0.0;
-        }
-        if ((domainBoundaryFlag & DIRECTION_FRONT) &&
-            pt1.z >= boundingBox.upperCorner.z)
-        {
-            pt1.z = boundingBox.upperCorner.z;
-            vel.z = 0.0;
-        }
-
         positions[i] = pt1;
-        velocities[i] = vel;
     });
 
+    ClampParticlesToBox(boundingBox, domainBoundaryFlag, positions, velocities);
+
     Collider3Ptr col = GetCollider();
     if (col != nullptr)
     {
@@ -291,6 +261,30 @@ void PICSolver3::MoveParticles(double timeIntervalInSeconds)
     }
 }
 
+void PICSolver3::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    GridFluidSolver3::OnSaveCheckpoint(checkpoint);
+
+    m_particles->SaveCheckpoint("particles", checkpoint);
+
+    if (m_particleEmitter != nullptr)
+    {
+        m_particleEmitter->SaveCheckpoint("particleEmitter", checkpoint);
+    }
+}
+
+void PICSolver3::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    GridFluidSolver3::OnLoadCheckpoint(checkpoint);
+
+    m_particles->LoadCheckpoint("particles", checkpoint);
+
+    if (m_particleEmitter != nullptr)
+    {
+        m_particleEmitter->LoadCheckpoint("particleEmitter", checkpoint);
+    }
+}
+
 void PICSolver3::ExtrapolateVelocityToAir()
 {
     FaceCenteredGrid3Ptr vel = GetGridSystemData()->Velocity();
@@ -299,9 +293,12 @@ void PICSolver3::ExtrapolateVelocityToAir()
     const ArrayView3<double> w = vel->WView();
 
     const auto depth = static_cast<unsigned int>(std::ceil(GetMaxCFL()));
-    ExtrapolateToRegion(vel->UView(), m_uMarkers, depth, u);
-    ExtrapolateToRegion(vel->VView(), m_vMarkers, depth, v);
-    ExtrapolateToRegion(vel->WView(), m_wMarkers, depth, w);
+    ExtrapolateToRegion(vel->UView(), m_uMarkers, depth, u,
+                        m_extrapolationBuffers);
+    ExtrapolateToRegion(vel->VView(), m_vMarkers, depth, v,
+                        m_extrapolationBuffers);
+    ExtrapolateToRegion(vel->WView(), m_wMarkers, depth, w,
+                        m_extrapolationBuffers);
 }
 
 void PICSolver3::BuildSignedDistanceField()
@@ -12,6 +12,7 @@
 #include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 
+#include <algorithm>
 #include <queue>
 
 namespace CubbyFlow
@@ -439,14 +440,16 @@ void FMMLevelSetSolver3::Extrapolate(const ScalarGrid3& input,
         throw std::invalid_argument{ "input and output have not same shape." };
     }
 
-    Array3<double> sdfGrid{ input.DataSize() };
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> sdfGrid =
+        m_scratchArena.AcquireUninitialized<double>(input.DataSize());
     GridDataPositionFunc<3> pos = input.DataPosition();
     ParallelForEachIndex(sdfGrid.Size(), [&](size_t i, size_t j, size_t k) {
         sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
     });
 
-    Extrapolate(input.DataView(), sdfGrid.View(), input.GridSpacing(),
-                maxDistance, output->DataView());
+    Extrapolate(input.DataView(), sdfGrid, input.GridSpacing(), maxDistance,
+                output->DataView());
 }
 
 void FMMLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
@@ -459,7 +462,11 @@ void FMMLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
         throw std::invalid_argument{ "input and output have not same shape." };
     }
 
-    Array3<double> sdfGrid{ input.DataSize() };
+    const Vector3UZ size = input.DataSize();
+
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> sdfGrid =
+        m_scratchArena.AcquireUninitialized<double>(size);
     GridDataPositionFunc<3> pos = input.DataPosition();
     ParallelForEachIndex(sdfGrid.Size(), [&](size_t i, size_t j, size_t k) {
         sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
@@ -467,12 +474,12 @@ void FMMLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
 
     const Vector3D gridSpacing = input.GridSpacing();
 
-    Array3<double> u{ input.DataSize() };
-    Array3<double> u0{ input.DataSize() };
-    Array3<double> v{ input.DataSize() };
-    Array3<double> v0{ input.DataSize() };
-    Array3<double> w{ input.DataSize() };
-    Array3<double> w0{ input.DataSize() };
+    ArrayView3<double> u = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> u0 = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> v = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> v0 = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> w = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> w0 = m_scratchArena.AcquireUninitialized<double>(size);
 
     input.ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
         u(i, j, k) = input(i, j, k).x;
@@ -480,14 +487,14 @@ void FMMLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
         w(i, j, k) = input(i, j, k).z;
     });
 
-    Extrapolate(u, sdfGrid.View(), gridSpacing, maxDistance, u0);
-    Extrapolate(v, sdfGrid.View(), gridSpacing, maxDistance, v0);
-    Extrapolate(w, sdfGrid.View(), gridSpacing, maxDistance, w0);
+    Extrapolate(u, sdfGrid, gridSpacing, maxDistance, u0);
+    Extrapolate(v, sdfGrid, gridSpacing, maxDistance, v0);
+    Extrapolate(w, sdfGrid, gridSpacing, maxDistance, w0);
 
     output->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
-        (*output)(i, j, k).x = u(i, j, k);
-        (*output)(i, j, k).y = v(i, j, k);
-        (*output)(i, j, k).z = w(i, j, k);
+        (*output)(i, j, k).x = u0(i, j, k);
+        (*output)(i, j, k).y = v0(i, j, k);
+        (*output)(i, j, k).z = w0(i, j, k);
     });
 }
 
@@ -505,9 +512,12 @@ void FMMLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const Vector3D& gridSpacing = input.GridSpacing();
 
+    ScratchArena::Scope scope{ m_scratchArena };
+
     const ConstArrayView3<double> u = input.UView();
     auto uPos = input.UPosition();
-    Array3<double> sdfAtU{ u.Size() };
+    ArrayView3<double> sdfAtU =
+        m_scratchArena.AcquireUninitialized<double>(u.Size());
     input.ParallelForEachUIndex(
         [&](const Vector3UZ& idx) { sdfAtU(idx) = sdf.Sample(uPos(idx)); });
 
@@ -515,7 +525,8 @@ void FMMLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const ConstArrayView3<double> v = input.VView();
     auto vPos = input.VPosition();
-    Array3<double> sdfAtV{ v.Size() };
+    ArrayView3<double> sdfAtV =
+        m_scratchArena.AcquireUninitialized<double>(v.Size());
     input.ParallelForEachVIndex(
         [&](const Vector3UZ& idx) { sdfAtV(idx) = sdf.Sample(vPos(idx)); });
 
@@ -523,7 +534,8 @@ void FMMLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const ConstArrayView3<double> w = input.WView();
     auto wPos = input.WPosition();
-    Array3<double> sdfAtW{ w.Size() };
+    ArrayView3<double> sdfAtW =
+        m_scratchArena.AcquireUninitialized<double>(w.Size());
     input.ParallelForEachWIndex(
         [&](const Vector3UZ& idx) { sdfAtW(idx) = sdf.Sample(wPos(idx)); });
 
@@ -540,12 +552,10 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
     const Vector3D invGridSpacing = 1.0 / gridSpacing;
 
     // Build markers
-    Array3<char> markers{ size, UNKNOWN };
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<char> markers = m_scratchArena.AcquireUninitialized<char>(size);
     ParallelForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(sdf(i, j, k)))
-        {
-            markers(i, j, k) = KNOWN;
-        }
+        markers(i, j, k) = IsInsideSDF(sdf(i, j, k)) ? KNOWN : UNKNOWN;
         output(i, j, k) = input(i, j, k);
     });
 
@@ -553,9 +563,14 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
         return sdf(a.x, a.y, a.z) > sdf(b.x, b.y, b.z);
     };
 
-    // Enqueue initial candidates
-    std::priority_queue<Vector3UZ, std::vector<Vector3UZ>, decltype(compare)>
-        trial(compare);
+    // Enqueue initial candidates. The heap is kept in m_trial so that its
+    // storage is reused by the following calls.
+    std::vector<Vector3UZ>& trial = m_trial;
+    trial.clear();
+    const auto push = [&](const Vector3UZ& idx) {
+        trial.push_back(idx);
+        std::push_heap(trial.begin(), trial.end(), compare);
+    };
     ForEachIndex(markers.Size(), [&](size_t i, size_t j, size_t k) {
         if (markers(i, j, k) == KNOWN)
         {
@@ -564,42 +579,42 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
 
         if (i > 0 && markers(i - 1, j, k) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
 
         if (i + 1 < size.x && markers(i + 1, j, k) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
 
         if (j > 0 && markers(i, j - 1, k) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
 
         if (j + 1 < size.y && markers(i, j + 1, k) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
 
         if (k > 0 && markers(i, j, k - 1) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
 
         if (k + 1 < size.z && markers(i, j, k + 1) == KNOWN)
         {
-            trial.push(Vector3UZ{ i, j, k });
+            push(Vector3UZ{ i, j, k });
             markers(i, j, k) = TRIAL;
             return;
         }
@@ -608,8 +623,9 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
     // Propagate
     while (!trial.empty())
     {
-        const Vector3UZ idx = trial.top();
-        trial.pop();
+        std::pop_heap(trial.begin(), trial.end(), compare);
+        const Vector3UZ idx = trial.back();
+        trial.pop_back();
 
         const size_t i = idx.x;
         const size_t j = idx.y;
@@ -643,7 +659,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i - 1, j, k) == UNKNOWN)
             {
                 markers(i - 1, j, k) = TRIAL;
-                trial.push(Vector3UZ{ i - 1, j, k });
+                push(Vector3UZ{ i - 1, j, k });
             }
         }
 
@@ -665,7 +681,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i + 1, j, k) == UNKNOWN)
             {
                 markers(i + 1, j, k) = TRIAL;
-                trial.push(Vector3UZ{ i + 1, j, k });
+                push(Vector3UZ{ i + 1, j, k });
             }
         }
 
@@ -687,7 +703,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i, j - 1, k) == UNKNOWN)
             {
                 markers(i, j - 1, k) = TRIAL;
-                trial.push(Vector3UZ{ i, j - 1, k });
+                push(Vector3UZ{ i, j - 1, k });
             }
         }
 
@@ -709,7 +725,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i, j + 1, k) == UNKNOWN)
             {
                 markers(i, j + 1, k) = TRIAL;
-                trial.push(Vector3UZ{ i, j + 1, k });
+                push(Vector3UZ{ i, j + 1, k });
             }
         }
 
@@ -731,7 +747,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i, j, k - 1) == UNKNOWN)
             {
                 markers(i, j, k - 1) = TRIAL;
-                trial.push(Vector3UZ{ i, j, k - 1 });
+                push(Vector3UZ{ i, j, k - 1 });
             }
         }
 
@@ -753,7 +769,7 @@ void FMMLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             else if (markers(i, j, k + 1) == UNKNOWN)
             {
                 markers(i, j, k + 1) = TRIAL;
-                trial.push(Vector3UZ{ i, j, k + 1 });
+                push(Vector3UZ{ i, j, k + 1 });
             }
         }
 
@@ -11,6 +11,7 @@
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/FDM/FDMUtils.hpp>
 #include <Core/Solver/LevelSet/IterativeLevelSetSolver3.hpp>
+#include <Core/Utils/LevelSetUtils.hpp>
 #include <Core/Utils/Logging.hpp>
 
 namespace CubbyFlow
@@ -29,6 +30,13 @@ void IterativeLevelSetSolver3::Reinitialize(const ScalarGrid3& inputSDF,
         };
     }
 
+    if (m_useNarrowBand)
+    {
+        ReinitializeNarrowBand(inputSDF.DataView(), gridSpacing, maxDistance,
+                               outputSDF->DataView());
+        return;
+    }
+
     ArrayView3<double> outputAcc = outputSDF->DataView();
 
     const double dtau = PseudoTimeStep(inputSDF.DataView(), gridSpacing);
@@ -37,42 +45,20 @@ void IterativeLevelSetSolver3::Reinitialize(const ScalarGrid3& inputSDF,
 
     Copy(inputSDF.DataView(), outputAcc);
 
-    Array3<double> temp{ size };
-    ArrayView3<double> tempAcc = temp.View();
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> tempAcc =
+        m_scratchArena.AcquireUninitialized<double>(size);
 
     CUBBYFLOW_INFO << "Reinitializing with pseudoTimeStep: " << dtau
                    << " numberOfIterations: " << numberOfIterations;
 
     for (unsigned int n = 0; n < numberOfIterations; ++n)
     {
-        inputSDF.ParallelForEachDataPointIndex([&](size_t i, size_t j,
-                                                   size_t k) {
-            const double s = Sign(outputAcc, gridSpacing, i, j, k);
-
-            std::array<double, 2> dx{}, dy{}, dz{};
-
-            GetDerivatives(outputAcc, gridSpacing, i, j, k, &dx, &dy, &dz);
-
-            // Explicit Euler step
-            const double val = outputAcc(i, j, k) -
-                               dtau * std::max(s, 0.0) *
-                                   (std::sqrt(Square(std::max(dx[0], 0.0)) +
-                                              Square(std::min(dx[1], 0.0)) +
-                                              Square(std::max(dy[0], 0.0)) +
-                                              Square(std::min(dy[1], 0.0)) +
-                                              Square(std::max(dz[0], 0.0)) +
-                                              Square(std::min(dz[1], 0.0))) -
-                                    1.0) -
-                               dtau * std::min(s, 0.0) *
-                                   (std::sqrt(Square(std::min(dx[0], 0.0)) +
-                                              Square(std::max(dx[1], 0.0)) +
-                                              Square(std::min(dy[0], 0.0)) +
-                                              Square(std::max(dy[1], 0.0)) +
-                                              Square(std::min(dz[0], 0.0)) +
-                                              Square(std::max(dz[1], 0.0))) -
-                                    1.0);
-            tempAcc(i, j, k) = val;
-        });
+        inputSDF.ParallelForEachDataPointIndex(
+            [&](size_t i, size_t j, size_t k) {
+                tempAcc(i, j, k) =
+                    ReinitializeStep(outputAcc, gridSpacing, dtau, i, j, k);
+            });
 
         std::swap(tempAcc, outputAcc);
     }
@@ -93,14 +79,16 @@ void IterativeLevelSetSolver3::Extrapolate(const ScalarGrid3& input,
         };
     }
 
-    Array3<double> sdfGrid{ input.DataSize() };
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> sdfGrid =
+        m_scratchArena.AcquireUninitialized<double>(input.DataSize());
     GridDataPositionFunc<3> pos = input.DataPosition();
     ParallelForEachIndex(sdfGrid.Size(), [&](size_t i, size_t j, size_t k) {
         sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
     });
 
-    Extrapolate(input.DataView(), sdfGrid.View(), input.GridSpacing(),
-                maxDistance, output->DataView());
+    Extrapolate(input.DataView(), sdfGrid, input.GridSpacing(), maxDistance,
+                output->DataView());
 }
 
 void IterativeLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
@@ -115,7 +103,11 @@ void IterativeLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
         };
     }
 
-    Array3<double> sdfGrid{ input.DataSize() };
+    const Vector3UZ size = input.DataSize();
+
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> sdfGrid =
+        m_scratchArena.AcquireUninitialized<double>(size);
     GridDataPositionFunc<3> pos = input.DataPosition();
     ParallelForEachIndex(sdfGrid.Size(), [&](size_t i, size_t j, size_t k) {
         sdfGrid(i, j, k) = sdf.Sample(pos(i, j, k));
@@ -123,12 +115,12 @@ void IterativeLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
 
     const Vector3D gridSpacing = input.GridSpacing();
 
-    Array3<double> u{ input.DataSize() };
-    Array3<double> u0{ input.DataSize() };
-    Array3<double> v{ input.DataSize() };
-    Array3<double> v0{ input.DataSize() };
-    Array3<double> w{ input.DataSize() };
-    Array3<double> w0{ input.DataSize() };
+    ArrayView3<double> u = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> u0 = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> v = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> v0 = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> w = m_scratchArena.AcquireUninitialized<double>(size);
+    ArrayView3<double> w0 = m_scratchArena.AcquireUninitialized<double>(size);
 
     input.ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
         u(i, j, k) = input(i, j, k).x;
@@ -136,14 +128,14 @@ void IterativeLevelSetSolver3::Extrapolate(const CollocatedVectorGrid3& input,
         w(i, j, k) = input(i, j, k).z;
     });
 
-    Extrapolate(u, sdfGrid.View(), gridSpacing, maxDistance, u0);
-    Extrapolate(v, sdfGrid.View(), gridSpacing, maxDistance, v0);
-    Extrapolate(w, sdfGrid.View(), gridSpacing, maxDistance, w0);
+    Extrapolate(u, sdfGrid, gridSpacing, maxDistance, u0);
+    Extrapolate(v, sdfGrid, gridSpacing, maxDistance, v0);
+    Extrapolate(w, sdfGrid, gridSpacing, maxDistance, w0);
 
     output->ParallelForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
-        (*output)(i, j, k).x = u(i, j, k);
-        (*output)(i, j, k).y = v(i, j, k);
-        (*output)(i, j, k).z = w(i, j, k);
+        (*output)(i, j, k).x = u0(i, j, k);
+        (*output)(i, j, k).y = v0(i, j, k);
+        (*output)(i, j, k).z = w0(i, j, k);
     });
 }
 
@@ -161,9 +153,12 @@ void IterativeLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const Vector3D& gridSpacing = input.GridSpacing();
 
+    ScratchArena::Scope scope{ m_scratchArena };
+
     const ConstArrayView3<double> u = input.UView();
     auto uPos = input.UPosition();
-    Array3<double> sdfAtU{ u.Size() };
+    ArrayView3<double> sdfAtU =
+        m_scratchArena.AcquireUninitialized<double>(u.Size());
     input.ParallelForEachUIndex(
         [&](const Vector3UZ& idx) { sdfAtU(idx) = sdf.Sample(uPos(idx)); });
 
@@ -171,7 +166,8 @@ void IterativeLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const ConstArrayView3<double> v = input.VView();
     auto vPos = input.VPosition();
-    Array3<double> sdfAtV{ v.Size() };
+    ArrayView3<double> sdfAtV =
+        m_scratchArena.AcquireUninitialized<double>(v.Size());
     input.ParallelForEachVIndex(
         [&](const Vector3UZ& idx) { sdfAtV(idx) = sdf.Sample(vPos(idx)); });
 
@@ -179,7 +175,8 @@ void IterativeLevelSetSolver3::Extrapolate(const FaceCenteredGrid3& input,
 
     const ConstArrayView3<double> w = input.WView();
     auto wPos = input.WPosition();
-    Array3<double> sdfAtW{ w.Size() };
+    ArrayView3<double> sdfAtW =
+        m_scratchArena.AcquireUninitialized<double>(w.Size());
     input.ParallelForEachWIndex(
         [&](const Vector3UZ& idx) { sdfAtW(idx) = sdf.Sample(wPos(idx)); });
 
@@ -192,6 +189,13 @@ void IterativeLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
                                            double maxDistance,
                                            ArrayView3<double> output)
 {
+    if (m_useNarrowBand)
+    {
+        Copy(input, output);
+        ExtrapolateNarrowBand(sdf, gridSpacing, maxDistance, output);
+        return;
+    }
+
     const Vector3UZ size = input.Size();
 
     ArrayView3<double> outputAcc{ output };
@@ -202,8 +206,9 @@ void IterativeLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
 
     Copy(input, outputAcc);
 
-    Array3<double> temp{ size };
-    ArrayView3<double> tempAcc = temp.View();
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView3<double> tempAcc =
+        m_scratchArena.AcquireUninitialized<double>(size);
 
     for (unsigned int n = 0; n < numberOfIterations; ++n)
     {
@@ -212,19 +217,9 @@ void IterativeLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
             [&](size_t i, size_t j, size_t k) {
                 if (sdf(i, j, k) >= 0)
                 {
-                    std::array<double, 2> dx{}, dy{}, dz{};
-                    const Vector3D grad = Gradient3(sdf, gridSpacing, i, j, k);
-
-                    GetDerivatives(outputAcc, gridSpacing, i, j, k, &dx, &dy,
-                                   &dz);
-
-                    tempAcc(i, j, k) = outputAcc(i, j, k) -
-                                       dtau * (std::max(grad.x, 0.0) * dx[0] +
-                                               std::min(grad.x, 0.0) * dx[1] +
-                                               std::max(grad.y, 0.0) * dy[0] +
-                                               std::min(grad.y, 0.0) * dy[1] +
-                                               std::max(grad.z, 0.0) * dz[0] +
-                                               std::min(grad.z, 0.0) * dz[1]);
+                    tempAcc(i, j, k) = ExtrapolateStep(outputAcc, sdf,
+                                                       gridSpacing, dtau, i, j,
+                                                       k);
                 }
                 else
                 {
@@ -238,6 +233,286 @@ void IterativeLevelSetSolver3::Extrapolate(const ConstArrayView3<double>& input,
     Copy(outputAcc, output);
 }
 
+void IterativeLevelSetSolver3::ReinitializeNarrowBand(
+    const ConstArrayView3<double>& inputSDF, const Vector3D& gridSpacing,
+    double maxDistance, ArrayView3<double> outputSDF)
+{
+    const Vector3UZ size = inputSDF.Size();
+    const size_t numberOfLayers = NumberOfBandLayers(maxDistance, gridSpacing);
+    const double bandDistance =
+        static_cast<double>(numberOfLayers) *
+        std::min({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+
+    Copy(inputSDF, outputSDF);
+
+    // Mark the cells next to the interface
+    m_bandMarkers.Resize(size);
+    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        const bool isInside = IsInsideSDF(outputSDF(i, j, k));
+        const auto differs = [&](size_t ni, size_t nj, size_t nk) {
+            return IsInsideSDF(outputSDF(ni, nj, nk)) != isInside;
+        };
+        const bool isInterface =
+            (i > 0 && differs(i - 1, j, k)) ||
+            (i + 1 < size.x && differs(i + 1, j, k)) ||
+            (j > 0 && differs(i, j - 1, k)) ||
+            (j + 1 < size.y && differs(i, j + 1, k)) ||
+            (k > 0 && differs(i, j, k - 1)) ||
+            (k + 1 < size.z && differs(i, j, k + 1));
+
+        m_bandMarkers(i, j, k) = isInterface ? 1 : 0;
+    });
+
+    // Grow the band from the interface cells. Dilating each axis in turn by
+    // numberOfLayers cells gives the same band as numberOfLayers layers of
+    // 3x3x3 growth.
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        DilateBandMarkers(axis, numberOfLayers);
+    }
+
+    CollectBand();
+
+    // No interface to reinitialize around
+    if (m_band.Length() == 0)
+    {
+        return;
+    }
+
+    // Clamp the cells outside of the band
+    ParallelForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        if (m_bandMarkers(i, j, k) == 0)
+        {
+            outputSDF(i, j, k) =
+                std::copysign(bandDistance, outputSDF(i, j, k));
+        }
+    });
+
+    const double maxS = ParallelReduce(
+        ZERO_SIZE, m_band.Length(), -std::numeric_limits<double>::max(),
+        [&](size_t begin, size_t end, double init) {
+            for (size_t n = begin; n < end; ++n)
+            {
+                const Vector3UZ& idx = m_band[n];
+                init = std::max(
+                    init, Sign(outputSDF, gridSpacing, idx.x, idx.y, idx.z));
+            }
+            return init;
+        },
+        [](double a, double b) { return std::max(a, b); });
+
+    const double dtau = PseudoTimeStep(maxS, gridSpacing);
+    const unsigned int numberOfIterations =
+        DistanceToNumberOfIterations(maxDistance, dtau);
+
+    CUBBYFLOW_INFO << "Reinitializing narrow band of " << m_band.Length()
+                   << " cells with pseudoTimeStep: " << dtau
+                   << " numberOfIterations: " << numberOfIterations;
+
+    m_bandValues.Resize(m_band.Length());
+
+    for (unsigned int iter = 0; iter < numberOfIterations; ++iter)
+    {
+        ParallelFor(ZERO_SIZE, m_band.Length(), [&](size_t n) {
+            const Vector3UZ& idx = m_band[n];
+            m_bandValues[n] = ReinitializeStep(outputSDF, gridSpacing, dtau,
+                                               idx.x, idx.y, idx.z);
+        });
+
+        ParallelFor(ZERO_SIZE, m_band.Length(), [&](size_t n) {
+            outputSDF(m_band[n]) = m_bandValues[n];
+        });
+    }
+}
+
+void IterativeLevelSetSolver3::ExtrapolateNarrowBand(
+    const ConstArrayView3<double>& sdf, const Vector3D& gridSpacing,
+    double maxDistance, ArrayView3<double> output)
+{
+    const double bandDistance =
+        static_cast<double>(NumberOfBandLayers(maxDistance, gridSpacing)) *
+        std::min({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+
+    m_bandMarkers.Resize(sdf.Size());
+    ParallelForEachIndex(sdf.Size(), [&](size_t i, size_t j, size_t k) {
+        const double phi = sdf(i, j, k);
+        m_bandMarkers(i, j, k) = (phi >= 0.0 && phi <= bandDistance) ? 1 : 0;
+    });
+
+    CollectBand();
+
+    if (m_band.Length() == 0)
+    {
+        return;
+    }
+
+    const double maxS = ParallelReduce(
+        ZERO_SIZE, m_band.Length(), -std::numeric_limits<double>::max(),
+        [&](size_t begin, size_t end, double init) {
+            for (size_t n = begin; n < end; ++n)
+            {
+                const Vector3UZ& idx = m_band[n];
+                init = std::max(init,
+                                Sign(sdf, gridSpacing, idx.x, idx.y, idx.z));
+            }
+            return init;
+        },
+        [](double a, double b) { return std::max(a, b); });
+
+    const double dtau = PseudoTimeStep(maxS, gridSpacing);
+    const unsigned int numberOfIterations =
+        DistanceToNumberOfIterations(maxDistance, dtau);
+
+    m_bandValues.Resize(m_band.Length());
+
+    for (unsigned int iter = 0; iter < numberOfIterations; ++iter)
+    {
+        ParallelFor(ZERO_SIZE, m_band.Length(), [&](size_t n) {
+            const Vector3UZ& idx = m_band[n];
+            m_bandValues[n] = ExtrapolateStep(output, sdf, gridSpacing, dtau,
+                                              idx.x, idx.y, idx.z);
+        });
+
+        ParallelFor(ZERO_SIZE, m_band.Length(), [&](size_t n) {
+            output(m_band[n]) = m_bandValues[n];
+        });
+    }
+}
+
+void IterativeLevelSetSolver3::DilateBandMarkers(size_t axis, size_t radius)
+{
+    const Vector3UZ size = m_bandMarkers.Size();
+    const size_t axis1 = (axis + 1) % 3;
+    const size_t axis2 = (axis + 2) % 3;
+
+    // Cells marked by the previous passes are the sources of this pass
+    const char source = static_cast<char>(axis + 1);
+    const char marker = static_cast<char>(axis + 2);
+
+    ParallelFor(ZERO_SIZE, size[axis1], ZERO_SIZE, size[axis2],
+                [&](size_t a, size_t b) {
+                    Vector3UZ idx;
+                    idx[axis1] = a;
+                    idx[axis2] = b;
+
+                    const auto sweep = [&](size_t t, size_t& distance) {
+                        idx[axis] = t;
+                        char& m = m_bandMarkers(idx);
+
+                        if (m != 0 && m <= source)
+                        {
+                            distance = 0;
+                        }
+                        else if (++distance <= radius)
+                        {
+                            m = marker;
+                        }
+                    };
+
+                    size_t distance = radius;
+                    for (size_t t = 0; t < size[axis]; ++t)
+                    {
+                        sweep(t, distance);
+                    }
+
+                    distance = radius;
+                    for (size_t t = size[axis]; t > 0; --t)
+                    {
+                        sweep(t - 1, distance);
+                    }
+                });
+}
+
+void IterativeLevelSetSolver3::CollectBand()
+{
+    const Vector3UZ size = m_bandMarkers.Size();
+
+    // Count the marked cells per slab, then let each slab write its cells
+    // from its prefix-summed offset.
+    m_bandOffsets.Resize(size.z + 1);
+    m_bandOffsets[0] = 0;
+    ParallelFor(ZERO_SIZE, size.z, [&](size_t k) {
+        size_t count = 0;
+        for (size_t j = 0; j < size.y; ++j)
+        {
+            for (size_t i = 0; i < size.x; ++i)
+            {
+                count += m_bandMarkers(i, j, k) != 0 ? 1 : 0;
+            }
+        }
+        m_bandOffsets[k + 1] = count;
+    });
+
+    for (size_t k = 0; k < size.z; ++k)
+    {
+        m_bandOffsets[k + 1] += m_bandOffsets[k];
+    }
+
+    m_band.ResizeUninitialized(m_bandOffsets[size.z]);
+    ParallelFor(ZERO_SIZE, size.z, [&](size_t k) {
+        size_t n = m_bandOffsets[k];
+        for (size_t j = 0; j < size.y; ++j)
+        {
+            for (size_t i = 0; i < size.x; ++i)
+            {
+                if (m_bandMarkers(i, j, k) != 0)
+                {
+                    m_band[n++] = Vector3UZ{ i, j, k };
+                }
+            }
+        }
+    });
+}
+
+double IterativeLevelSetSolver3::ReinitializeStep(
+    const ConstArrayView3<double>& sdf, const Vector3D& gridSpacing,
+    double dtau, size_t i, size_t j, size_t k) const
+{
+    const double s = Sign(sdf, gridSpacing, i, j, k);
+
+    std::array<double, 2> dx{}, dy{}, dz{};
+
+    GetDerivatives(sdf, gridSpacing, i, j, k, &dx, &dy, &dz);
+
+    // Explicit Euler step
+    return sdf(i, j, k) -
+           dtau * std::max(s, 0.0) *
+               (std::sqrt(Square(std::max(dx[0], 0.0)) +
+                          Square(std::min(dx[1], 0.0)) +
+                          Square(std::max(dy[0], 0.0)) +
+                          Square(std::min(dy[1], 0.0)) +
+                          Square(std::max(dz[0], 0.0)) +
+                          Square(std::min(dz[1], 0.0))) -
+                1.0) -
+           dtau * std::min(s, 0.0) *
+               (std::sqrt(Square(std::min(dx[0], 0.0)) +
+                          Square(std::max(dx[1], 0.0)) +
+                          Square(std::min(dy[0], 0.0)) +
+                          Square(std::max(dy[1], 0.0)) +
+                          Square(std::min(dz[0], 0.0)) +
+                          Square(std::max(dz[1], 0.0))) -
+                1.0);
+}
+
+double IterativeLevelSetSolver3::ExtrapolateStep(
+    const ConstArrayView3<double>& field, const ConstArrayView3<double>& sdf,
+    const Vector3D& gridSpacing, double dtau, size_t i, size_t j,
+    size_t k) const
+{
+    std::array<double, 2> dx{}, dy{}, dz{};
+    const Vector3D grad = Gradient3(sdf, gridSpacing, i, j, k);
+
+    GetDerivatives(field, gridSpacing, i, j, k, &dx, &dy, &dz);
+
+    return field(i, j, k) -
+           dtau * (std::max(grad.x, 0.0) * dx[0] +
+                   std::min(grad.x, 0.0) * dx[1] +
+                   std::max(grad.y, 0.0) * dy[0] +
+                   std::min(grad.y, 0.0) * dy[1] +
+                   std::max(grad.z, 0.0) * dz[0] +
+                   std::min(grad.z, 0.0) * dz[1]);
+}
+
 double IterativeLevelSetSolver3::GetMaxCFL() const
 {
     return m_maxCFL;
@@ -248,12 +523,31 @@ void IterativeLevelSetSolver3::SetMaxCFL(double newMaxCFL)
     m_maxCFL = std::max(newMaxCFL, 0.0);
 }
 
+bool IterativeLevelSetSolver3::GetUseNarrowBand() const
+{
+    return m_useNarrowBand;
+}
+
+void IterativeLevelSetSolver3::SetUseNarrowBand(bool isOn)
+{
+    m_useNarrowBand = isOn;
+}
+
 unsigned int IterativeLevelSetSolver3::DistanceToNumberOfIterations(
     double distance, double dtau)
 {
     return static_cast<unsigned int>(std::ceil(distance / dtau));
 }
 
+size_t IterativeLevelSetSolver3::NumberOfBandLayers(
+    double maxDistance, const Vector3D& gridSpacing)
+{
+    const double h = std::min({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+
+    // One extra layer so that the cells at maxDistance see updated neighbors
+    return static_cast<size_t>(std::ceil(maxDistance / h)) + 1;
+}
+
 double IterativeLevelSetSolver3::Sign(const ConstArrayView3<double>& sdf,
                                       const Vector3D& gridSpacing, size_t i,
                                       size_t j, size_t k)
@@ -268,10 +562,7 @@ double IterativeLevelSetSolver3::PseudoTimeStep(
 {
     const Vector3UZ size = sdf.Size();
 
-    const double h = std::max({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
-
     double maxS = -std::numeric_limits<double>::max();
-    double dtau = m_maxCFL * h;
 
     for (size_t k = 0; k < size.z; ++k)
     {
@@ -285,6 +576,16 @@ double IterativeLevelSetSolver3::PseudoTimeStep(
         }
     }
 
+    return PseudoTimeStep(maxS, gridSpacing);
+}
+
+double IterativeLevelSetSolver3::PseudoTimeStep(
+    double maxS, const Vector3D& gridSpacing) const
+{
+    const double h = std::max({ gridSpacing.x, gridSpacing.y, gridSpacing.z });
+
+    double dtau = m_maxCFL * h;
+
     while (dtau * maxS / h > m_maxCFL)
     {
         dtau *= 0.5;
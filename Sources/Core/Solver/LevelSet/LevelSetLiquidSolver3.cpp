@@ -10,7 +10,6 @@
 
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
 #include <Core/Solver/LevelSet/ENOLevelSetSolver3.hpp>
-#include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
 #include <Core/Solver/LevelSet/LevelSetLiquidSolver3.hpp>
 #include <Core/Utils/LevelSetUtils.hpp>
 #include <Core/Utils/Logging.hpp>
@@ -130,12 +129,34 @@ ScalarField3Ptr LevelSetLiquidSolver3::GetFluidSDF() const
     return GetSignedDistanceField();
 }
 
+void LevelSetLiquidSolver3::OnSaveCheckpoint(Checkpoint* checkpoint) const
+{
+    GridFluidSolver3::OnSaveCheckpoint(checkpoint);
+
+    checkpoint->WriteValue("solver/minReinitializeDistance",
+                           m_minReinitializeDistance);
+    checkpoint->WriteValue("solver/isGlobalCompensationEnabled",
+                           m_isGlobalCompensationEnabled);
+    checkpoint->WriteValue("solver/lastKnownVolume", m_lastKnownVolume);
+}
+
+void LevelSetLiquidSolver3::OnLoadCheckpoint(const Checkpoint& checkpoint)
+{
+    GridFluidSolver3::OnLoadCheckpoint(checkpoint);
+
+    m_minReinitializeDistance =
+        checkpoint.Value<double>("solver/minReinitializeDistance");
+    m_isGlobalCompensationEnabled =
+        checkpoint.Value<bool>("solver/isGlobalCompensationEnabled");
+    m_lastKnownVolume = checkpoint.Value<double>("solver/lastKnownVolume");
+}
+
 void LevelSetLiquidSolver3::Reinitialize(double currentCfl)
 {
     if (m_levelSetSolver != nullptr)
     {
         const ScalarGrid3Ptr sdf = GetSignedDistanceField();
-        const std::shared_ptr<ScalarGrid3> sdf0 = sdf->Clone();
+        CopyGrid(*sdf, &m_signedDistanceField0);
 
         const Vector3D gridSpacing = sdf->GridSpacing();
         const double h = gridSpacing.Max();
@@ -144,7 +165,8 @@ void LevelSetLiquidSolver3::Reinitialize(double currentCfl)
 
         CUBBYFLOW_INFO << "Max reinitialize distance: " << maxReinitDist;
 
-        m_levelSetSolver->Reinitialize(*sdf0, maxReinitDist, sdf.get());
+        m_levelSetSolver->Reinitialize(*m_signedDistanceField0, maxReinitDist,
+                                       sdf.get());
         ExtrapolateIntoCollider(sdf.get());
     }
 }
@@ -162,42 +184,24 @@ void LevelSetLiquidSolver3::ExtrapolateVelocityToAir(double currentCFL)
     GridDataPositionFunc<3> vPos = vel->VPosition();
     GridDataPositionFunc<3> wPos = vel->WPosition();
 
-    Array3<char> uMarker{ u.Size() };
-    Array3<char> vMarker{ v.Size() };
-    Array3<char> wMarker{ w.Size() };
-
-    ParallelForEachIndex(uMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(sdf->Sample(uPos(i, j, k))))
-        {
-            uMarker(i, j, k) = 1;
-        }
-        else
+    // Zero out the air velocities before extrapolating the liquid ones.
+    ParallelForEachIndex(u.Size(), [&](size_t i, size_t j, size_t k) {
+        if (!IsInsideSDF(sdf->Sample(uPos(i, j, k))))
         {
-            uMarker(i, j, k) = 0;
             u(i, j, k) = 0.0;
         }
     });
 
-    ParallelForEachIndex(vMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(sdf->Sample(vPos(i, j, k))))
+    ParallelForEachIndex(v.Size(), [&](size_t i, size_t j, size_t k) {
+        if (!IsInsideSDF(sdf->Sample(vPos(i, j, k))))
         {
-            vMarker(i, j, k) = 1;
-        }
-        else
-        {
-            vMarker(i, j, k) = 0;
             v(i, j, k) = 0.0;
         }
     });
 
-    ParallelForEachIndex(wMarker.Size(), [&](size_t i, size_t j, size_t k) {
-        if (IsInsideSDF(sdf->Sample(wPos(i, j, k))))
-        {
-            wMarker(i, j, k) = 1;
-        }
-        else
+    ParallelForEachIndex(w.Size(), [&](size_t i, size_t j, size_t k) {
+        if (!IsInsideSDF(sdf->Sample(wPos(i, j, k))))
         {
-            wMarker(i, j, k) = 0;
             w(i, j, k) = 0.0;
         }
     });
@@ -209,8 +213,7 @@ void LevelSetLiquidSolver3::ExtrapolateVelocityToAir(double currentCFL)
 
     CUBBYFLOW_INFO << "Max velocity extrapolation distance: " << maxDist;
 
-    FMMLevelSetSolver3 fmmSolver;
-    fmmSolver.Extrapolate(*vel, *sdf, maxDist, vel.get());
+    m_velocityExtrapolator.Extrapolate(*vel, *sdf, maxDist, vel.get());
 
     ApplyBoundaryCondition();
 }
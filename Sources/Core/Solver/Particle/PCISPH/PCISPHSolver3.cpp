@@ -65,7 +65,9 @@ void PCISPHSolver3::AccumulatePressureForce(double timeIntervalInSeconds)
     ArrayView1<Vector3D> f = particles->Forces();
 
     // Predicted density ds
-    Array1<double> ds(numberOfParticles, 0.0);
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView1<double> ds =
+        m_scratchArena.AcquireUninitialized<double>(numberOfParticles);
 
     SPHStdKernel3 kernel{ particles->KernelRadius() };
 
@@ -177,36 +179,37 @@ double PCISPHSolver3::ComputeDelta(double timeStepInSeconds) const
     const SPHSystemData3Ptr particles = GetSPHSystemData();
     const double kernelRadius = particles->KernelRadius();
 
-    Array1<Vector3D> points;
     const BccLatticePointGenerator pointsGenerator;
     const Vector3D origin;
     BoundingBox3D sampleBound{ origin, origin };
     sampleBound.Expand(1.5 * kernelRadius);
 
-    pointsGenerator.Generate(sampleBound, particles->TargetSpacing(), &points);
-
     const SPHSpikyKernel3 kernel{ kernelRadius };
 
     double denom = 0;
     Vector3D denom1;
     double denom2 = 0;
 
-    for (const auto& point : points)
-    {
-        const double distanceSquared = point.LengthSquared();
+    // The lattice points are visited in place rather than collected first,
+    // since this runs every sub-step.
+    pointsGenerator.ForEachPoint(
+        sampleBound, particles->TargetSpacing(), [&](const Vector3D& point) {
+            const double distanceSquared = point.LengthSquared();
 
-        if (distanceSquared < kernelRadius * kernelRadius)
-        {
-            const double distance = std::sqrt(distanceSquared);
-            Vector3D direction =
-                (distance > 0.0) ? point / distance : Vector3D{};
-
-            // grad(Wij)
-            Vector3D gradWij = kernel.Gradient(distance, direction);
-            denom1 += gradWij;
-            denom2 += gradWij.Dot(gradWij);
-        }
-    }
+            if (distanceSquared < kernelRadius * kernelRadius)
+            {
+                const double distance = std::sqrt(distanceSquared);
+                Vector3D direction =
+                    (distance > 0.0) ? point / distance : Vector3D{};
+
+                // grad(Wij)
+                Vector3D gradWij = kernel.Gradient(distance, direction);
+                denom1 += gradWij;
+                denom2 += gradWij.Dot(gradWij);
+            }
+
+            return true;
+        });
 
     denom += -denom1.Dot(denom1) - denom2;
 
@@ -10,6 +10,7 @@
 
 #include <Core/Array/ArrayUtils.hpp>
 #include <Core/Field/ConstantVectorField.hpp>
+#include <Core/Particle/ParticleKernels.hpp>
 #include <Core/Solver/Particle/ParticleSystemSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Parallel.hpp>
@@ -246,21 +247,14 @@ void ParticleSystemSolver3::AccumulateExternalForces()
 
 void ParticleSystemSolver3::TimeIntegration(double timeStepInSeconds)
 {
-    const size_t n = m_particleSystemData->NumberOfParticles();
     ArrayView1<Vector3D> forces = m_particleSystemData->Forces();
     ArrayView1<Vector3D> velocities = m_particleSystemData->Velocities();
     ArrayView1<Vector3D> positions = m_particleSystemData->Positions();
     const double mass = m_particleSystemData->Mass();
 
-    ParallelFor(ZERO_SIZE, n, [&](size_t i) {
-        // Integrate velocity first
-        Vector3D& newVelocity = m_newVelocities[i];
-        newVelocity = velocities[i] + timeStepInSeconds * forces[i] / mass;
-
-        // Integrate position.
-        Vector3D& newPosition = m_newPositions[i];
-        newPosition = positions[i] + timeStepInSeconds * newVelocity;
-    });
+    // Integrate velocity first, then position
+    IntegrateParticles(positions, velocities, forces, mass, timeStepInSeconds,
+                       m_newPositions, m_newVelocities);
 }
 
 void ParticleSystemSolver3::UpdateCollider(double timeStepInSeconds) const
@@ -8,6 +8,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Core/Particle/ParticleKernels.hpp>
 #include <Core/Particle/SPHKernels.hpp>
 #include <Core/Solver/Particle/SPH/SPHSolver3.hpp>
 #include <Core/Utils/Logging.hpp>
@@ -103,6 +104,11 @@ SPHSystemData3Ptr SPHSolver3::GetSPHSystemData() const
     return std::dynamic_pointer_cast<SPHSystemData3>(GetParticleSystemData());
 }
 
+const ScratchArena& SPHSolver3::GetScratchArena() const
+{
+    return m_scratchArena;
+}
+
 unsigned int SPHSolver3::GetNumberOfSubTimeSteps(
     double timeIntervalInSeconds) const
 {
@@ -149,7 +155,10 @@ void SPHSolver3::OnBeginAdvanceTimeStep(double timeStepInSeconds)
     const Timer timer;
     particles->BuildNeighborSearcher();
     particles->BuildNeighborLists();
-    particles->UpdateDensities();
+    ComputeSPHStdKernelDensities(particles->Positions(),
+                                 particles->NeighborLists(),
+                                 particles->KernelRadius(), particles->Mass(),
+                                 particles->Densities());
 
     CUBBYFLOW_INFO << "Building neighbor lists and updating densities took "
                    << timer.DurationInSeconds() << " seconds";
@@ -222,49 +231,31 @@ void SPHSolver3::AccumulatePressureForce(
     SPHSystemData3Ptr particles = GetSPHSystemData();
     const size_t numberOfParticles = particles->NumberOfParticles();
 
-    const double massSquared = Square(particles->Mass());
-    const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView1<double> pressureTerms =
+        m_scratchArena.AcquireUninitialized<double>(numberOfParticles);
 
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        const auto& neighbors = particles->NeighborLists()[i];
-        for (size_t j : neighbors)
-        {
-            const double dist = positions[i].DistanceTo(positions[j]);
-            if (dist > 0.0)
-            {
-                Vector3D dir = (positions[j] - positions[i]) / dist;
-                pressureForces[i] -=
-                    massSquared *
-                    (pressures[i] / (densities[i] * densities[i]) +
-                     pressures[j] / (densities[j] * densities[j])) *
-                    kernel.Gradient(dist, dir);
-            }
-        }
+        pressureTerms[i] = pressures[i] / (densities[i] * densities[i]);
     });
+
+    AccumulateSPHPressureForces(positions, pressureTerms,
+                                particles->NeighborLists(),
+                                particles->KernelRadius(), particles->Mass(),
+                                pressureForces);
 }
 
 void SPHSolver3::AccumulateViscosityForce()
 {
     SPHSystemData3Ptr particles = GetSPHSystemData();
-    const size_t numberOfParticles = particles->NumberOfParticles();
     ArrayView1<Vector3D> x = particles->Positions();
     ArrayView1<Vector3D> v = particles->Velocities();
     ArrayView1<double> d = particles->Densities();
     ArrayView1<Vector3D> f = particles->Forces();
 
-    const double massSquared = Square(particles->Mass());
-    const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
-
-    ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
-        const auto& neighbors = particles->NeighborLists()[i];
-        for (size_t j : neighbors)
-        {
-            const double dist = x[i].DistanceTo(x[j]);
-
-            f[i] += GetViscosityCoefficient() * massSquared * (v[j] - v[i]) /
-                    d[j] * kernel.SecondDerivative(dist);
-        }
-    });
+    AccumulateSPHViscosityForces(x, v, d, particles->NeighborLists(),
+                                 particles->KernelRadius(), particles->Mass(),
+                                 GetViscosityCoefficient(), f);
 }
 
 void SPHSolver3::ComputePseudoViscosity(double timeStepInSeconds)
@@ -278,7 +269,9 @@ void SPHSolver3::ComputePseudoViscosity(double timeStepInSeconds)
     const double mass = particles->Mass();
     const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
 
-    Array1<Vector3D> smoothedVelocities{ numberOfParticles };
+    ScratchArena::Scope scope{ m_scratchArena };
+    ArrayView1<Vector3D> smoothedVelocities =
+        m_scratchArena.AcquireUninitialized<Vector3D>(numberOfParticles);
 
     ParallelFor(ZERO_SIZE, numberOfParticles, [&](size_t i) {
         double weightSum = 0.0;
@@ -0,0 +1,658 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Math/MathUtils.hpp>
+#include <Core/Utils/AMG.hpp>
+#include <Core/Utils/Parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace CubbyFlow
+{
+namespace
+{
+constexpr size_t NOT_ASSIGNED = std::numeric_limits<size_t>::max();
+
+void ComputeInverseDiagonal(const MatrixCSRD& a, VectorND* invDiag)
+{
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    invDiag->Resize(a.GetRows(), 0.0);
+
+    ParallelFor(ZERO_SIZE, a.GetRows(), [&](size_t i) {
+        double diag = 0.0;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (ci[jj] == i)
+            {
+                diag = nnz[jj];
+                break;
+            }
+        }
+
+        (*invDiag)[i] = (std::fabs(diag) > 0.0) ? 1.0 / diag : 0.0;
+    });
+}
+
+// result = b - Ax
+void Residual(const MatrixCSRD& a, const VectorND& x, const VectorND& b,
+              VectorND* result)
+{
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    ParallelFor(ZERO_SIZE, a.GetRows(), [&](size_t i) {
+        double sum = 0.0;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            sum += nnz[jj] * x[ci[jj]];
+        }
+
+        (*result)[i] = b[i] - sum;
+    });
+}
+
+// result = Ax (+ result if accumulate is true)
+void MVM(const MatrixCSRD& a, const VectorND& x, bool accumulate,
+         VectorND* result)
+{
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    ParallelFor(ZERO_SIZE, a.GetRows(), [&](size_t i) {
+        double sum = accumulate ? (*result)[i] : 0.0;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            sum += nnz[jj] * x[ci[jj]];
+        }
+
+        (*result)[i] = sum;
+    });
+}
+
+void Transpose(const MatrixCSRD& a, MatrixCSRD* result)
+{
+    const size_t rows = a.GetRows();
+    const size_t cols = a.GetCols();
+    const size_t numNonZeros = a.NumberOfNonZeros();
+
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    result->Reserve(cols, rows, numNonZeros);
+
+    auto resultRp = result->RowPointersBegin();
+    auto resultCi = result->ColumnIndicesBegin();
+    auto resultNnz = result->NonZeroBegin();
+
+    std::fill(resultRp, result->RowPointersEnd(), ZERO_SIZE);
+
+    for (size_t jj = 0; jj < numNonZeros; ++jj)
+    {
+        ++resultRp[ci[jj] + 1];
+    }
+
+    for (size_t j = 0; j < cols; ++j)
+    {
+        resultRp[j + 1] += resultRp[j];
+    }
+
+    std::vector<size_t> offsets(resultRp, resultRp + cols);
+
+    // Visiting the rows in order keeps the column indices sorted.
+    for (size_t i = 0; i < rows; ++i)
+    {
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            const size_t dst = offsets[ci[jj]]++;
+            resultCi[dst] = i;
+            resultNnz[dst] = nnz[jj];
+        }
+    }
+}
+
+// Two-pass parallel sparse matrix-matrix multiplication (result = ab).
+void Multiply(const MatrixCSRD& a, const MatrixCSRD& b, MatrixCSRD* result)
+{
+    const size_t rows = a.GetRows();
+    const size_t cols = b.GetCols();
+
+    const auto aRp = a.RowPointersBegin();
+    const auto aCi = a.ColumnIndicesBegin();
+    const auto aNnz = a.NonZeroBegin();
+    const auto bRp = b.RowPointersBegin();
+    const auto bCi = b.ColumnIndicesBegin();
+    const auto bNnz = b.NonZeroBegin();
+
+    // First pass: count the number of non-zeros for each row.
+    std::vector<size_t> rowCounts(rows + 1, 0);
+
+    ParallelRangeFor(ZERO_SIZE, rows, [&](size_t begin, size_t end) {
+        std::vector<size_t> marker(cols, NOT_ASSIGNED);
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            size_t count = 0;
+
+            for (size_t kk = aRp[i]; kk < aRp[i + 1]; ++kk)
+            {
+                const size_t k = aCi[kk];
+
+                for (size_t jj = bRp[k]; jj < bRp[k + 1]; ++jj)
+                {
+                    if (const size_t j = bCi[jj]; marker[j] != i)
+                    {
+                        marker[j] = i;
+                        ++count;
+                    }
+                }
+            }
+
+            rowCounts[i + 1] = count;
+        }
+    });
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        rowCounts[i + 1] += rowCounts[i];
+    }
+
+    result->Reserve(rows, cols, rowCounts[rows]);
+
+    auto resultRp = result->RowPointersBegin();
+    auto resultCi = result->ColumnIndicesBegin();
+    auto resultNnz = result->NonZeroBegin();
+
+    std::copy(rowCounts.begin(), rowCounts.end(), resultRp);
+
+    // Second pass: accumulate the values and sort each row by column.
+    ParallelRangeFor(ZERO_SIZE, rows, [&](size_t begin, size_t end) {
+        std::vector<size_t> marker(cols, NOT_ASSIGNED);
+        std::vector<size_t> positions(cols, 0);
+        std::vector<std::pair<size_t, double>> row;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            row.clear();
+
+            for (size_t kk = aRp[i]; kk < aRp[i + 1]; ++kk)
+            {
+                const size_t k = aCi[kk];
+                const double aik = aNnz[kk];
+
+                for (size_t jj = bRp[k]; jj < bRp[k + 1]; ++jj)
+                {
+                    if (const size_t j = bCi[jj]; marker[j] != i)
+                    {
+                        marker[j] = i;
+                        positions[j] = row.size();
+                        row.emplace_back(j, aik * bNnz[jj]);
+                    }
+                    else
+                    {
+                        row[positions[j]].second += aik * bNnz[jj];
+                    }
+                }
+            }
+
+            std::sort(row.begin(), row.end(),
+                      [](const std::pair<size_t, double>& lhs,
+                         const std::pair<size_t, double>& rhs) {
+                          return lhs.first < rhs.first;
+                      });
+
+            size_t dst = rowCounts[i];
+            for (const auto& [j, value] : row)
+            {
+                resultCi[dst] = j;
+                resultNnz[dst] = value;
+                ++dst;
+            }
+        }
+    });
+}
+
+// Greedy aggregation based on the strength of connection.
+size_t Aggregate(const MatrixCSRD& a, const VectorND& invDiag,
+                 double threshold, std::vector<size_t>* aggregates)
+{
+    const size_t rows = a.GetRows();
+
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    // Strength of connection: |a_ij| >= threshold * sqrt(|a_ii * a_jj|)
+    std::vector<char> strong(a.NumberOfNonZeros(), 0);
+
+    ParallelFor(ZERO_SIZE, rows, [&](size_t i) {
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (const size_t j = ci[jj];
+                j != i && invDiag[i] != 0.0 && invDiag[j] != 0.0)
+            {
+                strong[jj] = Square(nnz[jj]) >=
+                             Square(threshold) *
+                                 std::fabs(1.0 / (invDiag[i] * invDiag[j]));
+            }
+        }
+    });
+
+    aggregates->assign(rows, NOT_ASSIGNED);
+    size_t numAggregates = 0;
+
+    // Phase 1: Make an aggregate from each node whose strongly connected
+    // neighbors are not aggregated yet.
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if ((*aggregates)[i] != NOT_ASSIGNED)
+        {
+            continue;
+        }
+
+        bool hasStrongNeighbor = false;
+        bool isFree = true;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (strong[jj])
+            {
+                hasStrongNeighbor = true;
+
+                if ((*aggregates)[ci[jj]] != NOT_ASSIGNED)
+                {
+                    isFree = false;
+                    break;
+                }
+            }
+        }
+
+        if (hasStrongNeighbor && isFree)
+        {
+            (*aggregates)[i] = numAggregates;
+
+            for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+            {
+                if (strong[jj])
+                {
+                    (*aggregates)[ci[jj]] = numAggregates;
+                }
+            }
+
+            ++numAggregates;
+        }
+    }
+
+    // Phase 2: Attach the remaining nodes to the aggregate of the most
+    // strongly connected neighbor.
+    std::vector<size_t> phase1 = *aggregates;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (phase1[i] != NOT_ASSIGNED)
+        {
+            continue;
+        }
+
+        double maxValue = 0.0;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (const size_t j = ci[jj];
+                j != i && phase1[j] != NOT_ASSIGNED &&
+                std::fabs(nnz[jj]) > maxValue)
+            {
+                maxValue = std::fabs(nnz[jj]);
+                (*aggregates)[i] = phase1[j];
+            }
+        }
+    }
+
+    // Phase 3: Make new aggregates from whatever is left.
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if ((*aggregates)[i] != NOT_ASSIGNED)
+        {
+            continue;
+        }
+
+        (*aggregates)[i] = numAggregates;
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (ci[jj] != i && nnz[jj] != 0.0 &&
+                (*aggregates)[ci[jj]] == NOT_ASSIGNED)
+            {
+                (*aggregates)[ci[jj]] = numAggregates;
+            }
+        }
+
+        ++numAggregates;
+    }
+
+    return numAggregates;
+}
+
+// Builds P = (I - omega D^-1 A) P0 where P0 is the tentative prolongation
+// operator which represents the constant vector on each aggregate.
+void BuildProlongation(const MatrixCSRD& a, const VectorND& invDiag,
+                       const std::vector<size_t>& aggregates,
+                       size_t numAggregates, double damping, MatrixCSRD* p)
+{
+    const size_t rows = a.GetRows();
+
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    // Tentative prolongation operator
+    std::vector<size_t> aggregateSizes(numAggregates, 0);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        ++aggregateSizes[aggregates[i]];
+    }
+
+    MatrixCSRD p0;
+    p0.Reserve(rows, numAggregates, rows);
+
+    auto p0Rp = p0.RowPointersBegin();
+    auto p0Ci = p0.ColumnIndicesBegin();
+    auto p0Nnz = p0.NonZeroBegin();
+
+    p0Rp[0] = 0;
+    ParallelFor(ZERO_SIZE, rows, [&](size_t i) {
+        p0Rp[i + 1] = i + 1;
+        p0Ci[i] = aggregates[i];
+        p0Nnz[i] =
+            1.0 / std::sqrt(static_cast<double>(aggregateSizes[aggregates[i]]));
+    });
+
+    // Estimate the spectral radius of D^-1 A using Gershgorin's theorem.
+    const double rho = ParallelReduce(
+        ZERO_SIZE, rows, 0.0,
+        [&](size_t begin, size_t end, double init) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                double sum = 0.0;
+
+                for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+                {
+                    sum += std::fabs(nnz[jj]);
+                }
+
+                init = std::max(init, std::fabs(invDiag[i]) * sum);
+            }
+
+            return init;
+        },
+        [](double lhs, double rhs) { return std::max(lhs, rhs); });
+
+    const double omega = (rho > 0.0) ? damping / rho : 0.0;
+
+    // Smoother S = I - omega D^-1 A
+    MatrixCSRD s = a;
+    auto sNnz = s.NonZeroBegin();
+
+    ParallelFor(ZERO_SIZE, rows, [&](size_t i) {
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            sNnz[jj] = ((ci[jj] == i) ? 1.0 : 0.0) -
+                       omega * invDiag[i] * nnz[jj];
+        }
+    });
+
+    Multiply(s, p0, p);
+}
+}  // namespace
+
+void AMGHierarchy::Build(const MatrixCSRD& A, const AMGParameters& params)
+{
+    const bool isSameParams =
+        m_params.maxNumberOfLevels == params.maxNumberOfLevels &&
+        m_params.coarsestSize == params.coarsestSize &&
+        m_params.strengthThreshold == params.strengthThreshold &&
+        m_params.prolongationDamping == params.prolongationDamping;
+
+    m_isLastBuildReused =
+        !m_levels.empty() && isSameParams && IsSamePattern(A);
+    m_fineMatrix = &A;
+    m_params = params;
+
+    if (m_isLastBuildReused)
+    {
+        BuildCoarseOperators();
+        return;
+    }
+
+    m_lastRowPointers.assign(A.RowPointersBegin(), A.RowPointersEnd());
+    m_lastColumnIndices.assign(A.ColumnIndicesBegin(), A.ColumnIndicesEnd());
+
+    m_levels.clear();
+    m_levels.emplace_back();
+
+    std::vector<size_t> aggregates;
+
+    while (true)
+    {
+        const size_t level = m_levels.size() - 1;
+        const MatrixCSRD& a = GetMatrix(level);
+
+        // Every level needs the inverse diagonal for smoothing, so it is
+        // computed here once before deciding whether to coarsen further.
+        ComputeInverseDiagonal(a, &m_levels[level].invDiag);
+
+        if (m_levels.size() >= std::max(params.maxNumberOfLevels, ONE_SIZE) ||
+            a.GetRows() <= params.coarsestSize)
+        {
+            break;
+        }
+
+        // Coarse operators are denser and weaker coupled, so the strength
+        // threshold is relaxed on each level.
+        const double threshold = params.strengthThreshold *
+                                 std::pow(0.5, static_cast<double>(level));
+        const size_t numAggregates = Aggregate(a, m_levels[level].invDiag,
+                                               threshold, &aggregates);
+
+        // Stop if the aggregation cannot make coarser level.
+        if (numAggregates == 0 || numAggregates >= a.GetRows())
+        {
+            break;
+        }
+
+        Level coarser;
+
+        BuildProlongation(a, m_levels[level].invDiag, aggregates,
+                          numAggregates, params.prolongationDamping,
+                          &m_levels[level].P);
+        Transpose(m_levels[level].P, &m_levels[level].R);
+
+        MatrixCSRD ap;
+        Multiply(a, m_levels[level].P, &ap);
+        Multiply(m_levels[level].R, ap, &coarser.A);
+
+        m_levels.emplace_back(std::move(coarser));
+    }
+
+    BuildCoarseOperators();
+}
+
+void AMGHierarchy::Clear()
+{
+    m_fineMatrix = nullptr;
+    m_levels.clear();
+    m_lastRowPointers.clear();
+    m_lastColumnIndices.clear();
+    m_isLastBuildReused = false;
+}
+
+void AMGHierarchy::VCycle(const VectorND& b, VectorND* x)
+{
+    if (m_levels.empty())
+    {
+        return;
+    }
+
+    VCycle(0, b, x);
+}
+
+size_t AMGHierarchy::GetNumberOfLevels() const
+{
+    return m_levels.size();
+}
+
+size_t AMGHierarchy::GetNumberOfRows(size_t level) const
+{
+    return GetMatrix(level).GetRows();
+}
+
+bool AMGHierarchy::IsLastBuildReused() const
+{
+    return m_isLastBuildReused;
+}
+
+const MatrixCSRD& AMGHierarchy::GetMatrix(size_t level) const
+{
+    return (level == 0) ? *m_fineMatrix : m_levels[level].A;
+}
+
+bool AMGHierarchy::IsSamePattern(const MatrixCSRD& A) const
+{
+    return m_lastRowPointers.size() == A.GetRows() + 1 &&
+           m_lastColumnIndices.size() == A.NumberOfNonZeros() &&
+           std::equal(m_lastRowPointers.begin(), m_lastRowPointers.end(),
+                      A.RowPointersBegin()) &&
+           std::equal(m_lastColumnIndices.begin(), m_lastColumnIndices.end(),
+                      A.ColumnIndicesBegin());
+}
+
+void AMGHierarchy::BuildCoarseOperators()
+{
+    for (size_t level = 0; level < m_levels.size(); ++level)
+    {
+        const MatrixCSRD& a = GetMatrix(level);
+
+        // The coarse operators and the inverse diagonals are already computed
+        // for a new hierarchy, so only the reused one needs them again.
+        if (m_isLastBuildReused)
+        {
+            if (level > 0)
+            {
+                MatrixCSRD ap;
+                Multiply(GetMatrix(level - 1), m_levels[level - 1].P, &ap);
+                Multiply(m_levels[level - 1].R, ap, &m_levels[level].A);
+            }
+
+            ComputeInverseDiagonal(a, &m_levels[level].invDiag);
+        }
+
+        m_levels[level].x.Resize(a.GetRows(), 0.0);
+        m_levels[level].b.Resize(a.GetRows(), 0.0);
+        m_levels[level].r.Resize(a.GetRows(), 0.0);
+    }
+}
+
+void AMGHierarchy::VCycle(size_t level, const VectorND& b, VectorND* x)
+{
+    if (level + 1 == m_levels.size())
+    {
+        SolveCoarsest(b, x);
+        return;
+    }
+
+    const MatrixCSRD& a = GetMatrix(level);
+    Level& current = m_levels[level];
+    Level& coarser = m_levels[level + 1];
+
+    x->Fill(0.0);
+
+    Smooth(level, b, m_params.numberOfPreSmoothingIter, x);
+
+    // Restrict the residual
+    Residual(a, *x, b, &current.r);
+    MVM(current.R, current.r, false, &coarser.b);
+
+    VCycle(level + 1, coarser.b, &coarser.x);
+
+    // Correct with the coarse-grid solution
+    MVM(current.P, coarser.x, true, x);
+
+    Smooth(level, b, m_params.numberOfPostSmoothingIter, x);
+}
+
+void AMGHierarchy::Smooth(size_t level, const VectorND& b,
+                          unsigned int numberOfIter, VectorND* x)
+{
+    const MatrixCSRD& a = GetMatrix(level);
+    Level& current = m_levels[level];
+    const double weight = m_params.jacobiWeight;
+
+    for (unsigned int iter = 0; iter < numberOfIter; ++iter)
+    {
+        Residual(a, *x, b, &current.r);
+
+        ParallelFor(ZERO_SIZE, a.GetRows(), [&](size_t i) {
+            (*x)[i] += weight * current.invDiag[i] * current.r[i];
+        });
+    }
+}
+
+void AMGHierarchy::SolveCoarsest(const VectorND& b, VectorND* x)
+{
+    const MatrixCSRD& a = GetMatrix(m_levels.size() - 1);
+    const VectorND& invDiag = m_levels.back().invDiag;
+    const size_t rows = a.GetRows();
+
+    const auto rp = a.RowPointersBegin();
+    const auto ci = a.ColumnIndicesBegin();
+    const auto nnz = a.NonZeroBegin();
+
+    const auto relax = [&](size_t i) {
+        double sum = b[i];
+
+        for (size_t jj = rp[i]; jj < rp[i + 1]; ++jj)
+        {
+            if (const size_t j = ci[jj]; j != i)
+            {
+                sum -= nnz[jj] * (*x)[j];
+            }
+        }
+
+        (*x)[i] = sum * invDiag[i];
+    };
+
+    x->Fill(0.0);
+
+    // Symmetric Gauss-Seidel keeps the V-cycle symmetric.
+    for (unsigned int iter = 0; iter < m_params.numberOfCoarsestIter; ++iter)
+    {
+        for (size_t i = 0; i < rows; ++i)
+        {
+            relax(i);
+        }
+
+        for (size_t i = rows; i > 0; --i)
+        {
+            relax(i - 1);
+        }
+    }
+}
+}  // namespace CubbyFlow
@@ -0,0 +1,345 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Macros.hpp>
+
+#ifdef CUBBYFLOW_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace CubbyFlow
+{
+namespace
+{
+constexpr std::array<char, 8> MAGIC = { 'C', 'F', 'C', 'H',
+                                        'N', 'L', '0', '1' };
+
+// A channel record consists of the header below, the name of the channel,
+// zero padding up to the alignment, and the data of the channel.
+struct ChannelHeader
+{
+    uint64_t nameLength;
+    uint64_t elementSize;
+    uint64_t numberOfElements;
+};
+
+size_t AlignUp(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+ChannelStreamWriter::ChannelStreamWriter(const std::string& filename)
+    : m_file{ filename, std::ios::binary | std::ios::trunc }
+{
+    if (!m_file)
+    {
+        throw std::invalid_argument{ "Cannot open file " + filename };
+    }
+
+    m_file.write(MAGIC.data(), MAGIC.size());
+    m_offset = MAGIC.size();
+}
+
+ChannelStreamWriter::~ChannelStreamWriter()
+{
+    // A destructor cannot report the failure, so call Close() explicitly to
+    // find out whether the data reached the file.
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+}
+
+void ChannelStreamWriter::WriteRaw(const std::string& name, const void* data,
+                                   size_t elementSize, size_t numberOfElements)
+{
+    if (!m_file.is_open())
+    {
+        throw std::invalid_argument{ "Channel stream is already closed." };
+    }
+
+    const ChannelHeader header{ name.size(), elementSize, numberOfElements };
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file.write(name.data(), static_cast<std::streamsize>(name.size()));
+    m_offset += sizeof(header) + name.size();
+
+    const size_t dataOffset = AlignUp(m_offset, CHANNEL_ALIGNMENT);
+    const std::array<char, CHANNEL_ALIGNMENT> padding{};
+    m_file.write(padding.data(),
+                 static_cast<std::streamsize>(dataOffset - m_offset));
+
+    const size_t dataSize = elementSize * numberOfElements;
+    m_file.write(static_cast<const char*>(data),
+                 static_cast<std::streamsize>(dataSize));
+    m_offset = dataOffset + dataSize;
+
+    if (!m_file)
+    {
+        throw std::invalid_argument{ "Failed to write channel " + name };
+    }
+}
+
+void ChannelStreamWriter::Close()
+{
+    if (m_file.is_open())
+    {
+        m_file.close();
+
+        if (m_file.fail())
+        {
+            throw std::runtime_error{ "Failed to flush and close the file." };
+        }
+    }
+}
+
+MappedChannelReader::MappedChannelReader(const std::string& filename)
+{
+    Map(filename);
+
+    try
+    {
+        ParseChannels();
+    }
+    catch (...)
+    {
+        Unmap();
+        throw;
+    }
+}
+
+MappedChannelReader::~MappedChannelReader()
+{
+    Unmap();
+}
+
+size_t MappedChannelReader::NumberOfChannels() const
+{
+    return m_channels.size();
+}
+
+bool MappedChannelReader::HasChannel(const std::string& name) const
+{
+    return m_channels.find(name) != m_channels.end();
+}
+
+std::vector<std::string> MappedChannelReader::ChannelNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(m_channels.size());
+
+    for (const auto& channel : m_channels)
+    {
+        names.push_back(channel.first);
+    }
+
+    return names;
+}
+
+size_t MappedChannelReader::ElementSize(const std::string& name) const
+{
+    return GetChannel(name).elementSize;
+}
+
+ConstArrayView1<uint8_t> MappedChannelReader::RawView(
+    const std::string& name) const
+{
+    const Channel& channel = GetChannel(name);
+
+    return ConstArrayView1<uint8_t>(
+        m_data + channel.offset,
+        channel.elementSize * channel.numberOfElements);
+}
+
+const MappedChannelReader::Channel& MappedChannelReader::GetChannel(
+    const std::string& name) const
+{
+    const auto iter = m_channels.find(name);
+    if (iter == m_channels.end())
+    {
+        throw std::invalid_argument{ "Cannot find channel " + name };
+    }
+
+    return iter->second;
+}
+
+const MappedChannelReader::Channel& MappedChannelReader::GetChannel(
+    const std::string& name, size_t elementSize) const
+{
+    const Channel& channel = GetChannel(name);
+    if (channel.elementSize != elementSize)
+    {
+        throw std::invalid_argument{ "Element size mismatch for channel " +
+                                     name };
+    }
+
+    return channel;
+}
+
+void MappedChannelReader::Map(const std::string& filename)
+{
+#ifdef CUBBYFLOW_WINDOWS
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::invalid_argument{ "Cannot open file " + filename };
+    }
+    m_fileHandle = file;
+
+    LARGE_INTEGER size;
+    GetFileSizeEx(file, &size);
+    m_size = static_cast<size_t>(size.QuadPart);
+    if (m_size == 0)
+    {
+        return;
+    }
+
+    HANDLE mapping =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        Unmap();
+        throw std::invalid_argument{ "Cannot map file " + filename };
+    }
+    m_mappingHandle = mapping;
+
+    m_data = static_cast<const uint8_t*>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::invalid_argument{ "Cannot open file " + filename };
+    }
+
+    struct stat st
+    {
+    };
+    fstat(fd, &st);
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size == 0)
+    {
+        close(fd);
+        return;
+    }
+
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+
+    m_data = (data == MAP_FAILED) ? nullptr : static_cast<uint8_t*>(data);
+#endif
+
+    if (m_data == nullptr)
+    {
+        Unmap();
+        throw std::invalid_argument{ "Cannot map file " + filename };
+    }
+}
+
+void MappedChannelReader::Unmap()
+{
+#ifdef CUBBYFLOW_WINDOWS
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    }
+#else
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+}
+
+void MappedChannelReader::ParseChannels()
+{
+    if (m_size < MAGIC.size() ||
+        std::memcmp(m_data, MAGIC.data(), MAGIC.size()) != 0)
+    {
+        throw std::invalid_argument{ "Invalid channel stream file." };
+    }
+
+    // The header fields come from the file, so every size is checked against
+    // the remaining bytes before any offset is computed from it.
+    size_t offset = MAGIC.size();
+    while (offset < m_size)
+    {
+        ChannelHeader header{};
+        if (m_size - offset < sizeof(header))
+        {
+            throw std::invalid_argument{ "Truncated channel header." };
+        }
+        std::memcpy(&header, m_data + offset, sizeof(header));
+        offset += sizeof(header);
+
+        if (header.nameLength > m_size - offset)
+        {
+            throw std::invalid_argument{ "Truncated channel name." };
+        }
+        std::string name(reinterpret_cast<const char*>(m_data + offset),
+                         static_cast<size_t>(header.nameLength));
+        offset += static_cast<size_t>(header.nameLength);
+
+        if (header.elementSize == 0)
+        {
+            throw std::invalid_argument{ "Invalid element size for channel " +
+                                         name };
+        }
+
+        Channel channel;
+        channel.offset =
+            AlignUp(offset, ChannelStreamWriter::CHANNEL_ALIGNMENT);
+        if (channel.offset > m_size ||
+            header.numberOfElements >
+                (m_size - channel.offset) / header.elementSize)
+        {
+            throw std::invalid_argument{ "Truncated channel " + name };
+        }
+        channel.elementSize = static_cast<size_t>(header.elementSize);
+        channel.numberOfElements =
+            static_cast<size_t>(header.numberOfElements);
+
+        offset = channel.offset +
+                 channel.elementSize * channel.numberOfElements;
+
+        m_channels[name] = channel;
+    }
+}
+}  // namespace CubbyFlow
@@ -0,0 +1,429 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Checkpoint.hpp>
+#include <Core/Utils/Macros.hpp>
+
+#ifdef CUBBYFLOW_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+
+namespace CubbyFlow
+{
+namespace
+{
+// Channels that have not changed since the last checkpoint are stored as a
+// reference to the file that holds their data, under this name prefix.
+const std::string REFERENCE_PREFIX = "@ref/";
+
+uint64_t RotateLeft(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+// 64-bit content hash used to detect the changed channels.
+uint64_t ComputeHash(const uint8_t* data, size_t size)
+{
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+
+    uint64_t hash = prime1 ^ (static_cast<uint64_t>(size) * prime2);
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+
+        hash ^= RotateLeft(word * prime2, 31) * prime1;
+        hash = RotateLeft(hash, 27) * prime1 + prime2;
+    }
+
+    for (; i < size; ++i)
+    {
+        hash ^= data[i] * prime1;
+        hash = RotateLeft(hash, 11) * prime2;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime1;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+std::string GetDirectory(const std::string& filename)
+{
+    const size_t pos = filename.find_last_of("/\\");
+    return (pos == std::string::npos) ? std::string{}
+                                      : filename.substr(0, pos + 1);
+}
+
+std::string GetBaseName(const std::string& filename)
+{
+    const size_t pos = filename.find_last_of("/\\");
+    return (pos == std::string::npos) ? filename : filename.substr(pos + 1);
+}
+
+// Moves the file \p from over the file \p to, replacing it atomically.
+bool MoveFileOver(const std::string& from, const std::string& to)
+{
+#ifdef CUBBYFLOW_WINDOWS
+    return MoveFileExA(from.c_str(), to.c_str(),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+}  // namespace
+
+void Checkpoint::WriteString(const std::string& name, const std::string& value)
+{
+    WriteRaw(name, value.data(), 1, value.size());
+}
+
+void Checkpoint::WriteSerializable(const std::string& name,
+                                   const Serializable& serializable)
+{
+    std::vector<uint8_t> buffer;
+    serializable.Serialize(&buffer);
+
+    if (m_writer != nullptr)
+    {
+        WriteRaw(name, buffer.data(), 1, buffer.size());
+        return;
+    }
+
+    // Take over the serialized buffer instead of copying it.
+    WriteRaw(name, nullptr, 1, 0);
+    m_channels[name].data = std::move(buffer);
+}
+
+void Checkpoint::WriteRaw(const std::string& name, const void* data,
+                          size_t elementSize, size_t numberOfElements)
+{
+    if (name.empty() || name[0] == '@')
+    {
+        throw std::invalid_argument{ "Invalid channel name " + name };
+    }
+
+    if (elementSize == 0)
+    {
+        throw std::invalid_argument{ "Element size must be greater than 0." };
+    }
+
+    if (m_writer != nullptr)
+    {
+        m_writer->WriteChannel(name, data, elementSize, numberOfElements);
+        return;
+    }
+
+    Channel& channel = m_channels[name];
+    channel.elementSize = elementSize;
+    channel.data.resize(elementSize * numberOfElements);
+    if (!channel.data.empty())
+    {
+        std::memcpy(channel.data.data(), data, channel.data.size());
+    }
+}
+
+std::string Checkpoint::String(const std::string& name) const
+{
+    const Channel& channel = GetChannel(name, 1);
+
+    return std::string(channel.data.begin(), channel.data.end());
+}
+
+void Checkpoint::ReadSerializable(const std::string& name,
+                                  Serializable* serializable) const
+{
+    serializable->Deserialize(GetChannel(name, 1).data);
+}
+
+bool Checkpoint::HasChannel(const std::string& name) const
+{
+    return m_channels.find(name) != m_channels.end();
+}
+
+size_t Checkpoint::NumberOfChannels() const
+{
+    return m_channels.size();
+}
+
+std::vector<std::string> Checkpoint::ChannelNames() const
+{
+    std::vector<std::string> names;
+    names.reserve(m_channels.size());
+
+    for (const auto& channel : m_channels)
+    {
+        names.push_back(channel.first);
+    }
+
+    return names;
+}
+
+size_t Checkpoint::ElementSize(const std::string& name) const
+{
+    const auto iter = m_channels.find(name);
+    if (iter == m_channels.end())
+    {
+        throw std::invalid_argument{ "Cannot find channel " + name };
+    }
+
+    return iter->second.elementSize;
+}
+
+ConstArrayView1<uint8_t> Checkpoint::RawView(const std::string& name) const
+{
+    const Channel& channel = GetChannel(name, ElementSize(name));
+
+    return ConstArrayView1<uint8_t>(channel.data.data(), channel.data.size());
+}
+
+void Checkpoint::Clear()
+{
+    m_channels.clear();
+}
+
+void Checkpoint::Load(const std::string& filename)
+{
+    Clear();
+
+    const MappedChannelReader reader(filename);
+    const std::string directory = GetDirectory(filename);
+    std::unordered_map<std::string, std::unique_ptr<MappedChannelReader>>
+        referencedReaders;
+
+    for (const std::string& name : reader.ChannelNames())
+    {
+        if (name.compare(0, REFERENCE_PREFIX.size(), REFERENCE_PREFIX) != 0)
+        {
+            const ConstArrayView1<uint8_t> data = reader.RawView(name);
+            const size_t elementSize = reader.ElementSize(name);
+            WriteRaw(name, data.data(), elementSize,
+                     data.Length() / elementSize);
+            continue;
+        }
+
+        const ConstArrayView1<uint8_t> reference = reader.RawView(name);
+        const std::string referencedFilename(
+            reinterpret_cast<const char*>(reference.data()),
+            reference.Length());
+
+        std::unique_ptr<MappedChannelReader>& referencedReader =
+            referencedReaders[referencedFilename];
+        if (referencedReader == nullptr)
+        {
+            referencedReader = std::make_unique<MappedChannelReader>(
+                directory + referencedFilename);
+        }
+
+        const std::string channelName = name.substr(REFERENCE_PREFIX.size());
+        const ConstArrayView1<uint8_t> data =
+            referencedReader->RawView(channelName);
+        const size_t elementSize = referencedReader->ElementSize(channelName);
+        WriteRaw(channelName, data.data(), elementSize,
+                 data.Length() / elementSize);
+    }
+}
+
+const Checkpoint::Channel& Checkpoint::GetChannel(const std::string& name,
+                                                  size_t elementSize) const
+{
+    const auto iter = m_channels.find(name);
+    if (iter == m_channels.end())
+    {
+        throw std::invalid_argument{ "Cannot find channel " + name };
+    }
+
+    if (iter->second.elementSize != elementSize)
+    {
+        throw std::invalid_argument{ "Element size mismatch for channel " +
+                                     name };
+    }
+
+    return iter->second;
+}
+
+CheckpointWriter::CheckpointWriter()
+{
+    m_checkpoint.m_writer = this;
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    Abort();
+}
+
+Checkpoint& CheckpointWriter::Begin(const std::string& filename)
+{
+    Abort();
+
+    // Overwriting a file that a newer checkpoint refers to would silently
+    // change the data that checkpoint restores.
+    if (m_referencedFilenames.count(filename) > 0)
+    {
+        throw std::invalid_argument{
+            "Checkpoint " + filename +
+            " is referenced by a newer checkpoint. Call Reset() before "
+            "overwriting it."
+        };
+    }
+
+    // Write to a temporary file first so that a job killed in the middle of
+    // writing does not leave a broken checkpoint behind.
+    m_stream = std::make_unique<ChannelStreamWriter>(filename + ".tmp");
+    m_filename = filename;
+
+    return m_checkpoint;
+}
+
+void CheckpointWriter::Commit()
+{
+    if (m_stream == nullptr)
+    {
+        throw std::invalid_argument{ "No checkpoint has begun." };
+    }
+
+    const std::string filename = m_filename;
+
+    // A truncated temporary file must never replace the last good checkpoint.
+    try
+    {
+        m_stream->Close();
+    }
+    catch (const std::runtime_error&)
+    {
+        Abort();
+        throw std::runtime_error{ "Cannot write checkpoint " + filename };
+    }
+
+    m_stream.reset();
+
+    if (!MoveFileOver(filename + ".tmp", filename))
+    {
+        std::remove((filename + ".tmp").c_str());
+        Abort();
+        throw std::invalid_argument{ "Cannot write checkpoint " + filename };
+    }
+
+    m_records = std::move(m_newRecords);
+    m_referencedFilenames.insert(m_newReferencedFilenames.begin(),
+                                 m_newReferencedFilenames.end());
+    m_lastNumberOfStoredChannels = m_numberOfStoredChannels;
+    m_lastNumberOfStoredBytes = m_numberOfStoredBytes;
+
+    Abort();
+}
+
+void CheckpointWriter::Write(const Checkpoint& checkpoint,
+                             const std::string& filename)
+{
+    Checkpoint& stream = Begin(filename);
+
+    for (const std::string& name : checkpoint.ChannelNames())
+    {
+        const ConstArrayView1<uint8_t> data = checkpoint.RawView(name);
+        const size_t elementSize = checkpoint.ElementSize(name);
+
+        stream.WriteRaw(name, data.data(), elementSize,
+                        data.Length() / elementSize);
+    }
+
+    Commit();
+}
+
+void CheckpointWriter::Reset()
+{
+    m_records.clear();
+    m_referencedFilenames.clear();
+}
+
+size_t CheckpointWriter::GetLastNumberOfStoredChannels() const
+{
+    return m_lastNumberOfStoredChannels;
+}
+
+size_t CheckpointWriter::GetLastNumberOfStoredBytes() const
+{
+    return m_lastNumberOfStoredBytes;
+}
+
+void CheckpointWriter::WriteChannel(const std::string& name, const void* data,
+                                    size_t elementSize,
+                                    size_t numberOfElements)
+{
+    if (m_stream == nullptr)
+    {
+        throw std::invalid_argument{ "No checkpoint has begun." };
+    }
+
+    if (m_newRecords.count(name) > 0)
+    {
+        throw std::invalid_argument{ "Channel " + name +
+                                     " is written twice." };
+    }
+
+    ChannelRecord record;
+    record.hash = ComputeHash(static_cast<const uint8_t*>(data),
+                              elementSize * numberOfElements);
+    record.elementSize = elementSize;
+    record.size = elementSize * numberOfElements;
+    record.filename = m_filename;
+
+    // Unchanged channels refer to the file holding their data, unless that
+    // file is the one being overwritten now.
+    const auto iter = m_records.find(name);
+    if (iter != m_records.end() && iter->second.filename != m_filename &&
+        iter->second.hash == record.hash &&
+        iter->second.elementSize == record.elementSize &&
+        iter->second.size == record.size)
+    {
+        const std::string referencedFilename =
+            GetBaseName(iter->second.filename);
+        m_stream->WriteRaw(REFERENCE_PREFIX + name, referencedFilename.data(),
+                           1, referencedFilename.size());
+        m_newRecords[name] = iter->second;
+        m_newReferencedFilenames.insert(iter->second.filename);
+        return;
+    }
+
+    m_stream->WriteRaw(name, data, elementSize, numberOfElements);
+    m_newRecords[name] = record;
+    ++m_numberOfStoredChannels;
+    m_numberOfStoredBytes += record.size;
+}
+
+void CheckpointWriter::Abort()
+{
+    if (m_stream != nullptr)
+    {
+        m_stream.reset();
+        std::remove((m_filename + ".tmp").c_str());
+    }
+
+    m_filename.clear();
+    m_newRecords.clear();
+    m_newReferencedFilenames.clear();
+    m_numberOfStoredChannels = 0;
+    m_numberOfStoredBytes = 0;
+}
+}  // namespace CubbyFlow
\ No newline at end of file
@@ -11,8 +11,17 @@
 #include <Core/Utils/Logging.hpp>
 #include <Core/Utils/Macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace CubbyFlow
 {
@@ -22,7 +31,8 @@ static std::ostream* infoOutStream = &std::cout;
 static std::ostream* warnOutStream = &std::cout;
 static std::ostream* errorOutStream = &std::cerr;
 static std::ostream* debugOutStream = &std::cout;
-static LogLevel logLevel = LogLevel::All;
+static std::atomic<LogLevel> logLevel{ LogLevel::All };
+static std::atomic<bool> isAsyncMode{ false };
 
 inline std::ostream* LevelToStream(LogLevel level)
 {
@@ -70,6 +80,284 @@ inline bool IsLeq(LogLevel a, LogLevel b)
     return static_cast<uint8_t>(a) <= static_cast<uint8_t>(b);
 }
 
+namespace
+{
+struct LogRecord
+{
+    LogLevel level = LogLevel::All;
+    std::string message;
+};
+
+//! Single-producer single-consumer lock-free ring buffer of the log records.
+class LogRingBuffer
+{
+ public:
+    bool TryPush(LogRecord& record)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+
+        m_records[tail % CAPACITY] = std::move(record);
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPop(LogRecord& record)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        record = std::move(m_records[head % CAPACITY]);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    [[nodiscard]] size_t GetHead() const
+    {
+        return m_head.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t GetTail() const
+    {
+        return m_tail.load(std::memory_order_acquire);
+    }
+
+    std::atomic<bool> isOrphaned{ false };
+
+ private:
+    static constexpr size_t CAPACITY = 1024;
+
+    std::array<LogRecord, CAPACITY> m_records;
+    std::atomic<size_t> m_head{ 0 };
+    std::atomic<size_t> m_tail{ 0 };
+};
+
+//! Marks the ring buffer of the thread orphaned when the thread exits, so
+//! that the drain thread can release it once it is empty.
+struct ThreadLogBuffer
+{
+    ~ThreadLogBuffer()
+    {
+        if (buffer != nullptr)
+        {
+            buffer->isOrphaned = true;
+        }
+    }
+
+    std::shared_ptr<LogRingBuffer> buffer;
+};
+
+class AsyncLogBackend
+{
+ public:
+    AsyncLogBackend() = default;
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+
+    AsyncLogBackend(AsyncLogBackend&&) noexcept = delete;
+
+    ~AsyncLogBackend()
+    {
+        // Flush on shutdown and write the later logs synchronously
+        Flush();
+        isAsyncMode = false;
+        Stop();
+    }
+
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+    AsyncLogBackend& operator=(AsyncLogBackend&&) noexcept = delete;
+
+    static AsyncLogBackend& GetInstance()
+    {
+        static AsyncLogBackend backend;
+        return backend;
+    }
+
+    void Start()
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        if (!m_thread.joinable())
+        {
+            m_isRunning = true;
+            m_thread = std::thread{ [this]() { Run(); } };
+        }
+    }
+
+    void Stop()
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        if (m_thread.joinable())
+        {
+            m_isRunning = false;
+            m_wakeCondition.notify_one();
+            m_thread.join();
+        }
+
+        // Write the records pushed before the drain thread stopped
+        Drain();
+    }
+
+    void Push(LogRecord&& record)
+    {
+        LogRingBuffer& buffer = GetThreadBuffer();
+
+        while (!buffer.TryPush(record))
+        {
+            // The ring buffer is full; wake up the drain thread and retry.
+            if (!m_isRunning)
+            {
+                Drain();
+            }
+
+            m_wakeCondition.notify_one();
+            std::this_thread::yield();
+        }
+
+        // The record raced with Stop(); nobody else will drain it
+        if (!m_isRunning)
+        {
+            Drain();
+        }
+    }
+
+    void Flush()
+    {
+        std::vector<std::pair<std::shared_ptr<LogRingBuffer>, size_t>> targets;
+        {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            for (const std::shared_ptr<LogRingBuffer>& buffer : m_buffers)
+            {
+                targets.emplace_back(buffer, buffer->GetTail());
+            }
+        }
+
+        for (const auto& [buffer, tail] : targets)
+        {
+            while (buffer->GetHead() < tail)
+            {
+                if (!m_isRunning)
+                {
+                    Drain();
+                    break;
+                }
+
+                m_wakeCondition.notify_one();
+                std::this_thread::yield();
+            }
+        }
+
+        // Also make sure that the streams are flushed after the last drain
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+    }
+
+ private:
+    LogRingBuffer& GetThreadBuffer()
+    {
+        thread_local ThreadLogBuffer threadBuffer;
+
+        if (threadBuffer.buffer == nullptr)
+        {
+            threadBuffer.buffer = std::make_shared<LogRingBuffer>();
+
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            m_buffers.push_back(threadBuffer.buffer);
+        }
+
+        return *threadBuffer.buffer;
+    }
+
+    void Run()
+    {
+        while (m_isRunning)
+        {
+            if (Drain() == 0)
+            {
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wakeCondition.wait_for(lock, std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    size_t Drain()
+    {
+        std::lock_guard<std::mutex> drainLock(m_drainMutex);
+
+        std::vector<std::shared_ptr<LogRingBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            buffers = m_buffers;
+        }
+
+        size_t numberOfRecords = 0;
+        LogRecord record;
+
+        {
+            std::lock_guard<std::mutex> lock(critical);
+
+            for (const std::shared_ptr<LogRingBuffer>& buffer : buffers)
+            {
+                while (buffer->TryPop(record))
+                {
+                    if (std::ostream* stream = LevelToStream(record.level);
+                        stream != nullptr)
+                    {
+                        *stream << record.message << '\n';
+                    }
+
+                    ++numberOfRecords;
+                }
+            }
+
+            if (numberOfRecords > 0)
+            {
+                for (std::ostream* stream : { infoOutStream, warnOutStream,
+                                              errorOutStream, debugOutStream })
+                {
+                    if (stream != nullptr)
+                    {
+                        stream->flush();
+                    }
+                }
+            }
+        }
+
+        // Release the buffers of the exited threads
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        m_buffers.erase(
+            std::remove_if(m_buffers.begin(), m_buffers.end(),
+                           [](const std::shared_ptr<LogRingBuffer>& buffer) {
+                               return buffer->isOrphaned &&
+                                      buffer->GetHead() == buffer->GetTail();
+                           }),
+            m_buffers.end());
+
+        return numberOfRecords;
+    }
+
+    std::mutex m_stateMutex;
+    std::mutex m_registryMutex;
+    std::mutex m_drainMutex;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::vector<std::shared_ptr<LogRingBuffer>> m_buffers;
+    std::thread m_thread;
+    std::atomic<bool> m_isRunning{ false };
+};
+}  // namespace
+
 Logger::Logger(LogLevel level) : m_level{ level }
 {
     // Do nothing
@@ -77,36 +365,57 @@ Logger::Logger(LogLevel level) : m_level{ level }
 
 Logger::~Logger()
 {
-    std::lock_guard<std::mutex> lock(critical);
+    if (!Logging::IsEnabled(m_level))
+    {
+        return;
+    }
 
-    if (IsLeq(logLevel, m_level))
+    if (isAsyncMode)
     {
-        std::ostream* stream = LevelToStream(m_level);
-        *stream << m_buffer.str() << std::endl;
-        stream->flush();
+        AsyncLogBackend::GetInstance().Push(
+            LogRecord{ m_level, m_buffer.str() });
+        return;
     }
+
+    std::lock_guard<std::mutex> lock(critical);
+
+    std::ostream* stream = LevelToStream(m_level);
+    *stream << m_buffer.str() << std::endl;
+    stream->flush();
 }
 
 void Logging::SetInfoStream(std::ostream* stream)
 {
+    // Pending logs should go to the previous stream
+    Flush();
+
     std::lock_guard<std::mutex> lock(critical);
     infoOutStream = stream;
 }
 
 void Logging::SetWarnStream(std::ostream* stream)
 {
+    // Pending logs should go to the previous stream
+    Flush();
+
     std::lock_guard<std::mutex> lock(critical);
     warnOutStream = stream;
 }
 
 void Logging::SetErrorStream(std::ostream* stream)
 {
+    // Pending logs should go to the previous stream
+    Flush();
+
     std::lock_guard<std::mutex> lock(critical);
     errorOutStream = stream;
 }
 
 void Logging::SetDebugStream(std::ostream* stream)
 {
+    // Pending logs should go to the previous stream
+    Flush();
+
     std::lock_guard<std::mutex> lock(critical);
     debugOutStream = stream;
 }
@@ -147,10 +456,44 @@ std::string Logging::GetHeader(LogLevel level)
 
 void Logging::SetLevel(LogLevel level)
 {
-    std::lock_guard<std::mutex> lock(critical);
     logLevel = level;
 }
 
+bool Logging::IsEnabled(LogLevel level)
+{
+    return IsLeq(logLevel, level);
+}
+
+void Logging::SetAsyncMode(bool isOn)
+{
+    if (isOn)
+    {
+        AsyncLogBackend::GetInstance().Start();
+        isAsyncMode = true;
+    }
+    else if (isAsyncMode)
+    {
+        // Drain the pending logs before the later logs are written
+        // synchronously, so that the logs of each thread keep their order.
+        AsyncLogBackend::GetInstance().Flush();
+        isAsyncMode = false;
+        AsyncLogBackend::GetInstance().Stop();
+    }
+}
+
+bool Logging::IsAsyncMode()
+{
+    return isAsyncMode;
+}
+
+void Logging::Flush()
+{
+    if (isAsyncMode)
+    {
+        AsyncLogBackend::GetInstance().Flush();
+    }
+}
+
 void Logging::Mute()
 {
     SetLevel(LogLevel::Off);
@@ -0,0 +1,99 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/SIMD.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(CUBBYFLOW_SIMD_X86_64) && defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace CubbyFlow
+{
+namespace
+{
+SIMDLevel DetectSIMDLevel()
+{
+#if defined(CUBBYFLOW_SIMD_X86_64)
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxId = info[0];
+
+    __cpuid(info, 1);
+    const bool hasSSE41 = (info[2] & (1 << 19)) != 0;
+    const bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+
+    // The OS must save the YMM/ZMM registers on context switches.
+    const unsigned long long xcr0 = hasOSXSave ? _xgetbv(0) : 0;
+    const bool hasYMM = (xcr0 & 0x6) == 0x6;
+    const bool hasZMM = (xcr0 & 0xe6) == 0xe6;
+
+    bool hasAVX2 = false;
+    bool hasAVX512 = false;
+    if (maxId >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        hasAVX2 = hasYMM && (info[1] & (1 << 5)) != 0;
+        hasAVX512 = hasZMM && (info[1] & (1 << 16)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    const bool hasSSE41 = __builtin_cpu_supports("sse4.1");
+    const bool hasAVX2 = __builtin_cpu_supports("avx2");
+    const bool hasAVX512 = __builtin_cpu_supports("avx512f");
+#endif
+
+    if (hasAVX512)
+    {
+        return SIMDLevel::AVX512;
+    }
+    if (hasAVX2)
+    {
+        return SIMDLevel::AVX2;
+    }
+    if (hasSSE41)
+    {
+        return SIMDLevel::SSE4;
+    }
+#endif
+
+    return SIMDLevel::Scalar;
+}
+
+std::atomic<SIMDLevel>& CurrentSIMDLevel()
+{
+    static std::atomic<SIMDLevel> s_level{ GetSupportedSIMDLevel() };
+
+    return s_level;
+}
+}  // namespace
+
+SIMDLevel GetSupportedSIMDLevel()
+{
+    static const SIMDLevel s_supportedLevel = DetectSIMDLevel();
+
+    return s_supportedLevel;
+}
+
+SIMDLevel GetSIMDLevel()
+{
+    return CurrentSIMDLevel().load(std::memory_order_relaxed);
+}
+
+void SetSIMDLevel(SIMDLevel level)
+{
+    CurrentSIMDLevel().store(std::min(level, GetSupportedSIMDLevel()),
+                             std::memory_order_relaxed);
+}
+}  // namespace CubbyFlow
\ No newline at end of file
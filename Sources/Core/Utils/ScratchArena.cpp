@@ -0,0 +1,212 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/ScratchArena.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+
+namespace CubbyFlow
+{
+namespace
+{
+size_t RoundUpToAlignment(size_t numberOfBytes)
+{
+    return (numberOfBytes + ScratchArena::ALIGNMENT - 1) /
+           ScratchArena::ALIGNMENT * ScratchArena::ALIGNMENT;
+}
+}  // namespace
+
+ScratchArena::Scope::Scope(ScratchArena& arena)
+    : m_arena{ arena },
+      m_block{ arena.m_currentBlock },
+      m_offset{ arena.m_blocks.empty()
+                    ? 0
+                    : arena.m_blocks[arena.m_currentBlock].offset },
+      m_numberOfBytesInUse{ arena.m_numberOfBytesInUse }
+{
+    // Do nothing
+}
+
+ScratchArena::Scope::~Scope()
+{
+    m_arena.Rewind(m_block, m_offset, m_numberOfBytesInUse);
+}
+
+ScratchArena::ScratchArena(ScratchArena&& other) noexcept
+    : m_blocks{ std::move(other.m_blocks) },
+      m_currentBlock{ std::exchange(other.m_currentBlock, 0) },
+      m_numberOfBytesInUse{ std::exchange(other.m_numberOfBytesInUse, 0) },
+      m_highWaterMark{ std::exchange(other.m_highWaterMark, 0) },
+      m_numberOfHeapAllocations{ std::exchange(other.m_numberOfHeapAllocations,
+                                               0) }
+{
+    other.m_blocks.clear();
+}
+
+ScratchArena::~ScratchArena()
+{
+    FreeBlocks();
+}
+
+ScratchArena& ScratchArena::operator=(ScratchArena&& other) noexcept
+{
+    if (this != &other)
+    {
+        FreeBlocks();
+
+        m_blocks = std::move(other.m_blocks);
+        m_currentBlock = std::exchange(other.m_currentBlock, 0);
+        m_numberOfBytesInUse = std::exchange(other.m_numberOfBytesInUse, 0);
+        m_highWaterMark = std::exchange(other.m_highWaterMark, 0);
+        m_numberOfHeapAllocations =
+            std::exchange(other.m_numberOfHeapAllocations, 0);
+
+        other.m_blocks.clear();
+    }
+
+    return *this;
+}
+
+void ScratchArena::Reserve(size_t numberOfBytes)
+{
+    assert(m_numberOfBytesInUse == 0);
+
+    numberOfBytes = RoundUpToAlignment(numberOfBytes);
+
+    if (m_blocks.size() == 1 && m_blocks[0].capacity >= numberOfBytes)
+    {
+        return;
+    }
+
+    FreeBlocks();
+    AddBlock(std::max(numberOfBytes, MIN_BLOCK_SIZE));
+}
+
+void ScratchArena::Clear()
+{
+    assert(m_numberOfBytesInUse == 0);
+
+    FreeBlocks();
+
+    m_highWaterMark = 0;
+    m_numberOfHeapAllocations = 0;
+}
+
+size_t ScratchArena::GetNumberOfBytesInUse() const
+{
+    return m_numberOfBytesInUse;
+}
+
+size_t ScratchArena::GetHighWaterMark() const
+{
+    return m_highWaterMark;
+}
+
+size_t ScratchArena::GetCapacity() const
+{
+    size_t capacity = 0;
+
+    for (const Block& block : m_blocks)
+    {
+        capacity += block.capacity;
+    }
+
+    return capacity;
+}
+
+size_t ScratchArena::GetNumberOfHeapAllocations() const
+{
+    return m_numberOfHeapAllocations;
+}
+
+void* ScratchArena::Allocate(size_t numberOfBytes)
+{
+    const size_t size = RoundUpToAlignment(numberOfBytes);
+
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    // The blocks after the current one are always empty.
+    while (m_currentBlock < m_blocks.size() &&
+           m_blocks[m_currentBlock].offset + size >
+               m_blocks[m_currentBlock].capacity)
+    {
+        ++m_currentBlock;
+    }
+
+    if (m_currentBlock == m_blocks.size())
+    {
+        // Grow geometrically so that a new workload settles in a few steps.
+        AddBlock(std::max({ size, MIN_BLOCK_SIZE, GetCapacity() }));
+        m_currentBlock = m_blocks.size() - 1;
+    }
+
+    Block& block = m_blocks[m_currentBlock];
+    std::byte* ptr = block.data + block.offset;
+
+    block.offset += size;
+    m_numberOfBytesInUse += size;
+    m_highWaterMark = std::max(m_highWaterMark, m_numberOfBytesInUse);
+
+    return ptr;
+}
+
+void ScratchArena::Rewind(size_t block, size_t offset,
+                          size_t numberOfBytesInUse)
+{
+    for (size_t i = block + 1; i <= m_currentBlock && i < m_blocks.size(); ++i)
+    {
+        m_blocks[i].offset = 0;
+    }
+
+    if (block < m_blocks.size())
+    {
+        m_blocks[block].offset = offset;
+    }
+
+    m_currentBlock = block;
+    m_numberOfBytesInUse = numberOfBytesInUse;
+
+    // Merge the blocks once the arena is empty so that the same workload fits
+    // into a single block next time.
+    if (m_numberOfBytesInUse == 0 && m_blocks.size() > 1)
+    {
+        FreeBlocks();
+        AddBlock(m_highWaterMark);
+    }
+}
+
+void ScratchArena::AddBlock(size_t capacity)
+{
+    Block block;
+    block.data = static_cast<std::byte*>(
+        ::operator new(capacity, std::align_val_t{ ALIGNMENT }));
+    block.capacity = capacity;
+
+    m_blocks.push_back(block);
+    ++m_numberOfHeapAllocations;
+}
+
+void ScratchArena::FreeBlocks()
+{
+    for (const Block& block : m_blocks)
+    {
+        ::operator delete(block.data, std::align_val_t{ ALIGNMENT });
+    }
+
+    m_blocks.clear();
+    m_currentBlock = 0;
+}
+}  // namespace CubbyFlow
\ No newline at end of file
@@ -12,6 +12,9 @@
 
 #include <Flatbuffers/generated/FlatData_generated.h>
 
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
 #include <vector>
 
 namespace CubbyFlow
@@ -37,6 +40,26 @@ void Serialize(const uint8_t* data, size_t size, std::vector<uint8_t>* buffer)
     memcpy(buffer->data(), buf, sz);
 }
 
+void Serialize(const Serializable* serializable, std::ostream* stream)
+{
+    std::vector<uint8_t> buffer;
+    serializable->Serialize(&buffer);
+
+    stream->write(reinterpret_cast<const char*>(buffer.data()),
+                  static_cast<std::streamsize>(buffer.size()));
+}
+
+void Serialize(const Serializable* serializable, const std::string& filename)
+{
+    std::ofstream file{ filename, std::ios::binary };
+    if (!file)
+    {
+        throw std::invalid_argument{ "Cannot open file " + filename };
+    }
+
+    Serialize(serializable, &file);
+}
+
 void Deserialize(const std::vector<uint8_t>& buffer, Serializable* serializable)
 {
     serializable->Deserialize(buffer);
@@ -48,4 +71,57 @@ void Deserialize(const std::vector<uint8_t>& buffer, std::vector<uint8_t>* data)
     data->resize(fbsData->data()->size());
     std::copy(fbsData->data()->begin(), fbsData->data()->end(), data->begin());
 }
+
+void Deserialize(const std::vector<uint8_t>& buffer,
+                 ConstArrayView1<uint8_t>* data)
+{
+    const auto fbsData = fbs::GetFlatData(buffer.data());
+    *data = ConstArrayView1<uint8_t>(fbsData->data()->data(),
+                                     fbsData->data()->size());
+}
+
+void Deserialize(std::istream* stream, Serializable* serializable)
+{
+    // tellg() and seekg() fail on streams that are not seekable, such as
+    // pipes, which are read until the end instead.
+    const std::streampos begin = stream->tellg();
+    std::streampos end = -1;
+    if (begin != std::streampos(-1) && stream->seekg(0, std::ios::end))
+    {
+        end = stream->tellg();
+        stream->seekg(begin);
+    }
+    stream->clear();
+
+    std::vector<uint8_t> buffer;
+    if (end != std::streampos(-1) && end >= begin)
+    {
+        // Read the stream into a buffer of the exact size at once.
+        buffer.resize(static_cast<size_t>(end - begin));
+        stream->read(reinterpret_cast<char*>(buffer.data()),
+                     static_cast<std::streamsize>(buffer.size()));
+        if (stream->gcount() != static_cast<std::streamsize>(buffer.size()))
+        {
+            throw std::invalid_argument{ "Failed to read the stream." };
+        }
+    }
+    else
+    {
+        buffer.assign(std::istreambuf_iterator<char>(*stream),
+                      std::istreambuf_iterator<char>());
+    }
+
+    serializable->Deserialize(buffer);
+}
+
+void Deserialize(const std::string& filename, Serializable* serializable)
+{
+    std::ifstream file{ filename, std::ios::binary };
+    if (!file)
+    {
+        throw std::invalid_argument{ "Cannot open file " + filename };
+    }
+
+    Deserialize(&file, serializable);
+}
 }  // namespace CubbyFlow
\ No newline at end of file
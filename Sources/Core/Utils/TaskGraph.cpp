@@ -0,0 +1,195 @@
+// This code is based on Jet framework.
+// Copyright (c) 2018 Doyub Kim
+// CubbyFlow is voxel-based fluid simulation engine for computer games.
+// Copyright (c) 2020 CubbyFlow Team
+// Core Part: Chris Ohk, Junwoo Hwang, Jihong Sin, Seungwoo Yoo
+// AI Part: Dongheon Cho, Minseo Kim
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Core/Utils/Macros.hpp>
+#include <Core/Utils/TaskGraph.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+// OpenMP is left out on purpose. The tasks are mostly ParallelFor-based
+// phases, and a parallel loop inside an OpenMP task is a nested parallel
+// region which runs on a single thread unless nesting is enabled.
+#if defined(CUBBYFLOW_TASKING_TBB) || defined(CUBBYFLOW_TASKING_HPX) || \
+    defined(CUBBYFLOW_TASKING_CPP11THREAD)
+#define CUBBYFLOW_TASK_GRAPH_PARALLEL
+#endif
+
+namespace CubbyFlow
+{
+TaskGraph::TaskID TaskGraph::AddTask(Task task,
+                                     const std::vector<TaskID>& dependencies)
+{
+    const TaskID id = m_nodes.size();
+
+    for (TaskID dependency : dependencies)
+    {
+        if (dependency >= id)
+        {
+            throw std::invalid_argument{
+                "Dependency should be added before the task."
+            };
+        }
+    }
+
+    m_nodes.push_back(Node{ std::move(task), {}, dependencies.size() });
+
+    for (TaskID dependency : dependencies)
+    {
+        m_nodes[dependency].successors.push_back(id);
+    }
+
+    return id;
+}
+
+void TaskGraph::AddDependency(TaskID task, TaskID dependency)
+{
+    if (task >= m_nodes.size() || dependency >= task)
+    {
+        throw std::invalid_argument{
+            "Dependency should be added before the task."
+        };
+    }
+
+    m_nodes[dependency].successors.push_back(task);
+    ++m_nodes[task].numberOfDependencies;
+}
+
+void TaskGraph::Run(ExecutionPolicy policy)
+{
+#if defined(CUBBYFLOW_TASK_GRAPH_PARALLEL)
+    if (policy == ExecutionPolicy::Parallel && m_nodes.size() > 1)
+    {
+        RunParallel();
+        return;
+    }
+#else
+    UNUSED_VARIABLE(policy);
+#endif
+
+    RunSerial();
+}
+
+void TaskGraph::Clear()
+{
+    m_nodes.clear();
+}
+
+size_t TaskGraph::NumberOfTasks() const
+{
+    return m_nodes.size();
+}
+
+void TaskGraph::RunSerial()
+{
+    // Insertion order is a topological order.
+    for (Node& node : m_nodes)
+    {
+        node.task();
+    }
+}
+
+void TaskGraph::RunParallel()
+{
+#if defined(CUBBYFLOW_TASK_GRAPH_PARALLEL)
+    const size_t numberOfTasks = m_nodes.size();
+
+    std::vector<std::atomic<size_t>> numberOfPendingDependencies(
+        numberOfTasks);
+    for (size_t i = 0; i < numberOfTasks; ++i)
+    {
+        numberOfPendingDependencies[i] = m_nodes[i].numberOfDependencies;
+    }
+
+    std::atomic<bool> hasFailed{ false };
+    std::exception_ptr exception;
+
+    std::mutex mutex;
+    std::function<void(TaskID)> launch;
+
+    // Each finished task launches the successors it made ready, so that no
+    // worker blocks while waiting for the dependencies.
+    auto execute = [&](TaskID id) {
+        if (!hasFailed)
+        {
+            try
+            {
+                m_nodes[id].task();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock{ mutex };
+                if (!hasFailed.exchange(true))
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        for (TaskID successor : m_nodes[id].successors)
+        {
+            if (numberOfPendingDependencies[successor].fetch_sub(1) == 1)
+            {
+                launch(successor);
+            }
+        }
+    };
+
+    std::atomic<size_t> numberOfUnfinishedTasks{ numberOfTasks };
+    std::condition_variable finished;
+    std::vector<Internal::future<void>> futures;
+    futures.reserve(numberOfTasks);
+
+    launch = [&](TaskID id) {
+        std::lock_guard<std::mutex> lock{ mutex };
+        futures.emplace_back(Internal::Async([&execute, &finished, &mutex,
+                                              &numberOfUnfinishedTasks, id]() {
+            execute(id);
+
+            if (numberOfUnfinishedTasks.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> finishedLock{ mutex };
+                finished.notify_all();
+            }
+        }));
+    };
+
+    for (TaskID id = 0; id < numberOfTasks; ++id)
+    {
+        if (m_nodes[id].numberOfDependencies == 0)
+        {
+            launch(id);
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock{ mutex };
+        finished.wait(lock, [&]() { return numberOfUnfinishedTasks == 0; });
+    }
+
+    // All the launches happen before the last task finishes, so the list of
+    // the futures does not change anymore.
+    for (Internal::future<void>& f : futures)
+    {
+        f.wait();
+    }
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+#else
+    RunSerial();
+#endif
+}
+}  // namespace CubbyFlow
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "MemPerfTestsUtils.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions of the MemPerfTests binary so that
+// the tests can count the heap allocations made by a simulation step. The
+// array forms and the nothrow forms call these in the standard library.
+namespace
+{
+std::atomic<size_t> s_numberOfAllocations{ 0 };
+std::atomic<size_t> s_numberOfBytes{ 0 };
+std::atomic<size_t> s_largestAllocation{ 0 };
+
+void Record(size_t size)
+{
+    s_numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    s_numberOfBytes.fetch_add(size, std::memory_order_relaxed);
+
+    size_t largest = s_largestAllocation.load(std::memory_order_relaxed);
+    while (largest < size && !s_largestAllocation.compare_exchange_weak(
+                                 largest, size, std::memory_order_relaxed))
+    {
+        // Do nothing
+    }
+}
+
+void* AlignedAllocate(size_t size, size_t alignment)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc requires a multiple of the alignment.
+    return std::aligned_alloc(alignment,
+                              (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void AlignedFree(void* ptr)
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+}  // namespace
+
+void ResetHeapAllocationStats()
+{
+    s_numberOfAllocations = 0;
+    s_numberOfBytes = 0;
+    s_largestAllocation = 0;
+}
+
+HeapAllocationStats GetHeapAllocationStats()
+{
+    HeapAllocationStats stats;
+    stats.numberOfAllocations = s_numberOfAllocations;
+    stats.numberOfBytes = s_numberOfBytes;
+    stats.largestAllocation = s_largestAllocation;
+    return stats;
+}
+
+void* operator new(size_t size)
+{
+    Record(size);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    Record(size);
+
+    if (void* ptr = AlignedAllocate(size == 0 ? 1 : size,
+                                    static_cast<size_t>(alignment)))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    AlignedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    AlignedFree(ptr);
+}
@@ -11,4 +11,16 @@ size_t GetCurrentRSS();
 
 std::pair<double, std::string> MakeReadableByteSize(size_t bytes);
 
+//! Heap allocations made through the global operator new.
+struct HeapAllocationStats
+{
+    size_t numberOfAllocations = 0;
+    size_t numberOfBytes = 0;
+    size_t largestAllocation = 0;
+};
+
+void ResetHeapAllocationStats();
+
+HeapAllocationStats GetHeapAllocationStats();
+
 #endif
\ No newline at end of file
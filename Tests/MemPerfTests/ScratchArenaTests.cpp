@@ -0,0 +1,188 @@
+#include "MemPerfTestsUtils.hpp"
+
+#include "gtest/gtest.h"
+
+#include <Core/Animation/Frame.hpp>
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/CellCenteredVectorGrid.hpp>
+#include <Core/Grid/FaceCenteredGrid.hpp>
+#include <Core/Solver/Hybrid/PIC/PICSolver3.hpp>
+#include <Core/Solver/LevelSet/FMMLevelSetSolver3.hpp>
+#include <Core/Solver/LevelSet/LevelSetLiquidSolver3.hpp>
+#include <Core/Solver/LevelSet/UpwindLevelSetSolver3.hpp>
+#include <Core/Solver/Particle/PCISPH/PCISPHSolver3.hpp>
+
+#include <iostream>
+
+using namespace CubbyFlow;
+
+namespace
+{
+void PrintHeapReport(const HeapAllocationStats& stats)
+{
+    const auto total = MakeReadableByteSize(stats.numberOfBytes);
+    const auto largest = MakeReadableByteSize(stats.largestAllocation);
+
+    std::cout << "Heap allocations: " << stats.numberOfAllocations
+              << ", total: " << total.first << ' ' << total.second
+              << ", largest: " << largest.first << ' ' << largest.second
+              << '\n';
+}
+}  // namespace
+
+TEST(ScratchArena, PICSolver3)
+{
+    const size_t n = 64;
+
+    auto solver =
+        PICSolver3::Builder().WithResolution({ n, n, n }).MakeShared();
+
+    // Frame 0 only initializes the solver, so the second frame is the first
+    // one that actually steps and sizes the buffers.
+    Frame frame(0, 0.01);
+    solver->Update(frame++);
+    solver->Update(frame++);
+
+    const ScratchArena& arena = solver->GetScratchArena();
+    const size_t numberOfHeapAllocations = arena.GetNumberOfHeapAllocations();
+
+    const auto msg = MakeReadableByteSize(arena.GetHighWaterMark());
+    PrintMemReport(msg.first, msg.second);
+
+    // Steady-state steps reuse the scratch memory and the copies of the
+    // fields, so nothing as large as a single slice of the grid is allocated
+    // from the heap.
+    ResetHeapAllocationStats();
+    for (int i = 0; i < 3; ++i)
+    {
+        solver->Update(frame++);
+    }
+
+    const HeapAllocationStats stats = GetHeapAllocationStats();
+    PrintHeapReport(stats);
+
+    EXPECT_LT(stats.largestAllocation, n * n);
+    EXPECT_EQ(numberOfHeapAllocations, arena.GetNumberOfHeapAllocations());
+    EXPECT_EQ(0u, arena.GetNumberOfBytesInUse());
+    EXPECT_EQ(arena.GetHighWaterMark(), arena.GetCapacity());
+}
+
+TEST(ScratchArena, LevelSetLiquidSolver3)
+{
+    const size_t n = 32;
+
+    auto solver = LevelSetLiquidSolver3::Builder()
+                      .WithResolution({ n, n, n })
+                      .WithDomainSizeX(1.0)
+                      .MakeShared();
+    solver->GetSignedDistanceField()->Fill(
+        [](const Vector3D& x) { return x.y - 0.5; });
+
+    // Frame 0 only initializes the solver, so the second frame is the first
+    // one that actually steps and sizes the buffers.
+    Frame frame(0, 0.01);
+    solver->Update(frame++);
+    solver->Update(frame++);
+
+    // The level set solvers keep their scratch memory across steps as well.
+    ResetHeapAllocationStats();
+    for (int i = 0; i < 3; ++i)
+    {
+        solver->Update(frame++);
+    }
+
+    const HeapAllocationStats stats = GetHeapAllocationStats();
+    PrintHeapReport(stats);
+
+    EXPECT_LT(stats.largestAllocation, n * n);
+}
+
+TEST(ScratchArena, LevelSetSolver3)
+{
+    const size_t n = 32;
+    const Vector3UZ resolution{ n, n, n };
+    const Vector3D gridSpacing{ 1.0 / n, 1.0 / n, 1.0 / n };
+
+    CellCenteredScalarGrid3 sdf{ resolution, gridSpacing };
+    sdf.Fill([](const Vector3D& x) { return x.y - 0.5; });
+
+    CellCenteredScalarGrid3 scalar{ resolution, gridSpacing, Vector3D{}, 1.0 };
+    CellCenteredVectorGrid3 vector{ resolution, gridSpacing, Vector3D{},
+                                    Vector3D{ 1.0, 2.0, 3.0 } };
+    FaceCenteredGrid3 face{ resolution, gridSpacing, Vector3D{},
+                            Vector3D{ 1.0, 2.0, 3.0 } };
+    CellCenteredScalarGrid3 scalarOut{ scalar };
+    CellCenteredVectorGrid3 vectorOut{ vector };
+    FaceCenteredGrid3 faceOut{ face };
+
+    UpwindLevelSetSolver3 upwindSolver;
+    FMMLevelSetSolver3 fmmSolver;
+
+    for (LevelSetSolver3* solver :
+         { static_cast<LevelSetSolver3*>(&upwindSolver),
+           static_cast<LevelSetSolver3*>(&fmmSolver) })
+    {
+        const auto extrapolate = [&]() {
+            solver->Extrapolate(scalar, sdf, 0.1, &scalarOut);
+            solver->Extrapolate(vector, sdf, 0.1, &vectorOut);
+            solver->Extrapolate(face, sdf, 0.1, &faceOut);
+        };
+
+        extrapolate();
+
+        ResetHeapAllocationStats();
+        extrapolate();
+
+        const HeapAllocationStats stats = GetHeapAllocationStats();
+        PrintHeapReport(stats);
+
+        EXPECT_LT(stats.largestAllocation, n * n);
+    }
+}
+
+TEST(ScratchArena, PCISPHSolver3)
+{
+    auto solver = PCISPHSolver3::Builder().WithTargetSpacing(0.05).MakeShared();
+
+    Array1<Vector3D> positions;
+    for (size_t k = 0; k < 10; ++k)
+    {
+        for (size_t j = 0; j < 10; ++j)
+        {
+            for (size_t i = 0; i < 10; ++i)
+            {
+                positions.Append(0.05 * Vector3D(static_cast<double>(i),
+                                                 static_cast<double>(j),
+                                                 static_cast<double>(k)));
+            }
+        }
+    }
+    solver->GetSPHSystemData()->AddParticles(positions);
+
+    // Frame 0 only initializes the solver, so the second frame is the first
+    // one that actually steps and sizes the buffers.
+    Frame frame(0, 0.01);
+    solver->Update(frame++);
+    solver->Update(frame++);
+
+    const ScratchArena& arena = solver->GetScratchArena();
+    const size_t numberOfHeapAllocations = arena.GetNumberOfHeapAllocations();
+
+    const auto msg = MakeReadableByteSize(arena.GetHighWaterMark());
+    PrintMemReport(msg.first, msg.second);
+
+    ResetHeapAllocationStats();
+    for (int i = 0; i < 3; ++i)
+    {
+        solver->Update(frame++);
+    }
+
+    const HeapAllocationStats stats = GetHeapAllocationStats();
+    PrintHeapReport(stats);
+
+    // The only particle-sized buffer left is the temporary of the parallel
+    // sort in the neighbor searcher, which holds one index per particle.
+    EXPECT_LT(stats.largestAllocation, positions.Length() * sizeof(Vector3D));
+    EXPECT_EQ(numberOfHeapAllocations, arena.GetNumberOfHeapAllocations());
+    EXPECT_EQ(0u, arena.GetNumberOfBytesInUse());
+}
\ No newline at end of file
@@ -16,3 +16,13 @@ def test_inheritance():
     anim.Update(f)
     assert anim.lastFrame.index == 3
     assert anim.lastFrame.timeIntervalInSeconds == 0.02
+
+
+def test_update_async():
+    anim = MyAnimation()
+    f = pyCubbyFlow.Frame(3, 0.02)
+    future = anim.UpdateAsync(f)
+    future.Wait()
+    assert future.IsReady()
+    assert anim.lastFrame.index == 3
+    assert anim.lastFrame.timeIntervalInSeconds == 0.02
@@ -1,5 +1,7 @@
+import gc
 import numpy as np
 import pyCubbyFlow
+import pytest
 from pytest import approx
 from pytest_utils import *
 
@@ -349,3 +351,115 @@ def test_cell_centered_scalar_grid3():
         for j in range(c.resolution.y):
             for i in range(c.resolution.x):
                 assert c[i, j, k] == 42.0
+
+
+def test_cell_centered_scalar_grid3_sample_many():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5),
+                                            gridSpacing=(1, 2, 3),
+                                            gridOrigin=(7, 5, 2))
+    a.Fill(lambda x: x.x + 2.0 * x.y - x.z)
+
+    points = np.random.rand(100, 3) * (3, 8, 15) + (7, 5, 2)
+    values = a.SampleMany(points)
+    gradients = a.GradientMany(points)
+    assert values.shape == (100,)
+    assert gradients.shape == (100, 3)
+    for i in range(100):
+        assert values[i] == approx(a.Sample(tuple(points[i])))
+        assert_vector_similar(gradients[i], a.Gradient(tuple(points[i])))
+
+
+def test_cell_centered_scalar_grid3_fill_from_array():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5))
+    data = np.arange(60, dtype=np.float64).reshape(5, 4, 3)
+    a.FillFromArray(data)
+    for k in range(a.resolution.z):
+        for j in range(a.resolution.y):
+            for i in range(a.resolution.x):
+                assert a[i, j, k] == data[k, j, i]
+
+
+def test_cell_centered_scalar_grid3_sample_many_conversions():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5),
+                                            gridSpacing=(1, 2, 3),
+                                            gridOrigin=(7, 5, 2))
+    a.Fill(lambda x: x.x + 2.0 * x.y - x.z)
+
+    points = np.rint(np.random.rand(10, 3) * (3, 8, 15) + (7, 5, 2))
+    expected = a.SampleMany(points)
+
+    # Arrays that are not C-contiguous doubles are converted before sampling
+    strided = np.zeros((10, 6))
+    strided[:, ::2] = points
+    assert a.SampleMany(strided[:, ::2]) == approx(expected)
+    assert a.SampleMany(np.asfortranarray(points)) == approx(expected)
+    assert a.SampleMany(points.astype(np.int32)) == approx(expected)
+    assert a.SampleMany(memoryview(points)) == approx(expected)
+    assert a.SampleMany(points.tolist()) == approx(expected)
+
+    assert a.SampleMany(np.zeros((0, 3))).shape == (0,)
+
+    with pytest.raises(ValueError):
+        a.SampleMany(np.zeros((10, 2)))
+    with pytest.raises(ValueError):
+        a.SampleMany(np.zeros(30))
+
+
+def test_cell_centered_scalar_grid3_sample_many_lifetime():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5),
+                                            gridSpacing=(1, 2, 3),
+                                            gridOrigin=(7, 5, 2))
+    a.Fill(lambda x: x.x + 2.0 * x.y - x.z)
+
+    points = np.random.rand(10, 3) * (3, 8, 15) + (7, 5, 2)
+    values = a.SampleMany(points)
+    gradients = a.GradientMany(points)
+    expected = np.array([a.Sample(tuple(p)) for p in points])
+    expected_gradients = [tuple(a.Gradient(tuple(p))) for p in points]
+
+    # The results own their memory and outlive the grid and the input
+    assert values.flags.owndata
+    assert gradients.flags.owndata
+    del a
+    del points
+    gc.collect()
+    assert values == approx(expected)
+    for i in range(10):
+        assert_vector_similar(gradients[i], expected_gradients[i])
+
+
+def test_cell_centered_scalar_grid3_fill_from_array_buffers():
+    a = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5))
+    view = np.array(a.DataView(), copy=False)
+
+    # The grid data is shared with the view
+    data = np.arange(60, dtype=np.float64).reshape(5, 4, 3)
+    a.FillFromArray(data)
+    assert np.array_equal(view, data)
+
+    # Non-contiguous arrays and other buffers are accepted as sources
+    a.FillFromArray(np.ascontiguousarray(data.T).T * 2.0)
+    assert np.array_equal(view, data * 2.0)
+
+    b = pyCubbyFlow.CellCenteredScalarGrid3(resolution=(3, 4, 5))
+    b.FillFromArray(a.DataView())
+    assert np.array_equal(np.array(b.DataView(), copy=False), data * 2.0)
+
+    with pytest.raises(ValueError):
+        a.FillFromArray(np.zeros((3, 4, 5)))
+
+    # The view keeps the grid alive
+    del a
+    gc.collect()
+    assert np.array_equal(view, data * 2.0)
+
+
+def test_custom_scalar_field3_sample_many():
+    # Python callbacks are evaluated while holding the GIL
+    a = pyCubbyFlow.CustomScalarField3(lambda x: x.x + 2.0 * x.y - x.z)
+
+    points = np.random.rand(100, 3)
+    values = a.SampleMany(points)
+    assert values.shape == (100,)
+    for i in range(100):
+        assert values[i] == approx(a.Sample(tuple(points[i])))
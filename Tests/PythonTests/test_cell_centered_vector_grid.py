@@ -0,0 +1,67 @@
+import gc
+import numpy as np
+import pyCubbyFlow
+import pytest
+from pytest import approx
+from pytest_utils import *
+
+
+def test_cell_centered_vector_grid3_sample_many():
+    a = pyCubbyFlow.CellCenteredVectorGrid3(resolution=(3, 4, 5),
+                                            gridSpacing=(1, 2, 3),
+                                            gridOrigin=(7, 5, 2))
+    a.Fill(lambda x: (x.y, -x.x + x.z, 2.0 * x.x))
+
+    points = np.random.rand(100, 3) * (3, 8, 15) + (7, 5, 2)
+    values = a.SampleMany(points)
+    divergences = a.DivergenceMany(points)
+    curls = a.CurlMany(points)
+    assert values.shape == (100, 3)
+    assert divergences.shape == (100,)
+    assert curls.shape == (100, 3)
+    for i in range(100):
+        pt = tuple(points[i])
+        assert_vector_similar(values[i], a.Sample(pt))
+        assert divergences[i] == approx(a.Divergence(pt))
+        assert_vector_similar(curls[i], a.Curl(pt))
+
+    # The results own their memory and outlive the grid
+    expected = np.array([tuple(a.Sample(tuple(p))) for p in points])
+    del a
+    gc.collect()
+    assert values.flags.owndata
+    assert values == approx(expected)
+
+
+def test_cell_centered_vector_grid3_fill_from_array():
+    a = pyCubbyFlow.CellCenteredVectorGrid3(resolution=(3, 4, 5))
+    data = np.arange(180, dtype=np.float64).reshape(5, 4, 3, 3)
+    a.FillFromArray(data)
+    for k in range(a.resolution.z):
+        for j in range(a.resolution.y):
+            for i in range(a.resolution.x):
+                assert_vector_similar(a[i, j, k], data[k, j, i])
+
+    # Non-contiguous arrays are converted before copying
+    a.FillFromArray(np.asfortranarray(data * 2.0))
+    for k in range(a.resolution.z):
+        for j in range(a.resolution.y):
+            for i in range(a.resolution.x):
+                assert_vector_similar(a[i, j, k], data[k, j, i] * 2.0)
+
+    with pytest.raises(ValueError):
+        a.FillFromArray(np.zeros((5, 4, 3)))
+    with pytest.raises(ValueError):
+        a.FillFromArray(np.zeros((5, 4, 3, 2)))
+
+
+def test_custom_vector_field3_sample_many():
+    # Python callbacks are evaluated while holding the GIL
+    a = pyCubbyFlow.CustomVectorField3(
+        lambda x: pyCubbyFlow.Vector3D(x.y, -x.x, 2.0 * x.z))
+
+    points = np.random.rand(100, 3)
+    values = a.SampleMany(points)
+    assert values.shape == (100, 3)
+    for i in range(100):
+        assert_vector_similar(values[i], a.Sample(tuple(points[i])))
@@ -0,0 +1,27 @@
+import numpy as np
+import pyCubbyFlow
+
+
+def test_particle_cache3(tmp_path):
+    ps = pyCubbyFlow.ParticleSystemData3()
+    ps.AddParticles([(0.0, 0.0, 0.0), (1.0, 2.0, 3.0), (0.5, 0.5, 0.5)],
+                    [(7.0, 8.0, 9.0), (8.0, 7.0, 6.0), (1.0, 1.0, 1.0)])
+
+    writer = pyCubbyFlow.ParticleCacheWriter3(positionBits=20,
+                                              storeVelocities=True,
+                                              useDeltaEncoding=True)
+    reader = pyCubbyFlow.ParticleCacheReader3()
+    ps2 = pyCubbyFlow.ParticleSystemData3()
+
+    for frame in range(3):
+        file_name = str(tmp_path / ('frame_%06d.pcache' % frame))
+        writer.Write(file_name, ps)
+        assert writer.isLastFrameKeyFrame == (frame == 0)
+
+        reader.Read(file_name, ps2)
+        assert reader.isLastFrameKeyFrame == (frame == 0)
+        assert ps2.numberOfParticles == 3
+        assert np.allclose(np.array(ps2.positions), np.array(ps.positions),
+                           atol=1e-5)
+        assert np.allclose(np.array(ps2.velocities),
+                           np.array(ps.velocities))
@@ -148,3 +148,21 @@ def test_add_particles3():
     assert [8.0, 7.0, 6.0] == v[13]
     assert [5.0, 4.0, 3.0] == f[12]
     assert [2.0, 1.0, 3.0] == f[13]
+
+
+def test_serialize_channels3(tmp_path):
+    ps = pyCubbyFlow.ParticleSystemData3()
+    ps.AddParticles([(1.0, 2.0, 3.0), (4.0, 5.0, 6.0)],
+                    [(7.0, 8.0, 9.0), (8.0, 7.0, 6.0)])
+    a0 = ps.AddScalarData(2.0)
+
+    file_name = str(tmp_path / 'particles.bin')
+    ps.SerializeChannelsToFile(file_name)
+
+    ps2 = pyCubbyFlow.ParticleSystemData3()
+    ps2.DeserializeChannelsFromFile(file_name)
+
+    assert ps2.numberOfParticles == 2
+    assert [4.0, 5.0, 6.0] == np.array(ps2.positions)[1]
+    assert [7.0, 8.0, 9.0] == np.array(ps2.velocities)[0]
+    assert 2.0 == np.array(ps2.ScalarDataAt(a0))[1]
@@ -26,3 +26,15 @@ def test_inheritance():
     anim.Update(f)
     assert anim.init_data == 1
     assert anim.adv_data == 20
+
+
+def test_advance_single_frame_async():
+    anim = MyPhysicsAnimation()
+
+    anim.isUsingFixedSubTimeSteps = False
+    future = anim.AdvanceSingleFrameAsync()
+    future.Wait()
+    assert future.IsReady()
+    assert anim.init_data == 1
+    assert anim.adv_data == 1
+    assert anim.currentFrame.index == 0
@@ -2,16 +2,21 @@
 
 #include <Core/Array/ArrayView.hpp>
 #include <Core/FDM/FDMLinearSystem2.hpp>
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3.hpp>
 #include <Core/FDM/FDMLinearSystem3.hpp>
 
 #include <random>
 
 using CubbyFlow::Array3;
 using CubbyFlow::FDMCompressedLinearSystem3;
+using CubbyFlow::FDMCompressedLinearSystemBuilder3;
+using CubbyFlow::FDMMarkerMatrix3;
 using CubbyFlow::FDMMatrix2;
 using CubbyFlow::FDMMatrix3;
 using CubbyFlow::FDMVector2;
+using CubbyFlow::FDMStencil3;
 using CubbyFlow::FDMVector3;
+using CubbyFlow::MatrixSELLD;
 using CubbyFlow::Vector3UZ;
 
 class FDMBLAS2 : public ::benchmark::Fixture
@@ -69,6 +74,34 @@ class FDMBLAS3 : public ::benchmark::Fixture
     }
 };
 
+class FDMMatrixFreeBLAS3 : public ::benchmark::Fixture
+{
+ public:
+    FDMMarkerMatrix3 m;
+    FDMVector3 a;
+    FDMVector3 b;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto dim = static_cast<size_t>(state.range(0));
+
+        m.Resize({ dim, dim, dim });
+        a.Resize(dim, dim, dim);
+        b.Resize(dim, dim, dim);
+
+        std::mt19937 rng;
+        std::uniform_real_distribution<> d(0.0, 1.0);
+
+        ForEachIndex(m.Size(), [&](size_t i, size_t j, size_t k) {
+            const double r = d(rng);
+            m.markers(i, j, k) = (r < 0.8)   ? FDMMarkerMatrix3::FLUID
+                                 : (r < 0.9) ? FDMMarkerMatrix3::AIR
+                                             : FDMMarkerMatrix3::BOUNDARY;
+            a(i, j, k) = d(rng);
+        });
+    }
+};
+
 class FDMCompressedBLAS3 : public ::benchmark::Fixture
 {
  public:
@@ -169,6 +202,114 @@ class FDMCompressedBLAS3 : public ::benchmark::Fixture
     }
 };
 
+// Fixtures for the large systems (1M-50M unknowns). The systems are assembled
+// in parallel and released after each benchmark to bound the memory usage.
+class FDMLargeCompressedBLAS3 : public ::benchmark::Fixture
+{
+ public:
+    FDMCompressedLinearSystem3 system;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto dim = static_cast<size_t>(state.range(0));
+
+        BuildSystem(&system, { dim, dim, dim });
+    }
+
+    void TearDown(const ::benchmark::State&)
+    {
+        system.Clear();
+    }
+
+    static void BuildSystem(FDMCompressedLinearSystem3* system,
+                            const Vector3UZ& size)
+    {
+        FDMCompressedLinearSystemBuilder3 builder;
+
+        builder.Build(
+            size, [](size_t, size_t, size_t) { return true; },
+            [&](size_t i, size_t j, size_t k, FDMStencil3& row) {
+                double bijk = 0.0;
+
+                if (i > 0)
+                {
+                    row.center += 1.0;
+                    row.left = -1.0;
+                }
+                if (i < size.x - 1)
+                {
+                    row.center += 1.0;
+                    row.right = -1.0;
+                }
+
+                if (j > 0)
+                {
+                    row.center += 1.0;
+                    row.down = -1.0;
+                }
+                else
+                {
+                    bijk += 1.0;
+                }
+
+                if (j < size.y - 1)
+                {
+                    row.center += 1.0;
+                    row.up = -1.0;
+                }
+                else
+                {
+                    bijk -= 1.0;
+                }
+
+                if (k > 0)
+                {
+                    row.center += 1.0;
+                    row.back = -1.0;
+                }
+                else
+                {
+                    bijk += 1.0;
+                }
+
+                if (k < size.z - 1)
+                {
+                    row.center += 1.0;
+                    row.front = -1.0;
+                }
+                else
+                {
+                    bijk -= 1.0;
+                }
+
+                return bijk;
+            },
+            system);
+    }
+};
+
+class FDMCompressedSELLBLAS3 : public ::benchmark::Fixture
+{
+ public:
+    FDMCompressedLinearSystem3 system;
+    MatrixSELLD matrix;
+
+    void SetUp(const ::benchmark::State& state)
+    {
+        const auto dim = static_cast<size_t>(state.range(0));
+
+        FDMLargeCompressedBLAS3::BuildSystem(&system, { dim, dim, dim });
+        matrix.Build(system.A);
+        system.A.Clear();
+    }
+
+    void TearDown(const ::benchmark::State&)
+    {
+        system.Clear();
+        matrix.Clear();
+    }
+};
+
 BENCHMARK_DEFINE_F(FDMBLAS2, MVM)(benchmark::State& state)
 {
     while (state.KeepRunning())
@@ -189,6 +330,19 @@ BENCHMARK_DEFINE_F(FDMBLAS3, MVM)(benchmark::State& state)
 
 BENCHMARK_REGISTER_F(FDMBLAS3, MVM)->Arg(1 << 4)->Arg(1 << 6)->Arg(1 << 8);
 
+BENCHMARK_DEFINE_F(FDMMatrixFreeBLAS3, MVM)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::FDMMatrixFreeBLAS3::MVM(m, a, &b);
+    }
+}
+
+BENCHMARK_REGISTER_F(FDMMatrixFreeBLAS3, MVM)
+    ->Arg(1 << 4)
+    ->Arg(1 << 6)
+    ->Arg(1 << 8);
+
 BENCHMARK_DEFINE_F(FDMCompressedBLAS3, MVM)(benchmark::State& state)
 {
     while (state.KeepRunning())
@@ -200,4 +354,62 @@ BENCHMARK_DEFINE_F(FDMCompressedBLAS3, MVM)(benchmark::State& state)
 BENCHMARK_REGISTER_F(FDMCompressedBLAS3, MVM)
     ->Arg(1 << 4)
     ->Arg(1 << 6)
-    ->Arg(1 << 8);
\ No newline at end of file
+    ->Arg(1 << 8);
+
+BENCHMARK_DEFINE_F(FDMLargeCompressedBLAS3, MVM)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::FDMCompressedBLAS3::MVM(system.A, system.b, &system.x);
+    }
+}
+
+BENCHMARK_REGISTER_F(FDMLargeCompressedBLAS3, MVM)
+    ->Arg(100)
+    ->Arg(215)
+    ->Arg(368)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(FDMLargeCompressedBLAS3, Residual)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::FDMCompressedBLAS3::Residual(system.A, system.b, system.b,
+                                                &system.x);
+    }
+}
+
+BENCHMARK_REGISTER_F(FDMLargeCompressedBLAS3, Residual)
+    ->Arg(100)
+    ->Arg(215)
+    ->Arg(368)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(FDMCompressedSELLBLAS3, MVM)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::FDMCompressedSELLBLAS3::MVM(matrix, system.b, &system.x);
+    }
+}
+
+BENCHMARK_REGISTER_F(FDMCompressedSELLBLAS3, MVM)
+    ->Arg(100)
+    ->Arg(215)
+    ->Arg(368)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(FDMCompressedSELLBLAS3, Residual)(benchmark::State& state)
+{
+    while (state.KeepRunning())
+    {
+        CubbyFlow::FDMCompressedSELLBLAS3::Residual(matrix, system.b,
+                                                    system.b, &system.x);
+    }
+}
+
+BENCHMARK_REGISTER_F(FDMCompressedSELLBLAS3, Residual)
+    ->Arg(100)
+    ->Arg(215)
+    ->Arg(368)
+    ->Unit(benchmark::kMillisecond);
\ No newline at end of file
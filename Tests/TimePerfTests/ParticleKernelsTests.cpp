@@ -0,0 +1,197 @@
+#include "benchmark/benchmark.h"
+
+#include <Core/Particle/ParticleKernels.hpp>
+#include <Core/Particle/SPHSystemData.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/SIMD.hpp>
+
+#include <random>
+
+using CubbyFlow::Array1;
+using CubbyFlow::BoundingBox3D;
+using CubbyFlow::SIMDLevel;
+using CubbyFlow::SPHSystemData3;
+using CubbyFlow::Vector3D;
+
+// The benchmark argument is the SIMDLevel, so that the throughput of each
+// instruction set level can be compared. Real time is measured since the
+// kernels run on the worker threads.
+class ParticleKernels : public ::benchmark::Fixture
+{
+ protected:
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<> dist{ 0.0, 1.0 };
+    Array1<Vector3D> positions;
+    Array1<Vector3D> velocities;
+    Array1<Vector3D> forces;
+    Array1<Vector3D> newPositions;
+    Array1<Vector3D> newVelocities;
+    SPHSystemData3 sphData;
+    Array1<double> pressureTerms;
+
+    void SetUp(const ::benchmark::State&)
+    {
+        const size_t n = 1 << 20;
+        positions.Resize(n);
+        velocities.Resize(n);
+        forces.Resize(n);
+        newPositions.Resize(n);
+        newVelocities.Resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            positions[i] = MakeVec();
+            velocities[i] = MakeVec() - Vector3D{ 0.5, 0.5, 0.5 };
+            forces[i] = MakeVec();
+        }
+
+        // About 25 neighbors per particle.
+        const size_t numberOfSPHParticles = 1 << 15;
+        sphData.Resize(0);
+        sphData.SetTargetSpacing(1.0 / 32.0);
+        Array1<Vector3D> sphPositions(numberOfSPHParticles);
+        for (Vector3D& p : sphPositions)
+        {
+            p = MakeVec();
+        }
+        sphData.AddParticles(sphPositions);
+        sphData.BuildNeighborSearcher();
+        sphData.BuildNeighborLists();
+        sphData.UpdateDensities();
+
+        pressureTerms.Resize(numberOfSPHParticles);
+        for (double& q : pressureTerms)
+        {
+            q = dist(rng);
+        }
+    }
+
+    Vector3D MakeVec()
+    {
+        return Vector3D(dist(rng), dist(rng), dist(rng));
+    }
+
+    static bool SetLevel(benchmark::State& state)
+    {
+        const auto level = static_cast<SIMDLevel>(state.range(0));
+        if (level > CubbyFlow::GetSupportedSIMDLevel())
+        {
+            state.SkipWithError("Unsupported SIMD level");
+            return false;
+        }
+
+        CubbyFlow::SetSIMDLevel(level);
+        return true;
+    }
+};
+
+BENCHMARK_DEFINE_F(ParticleKernels, IntegrateParticles)
+(benchmark::State& state)
+{
+    if (!SetLevel(state))
+    {
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::IntegrateParticles(positions, velocities, forces, 1.0,
+                                      0.01, newPositions, newVelocities);
+    }
+
+    state.SetItemsProcessed(state.iterations() * positions.Length());
+}
+
+BENCHMARK_REGISTER_F(ParticleKernels, IntegrateParticles)
+    ->DenseRange(0, 3)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(ParticleKernels, ClampParticlesToBox)
+(benchmark::State& state)
+{
+    if (!SetLevel(state))
+    {
+        return;
+    }
+
+    const BoundingBox3D box{ Vector3D{ 0.1, 0.1, 0.1 },
+                             Vector3D{ 0.9, 0.9, 0.9 } };
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::ClampParticlesToBox(box, CubbyFlow::DIRECTION_ALL,
+                                       positions, velocities);
+    }
+
+    state.SetItemsProcessed(state.iterations() * positions.Length());
+}
+
+BENCHMARK_REGISTER_F(ParticleKernels, ClampParticlesToBox)
+    ->DenseRange(0, 3)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(ParticleKernels, ComputeSPHStdKernelDensities)
+(benchmark::State& state)
+{
+    if (!SetLevel(state))
+    {
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::ComputeSPHStdKernelDensities(
+            sphData.Positions(), sphData.NeighborLists(),
+            sphData.KernelRadius(), sphData.Mass(), sphData.Densities());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sphData.NumberOfParticles());
+}
+
+BENCHMARK_REGISTER_F(ParticleKernels, ComputeSPHStdKernelDensities)
+    ->DenseRange(0, 3)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(ParticleKernels, AccumulateSPHPressureForces)
+(benchmark::State& state)
+{
+    if (!SetLevel(state))
+    {
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::AccumulateSPHPressureForces(
+            sphData.Positions(), pressureTerms, sphData.NeighborLists(),
+            sphData.KernelRadius(), sphData.Mass(), sphData.Forces());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sphData.NumberOfParticles());
+}
+
+BENCHMARK_REGISTER_F(ParticleKernels, AccumulateSPHPressureForces)
+    ->DenseRange(0, 3)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(ParticleKernels, AccumulateSPHViscosityForces)
+(benchmark::State& state)
+{
+    if (!SetLevel(state))
+    {
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        CubbyFlow::AccumulateSPHViscosityForces(
+            sphData.Positions(), sphData.Velocities(), sphData.Densities(),
+            sphData.NeighborLists(), sphData.KernelRadius(), sphData.Mass(),
+            0.01, sphData.Forces());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sphData.NumberOfParticles());
+}
+
+BENCHMARK_REGISTER_F(ParticleKernels, AccumulateSPHViscosityForces)
+    ->DenseRange(0, 3)
+    ->UseRealTime();
\ No newline at end of file
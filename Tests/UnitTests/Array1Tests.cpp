@@ -3,6 +3,9 @@
 #include <Core/Array/Array.hpp>
 #include <Core/Utils/Serialization.hpp>
 
+#include <cstdint>
+#include <string>
+
 using namespace CubbyFlow;
 
 TEST(Array1, Constructors)
@@ -90,6 +93,22 @@ TEST(Array1, ResizeMethod)
     }
 }
 
+TEST(Array1, ResizeUninitialized)
+{
+    Array1<Vector3D> arr(10, Vector3D(1, 2, 3));
+    arr.ResizeUninitialized(4);
+    EXPECT_EQ(4u, arr.Length());
+
+    arr.ResizeUninitialized(100);
+    EXPECT_EQ(100u, arr.Length());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(arr.data()) % 64);
+
+    arr.Append(Vector3D(4, 5, 6));
+    EXPECT_EQ(101u, arr.Length());
+    EXPECT_EQ(Vector3D(4, 5, 6), arr[100]);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(arr.data()) % 64);
+}
+
 TEST(Array1, Iterators)
 {
     Array1<float> arr1 = { 6.f, 4.f, 1.f, -5.f };
@@ -139,4 +158,59 @@ TEST(Array1, ParallelForEachIndex)
         float ans = static_cast<float>(200.f - i);
         EXPECT_EQ(ans, arr1[i]);
     });
+}
+
+namespace
+{
+struct PaddedCell
+{
+    double value = 7.0;
+};
+}  // namespace
+
+namespace CubbyFlow
+{
+template <>
+struct ArrayAllocationPolicy<PaddedCell>
+{
+    static constexpr size_t ALIGNMENT = 256;
+
+    static constexpr bool DEFER_INITIALIZATION = false;
+
+    static constexpr size_t PARALLEL_INIT_THRESHOLD = 64;
+};
+}  // namespace CubbyFlow
+
+TEST(Array1, AllocationPolicy)
+{
+    static_assert(ArrayAllocationPolicy<Vector3D>::DEFER_INITIALIZATION);
+    static_assert(ArrayAllocationPolicy<Matrix3x3D>::DEFER_INITIALIZATION);
+    static_assert(!ArrayAllocationPolicy<std::string>::DEFER_INITIALIZATION);
+
+    // Vector3D has a user-provided default constructor but is still filled
+    // with the given value only.
+    Array1<Vector3D> vecs(1000, Vector3D(1, 2, 3));
+    for (const Vector3D& v : vecs)
+    {
+        EXPECT_EQ(Vector3D(1, 2, 3), v);
+    }
+
+    Array1<std::string> strs(3, "abc");
+    strs.ResizeUninitialized(5);
+    EXPECT_TRUE(strs[4].empty());
+
+    EXPECT_EQ(64u, Array1<PaddedCell>::PARALLEL_INIT_THRESHOLD);
+
+    Array1<PaddedCell> cells(100);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(cells.data()) % 256);
+    cells.ResizeUninitialized(200);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(cells.data()) % 256);
+    for (const PaddedCell& cell : cells)
+    {
+        EXPECT_DOUBLE_EQ(7.0, cell.value);
+    }
+
+    Array1<PaddedCell> copy(cells);
+    EXPECT_EQ(200u, copy.Length());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(copy.data()) % 256);
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <Core/Array/Array.hpp>
 #include <Core/Utils/Serialization.hpp>
 
+#include <cstdint>
+
 using namespace CubbyFlow;
 
 TEST(Array3, Constructors)
@@ -162,6 +164,58 @@ TEST(Array3, ResizeMethod)
     }
 }
 
+TEST(Array3, ResizeUninitialized)
+{
+    Array3<double> arr1(4, 5, 6, 1.0);
+    const double* ptr = arr1.data();
+
+    // Shrinking and reshaping reuse the storage.
+    arr1.ResizeUninitialized(Vector3UZ(6, 5, 4));
+    EXPECT_EQ(Vector3UZ(6, 5, 4), arr1.Size());
+    EXPECT_EQ(ptr, arr1.data());
+
+    arr1.ResizeUninitialized(2, 3, 4);
+    EXPECT_EQ(Vector3UZ(2, 3, 4), arr1.Size());
+    EXPECT_EQ(ptr, arr1.data());
+
+    arr1.ResizeUninitialized(Vector3UZ(64, 64, 64));
+    EXPECT_EQ(Vector3UZ(64, 64, 64), arr1.Size());
+    arr1.Fill(2.0);
+    for (double v : arr1)
+    {
+        EXPECT_EQ(2.0, v);
+    }
+
+    Array3<double> arr2;
+    arr2.CopyFrom(arr1);
+    EXPECT_EQ(arr1.Size(), arr2.Size());
+    for (size_t i = 0; i < arr2.Length(); ++i)
+    {
+        EXPECT_EQ(2.0, arr2[i]);
+    }
+}
+
+TEST(Array3, LargeArray)
+{
+    // Large enough to be initialized in parallel
+    const Vector3UZ size(100, 80, 60);
+    ASSERT_GE(size.x * size.y * size.z * sizeof(float),
+              Array3<float>::PARALLEL_INIT_THRESHOLD);
+
+    Array3<float> arr(size, 3.f);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(arr.data()) % 64);
+    for (float v : arr)
+    {
+        EXPECT_FLOAT_EQ(3.f, v);
+    }
+
+    arr.Resize(Vector3UZ(120, 80, 60), 5.f);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(arr.data()) % 64);
+    ForEachIndex(arr.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_FLOAT_EQ(i < size.x ? 3.f : 5.f, arr(i, j, k));
+    });
+}
+
 TEST(Array3, Iterators)
 {
     Array3<float> arr1({ { { 1.f, 2.f, 3.f, 4.f },
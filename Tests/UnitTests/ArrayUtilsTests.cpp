@@ -172,4 +172,130 @@ TEST(ArrayUtils, ExtrapolateToRegion3)
             }
         }
     }
+}
+
+TEST(ArrayUtils, ExtrapolateToRegionFront)
+{
+    const Vector3UZ size{ 17, 11, 13 };
+    Array3<double> data(size, 0.0);
+    Array3<char> valid(size, static_cast<char>(0));
+
+    // Two separated valid blocks with varying values
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        if ((i >= 2 && i < 5 && j >= 3 && j < 6 && k >= 4 && k < 7) ||
+            (i >= 12 && i < 14 && j >= 7 && j < 9 && k >= 1 && k < 3))
+        {
+            data(i, j, k) = static_cast<double>(i + 2 * j + 3 * k);
+            valid(i, j, k) = 1;
+        }
+    });
+
+    // Reference: the full-grid Jacobi sweeps
+    Array3<double> expected(data);
+    Array3<char> valid0(valid);
+    for (unsigned int iter = 0; iter < 4; ++iter)
+    {
+        Array3<char> valid1(valid0);
+        Array3<double> next(expected);
+
+        ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            if (valid0(i, j, k))
+            {
+                return;
+            }
+
+            double sum = 0.0;
+            unsigned int count = 0;
+            const auto add = [&](size_t ni, size_t nj, size_t nk) {
+                if (valid0(ni, nj, nk))
+                {
+                    sum += expected(ni, nj, nk);
+                    ++count;
+                }
+            };
+
+            if (i + 1 < size.x)
+            {
+                add(i + 1, j, k);
+            }
+            if (i > 0)
+            {
+                add(i - 1, j, k);
+            }
+            if (j + 1 < size.y)
+            {
+                add(i, j + 1, k);
+            }
+            if (j > 0)
+            {
+                add(i, j - 1, k);
+            }
+            if (k + 1 < size.z)
+            {
+                add(i, j, k + 1);
+            }
+            if (k > 0)
+            {
+                add(i, j, k - 1);
+            }
+
+            if (count > 0)
+            {
+                next(i, j, k) = sum / count;
+                valid1(i, j, k) = 1;
+            }
+        });
+
+        expected = next;
+        valid0 = valid1;
+    }
+
+    Array3<double> output(size, -1.0);
+    ExtrapolateToRegion(data.View(), valid.View(), 4, output.View());
+
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(expected(i, j, k), output(i, j, k))
+            << i << ", " << j << ", " << k;
+    });
+
+    // Zero iteration only copies the input
+    ExtrapolateToRegion(data.View(), valid.View(), 0, output.View());
+
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        EXPECT_DOUBLE_EQ(data(i, j, k), output(i, j, k));
+    });
+}
+
+TEST(ArrayUtils, ExtrapolateToRegionBuffers)
+{
+    ExtrapolationBuffers<3> buffers;
+
+    // Face-centered components with different sizes share the buffers.
+    const Vector3UZ sizes[] = { { 17, 16, 16 }, { 16, 17, 16 }, { 9, 8, 7 } };
+
+    for (const Vector3UZ& size : sizes)
+    {
+        Array3<double> data(size, 0.0);
+        Array3<char> valid(size, static_cast<char>(0));
+
+        ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            if (i + j + k < 6)
+            {
+                data(i, j, k) = static_cast<double>(i * j + k);
+                valid(i, j, k) = 1;
+            }
+        });
+
+        Array3<double> expected(size);
+        ExtrapolateToRegion(data.View(), valid.View(), 5, expected.View());
+
+        Array3<double> output(size);
+        ExtrapolateToRegion(data.View(), valid.View(), 5, output.View(),
+                            buffers);
+
+        EXPECT_EQ(size, buffers.markers.Size());
+        ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            EXPECT_DOUBLE_EQ(expected(i, j, k), output(i, j, k));
+        });
+    }
 }
\ No newline at end of file
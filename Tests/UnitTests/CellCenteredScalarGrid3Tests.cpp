@@ -357,6 +357,35 @@ TEST(CellCenteredScalarGrid3, LaplacianAtAtDataPoint)
     }
 }
 
+TEST(CellCenteredScalarGrid3, SampleMany)
+{
+    CellCenteredScalarGrid3 grid({ 5, 8, 6 }, { 2.0, 3.0, 1.5 });
+    grid.Fill([](const Vector3D& x) {
+        return Square(x.x) + 2.0 * Square(x.y) - 4.0 * Square(x.z);
+    });
+
+    Array1<Vector3D> points;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const double t = static_cast<double>(i) / 100.0;
+        points.Append({ 10.0 * t, 24.0 * (1.0 - t), 9.0 * t * t });
+    }
+
+    Array1<double> values(points.Length());
+    Array1<Vector3D> gradients(points.Length());
+    Array1<double> laplacians(points.Length());
+    grid.SampleMany(points, values);
+    grid.GradientMany(points, gradients);
+    grid.LaplacianMany(points, laplacians);
+
+    for (size_t i = 0; i < points.Length(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(grid.Sample(points[i]), values[i]);
+        EXPECT_EQ(grid.Gradient(points[i]), gradients[i]);
+        EXPECT_DOUBLE_EQ(grid.Laplacian(points[i]), laplacians[i]);
+    }
+}
+
 TEST(CellCenteredScalarGrid3, Serialization)
 {
     CellCenteredScalarGrid3 grid1({ 5, 4, 3 }, { 1.0, 2.0, 3.0 },
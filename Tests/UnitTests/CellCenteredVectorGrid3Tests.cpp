@@ -398,6 +398,35 @@ TEST(CellCenteredVectorGrid3, CurlAtDataPoint)
     }
 }
 
+TEST(CellCenteredVectorGrid3, SampleMany)
+{
+    CellCenteredVectorGrid3 grid({ 5, 8, 6 }, { 2.0, 3.0, 1.5 });
+    grid.Fill([](const Vector3D& x) {
+        return Vector3D{ x.y, -x.z * x.x, Square(x.x) };
+    });
+
+    Array1<Vector3D> points;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const double t = static_cast<double>(i) / 100.0;
+        points.Append({ 10.0 * t, 24.0 * (1.0 - t), 9.0 * t * t });
+    }
+
+    Array1<Vector3D> values(points.Length());
+    Array1<double> divergences(points.Length());
+    Array1<Vector3D> curls(points.Length());
+    grid.SampleMany(points, values);
+    grid.DivergenceMany(points, divergences);
+    grid.CurlMany(points, curls);
+
+    for (size_t i = 0; i < points.Length(); ++i)
+    {
+        EXPECT_EQ(grid.Sample(points[i]), values[i]);
+        EXPECT_DOUBLE_EQ(grid.Divergence(points[i]), divergences[i]);
+        EXPECT_EQ(grid.Curl(points[i]), curls[i]);
+    }
+}
+
 TEST(CellCenteredVectorGrid3, Serialization)
 {
     CellCenteredVectorGrid3 grid1({ 5, 4, 3 }, { 1.0, 2.0, 3.0 },
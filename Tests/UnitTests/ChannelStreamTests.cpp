@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Matrix/Matrix.hpp>
+#include <Core/Utils/ChannelStream.hpp>
+#include <Core/Utils/Macros.hpp>
+
+#include <cstdio>
+
+using namespace CubbyFlow;
+
+TEST(ChannelStream, WriteAndMap)
+{
+    const std::string filename = "ChannelStreamTests.WriteAndMap.bin";
+
+    Array1<double> scalars(1000);
+    Array1<Vector3D> vectors(77);
+    for (size_t i = 0; i < scalars.Length(); ++i)
+    {
+        scalars[i] = 0.5 * static_cast<double>(i);
+    }
+    for (size_t i = 0; i < vectors.Length(); ++i)
+    {
+        vectors[i] = Vector3D{ 1.0, 2.0, 3.0 } * static_cast<double>(i);
+    }
+
+    {
+        ChannelStreamWriter writer(filename);
+        writer.WriteValue("answer", 42);
+        writer.Write("scalars", ConstArrayView1<double>(scalars));
+        writer.Write("vectors", ConstArrayView1<Vector3D>(vectors));
+        writer.Write("empty", ConstArrayView1<double>());
+    }
+
+    MappedChannelReader reader(filename);
+    EXPECT_EQ(4u, reader.NumberOfChannels());
+    EXPECT_TRUE(reader.HasChannel("vectors"));
+    EXPECT_FALSE(reader.HasChannel("velocities"));
+    EXPECT_EQ(42, reader.Value<int>("answer"));
+
+    const ConstArrayView1<double> scalarView = reader.View<double>("scalars");
+    EXPECT_EQ(scalars.Length(), scalarView.Length());
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(scalarView.data()) %
+                      ChannelStreamWriter::CHANNEL_ALIGNMENT);
+    for (size_t i = 0; i < scalars.Length(); ++i)
+    {
+        EXPECT_EQ(scalars[i], scalarView[i]);
+    }
+
+    Array1<Vector3D> vectors2;
+    reader.Read("vectors", &vectors2);
+    EXPECT_EQ(vectors.Length(), vectors2.Length());
+    for (size_t i = 0; i < vectors.Length(); ++i)
+    {
+        EXPECT_EQ(vectors[i], vectors2[i]);
+    }
+
+    EXPECT_EQ(0u, reader.View<double>("empty").Length());
+    EXPECT_THROW(static_cast<void>(reader.View<float>("scalars")),
+                 std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(reader.View<double>("velocities")),
+                 std::invalid_argument);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChannelStream, InvalidFile)
+{
+    const std::string filename = "ChannelStreamTests.InvalidFile.bin";
+
+    EXPECT_THROW(MappedChannelReader("ChannelStreamTests.Missing.bin"),
+                 std::invalid_argument);
+
+    FILE* file = std::fopen(filename.c_str(), "wb");
+    std::fputs("Not a channel stream.", file);
+    std::fclose(file);
+
+    EXPECT_THROW(MappedChannelReader{ filename }, std::invalid_argument);
+
+    std::remove(filename.c_str());
+}
+TEST(ChannelStream, CorruptedHeader)
+{
+    const std::string filename = "ChannelStreamTests.CorruptedHeader.bin";
+
+    // Overwrites the 64-bit header field at given offset of a valid file.
+    const auto writeCorrupted = [&](long fieldOffset) {
+        {
+            ChannelStreamWriter writer(filename);
+            writer.Write("scalars", ConstArrayView1<double>(Array1<double>(8)));
+        }
+
+        const uint64_t value = ~uint64_t{ 0 } - 7;
+        FILE* file = std::fopen(filename.c_str(), "r+b");
+        std::fseek(file, fieldOffset, SEEK_SET);
+        std::fwrite(&value, sizeof(value), 1, file);
+        std::fclose(file);
+    };
+
+    // The header follows the 8-byte magic: name length, element size and
+    // number of elements.
+    for (const long fieldOffset : { 8L, 16L, 24L })
+    {
+        writeCorrupted(fieldOffset);
+        EXPECT_THROW(MappedChannelReader{ filename }, std::invalid_argument);
+    }
+
+    std::remove(filename.c_str());
+}
+
+#ifdef CUBBYFLOW_LINUX
+TEST(ChannelStream, CloseFailure)
+{
+    // Every write to /dev/full fails with ENOSPC, so the buffered channel is
+    // lost when Close() flushes it.
+    ChannelStreamWriter writer("/dev/full");
+    writer.WriteValue("count", 42);
+
+    EXPECT_THROW(writer.Close(), std::runtime_error);
+    EXPECT_NO_THROW(writer.Close());
+}
+#endif
\ No newline at end of file
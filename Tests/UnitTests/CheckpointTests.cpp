@@ -0,0 +1,315 @@
+#include "gtest/gtest.h"
+
+#include <Core/Array/Array.hpp>
+#include <Core/Emitter/VolumeGridEmitter3.hpp>
+#include <Core/Emitter/VolumeParticleEmitter3.hpp>
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
+#include <Core/Solver/Hybrid/APIC/APICSolver3.hpp>
+#include <Core/Solver/Hybrid/FLIP/FLIPSolver3.hpp>
+#include <Core/Solver/LevelSet/LevelSetLiquidSolver3.hpp>
+#include <Core/Utils/Checkpoint.hpp>
+#include <Core/Utils/Macros.hpp>
+
+#ifdef CUBBYFLOW_LINUX
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+
+using namespace CubbyFlow;
+
+namespace
+{
+template <typename T, typename U, size_t N>
+void ExpectSameData(const ArrayView<T, N>& expected,
+                    const ArrayView<U, N>& actual)
+{
+    ASSERT_EQ(expected.Size(), actual.Size());
+    for (size_t i = 0; i < expected.Length(); ++i)
+    {
+        EXPECT_EQ(expected[i], actual[i]);
+    }
+}
+
+template <typename Solver>
+std::shared_ptr<Solver> MakeHybridSolver()
+{
+    auto solver = Solver::GetBuilder()
+                      .WithResolution({ 12, 16, 12 })
+                      .WithDomainSizeX(1.0)
+                      .MakeShared();
+
+    auto emitter = VolumeParticleEmitter3::GetBuilder()
+                       .WithSurface(std::make_shared<Sphere3>(
+                           Vector3D{ 0.5, 0.9, 0.5 }, 0.2))
+                       .WithSpacing(1.0 / 24.0)
+                       .WithJitter(0.5)
+                       .WithIsOneShot(false)
+                       .WithAllowOverlapping(true)
+                       .WithMaxNumberOfParticles(3000)
+                       .MakeShared();
+    solver->SetParticleEmitter(emitter);
+
+    auto collider =
+        RigidBodyCollider3::GetBuilder()
+            .WithSurface(
+                std::make_shared<Sphere3>(Vector3D{ 0.3, 0.3, 0.5 }, 0.1))
+            .WithLinearVelocity({ 0.5, 0.0, 0.0 })
+            .MakeShared();
+    collider->SetOnBeginUpdateCallback(
+        [](Collider3* col, double, double timeIntervalInSeconds) {
+            auto body = dynamic_cast<RigidBodyCollider3*>(col);
+            Transform3& transform = body->GetSurface()->transform;
+            transform.SetTranslation(transform.GetTranslation() +
+                                     timeIntervalInSeconds *
+                                         body->linearVelocity);
+        });
+    solver->SetCollider(collider);
+
+    return solver;
+}
+
+template <typename Solver>
+void ExpectBitExactRestart(const std::string& filename)
+{
+    const auto original = MakeHybridSolver<Solver>();
+    Frame frame{ 0, 1.0 / 60.0 };
+    for (; frame.index < 3; ++frame)
+    {
+        original->Update(frame);
+    }
+
+    // Stream the channels to the file as the solver saves them.
+    CheckpointWriter writer;
+    original->SaveCheckpoint(&writer.Begin(filename));
+    writer.Commit();
+
+    const Frame restartFrame = frame;
+    for (; frame.index < 6; ++frame)
+    {
+        original->Update(frame);
+    }
+
+    const auto restarted = MakeHybridSolver<Solver>();
+    Checkpoint loaded;
+    loaded.Load(filename);
+    restarted->LoadCheckpoint(loaded);
+    for (frame = restartFrame; frame.index < 6; ++frame)
+    {
+        restarted->Update(frame);
+    }
+
+    const auto particles = original->GetParticleSystemData();
+    const auto particles2 = restarted->GetParticleSystemData();
+    ASSERT_EQ(particles->NumberOfParticles(), particles2->NumberOfParticles());
+    EXPECT_LT(0u, particles->NumberOfParticles());
+    for (size_t i = 0; i < particles->NumberOfParticles(); ++i)
+    {
+        EXPECT_EQ(particles->Positions()[i], particles2->Positions()[i]);
+        EXPECT_EQ(particles->Velocities()[i], particles2->Velocities()[i]);
+    }
+
+    const FaceCenteredGrid3& velocity = *original->GetVelocity();
+    const FaceCenteredGrid3& velocity2 = *restarted->GetVelocity();
+    ExpectSameData(velocity.UView(), velocity2.UView());
+    ExpectSameData(velocity.VView(), velocity2.VView());
+    ExpectSameData(velocity.WView(), velocity2.WView());
+
+    std::remove(filename.c_str());
+}
+}  // namespace
+
+TEST(Checkpoint, WriteAndRead)
+{
+    Array1<Vector3D> vectors(10);
+    for (size_t i = 0; i < vectors.Length(); ++i)
+    {
+        vectors[i] = Vector3D{ 1.0, 2.0, 3.0 } * static_cast<double>(i);
+    }
+
+    Checkpoint checkpoint;
+    checkpoint.WriteValue("answer", 42);
+    checkpoint.WriteString("name", "CubbyFlow");
+    checkpoint.Write("vectors", ConstArrayView1<Vector3D>{ vectors });
+
+    EXPECT_EQ(3u, checkpoint.NumberOfChannels());
+    EXPECT_TRUE(checkpoint.HasChannel("vectors"));
+    EXPECT_FALSE(checkpoint.HasChannel("scalars"));
+    EXPECT_EQ(42, checkpoint.Value<int>("answer"));
+    EXPECT_EQ("CubbyFlow", checkpoint.String("name"));
+    EXPECT_EQ(sizeof(Vector3D), checkpoint.ElementSize("vectors"));
+
+    Array1<Vector3D> vectors2;
+    checkpoint.Read("vectors", &vectors2);
+    ExpectSameData(vectors.View(), vectors2.View());
+
+    const std::vector<std::string> names = checkpoint.ChannelNames();
+    ASSERT_EQ(3u, names.size());
+    EXPECT_EQ("answer", names[0]);
+    EXPECT_EQ("vectors", names[2]);
+
+    EXPECT_THROW(static_cast<void>(checkpoint.Value<double>("answer")),
+                 std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(checkpoint.Value<int>("scalars")),
+                 std::invalid_argument);
+    EXPECT_THROW(checkpoint.WriteValue("@ref", 1), std::invalid_argument);
+
+    checkpoint.Clear();
+    EXPECT_EQ(0u, checkpoint.NumberOfChannels());
+}
+
+TEST(Checkpoint, IncrementalWrite)
+{
+    const std::string filename0 = "CheckpointTests.IncrementalWrite.0.bin";
+    const std::string filename1 = "CheckpointTests.IncrementalWrite.1.bin";
+
+    Array1<double> large(1000, 1.0);
+    Array1<double> small(10, 2.0);
+
+    Checkpoint checkpoint;
+    checkpoint.Write("large", ConstArrayView1<double>{ large });
+    checkpoint.Write("small", ConstArrayView1<double>{ small });
+
+    CheckpointWriter writer;
+    writer.Write(checkpoint, filename0);
+    EXPECT_EQ(2u, writer.GetLastNumberOfStoredChannels());
+
+    // Only the changed channel is stored by the second checkpoint.
+    small[3] = 3.0;
+    checkpoint.Write("small", ConstArrayView1<double>{ small });
+    writer.Write(checkpoint, filename1);
+    EXPECT_EQ(1u, writer.GetLastNumberOfStoredChannels());
+    EXPECT_EQ(small.Length() * sizeof(double),
+              writer.GetLastNumberOfStoredBytes());
+
+    Checkpoint loaded;
+    loaded.Load(filename1);
+    EXPECT_EQ(2u, loaded.NumberOfChannels());
+
+    Array1<double> large2;
+    Array1<double> small2;
+    loaded.Read("large", &large2);
+    loaded.Read("small", &small2);
+    ExpectSameData(large.View(), large2.View());
+    ExpectSameData(small.View(), small2.View());
+
+    // The file holding the unchanged channel cannot be overwritten while the
+    // newer checkpoint refers to it.
+    small[3] = 4.0;
+    checkpoint.Write("small", ConstArrayView1<double>{ small });
+    EXPECT_THROW(writer.Write(checkpoint, filename0), std::invalid_argument);
+    loaded.Load(filename1);
+    loaded.Read("large", &large2);
+    ExpectSameData(large.View(), large2.View());
+
+    // Overwriting the latest file stores its own channels again.
+    writer.Write(checkpoint, filename1);
+    EXPECT_EQ(1u, writer.GetLastNumberOfStoredChannels());
+    loaded.Load(filename1);
+    loaded.Read("large", &large2);
+    loaded.Read("small", &small2);
+    ExpectSameData(large.View(), large2.View());
+    ExpectSameData(small.View(), small2.View());
+
+    writer.Reset();
+    writer.Write(checkpoint, filename0);
+    EXPECT_EQ(2u, writer.GetLastNumberOfStoredChannels());
+
+    std::remove(filename0.c_str());
+    std::remove(filename1.c_str());
+}
+
+#ifdef CUBBYFLOW_LINUX
+TEST(Checkpoint, CommitFailure)
+{
+    const std::string filename = "CheckpointTests.CommitFailure.bin";
+    const std::string tmpFilename = filename + ".tmp";
+
+    Checkpoint checkpoint;
+    checkpoint.WriteValue("frame", 1);
+
+    CheckpointWriter writer;
+    writer.Write(checkpoint, filename);
+
+    // Redirect the temporary file to /dev/full so that the final flush of the
+    // next checkpoint fails.
+    std::remove(tmpFilename.c_str());
+    ASSERT_EQ(0, symlink("/dev/full", tmpFilename.c_str()));
+
+    checkpoint.WriteValue("frame", 2);
+    EXPECT_THROW(writer.Write(checkpoint, filename), std::runtime_error);
+
+    // The failed temporary file is discarded and the last good checkpoint is
+    // still intact.
+    EXPECT_EQ(nullptr, std::fopen(tmpFilename.c_str(), "rb"));
+
+    Checkpoint loaded;
+    loaded.Load(filename);
+    EXPECT_EQ(1, loaded.Value<int>("frame"));
+
+    std::remove(tmpFilename.c_str());
+    std::remove(filename.c_str());
+}
+#endif
+
+TEST(Checkpoint, RestartFLIPSolver3)
+{
+    ExpectBitExactRestart<FLIPSolver3>("CheckpointTests.FLIPSolver3.bin");
+}
+
+TEST(Checkpoint, RestartAPICSolver3)
+{
+    ExpectBitExactRestart<APICSolver3>("CheckpointTests.APICSolver3.bin");
+}
+
+TEST(Checkpoint, RestartLevelSetLiquidSolver3)
+{
+    const auto makeSolver = [] {
+        auto solver = LevelSetLiquidSolver3::GetBuilder()
+                          .WithResolution({ 12, 16, 12 })
+                          .WithDomainSizeX(1.0)
+                          .MakeShared();
+
+        auto emitter = VolumeGridEmitter3::GetBuilder()
+                           .WithSourceRegion(std::make_shared<Sphere3>(
+                               Vector3D{ 0.5, 0.8, 0.5 }, 0.25))
+                           .WithIsOneShot(true)
+                           .MakeShared();
+        emitter->AddSignedDistanceTarget(solver->GetSignedDistanceField());
+        solver->SetEmitter(emitter);
+
+        return solver;
+    };
+
+    const auto original = makeSolver();
+    Frame frame{ 0, 1.0 / 60.0 };
+    for (; frame.index < 2; ++frame)
+    {
+        original->Update(frame);
+    }
+
+    Checkpoint checkpoint;
+    original->SaveCheckpoint(&checkpoint);
+
+    const Frame restartFrame = frame;
+    for (; frame.index < 4; ++frame)
+    {
+        original->Update(frame);
+    }
+
+    const auto restarted = makeSolver();
+    restarted->LoadCheckpoint(checkpoint);
+    for (frame = restartFrame; frame.index < 4; ++frame)
+    {
+        restarted->Update(frame);
+    }
+
+    const ScalarGrid3& sdf = *original->GetSignedDistanceField();
+    const ScalarGrid3& sdf2 = *restarted->GetSignedDistanceField();
+    ExpectSameData(sdf.DataView(), sdf2.DataView());
+
+    const FaceCenteredGrid3& velocity = *original->GetVelocity();
+    const FaceCenteredGrid3& velocity2 = *restarted->GetVelocity();
+    ExpectSameData(velocity.UView(), velocity2.UView());
+}
\ No newline at end of file
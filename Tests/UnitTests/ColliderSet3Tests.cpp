@@ -59,4 +59,27 @@ TEST(ColliderSet3, Builder)
 
     auto colSet3 = ColliderSet3::GetBuilder().Build();
     EXPECT_EQ(0u, colSet3.NumberOfColliders());
+}
+
+TEST(ColliderSet3, Revisions)
+{
+    auto box = Box3::GetBuilder()
+                   .WithLowerCorner({ 0, 1, 2 })
+                   .WithUpperCorner({ 1, 2, 3 })
+                   .MakeShared();
+    auto col = std::make_shared<RigidBodyCollider3>(box);
+
+    ColliderSet3 colSet;
+    const size_t shapeRevision = colSet.GetShapeRevision();
+    const size_t transformRevision = colSet.GetTransformRevision();
+
+    colSet.AddCollider(col);
+    EXPECT_LT(shapeRevision, colSet.GetShapeRevision());
+
+    colSet.Update(0.0, 0.01);
+    EXPECT_EQ(transformRevision, colSet.GetTransformRevision());
+
+    box->transform.SetTranslation({ 1, 0, 0 });
+    colSet.Update(0.01, 0.01);
+    EXPECT_EQ(transformRevision + 1, colSet.GetTransformRevision());
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+
+#include <FDMLinearSystemSolverTestHelper2.hpp>
+
+#include <Core/Solver/FDM/FDMAMGPCGSolver2.hpp>
+
+using namespace CubbyFlow;
+
+TEST(FDMAMGPCGSolver2, SolveLowRes)
+{
+    FDMLinearSystem2 system;
+    FDMLinearSystemSolverTestHelper2::BuildTestLinearSystem(&system, { 3, 3 });
+
+    FDMAMGPCGSolver2 solver(10, 1e-9);
+    solver.Solve(&system);
+
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+}
+
+TEST(FDMAMGPCGSolver2, Solve)
+{
+    FDMLinearSystem2 system;
+    FDMLinearSystemSolverTestHelper2::BuildTestLinearSystem(&system,
+                                                            { 128, 128 });
+
+    FDMAMGPCGSolver2 solver(200, 1e-4);
+
+    EXPECT_TRUE(solver.Solve(&system));
+    EXPECT_GT(solver.GetNumberOfLevels(), 1u);
+}
+
+TEST(FDMAMGPCGSolver2, SolveCompressed)
+{
+    FDMCompressedLinearSystem2 system;
+    FDMLinearSystemSolverTestHelper2::BuildTestCompressedLinearSystem(
+        &system, { 64, 64 });
+
+    FDMAMGPCGSolver2 solver(200, 1e-4);
+
+    EXPECT_TRUE(solver.SolveCompressed(&system));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+
+    EXPECT_TRUE(solver.SolveCompressed(&system));
+    EXPECT_TRUE(solver.IsLastHierarchyReused());
+}
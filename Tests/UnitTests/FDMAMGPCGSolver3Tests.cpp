@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include <FDMLinearSystemSolverTestHelper3.hpp>
+
+#include <Core/Solver/FDM/FDMAMGPCGSolver3.hpp>
+
+using namespace CubbyFlow;
+
+TEST(FDMAMGPCGSolver3, SolveLowRes)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system,
+                                                            { 3, 3, 3 });
+
+    FDMAMGPCGSolver3 solver(100, 1e-9);
+    solver.Solve(&system);
+
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+}
+
+TEST(FDMAMGPCGSolver3, Solve)
+{
+    FDMLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestLinearSystem(&system,
+                                                            { 32, 32, 32 });
+
+    FDMAMGPCGSolver3 solver(100, 1e-4);
+
+    EXPECT_TRUE(solver.Solve(&system));
+    EXPECT_GT(solver.GetNumberOfLevels(), 1u);
+}
+
+TEST(FDMAMGPCGSolver3, SolveCompressed)
+{
+    FDMCompressedLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(
+        &system, { 16, 16, 16 });
+
+    FDMAMGPCGSolver3 solver(100, 1e-4);
+
+    EXPECT_TRUE(solver.SolveCompressed(&system));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+    EXPECT_FALSE(solver.IsLastHierarchyReused());
+
+    // Same sparsity pattern with different values
+    system.A *= 2.0;
+    EXPECT_TRUE(solver.SolveCompressed(&system));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+    EXPECT_TRUE(solver.IsLastHierarchyReused());
+
+    FDMCompressedLinearSystem3 other;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(
+        &other, { 8, 8, 8 });
+
+    EXPECT_TRUE(solver.SolveCompressed(&other));
+    EXPECT_FALSE(solver.IsLastHierarchyReused());
+}
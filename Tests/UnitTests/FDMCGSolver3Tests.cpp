@@ -28,4 +28,56 @@ TEST(FDMCGSolver3, SolveCompressed)
     solver.SolveCompressed(&system);
 
     EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+}
+
+TEST(FDMCGSolver3, SolveCompressedSlicedEllpack)
+{
+    FDMCompressedLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestCompressedLinearSystem(
+        &system, { 8, 8, 8 });
+    FDMCompressedLinearSystem3 system2 = system;
+
+    FDMCGSolver3 solver(100, 1e-9);
+    solver.SolveCompressed(&system);
+
+    FDMCGSolver3 solver2(100, 1e-9);
+    solver2.SetUseSlicedEllpack(true);
+    EXPECT_TRUE(solver2.GetUseSlicedEllpack());
+    solver2.SolveCompressed(&system2);
+
+    EXPECT_GT(solver2.GetTolerance(), solver2.GetLastResidual());
+    EXPECT_EQ(solver.GetLastNumberOfIterations(),
+              solver2.GetLastNumberOfIterations());
+
+    for (size_t i = 0; i < system.x.GetRows(); ++i)
+    {
+        EXPECT_NEAR(system.x[i], system2.x[i], 1e-9);
+    }
+}
+
+TEST(FDMCGSolver3, SolveMatrixFree)
+{
+    FDMMatrixFreeLinearSystem3 system;
+    FDMLinearSystemSolverTestHelper3::BuildTestMatrixFreeLinearSystem(
+        &system, { 6, 5, 4 });
+
+    FDMLinearSystem3 assembled;
+    assembled.Resize(system.A.Size());
+    ForEachIndex(system.A.Size(), [&](size_t i, size_t j, size_t k) {
+        assembled.A(i, j, k) = system.A(i, j, k);
+        assembled.b(i, j, k) = system.b(i, j, k);
+    });
+
+    FDMCGSolver3 solver(100, 1e-9);
+    EXPECT_TRUE(solver.SolveMatrixFree(&system));
+    EXPECT_GT(solver.GetTolerance(), solver.GetLastResidual());
+
+    FDMCGSolver3 solver2(100, 1e-9);
+    solver2.Solve(&assembled);
+    EXPECT_EQ(solver2.GetLastNumberOfIterations(),
+              solver.GetLastNumberOfIterations());
+
+    ForEachIndex(system.A.Size(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR(assembled.x(i, j, k), system.x(i, j, k), 1e-9);
+    });
 }
\ No newline at end of file
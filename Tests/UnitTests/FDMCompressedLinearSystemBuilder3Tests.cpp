@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+
+#include <Core/FDM/FDMCompressedLinearSystemBuilder3.hpp>
+
+using namespace CubbyFlow;
+
+TEST(FDMCompressedLinearSystemBuilder3, Build)
+{
+    const Vector3UZ size{ 5, 4, 3 };
+    const auto isActive = [](size_t i, size_t j, size_t k) {
+        return (i + 2 * j + 3 * k) % 4 != 0;
+    };
+    const auto isActiveNeighbor = [&](ssize_t i, ssize_t j, ssize_t k) {
+        return i >= 0 && j >= 0 && k >= 0 && i < static_cast<ssize_t>(size.x) &&
+               j < static_cast<ssize_t>(size.y) &&
+               k < static_cast<ssize_t>(size.z) && isActive(i, j, k);
+    };
+
+    // Reference system built row by row
+    FDMCompressedLinearSystem3 expected;
+    Array3<size_t> coordToIndex{ size };
+    size_t numRows = 0;
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        if (isActive(i, j, k))
+        {
+            coordToIndex(i, j, k) = numRows++;
+        }
+    });
+
+    ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+        if (!isActive(i, j, k))
+        {
+            return;
+        }
+
+        std::vector<double> row{ 7.0 };
+        std::vector<size_t> colIdx{ coordToIndex(i, j, k) };
+        const std::array<Vector3<ssize_t>, 6> offsets{
+            Vector3<ssize_t>{ -1, 0, 0 }, Vector3<ssize_t>{ 1, 0, 0 },
+            Vector3<ssize_t>{ 0, -1, 0 }, Vector3<ssize_t>{ 0, 1, 0 },
+            Vector3<ssize_t>{ 0, 0, -1 }, Vector3<ssize_t>{ 0, 0, 1 }
+        };
+
+        for (size_t n = 0; n < 6; ++n)
+        {
+            const ssize_t ni = static_cast<ssize_t>(i) + offsets[n].x;
+            const ssize_t nj = static_cast<ssize_t>(j) + offsets[n].y;
+            const ssize_t nk = static_cast<ssize_t>(k) + offsets[n].z;
+
+            if (isActiveNeighbor(ni, nj, nk))
+            {
+                row.push_back(-static_cast<double>(n + 1));
+                colIdx.push_back(coordToIndex(ni, nj, nk));
+            }
+        }
+
+        expected.A.AddRow(row, colIdx);
+        expected.b.AddElement(static_cast<double>(i + 10 * j + 100 * k));
+    });
+
+    FDMCompressedLinearSystemBuilder3 builder;
+    FDMCompressedLinearSystem3 system;
+
+    // Build twice to make sure the reused buffers give the same result.
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        builder.Build(
+            size, isActive,
+            [&](size_t i, size_t j, size_t k, FDMStencil3& row) {
+                const auto si = static_cast<ssize_t>(i);
+                const auto sj = static_cast<ssize_t>(j);
+                const auto sk = static_cast<ssize_t>(k);
+
+                row.center = 7.0;
+                row.left = isActiveNeighbor(si - 1, sj, sk) ? -1.0 : 0.0;
+                row.right = isActiveNeighbor(si + 1, sj, sk) ? -2.0 : 0.0;
+                row.down = isActiveNeighbor(si, sj - 1, sk) ? -3.0 : 0.0;
+                row.up = isActiveNeighbor(si, sj + 1, sk) ? -4.0 : 0.0;
+                row.back = isActiveNeighbor(si, sj, sk - 1) ? -5.0 : 0.0;
+                row.front = isActiveNeighbor(si, sj, sk + 1) ? -6.0 : 0.0;
+
+                return static_cast<double>(i + 10 * j + 100 * k);
+            },
+            &system);
+
+        EXPECT_EQ(numRows, builder.GetNumberOfRows());
+        EXPECT_EQ(numRows, system.A.GetRows());
+        EXPECT_EQ(numRows, system.A.GetCols());
+        EXPECT_EQ(numRows, system.x.GetRows());
+        EXPECT_EQ(numRows, system.b.GetRows());
+        EXPECT_EQ(expected.A.NumberOfNonZeros(), system.A.NumberOfNonZeros());
+        EXPECT_TRUE(expected.A == system.A);
+
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            EXPECT_DOUBLE_EQ(expected.b[row], system.b[row]);
+        }
+
+        ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            if (isActive(i, j, k))
+            {
+                EXPECT_EQ(coordToIndex(i, j, k), builder.GetIndex(i, j, k));
+            }
+            else
+            {
+                EXPECT_EQ(FDMCompressedLinearSystemBuilder3::INVALID_INDEX,
+                          builder.GetIndex(i, j, k));
+            }
+        });
+    }
+}
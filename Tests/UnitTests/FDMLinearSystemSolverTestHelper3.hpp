@@ -142,6 +142,32 @@ class FDMLinearSystemSolverTestHelper3
 
         system->x.Resize(system->b.GetRows(), 0.0);
     }
+
+    static void BuildTestMatrixFreeLinearSystem(
+        FDMMatrixFreeLinearSystem3* system, const Vector3UZ& size)
+    {
+        system->Resize(size);
+        system->A.invGridSpacingSqr = Vector3D{ 1.0, 4.0, 0.25 };
+
+        // Fluid below a slanted free surface, with a solid block inside.
+        ForEachIndex(size, [&](size_t i, size_t j, size_t k) {
+            char& marker = system->A.markers(i, j, k);
+
+            if (i == 1 && j < 2)
+            {
+                marker = FDMMarkerMatrix3::BOUNDARY;
+            }
+            else if (j + i / 2 < size.y - 1)
+            {
+                marker = FDMMarkerMatrix3::FLUID;
+                system->b(i, j, k) = std::sin(static_cast<double>(i + j * k));
+            }
+            else
+            {
+                marker = FDMMarkerMatrix3::AIR;
+            }
+        });
+    }
 };
 }  // namespace CubbyFlow
 
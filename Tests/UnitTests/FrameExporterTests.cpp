@@ -0,0 +1,279 @@
+#include "gtest/gtest.h"
+
+#include <Core/Animation/FrameExporter.hpp>
+#include <Core/Animation/PhysicsAnimation.hpp>
+#include <Core/Utils/Logging.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CubbyFlow;
+
+namespace
+{
+class CounterAnimation final : public PhysicsAnimation
+{
+ public:
+    Array1<double> values = Array1<double>(4, 0.0);
+
+ protected:
+    void OnAdvanceTimeStep(double timeIntervalInSeconds) override
+    {
+        for (double& v : values)
+        {
+            v += timeIntervalInSeconds;
+        }
+    }
+};
+}  // namespace
+
+TEST(FrameExporter, Constructors)
+{
+    EXPECT_THROW(FrameExporter(FrameExporter::Writer{}),
+                 std::invalid_argument);
+    EXPECT_THROW(FrameExporter([](const FrameExporter::Snapshot&) {}, 0),
+                 std::invalid_argument);
+
+    FrameExporter exporter([](const FrameExporter::Snapshot&) {}, 3);
+    EXPECT_EQ(3u, exporter.GetMaxQueueDepth());
+    EXPECT_EQ(0u, exporter.NumberOfPendingFrames());
+    EXPECT_EQ(0u, exporter.NumberOfExportedFrames());
+
+    exporter.Flush();
+}
+
+TEST(FrameExporter, Capture)
+{
+    Array1<double> scalars = { 1.0, 2.0, 3.0 };
+    Array1<Vector3D> vectors = { Vector3D{ 1, 2, 3 }, Vector3D{ 4, 5, 6 } };
+    Array3<double> grid(2, 3, 4, 0.0);
+
+    std::vector<int> frames;
+    std::vector<double> firstScalars;
+    std::vector<double> firstVectorXs;
+    std::vector<double> gridSums;
+
+    FrameExporter exporter([&](const FrameExporter::Snapshot& snapshot) {
+        ASSERT_EQ(1u, snapshot.scalarChannels.size());
+        ASSERT_EQ(1u, snapshot.vectorChannels.size());
+        ASSERT_EQ(1u, snapshot.scalarGrids.size());
+        EXPECT_EQ(3u, snapshot.scalarChannels[0].Length());
+        EXPECT_EQ(2u, snapshot.vectorChannels[0].Length());
+        EXPECT_EQ(Vector3UZ(2, 3, 4), snapshot.scalarGrids[0].Size());
+
+        frames.push_back(snapshot.frame.index);
+        firstScalars.push_back(snapshot.scalarChannels[0][0]);
+        firstVectorXs.push_back(snapshot.vectorChannels[0][1].x);
+
+        double sum = 0.0;
+        for (double v : snapshot.scalarGrids[0])
+        {
+            sum += v;
+        }
+        gridSums.push_back(sum);
+    });
+
+    EXPECT_EQ(0u,
+              exporter.AddScalarChannel([&]() { return scalars.View(); }));
+    EXPECT_EQ(0u,
+              exporter.AddVectorChannel([&]() { return vectors.View(); }));
+    EXPECT_EQ(0u, exporter.AddScalarGrid([&]() { return grid.View(); }));
+
+    for (Frame frame; frame.index < 5; ++frame)
+    {
+        exporter.Capture(frame);
+
+        // The snapshot must not see the changes made after the capture.
+        scalars[0] += 1.0;
+        vectors[1].x += 10.0;
+        grid.Fill(static_cast<double>(frame.index + 1));
+    }
+
+    exporter.Flush();
+
+    EXPECT_EQ(0u, exporter.NumberOfPendingFrames());
+    EXPECT_EQ(5u, exporter.NumberOfExportedFrames());
+    ASSERT_EQ(5u, frames.size());
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(i, frames[i]);
+        EXPECT_DOUBLE_EQ(1.0 + i, firstScalars[i]);
+        EXPECT_DOUBLE_EQ(4.0 + 10.0 * i, firstVectorXs[i]);
+        EXPECT_DOUBLE_EQ(24.0 * i, gridSums[i]);
+    }
+}
+
+TEST(FrameExporter, Backpressure)
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isReleased = false;
+
+    FrameExporter exporter(
+        [&](const FrameExporter::Snapshot&) {
+            std::unique_lock<std::mutex> lock{ mutex };
+            cv.wait(lock, [&]() { return isReleased; });
+        },
+        1);
+
+    // One snapshot is being written and one is waiting in the queue.
+    exporter.Capture(Frame{ 0, 1.0 / 60.0 });
+    exporter.Capture(Frame{ 1, 1.0 / 60.0 });
+    EXPECT_EQ(2u, exporter.NumberOfPendingFrames());
+
+    // The queue is full, so the next capture has to wait for the writer.
+    std::atomic<bool> isCaptured{ false };
+    std::thread producer{ [&]() {
+        exporter.Capture(Frame{ 2, 1.0 / 60.0 });
+        isCaptured = true;
+    } };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(isCaptured);
+
+    {
+        std::lock_guard<std::mutex> lock{ mutex };
+        isReleased = true;
+    }
+    cv.notify_all();
+
+    producer.join();
+    EXPECT_TRUE(isCaptured);
+
+    exporter.Flush();
+    EXPECT_EQ(3u, exporter.NumberOfExportedFrames());
+}
+
+TEST(FrameExporter, WriterException)
+{
+    FrameExporter exporter([](const FrameExporter::Snapshot& snapshot) {
+        if (snapshot.frame.index == 1)
+        {
+            throw std::runtime_error{ "Failed to write." };
+        }
+    });
+
+    exporter.Capture(Frame{ 0, 1.0 / 60.0 });
+    exporter.Capture(Frame{ 1, 1.0 / 60.0 });
+    EXPECT_THROW(exporter.Flush(), std::runtime_error);
+
+    // The error is reported only once.
+    exporter.Capture(Frame{ 2, 1.0 / 60.0 });
+    exporter.Flush();
+    EXPECT_EQ(2u, exporter.NumberOfExportedFrames());
+}
+
+TEST(FrameExporter, VectorGrid)
+{
+    Array3<Vector3D> grid(2, 3, 4, Vector3D{ 1, 2, 3 });
+
+    std::vector<Vector3D> firstValues;
+
+    FrameExporter exporter([&](const FrameExporter::Snapshot& snapshot) {
+        ASSERT_EQ(1u, snapshot.vectorGrids.size());
+        EXPECT_EQ(Vector3UZ(2, 3, 4), snapshot.vectorGrids[0].Size());
+        firstValues.push_back(snapshot.vectorGrids[0](1, 2, 3));
+    });
+
+    EXPECT_EQ(0u, exporter.AddVectorGrid([&]() { return grid.View(); }));
+
+    for (Frame frame; frame.index < 3; ++frame)
+    {
+        exporter.Capture(frame);
+        grid(1, 2, 3).x += 1.0;
+    }
+
+    exporter.Wait();
+
+    ASSERT_EQ(3u, firstValues.size());
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(Vector3D(1.0 + i, 2.0, 3.0), firstValues[i]);
+    }
+}
+
+TEST(FrameExporter, WriterExceptionOnWait)
+{
+    FrameExporter exporter([](const FrameExporter::Snapshot& snapshot) {
+        if (snapshot.frame.index == 2)
+        {
+            throw std::runtime_error{ "Failed to write." };
+        }
+    });
+
+    for (Frame frame; frame.index < 3; ++frame)
+    {
+        exporter.Capture(frame);
+    }
+
+    // The last snapshot fails while it is drained.
+    EXPECT_THROW(exporter.Wait(), std::runtime_error);
+    EXPECT_EQ(2u, exporter.NumberOfExportedFrames());
+    EXPECT_THROW(exporter.Capture(Frame{ 3, 1.0 / 60.0 }), std::logic_error);
+
+    // Waiting again is harmless.
+    exporter.Wait();
+}
+
+TEST(FrameExporter, WriterExceptionOnDestruction)
+{
+    std::stringstream stream;
+    Logging::SetErrorStream(&stream);
+    Logging::SetLevel(LogLevel::All);
+
+    {
+        FrameExporter exporter([](const FrameExporter::Snapshot&) {
+            throw std::runtime_error{ "Failed to write." };
+        });
+        exporter.Capture(Frame{ 0, 1.0 / 60.0 });
+    }
+
+    EXPECT_NE(std::string::npos,
+              stream.str().find("Unreported frame exporter error: Failed"));
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetErrorStream(&logFile);
+}
+
+TEST(FrameExporter, PhysicsAnimation)
+{
+    CounterAnimation anim;
+
+    std::vector<int> frames;
+    std::vector<double> values;
+
+    const auto exporter = std::make_shared<FrameExporter>(
+        [&](const FrameExporter::Snapshot& snapshot) {
+            frames.push_back(snapshot.frame.index);
+            values.push_back(snapshot.scalarChannels[0][3]);
+        });
+    exporter->AddScalarChannel([&]() { return anim.values.View(); });
+
+    anim.SetFrameExporter(exporter);
+    EXPECT_EQ(exporter, anim.GetFrameExporter());
+
+    for (Frame frame(0, 0.5); frame.index < 4; ++frame)
+    {
+        anim.Update(frame);
+    }
+
+    exporter->Flush();
+
+    ASSERT_EQ(4u, frames.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(i, frames[i]);
+        EXPECT_DOUBLE_EQ(0.5 * (i + 1), values[i]);
+    }
+
+    anim.SetFrameExporter(nullptr);
+    anim.AdvanceSingleFrame();
+    EXPECT_EQ(4u, exporter->NumberOfExportedFrames());
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 
+#include <Core/Geometry/RigidBodyCollider.hpp>
+#include <Core/Geometry/Sphere.hpp>
 #include <Core/Solver/Grid/GridBlockedBoundaryConditionSolver3.hpp>
 
 using namespace CubbyFlow;
@@ -101,4 +103,103 @@ TEST(GridBlockedBoundaryConditionSolver3, OpenDomain)
             EXPECT_DOUBLE_EQ(1.0, velocity.W(idx));
         }
     });
+}
+
+TEST(GridBlockedBoundaryConditionSolver3, IncrementalUpdate)
+{
+    Vector3UZ gridSize(24, 24, 24);
+    Vector3D gridSpacing(0.05, 0.05, 0.05);
+    Vector3D gridOrigin(0.0, 0.0, 0.0);
+
+    auto sphere = Sphere3::GetBuilder()
+                      .WithCenter(Vector3D(0.0, 0.0, 0.0))
+                      .WithRadius(0.3)
+                      .MakeShared();
+    sphere->transform.SetTranslation(Vector3D(0.5, 0.5, 0.5));
+    auto collider = std::make_shared<RigidBodyCollider3>(sphere);
+    collider->SetOnBeginUpdateCallback([](Collider3* col, double t, double) {
+        col->GetSurface()->transform.SetTranslation(
+            Vector3D(0.5 + t, 0.5, 0.5 + 0.5 * t));
+        col->GetSurface()->transform.SetOrientation(
+            QuaternionD(Vector3D(0, 1, 0), t));
+    });
+
+    GridBlockedBoundaryConditionSolver3 incSolver;
+    GridBlockedBoundaryConditionSolver3 fullSolver;
+    incSolver.SetUseIncrementalUpdate(true);
+    EXPECT_TRUE(incSolver.GetUseIncrementalUpdate());
+    EXPECT_FALSE(fullSolver.GetUseIncrementalUpdate());
+
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        collider->Update(0.1 * frame, 0.1);
+
+        incSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+        fullSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+        const auto incSDF = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+            incSolver.GetColliderSDF());
+        const auto fullSDF =
+            std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+                fullSolver.GetColliderSDF());
+
+        // The cached local SDF of the rigid body is interpolated, so the
+        // incremental result can differ slightly near the surface.
+        ForEachIndex(gridSize, [&](size_t i, size_t j, size_t k) {
+            const double phi = (*fullSDF)(i, j, k);
+            if (std::fabs(phi) < 2.0 * gridSpacing.x)
+            {
+                EXPECT_NEAR(phi, (*incSDF)(i, j, k), 0.01);
+            }
+            if (std::fabs(phi) > 0.01)
+            {
+                EXPECT_EQ(phi > 0.0, (*incSDF)(i, j, k) > 0.0);
+                EXPECT_EQ(fullSolver.GetMarker()(i, j, k),
+                          incSolver.GetMarker()(i, j, k));
+            }
+        });
+    }
+
+    // Static collider: nothing to re-rasterize
+    collider->SetOnBeginUpdateCallback(nullptr);
+    collider->Update(0.5, 0.1);
+
+    const auto incSDF = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+        incSolver.GetColliderSDF());
+    (*incSDF)(0, 0, 0) = -1.0;
+    incSolver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+    EXPECT_DOUBLE_EQ(-1.0, (*incSDF)(0, 0, 0));
+
+    // Changing the grid rebuilds everything
+    incSolver.UpdateCollider(collider, gridSize, gridSpacing,
+                             Vector3D(0.0, 0.0, 0.01));
+    EXPECT_LT(0.0, (*incSDF)(0, 0, 0));
+}
+
+TEST(GridBlockedBoundaryConditionSolver3, InPlaceShapeEdit)
+{
+    Vector3UZ gridSize(16, 16, 16);
+    Vector3D gridSpacing(0.1, 0.1, 0.1);
+    Vector3D gridOrigin(0.0, 0.0, 0.0);
+
+    auto sphere = Sphere3::GetBuilder()
+                      .WithCenter(Vector3D(0.8, 0.8, 0.8))
+                      .WithRadius(0.3)
+                      .MakeShared();
+    auto collider = std::make_shared<RigidBodyCollider3>(sphere);
+
+    GridBlockedBoundaryConditionSolver3 solver;
+    EXPECT_FALSE(solver.GetUseIncrementalUpdate());
+    solver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+    // Editing the surface without MarkShapeChanged is still picked up since
+    // the whole SDF is rebuilt by default.
+    sphere->radius = 0.5;
+    collider->Update(0.0, 0.1);
+    solver.UpdateCollider(collider, gridSize, gridSpacing, gridOrigin);
+
+    const auto sdf = std::dynamic_pointer_cast<CellCenteredScalarGrid3>(
+        solver.GetColliderSDF());
+    const Vector3D pos = sdf->DataPosition()(4, 8, 8);
+    EXPECT_NEAR(pos.DistanceTo(sphere->center) - 0.5, (*sdf)(4, 8, 8), 0.05);
 }
\ No newline at end of file
@@ -161,4 +161,45 @@ TEST(GridFractionalSinglePhasePressureSolver3, SolveFreeSurfaceCompressed)
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(GridFractionalSinglePhasePressureSolver3, SolveWithWarmStart)
+{
+    FaceCenteredGrid3 input({ 16, 16, 16 });
+    CellCenteredScalarGrid3 fluidSDF({ 16, 16, 16 });
+    const ConstantScalarField3 noBoundary{ std::numeric_limits<double>::max() };
+    const ConstantVectorField3 noVelocity{ { 0, 0, 0 } };
+
+    input.Fill([](const Vector3D& x) {
+        return Vector3D{ std::sin(x.y), std::cos(x.z), std::sin(x.x + x.z) };
+    });
+    fluidSDF.Fill([](const Vector3D& x) { return x.y - 10.3; });
+
+    for (bool useCompressed : { false, true })
+    {
+        FaceCenteredGrid3 expected{ input };
+        GridFractionalSinglePhasePressureSolver3 reference;
+        reference.Solve(input, 1.0, &expected, noBoundary, noVelocity, fluidSDF,
+                        useCompressed);
+
+        GridFractionalSinglePhasePressureSolver3 solver;
+        solver.SetUseWarmStart(true);
+        EXPECT_TRUE(solver.GetUseWarmStart());
+
+        FaceCenteredGrid3 output{ input };
+        for (int frame = 0; frame < 2; ++frame)
+        {
+            output = input;
+            solver.Solve(input, 1.0, &output, noBoundary, noVelocity, fluidSDF,
+                         useCompressed);
+        }
+
+        EXPECT_LT(solver.GetLastNumberOfIterations(),
+                  reference.GetLastNumberOfIterations());
+        EXPECT_LE(solver.GetLastResidual(), 1e-6);
+
+        ForEachIndex(output.VView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.V(i, j, k), output.V(i, j, k), 1e-5);
+        });
+    }
+}
@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 
 #include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Solver/FDM/FDMCGSolver3.hpp>
+#include <Core/Solver/FDM/FDMICCGSolver3.hpp>
+#include <Core/Solver/FDM/FDMJacobiSolver3.hpp>
 #include <Core/Solver/Grid/GridSinglePhasePressureSolver3.hpp>
 
 using namespace CubbyFlow;
@@ -408,4 +411,196 @@ TEST(GridSinglePhasePressureSolver3, SolveFreeSurfaceWithBoundary)
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(GridSinglePhasePressureSolver3, SolveWithWarmStart)
+{
+    FaceCenteredGrid3 input({ 16, 16, 16 });
+    CellCenteredScalarGrid3 fluidSDF({ 16, 16, 16 });
+    const ConstantScalarField3 noBoundary{ std::numeric_limits<double>::max() };
+    const ConstantVectorField3 noVelocity{ { 0, 0, 0 } };
+
+    input.Fill([](const Vector3D& x) {
+        return Vector3D{ std::sin(x.y), std::cos(x.z), std::sin(x.x + x.z) };
+    });
+    fluidSDF.Fill([](const Vector3D& x) { return x.y - 10.0; });
+
+    for (bool useCompressed : { false, true })
+    {
+        FaceCenteredGrid3 expected{ input };
+        GridSinglePhasePressureSolver3 reference;
+        reference.Solve(input, 1.0, &expected, noBoundary, noVelocity, fluidSDF,
+                        useCompressed);
+
+        GridSinglePhasePressureSolver3 solver;
+        EXPECT_FALSE(solver.GetUseWarmStart());
+        solver.SetUseWarmStart(true);
+        EXPECT_TRUE(solver.GetUseWarmStart());
+
+        FaceCenteredGrid3 output{ input };
+        solver.Solve(input, 1.0, &output, noBoundary, noVelocity, fluidSDF,
+                     useCompressed);
+        EXPECT_FALSE(solver.IsLastSystemReused());
+        EXPECT_EQ(reference.GetLastNumberOfIterations(),
+                  solver.GetLastNumberOfIterations());
+        EXPECT_GT(solver.GetLastNumberOfIterations(), 0u);
+
+        // Same markers and divergence: the previous pressure is the solution.
+        output = input;
+        solver.Solve(input, 1.0, &output, noBoundary, noVelocity, fluidSDF,
+                     useCompressed);
+        EXPECT_TRUE(solver.IsLastSystemReused());
+        EXPECT_LT(solver.GetLastNumberOfIterations(),
+                  reference.GetLastNumberOfIterations());
+        EXPECT_LE(solver.GetLastResidual(), 1e-6);
+
+        ForEachIndex(output.UView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.U(i, j, k), output.U(i, j, k), 1e-5);
+        });
+        ForEachIndex(output.VView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.V(i, j, k), output.V(i, j, k), 1e-5);
+        });
+        ForEachIndex(output.WView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.W(i, j, k), output.W(i, j, k), 1e-5);
+        });
+
+        // Changed markers: the system is rebuilt but the pressure is mapped.
+        CellCenteredScalarGrid3 newFluidSDF({ 16, 16, 16 });
+        newFluidSDF.Fill([](const Vector3D& x) { return x.y - 9.0; });
+
+        expected = input;
+        reference.Solve(input, 1.0, &expected, noBoundary, noVelocity,
+                        newFluidSDF, useCompressed);
+
+        output = input;
+        solver.Solve(input, 1.0, &output, noBoundary, noVelocity, newFluidSDF,
+                     useCompressed);
+        EXPECT_FALSE(solver.IsLastSystemReused());
+
+        ForEachIndex(output.VView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.V(i, j, k), output.V(i, j, k), 1e-4);
+        });
+    }
+}
+
+TEST(GridSinglePhasePressureSolver3, SolveWithWarmStartAndMovingCollider)
+{
+    FaceCenteredGrid3 input({ 16, 16, 16 });
+    CellCenteredScalarGrid3 fluidSDF({ 16, 16, 16 });
+    CellCenteredScalarGrid3 noCollider({ 16, 16, 16 }, { 1, 1, 1 },
+                                       { 0, 0, 0 },
+                                       std::numeric_limits<double>::max());
+    CellCenteredScalarGrid3 collider({ 16, 16, 16 });
+    const ConstantVectorField3 noVelocity{ { 0, 0, 0 } };
+
+    input.Fill([](const Vector3D& x) {
+        return Vector3D{ std::sin(x.y), std::cos(x.z), std::sin(x.x + x.z) };
+    });
+    fluidSDF.Fill([](const Vector3D& x) { return x.y - 10.0; });
+    collider.Fill([](const Vector3D& x) { return x.x - 4.0; });
+
+    const auto expectSameVelocity = [](const FaceCenteredGrid3& expected,
+                                       const FaceCenteredGrid3& output) {
+        ForEachIndex(output.UView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.U(i, j, k), output.U(i, j, k), 1e-4);
+        });
+        ForEachIndex(output.VView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.V(i, j, k), output.V(i, j, k), 1e-4);
+        });
+        ForEachIndex(output.WView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.W(i, j, k), output.W(i, j, k), 1e-4);
+        });
+    };
+
+    for (bool useCompressed : { false, true })
+    {
+        GridSinglePhasePressureSolver3 solver;
+        solver.SetUseWarmStart(true);
+
+        FaceCenteredGrid3 output{ input };
+        solver.Solve(input, 1.0, &output, noCollider, noVelocity, fluidSDF,
+                     useCompressed);
+        output = input;
+        solver.Solve(input, 1.0, &output, noCollider, noVelocity, fluidSDF,
+                     useCompressed);
+        EXPECT_TRUE(solver.IsLastSystemReused());
+
+        // The collider moved in: the kept matrix must not be used.
+        FaceCenteredGrid3 expected{ input };
+        GridSinglePhasePressureSolver3 reference;
+        reference.Solve(input, 1.0, &expected, collider, noVelocity, fluidSDF,
+                        useCompressed);
+
+        output = input;
+        solver.Solve(input, 1.0, &output, collider, noVelocity, fluidSDF,
+                     useCompressed);
+        EXPECT_FALSE(solver.IsLastSystemReused());
+        expectSameVelocity(expected, output);
+
+        // The other layout is solved in between. Its matrix is built from the
+        // same markers, but it must not stand in for this layout's matrix.
+        output = input;
+        solver.Solve(input, 1.0, &output, noCollider, noVelocity, fluidSDF,
+                     !useCompressed);
+        output = input;
+        solver.Solve(input, 1.0, &output, collider, noVelocity, fluidSDF,
+                     !useCompressed);
+        EXPECT_FALSE(solver.IsLastSystemReused());
+
+        output = input;
+        solver.Solve(input, 1.0, &output, collider, noVelocity, fluidSDF,
+                     useCompressed);
+        EXPECT_FALSE(solver.IsLastSystemReused());
+        expectSameVelocity(expected, output);
+    }
+}
+
+TEST(GridSinglePhasePressureSolver3, SolveMatrixFree)
+{
+    FaceCenteredGrid3 input({ 16, 16, 16 });
+    CellCenteredScalarGrid3 fluidSDF({ 16, 16, 16 });
+    CellCenteredScalarGrid3 boundarySDF({ 16, 16, 16 });
+    const ConstantVectorField3 noVelocity{ { 0, 0, 0 } };
+
+    input.Fill([](const Vector3D& x) {
+        return Vector3D{ std::sin(x.y), std::cos(x.z), std::sin(x.x + x.z) };
+    });
+    fluidSDF.Fill([](const Vector3D& x) { return x.y - 10.0; });
+    boundarySDF.Fill([](const Vector3D& x) { return x.x - 3.0; });
+
+    const std::vector<FDMLinearSystemSolver3Ptr> systemSolvers = {
+        std::make_shared<FDMICCGSolver3>(100, 1e-6),
+        std::make_shared<FDMCGSolver3>(200, 1e-6),
+        std::make_shared<FDMJacobiSolver3>(2000, 100, 1e-6)
+    };
+
+    for (const auto& systemSolver : systemSolvers)
+    {
+        FaceCenteredGrid3 expected{ input };
+        GridSinglePhasePressureSolver3 reference;
+        reference.SetLinearSystemSolver(systemSolver);
+        reference.Solve(input, 1.0, &expected, boundarySDF, noVelocity,
+                        fluidSDF);
+
+        FaceCenteredGrid3 output{ input };
+        GridSinglePhasePressureSolver3 solver;
+        EXPECT_FALSE(solver.GetUseMatrixFree());
+        solver.SetUseMatrixFree(true);
+        EXPECT_TRUE(solver.GetUseMatrixFree());
+        solver.SetLinearSystemSolver(systemSolver);
+        solver.Solve(input, 1.0, &output, boundarySDF, noVelocity, fluidSDF);
+
+        EXPECT_EQ(reference.GetLastNumberOfIterations(),
+                  solver.GetLastNumberOfIterations());
+
+        ForEachIndex(output.UView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.U(i, j, k), output.U(i, j, k), 1e-6);
+        });
+        ForEachIndex(output.VView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.V(i, j, k), output.V(i, j, k), 1e-6);
+        });
+        ForEachIndex(output.WView().Size(), [&](size_t i, size_t j, size_t k) {
+            EXPECT_NEAR(expected.W(i, j, k), output.W(i, j, k), 1e-6);
+        });
+    }
+}
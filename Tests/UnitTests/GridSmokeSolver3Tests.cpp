@@ -2,6 +2,9 @@
 
 #include <Core/Solver/Grid/GridSmokeSolver3.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace CubbyFlow;
 
 TEST(GridSmokeSolver3, UpdateEmpty)
@@ -13,3 +16,136 @@ TEST(GridSmokeSolver3, UpdateEmpty)
         solver.Update(frame);
     }
 }
+
+TEST(GridSmokeSolver3, ActiveRegion)
+{
+    const auto build = [](bool useActiveRegion) {
+        GridSmokeSolver3Ptr solver = GridSmokeSolver3::GetBuilder()
+                                         .WithResolution({ 32, 32, 32 })
+                                         .WithDomainSizeX(1.0)
+                                         .MakeShared();
+        solver->SetUseActiveRegion(useActiveRegion);
+
+        const auto fill = [](const Vector3D& x) {
+            return (x - Vector3D{ 0.2, 0.2, 0.2 }).Length() < 0.1 ? 1.0 : 0.0;
+        };
+        solver->GetSmokeDensity()->Fill(fill);
+        solver->GetTemperature()->Fill(fill);
+
+        return solver;
+    };
+
+    GridSmokeSolver3Ptr solver = build(false);
+    GridSmokeSolver3Ptr activeSolver = build(true);
+    EXPECT_TRUE(activeSolver->GetUseActiveRegion());
+
+    for (Frame frame; frame.index < 2; ++frame)
+    {
+        solver->Update(frame);
+        activeSolver->Update(frame);
+
+        EXPECT_EQ(0u, solver->GetNumberOfActiveTiles());
+        EXPECT_LT(0u, activeSolver->GetNumberOfActiveTiles());
+        EXPECT_GT(64u, activeSolver->GetNumberOfActiveTiles());
+        EXPECT_TRUE(
+            activeSolver->GetActiveRegion().Contains({ 0.2, 0.2, 0.2 }));
+        EXPECT_FALSE(
+            activeSolver->GetActiveRegion().Contains({ 0.9, 0.9, 0.9 }));
+    }
+
+    const ScalarGrid3Ptr den = solver->GetSmokeDensity();
+    const ScalarGrid3Ptr activeDen = activeSolver->GetSmokeDensity();
+
+    den->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR((*den)(i, j, k), (*activeDen)(i, j, k), 1e-3)
+            << i << ", " << j << ", " << k;
+    });
+}
+
+TEST(GridSmokeSolver3, ActiveRegionBuoyancy)
+{
+    const auto build = [](bool useActiveRegion) {
+        GridSmokeSolver3Ptr solver = GridSmokeSolver3::GetBuilder()
+                                         .WithResolution({ 32, 32, 32 })
+                                         .WithDomainSizeX(1.0)
+                                         .MakeShared();
+        solver->SetUseActiveRegion(useActiveRegion);
+        solver->SetBuoyancySmokeDensityFactor(0.0);
+        solver->SetBuoyancyTemperatureFactor(1.0);
+
+        solver->GetTemperature()->Fill([](const Vector3D& x) {
+            return (x - Vector3D{ 0.3, 0.3, 0.3 }).Length() < 0.1 ? 1.0 : 0.0;
+        });
+
+        return solver;
+    };
+
+    GridSmokeSolver3Ptr solver = build(false);
+    GridSmokeSolver3Ptr activeSolver = build(true);
+
+    Frame frame;
+    solver->Update(frame);
+    activeSolver->Update(frame);
+
+    // The active region only skips the buoyancy of the cells without
+    // temperature, which is as small as the ambient temperature. The
+    // velocity fields should agree up to that.
+    const FaceCenteredGrid3Ptr vel = solver->GetVelocity();
+    const FaceCenteredGrid3Ptr activeVel = activeSolver->GetVelocity();
+
+    double maxVel = 0.0;
+    vel->ForEachVIndex([&](const Vector3UZ& idx) {
+        maxVel = std::max(maxVel, std::fabs(vel->V(idx)));
+    });
+    EXPECT_LT(0.0, maxVel);
+
+    vel->ForEachUIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(vel->U(idx), activeVel->U(idx), 1e-2 * maxVel);
+    });
+    vel->ForEachVIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(vel->V(idx), activeVel->V(idx), 1e-2 * maxVel);
+    });
+    vel->ForEachWIndex([&](const Vector3UZ& idx) {
+        EXPECT_NEAR(vel->W(idx), activeVel->W(idx), 1e-2 * maxVel);
+    });
+}
+
+TEST(GridSmokeSolver3, ConcurrentAdvection)
+{
+    const auto build = [](bool useConcurrentAdvection) {
+        GridSmokeSolver3Ptr solver = GridSmokeSolver3::GetBuilder()
+                                         .WithResolution({ 16, 16, 16 })
+                                         .WithDomainSizeX(1.0)
+                                         .MakeShared();
+        solver->SetUseConcurrentAdvection(useConcurrentAdvection);
+
+        const auto fill = [](const Vector3D& x) {
+            return (x - Vector3D{ 0.5, 0.3, 0.5 }).Length() < 0.2 ? 1.0 : 0.0;
+        };
+        solver->GetSmokeDensity()->Fill(fill);
+        solver->GetTemperature()->Fill(fill);
+
+        return solver;
+    };
+
+    GridSmokeSolver3Ptr solver = build(false);
+    GridSmokeSolver3Ptr concurrentSolver = build(true);
+    EXPECT_FALSE(solver->GetUseConcurrentAdvection());
+    EXPECT_TRUE(concurrentSolver->GetUseConcurrentAdvection());
+
+    for (Frame frame; frame.index < 3; ++frame)
+    {
+        solver->Update(frame);
+        concurrentSolver->Update(frame);
+    }
+
+    // The fields do not depend on each other, so the results are identical.
+    const ScalarGrid3Ptr den = solver->GetSmokeDensity();
+    const ScalarGrid3Ptr den2 = concurrentSolver->GetSmokeDensity();
+    const ScalarGrid3Ptr temp = solver->GetTemperature();
+    const ScalarGrid3Ptr temp2 = concurrentSolver->GetTemperature();
+    den->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_EQ((*den)(i, j, k), (*den2)(i, j, k));
+        EXPECT_EQ((*temp)(i, j, k), (*temp2)(i, j, k));
+    });
+}
@@ -6,6 +6,8 @@
 #include <Core/Grid/VertexCenteredScalarGrid.hpp>
 #include <Core/Grid/VertexCenteredVectorGrid.hpp>
 
+#include <cstdio>
+
 using namespace CubbyFlow;
 
 TEST(GridSystemData3, Constructors)
@@ -174,4 +176,89 @@ TEST(GridSystemData3, Serialize)
     velocity->ForEachWIndex([&](const Vector3UZ& idx) {
         EXPECT_EQ(velocity->W(idx), velocity2->W(idx));
     });
+}
+
+TEST(GridSystemData3, ChannelSerialization)
+{
+    const std::string filename = "GridSystemData3.Channels.bin";
+
+    const auto makeGrids = [] {
+        GridSystemData3 grids({ 8, 12, 6 }, { 1.0, 2.0, 3.0 },
+                              { -5.0, 4.5, 10.0 });
+        grids.AddScalarData(
+            std::make_shared<CellCenteredScalarGrid3::Builder>());
+        grids.AddVectorData(
+            std::make_shared<CellCenteredVectorGrid3::Builder>());
+        grids.AddAdvectableScalarData(
+            std::make_shared<VertexCenteredScalarGrid3::Builder>());
+        return grids;
+    };
+
+    GridSystemData3 grids = makeGrids();
+    grids.ScalarDataAt(0)->Fill(
+        [](const Vector3D& pt) -> double { return pt.Length(); });
+    grids.VectorDataAt(0)->Fill(
+        [](const Vector3D& pt) -> Vector3D { return pt; });
+    grids.AdvectableScalarDataAt(0)->Fill([](const Vector3D& pt) -> double {
+        return (pt - Vector3D(1, 2, 3)).Length();
+    });
+    grids.Velocity()->Fill(
+        [](const Vector3D& pt) -> Vector3D { return pt * 2.0; });
+
+    {
+        ChannelStreamWriter writer(filename);
+        grids.Serialize(&writer);
+    }
+
+    // The layers are restored in place, so the shared grids stay valid.
+    GridSystemData3 grids2 = makeGrids();
+    const auto velocity2 = grids2.Velocity();
+    {
+        MappedChannelReader reader(filename);
+        grids2.Deserialize(reader);
+    }
+
+    EXPECT_EQ(grids.Resolution(), grids2.Resolution());
+    EXPECT_EQ(grids.GridSpacing(), grids2.GridSpacing());
+    EXPECT_EQ(grids.Origin(), grids2.Origin());
+    EXPECT_EQ(velocity2, grids2.Velocity());
+
+    const auto scalar = grids.ScalarDataAt(0);
+    const auto scalar2 = grids2.ScalarDataAt(0);
+    scalar->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_EQ((*scalar)(i, j, k), (*scalar2)(i, j, k));
+    });
+
+    const auto vector =
+        std::dynamic_pointer_cast<CellCenteredVectorGrid3>(
+            grids.VectorDataAt(0));
+    const auto vector2 =
+        std::dynamic_pointer_cast<CellCenteredVectorGrid3>(
+            grids2.VectorDataAt(0));
+    vector->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_EQ((*vector)(i, j, k), (*vector2)(i, j, k));
+    });
+
+    const auto advectable = grids.AdvectableScalarDataAt(0);
+    const auto advectable2 = grids2.AdvectableScalarDataAt(0);
+    advectable->ForEachDataPointIndex([&](size_t i, size_t j, size_t k) {
+        EXPECT_EQ((*advectable)(i, j, k), (*advectable2)(i, j, k));
+    });
+
+    const auto velocity = grids.Velocity();
+    velocity->ForEachUIndex([&](const Vector3UZ& idx) {
+        EXPECT_EQ(velocity->U(idx), velocity2->U(idx));
+    });
+    velocity->ForEachWIndex([&](const Vector3UZ& idx) {
+        EXPECT_EQ(velocity->W(idx), velocity2->W(idx));
+    });
+
+    // A system with different layers cannot be restored in place.
+    GridSystemData3 grids3;
+    {
+        MappedChannelReader reader(filename);
+        EXPECT_THROW(grids3.Deserialize(reader), std::invalid_argument);
+    }
+
+    std::remove(filename.c_str());
 }
\ No newline at end of file
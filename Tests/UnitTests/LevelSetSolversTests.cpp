@@ -102,6 +102,96 @@ TEST(UpwindLevelSetSolver3, Extrapolate)
     }
 }
 
+TEST(UpwindLevelSetSolver3, ReinitializeNarrowBand)
+{
+    CellCenteredScalarGrid3 sdf({ 40, 30, 50 }), temp({ 40, 30, 50 });
+    CellCenteredScalarGrid3 full({ 40, 30, 50 });
+
+    // Distorted SDF with the same zero level set
+    sdf.Fill([](const Vector3D& x) {
+        return 2.0 * ((x - Vector3D(20, 20, 20)).Length() - 8.0);
+    });
+
+    UpwindLevelSetSolver3 solver;
+    EXPECT_FALSE(solver.GetUseNarrowBand());
+    solver.Reinitialize(sdf, 5.0, &full);
+
+    solver.SetUseNarrowBand(true);
+    EXPECT_TRUE(solver.GetUseNarrowBand());
+    solver.Reinitialize(sdf, 5.0, &temp);
+
+    for (size_t k = 0; k < 50; ++k)
+    {
+        for (size_t j = 0; j < 30; ++j)
+        {
+            for (size_t i = 0; i < 40; ++i)
+            {
+                const double expected = 0.5 * sdf(i, j, k);
+
+                // Near the interface, the band matches the full solve
+                if (std::fabs(expected) <= 3.0)
+                {
+                    EXPECT_NEAR(full(i, j, k), temp(i, j, k), 1e-3)
+                        << i << ", " << j << ", " << k;
+                }
+                else
+                {
+                    EXPECT_EQ(expected > 0.0, temp(i, j, k) > 0.0)
+                        << i << ", " << j << ", " << k;
+                }
+
+                // Far away from the band, the values are clamped
+                if (std::fabs(expected) > 12.0)
+                {
+                    EXPECT_DOUBLE_EQ(6.0, std::fabs(temp(i, j, k)))
+                        << i << ", " << j << ", " << k;
+                }
+            }
+        }
+    }
+}
+
+TEST(UpwindLevelSetSolver3, ExtrapolateNarrowBand)
+{
+    CellCenteredScalarGrid3 sdf({ 40, 30, 50 }), field({ 40, 30, 50 });
+    CellCenteredScalarGrid3 temp({ 40, 30, 50 }), temp2({ 40, 30, 50 });
+
+    sdf.Fill([](const Vector3D& x) {
+        return (x - Vector3D(20, 20, 20)).Length() - 8.0;
+    });
+    field.Fill([](const Vector3D& x) {
+        return (x - Vector3D(20, 20, 20)).Length() < 8.0 ? 5.0 : 0.0;
+    });
+
+    UpwindLevelSetSolver3 solver;
+    solver.Extrapolate(field, sdf, 5.0, &temp);
+
+    solver.SetUseNarrowBand(true);
+    solver.Extrapolate(field, sdf, 5.0, &temp2);
+
+    for (size_t k = 0; k < 50; ++k)
+    {
+        for (size_t j = 0; j < 30; ++j)
+        {
+            for (size_t i = 0; i < 40; ++i)
+            {
+                const double phi = sdf(i, j, k);
+
+                if (phi < 0.0 || phi > 7.0)
+                {
+                    EXPECT_DOUBLE_EQ(field(i, j, k), temp2(i, j, k))
+                        << i << ", " << j << ", " << k;
+                }
+                else if (phi <= 4.0)
+                {
+                    EXPECT_NEAR(temp(i, j, k), temp2(i, j, k), 0.01)
+                        << i << ", " << j << ", " << k;
+                }
+            }
+        }
+    }
+}
+
 TEST(ENOLevelSetSolver2, Reinitialize)
 {
     CellCenteredScalarGrid2 sdf({ 40, 30 }), temp({ 40, 30 });
@@ -194,6 +284,96 @@ TEST(ENOLevelSetSolver3, Extrapolate)
     }
 }
 
+TEST(ENOLevelSetSolver3, ReinitializeNarrowBand)
+{
+    CellCenteredScalarGrid3 sdf({ 40, 30, 50 }), temp({ 40, 30, 50 });
+    CellCenteredScalarGrid3 full({ 40, 30, 50 });
+
+    // Distorted SDF with the same zero level set
+    sdf.Fill([](const Vector3D& x) {
+        return 2.0 * ((x - Vector3D(20, 20, 20)).Length() - 8.0);
+    });
+
+    ENOLevelSetSolver3 solver;
+    EXPECT_FALSE(solver.GetUseNarrowBand());
+    solver.Reinitialize(sdf, 5.0, &full);
+
+    solver.SetUseNarrowBand(true);
+    EXPECT_TRUE(solver.GetUseNarrowBand());
+    solver.Reinitialize(sdf, 5.0, &temp);
+
+    for (size_t k = 0; k < 50; ++k)
+    {
+        for (size_t j = 0; j < 30; ++j)
+        {
+            for (size_t i = 0; i < 40; ++i)
+            {
+                const double expected = 0.5 * sdf(i, j, k);
+
+                // Near the interface, the band matches the full solve
+                if (std::fabs(expected) <= 3.0)
+                {
+                    EXPECT_NEAR(full(i, j, k), temp(i, j, k), 1e-3)
+                        << i << ", " << j << ", " << k;
+                }
+                else
+                {
+                    EXPECT_EQ(expected > 0.0, temp(i, j, k) > 0.0)
+                        << i << ", " << j << ", " << k;
+                }
+
+                // Far away from the band, the values are clamped
+                if (std::fabs(expected) > 12.0)
+                {
+                    EXPECT_DOUBLE_EQ(6.0, std::fabs(temp(i, j, k)))
+                        << i << ", " << j << ", " << k;
+                }
+            }
+        }
+    }
+}
+
+TEST(ENOLevelSetSolver3, ExtrapolateNarrowBand)
+{
+    CellCenteredScalarGrid3 sdf({ 40, 30, 50 }), field({ 40, 30, 50 });
+    CellCenteredScalarGrid3 temp({ 40, 30, 50 }), temp2({ 40, 30, 50 });
+
+    sdf.Fill([](const Vector3D& x) {
+        return (x - Vector3D(20, 20, 20)).Length() - 8.0;
+    });
+    field.Fill([](const Vector3D& x) {
+        return (x - Vector3D(20, 20, 20)).Length() < 8.0 ? 5.0 : 0.0;
+    });
+
+    ENOLevelSetSolver3 solver;
+    solver.Extrapolate(field, sdf, 5.0, &temp);
+
+    solver.SetUseNarrowBand(true);
+    solver.Extrapolate(field, sdf, 5.0, &temp2);
+
+    for (size_t k = 0; k < 50; ++k)
+    {
+        for (size_t j = 0; j < 30; ++j)
+        {
+            for (size_t i = 0; i < 40; ++i)
+            {
+                const double phi = sdf(i, j, k);
+
+                if (phi < 0.0 || phi > 7.0)
+                {
+                    EXPECT_DOUBLE_EQ(field(i, j, k), temp2(i, j, k))
+                        << i << ", " << j << ", " << k;
+                }
+                else if (phi <= 4.0)
+                {
+                    EXPECT_NEAR(temp(i, j, k), temp2(i, j, k), 0.01)
+                        << i << ", " << j << ", " << k;
+                }
+            }
+        }
+    }
+}
+
 TEST(FMMLevelSetSolver2, Reinitialize)
 {
     CellCenteredScalarGrid2 sdf({ 40, 30 }), temp({ 40, 30 });
@@ -0,0 +1,337 @@
+#include "UnitTestsUtils.hpp"
+#include "gtest/gtest.h"
+
+#include <Core/Geometry/LinearTree.hpp>
+
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+Array1<BoundingBox3D> MakeSampleBoxes()
+{
+    const size_t numSamples = GetNumberOfSamplePoints3();
+    Array1<BoundingBox3D> items(numSamples);
+
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const Vector3D c = GetSamplePoints3()[i];
+        BoundingBox3D box(c, c);
+
+        // Mix of tiny and large items so that they land on various levels.
+        box.Expand(i % 7 == 0 ? 0.2 : 0.01 * static_cast<double>(i % 3));
+
+        items[i] = box;
+    }
+
+    return items;
+}
+}  // namespace
+
+TEST(LinearOctree, Constructors)
+{
+    LinearOctree<Vector3D> octree;
+    EXPECT_EQ(octree.begin(), octree.end());
+    EXPECT_EQ(0u, octree.GetNumberOfItems());
+    EXPECT_EQ(0u, octree.GetNumberOfNodes());
+}
+
+TEST(LinearOctree, Build)
+{
+    LinearOctree<BoundingBox3D> octree;
+
+    Array1<BoundingBox3D> items = MakeSampleBoxes();
+    octree.Build(items, items, 6);
+
+    EXPECT_EQ(items.Length(), octree.GetNumberOfItems());
+    EXPECT_EQ(6u, octree.GetMaxDepth());
+    EXPECT_GT(octree.GetNumberOfNodes(), 1u);
+
+    // Every item is stored exactly once and fits into its node's loose bound.
+    size_t numItems = 0;
+    for (size_t i = 0; i < octree.GetNumberOfNodes(); ++i)
+    {
+        numItems += octree.GetNumberOfItemsAtNode(i);
+    }
+    EXPECT_EQ(items.Length(), numItems);
+
+    for (const BoundingBox3D& box : items)
+    {
+        EXPECT_TRUE(octree.GetBoundingBox().Contains(box.lowerCorner));
+        EXPECT_TRUE(octree.GetBoundingBox().Contains(box.upperCorner));
+    }
+
+    Array1<BoundingBox3D> sorted;
+    for (const BoundingBox3D& box : octree)
+    {
+        sorted.Append(box);
+    }
+
+    auto less = [](const BoundingBox3D& a, const BoundingBox3D& b) {
+        return std::tie(a.lowerCorner.x, a.lowerCorner.y, a.lowerCorner.z) <
+               std::tie(b.lowerCorner.x, b.lowerCorner.y, b.lowerCorner.z);
+    };
+    Array1<BoundingBox3D> expected = items;
+    std::sort(sorted.begin(), sorted.end(), less);
+    std::sort(expected.begin(), expected.end(), less);
+    for (size_t i = 0; i < items.Length(); ++i)
+    {
+        EXPECT_EQ(expected[i].lowerCorner, sorted[i].lowerCorner);
+        EXPECT_EQ(expected[i].upperCorner, sorted[i].upperCorner);
+    }
+
+    // Degenerate input
+    octree.Build(ConstArrayView1<BoundingBox3D>(),
+                 ConstArrayView1<BoundingBox3D>(), 6);
+    EXPECT_EQ(0u, octree.GetNumberOfItems());
+    EXPECT_EQ(octree.begin(), octree.end());
+
+    octree.Clear();
+    EXPECT_EQ(0u, octree.GetNumberOfNodes());
+}
+
+TEST(LinearOctree, Nearest)
+{
+    LinearOctree<Vector3D> octree;
+
+    auto distanceFunc = [](const Vector3D& a, const Vector3D& b) {
+        return a.DistanceTo(b);
+    };
+
+    const size_t numSamples = GetNumberOfSamplePoints3();
+    Array1<Vector3D> points(numSamples);
+    Array1<BoundingBox3D> bounds(numSamples);
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        points[i] = GetSamplePoints3()[i];
+        bounds[i] = BoundingBox3D(points[i], points[i]);
+    }
+
+    octree.Build(points, bounds, 5);
+
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<double> d{ -0.5, 1.5 };
+    for (size_t t = 0; t < 100; ++t)
+    {
+        const Vector3D testPt(d(rng), d(rng), d(rng));
+
+        double bestDist = std::numeric_limits<double>::max();
+        for (const Vector3D& pt : points)
+        {
+            bestDist = std::min(bestDist, testPt.DistanceTo(pt));
+        }
+
+        auto nearest = octree.Nearest(testPt, distanceFunc);
+        ASSERT_NE(nullptr, nearest.item);
+        EXPECT_DOUBLE_EQ(bestDist, nearest.distance);
+        EXPECT_DOUBLE_EQ(bestDist, testPt.DistanceTo(*nearest.item));
+    }
+}
+
+TEST(LinearOctree, NearestManyPoints)
+{
+    LinearOctree<Vector3D> octree;
+
+    auto distanceFunc = [](const Vector3D& a, const Vector3D& b) {
+        return a.DistanceTo(b);
+    };
+
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<double> d{ 0.0, 1.0 };
+
+    const size_t numPoints = 20000;
+    Array1<Vector3D> points(numPoints);
+    Array1<BoundingBox3D> bounds(numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        points[i] = Vector3D(d(rng), d(rng), 0.1 * d(rng));
+        bounds[i] = BoundingBox3D(points[i], points[i]);
+    }
+
+    octree.Build(points, bounds, LinearOctree<Vector3D>::MAX_DEPTH);
+    EXPECT_EQ(numPoints, octree.GetNumberOfItems());
+
+    for (size_t t = 0; t < 50; ++t)
+    {
+        const Vector3D testPt(d(rng), d(rng), d(rng));
+
+        double bestDist = std::numeric_limits<double>::max();
+        for (const Vector3D& pt : points)
+        {
+            bestDist = std::min(bestDist, testPt.DistanceTo(pt));
+        }
+
+        EXPECT_DOUBLE_EQ(bestDist,
+                         octree.Nearest(testPt, distanceFunc).distance);
+    }
+}
+
+TEST(LinearOctree, BBoxIntersects)
+{
+    LinearOctree<BoundingBox3D> octree;
+
+    auto overlapsFunc = [](const BoundingBox3D& a, const BoundingBox3D& b) {
+        return a.Overlaps(b);
+    };
+
+    Array1<BoundingBox3D> items = MakeSampleBoxes();
+    octree.Build(items, items, 5);
+
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<double> d{ 0.0, 1.0 };
+    for (size_t t = 0; t < 100; ++t)
+    {
+        const Vector3D c(d(rng), d(rng), d(rng));
+        BoundingBox3D testBox(c, c);
+        testBox.Expand(0.02 * d(rng));
+
+        bool hasOverlaps = false;
+        size_t numOverlaps = 0;
+        for (const BoundingBox3D& item : items)
+        {
+            hasOverlaps |= overlapsFunc(item, testBox);
+            numOverlaps += overlapsFunc(item, testBox) ? 1 : 0;
+        }
+
+        EXPECT_EQ(hasOverlaps, octree.Intersects(testBox, overlapsFunc));
+
+        size_t measured = 0;
+        octree.ForEachIntersectingItem(
+            testBox, overlapsFunc, [&](const BoundingBox3D& item) {
+                EXPECT_TRUE(overlapsFunc(item, testBox));
+                ++measured;
+            });
+        EXPECT_EQ(numOverlaps, measured);
+    }
+}
+
+TEST(LinearOctree, RayIntersects)
+{
+    LinearOctree<BoundingBox3D> octree;
+
+    auto intersectsFunc = [](const BoundingBox3D& a, const Ray3D& ray) {
+        return a.Intersects(ray);
+    };
+
+    Array1<BoundingBox3D> items = MakeSampleBoxes();
+    octree.Build(items, items, 5);
+
+    const size_t numSamples = GetNumberOfSamplePoints3();
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const Ray3D ray(GetSamplePoints3()[i] * 3.0 - Vector3D(1, 1, 1),
+                        GetSampleDirs3()[i]);
+
+        bool ansInts = false;
+        size_t numInts = 0;
+        for (const BoundingBox3D& item : items)
+        {
+            ansInts |= intersectsFunc(item, ray);
+            numInts += intersectsFunc(item, ray) ? 1 : 0;
+        }
+
+        EXPECT_EQ(ansInts, octree.Intersects(ray, intersectsFunc));
+
+        size_t measured = 0;
+        octree.ForEachIntersectingItem(
+            ray, intersectsFunc, [&](const BoundingBox3D&) { ++measured; });
+        EXPECT_EQ(numInts, measured);
+    }
+}
+
+TEST(LinearOctree, ClosestIntersection)
+{
+    LinearOctree<BoundingBox3D> octree;
+
+    auto intersectsFunc = [](const BoundingBox3D& a, const Ray3D& ray) {
+        auto bboxResult = a.ClosestIntersection(ray);
+
+        if (bboxResult.isIntersecting)
+        {
+            return bboxResult.near;
+        }
+        else
+        {
+            return std::numeric_limits<double>::max();
+        }
+    };
+
+    Array1<BoundingBox3D> items = MakeSampleBoxes();
+    octree.Build(items, items, 5);
+
+    const size_t numSamples = GetNumberOfSamplePoints3();
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const Ray3D ray(GetSamplePoints3()[i] * 3.0 - Vector3D(1, 1, 1),
+                        GetSampleDirs3()[i]);
+
+        double ansDist = std::numeric_limits<double>::max();
+        for (const BoundingBox3D& item : items)
+        {
+            ansDist = std::min(ansDist, intersectsFunc(item, ray));
+        }
+
+        auto octInts = octree.ClosestIntersection(ray, intersectsFunc);
+
+        EXPECT_DOUBLE_EQ(ansDist, octInts.distance);
+        if (octInts.item != nullptr)
+        {
+            EXPECT_DOUBLE_EQ(ansDist, intersectsFunc(*octInts.item, ray));
+        }
+    }
+}
+
+TEST(LinearQuadtree, Queries)
+{
+    LinearQuadtree<Vector2D> quadtree;
+
+    auto distanceFunc = [](const Vector2D& a, const Vector2D& b) {
+        return a.DistanceTo(b);
+    };
+    auto overlapsFunc = [](const Vector2D& pt, const BoundingBox2D& box) {
+        return box.Contains(pt);
+    };
+
+    const size_t numSamples = GetNumberOfSamplePoints2();
+    Array1<Vector2D> points(numSamples);
+    Array1<BoundingBox2D> bounds(numSamples);
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        points[i] = GetSamplePoints2()[i];
+        bounds[i] = BoundingBox2D(points[i], points[i]);
+    }
+
+    quadtree.Build(points, bounds, 8);
+    EXPECT_EQ(numSamples, quadtree.GetNumberOfItems());
+
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<double> d{ -0.5, 1.5 };
+    for (size_t t = 0; t < 100; ++t)
+    {
+        const Vector2D testPt(d(rng), d(rng));
+
+        double bestDist = std::numeric_limits<double>::max();
+        for (const Vector2D& pt : points)
+        {
+            bestDist = std::min(bestDist, testPt.DistanceTo(pt));
+        }
+
+        EXPECT_DOUBLE_EQ(bestDist,
+                         quadtree.Nearest(testPt, distanceFunc).distance);
+
+        BoundingBox2D testBox(testPt, testPt);
+        testBox.Expand(0.1);
+
+        size_t numOverlaps = 0;
+        for (const Vector2D& pt : points)
+        {
+            numOverlaps += overlapsFunc(pt, testBox) ? 1 : 0;
+        }
+
+        size_t measured = 0;
+        quadtree.ForEachIntersectingItem(testBox, overlapsFunc,
+                                         [&](const Vector2D&) { ++measured; });
+        EXPECT_EQ(numOverlaps, measured);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+
+#include <Core/Utils/Logging.hpp>
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CubbyFlow;
+
+namespace
+{
+int numberOfEvaluations = 0;
+
+int CountEvaluation()
+{
+    return ++numberOfEvaluations;
+}
+
+size_t CountLines(const std::string& str, const std::string& pattern)
+{
+    size_t count = 0;
+    std::istringstream stream{ str };
+
+    for (std::string line; std::getline(stream, line);)
+    {
+        if (line.find(pattern) != std::string::npos)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+}  // namespace
+
+TEST(Logging, FilteredLevel)
+{
+    std::stringstream stream;
+    Logging::SetAllStream(&stream);
+    Logging::SetLevel(LogLevel::Warn);
+
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::Info));
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::Warn));
+
+    numberOfEvaluations = 0;
+    CUBBYFLOW_INFO << "Skipped " << CountEvaluation();
+    EXPECT_EQ(0, numberOfEvaluations);
+
+    CUBBYFLOW_WARN << "Written " << CountEvaluation()
+                   << LogField{ "key", 3.5 };
+    EXPECT_EQ(1, numberOfEvaluations);
+    EXPECT_EQ(1u, CountLines(stream.str(), "Written 1 key=3.5"));
+    EXPECT_EQ(0u, CountLines(stream.str(), "Skipped"));
+
+    Logging::SetLevel(LogLevel::All);
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetAllStream(&logFile);
+}
+
+TEST(Logging, AsyncMode)
+{
+    std::stringstream stream;
+    Logging::SetAllStream(&stream);
+    Logging::SetAsyncMode(true);
+    EXPECT_TRUE(Logging::IsAsyncMode());
+
+    const int numberOfThreads = 4;
+    const int numberOfLogs = 3000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numberOfThreads; ++t)
+    {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < numberOfLogs; ++i)
+            {
+                CUBBYFLOW_INFO << "Async" << LogField{ "thread", t }
+                               << LogField{ "index", i };
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Logging::Flush();
+    EXPECT_EQ(static_cast<size_t>(numberOfThreads * numberOfLogs),
+              CountLines(stream.str(), "Async thread="));
+    EXPECT_EQ(1u, CountLines(stream.str(), "Async thread=2 index=2999"));
+
+    CUBBYFLOW_WARN << "Last";
+    Logging::SetAsyncMode(false);
+    EXPECT_FALSE(Logging::IsAsyncMode());
+    EXPECT_EQ(1u, CountLines(stream.str(), "Last"));
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetAllStream(&logFile);
+}
+TEST(Logging, UnbracedIfElse)
+{
+    std::stringstream stream;
+    Logging::SetAllStream(&stream);
+
+    const bool isTaken = false;
+
+    if (isTaken)
+        CUBBYFLOW_INFO << "Then";
+    else
+        CUBBYFLOW_INFO << "Else";
+
+    EXPECT_EQ(0u, CountLines(stream.str(), "Then"));
+    EXPECT_EQ(1u, CountLines(stream.str(), "Else"));
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetAllStream(&logFile);
+}
+
+TEST(Logging, FieldOwnsValue)
+{
+    std::stringstream stream;
+    Logging::SetAllStream(&stream);
+
+    // The temporary string is gone before the field is written
+    const auto field = LogField{ "name", std::string{ "value" } };
+    const auto literal = LogField{ "literal", "text" };
+    CUBBYFLOW_INFO << "Field" << field << literal;
+
+    EXPECT_EQ(1u, CountLines(stream.str(), "Field name=value literal=text"));
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetAllStream(&logFile);
+}
+
+TEST(Logging, AsyncModeOffKeepsOrder)
+{
+    std::stringstream stream;
+    Logging::SetAllStream(&stream);
+    Logging::SetAsyncMode(true);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CUBBYFLOW_INFO << "Pending" << LogField{ "index", i };
+    }
+
+    Logging::SetAsyncMode(false);
+    CUBBYFLOW_INFO << "Synchronous";
+
+    const std::string str = stream.str();
+    EXPECT_EQ(100u, CountLines(str, "Pending index="));
+    EXPECT_LT(str.find("Pending index=99"), str.find("Synchronous"));
+
+    static std::ofstream logFile("UnitTests.log", std::ios::app);
+    Logging::SetAllStream(&logFile);
+}
\ No newline at end of file
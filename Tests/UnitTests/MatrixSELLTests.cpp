@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include <Core/Matrix/Matrix.hpp>
+#include <Core/Matrix/MatrixSELL.hpp>
+
+using namespace CubbyFlow;
+
+namespace
+{
+MatrixMxND MakeTestMatrix(size_t rows, size_t cols)
+{
+    MatrixMxND mat(rows, cols, 0.0);
+
+    // Rows have different lengths so that the chunks need the padding and
+    // the sorting actually reorders them.
+    for (size_t i = 0; i < rows; ++i)
+    {
+        for (size_t j = 0; j < cols; ++j)
+        {
+            if ((i * 7 + j * 3) % (i % 4 + 2) == 0)
+            {
+                mat(i, j) = static_cast<double>(i + 1) - 0.5 * j;
+            }
+        }
+    }
+
+    return mat;
+}
+}  // namespace
+
+TEST(MatrixSELL, Constructors)
+{
+    const MatrixSELLD emptyMat;
+
+    EXPECT_EQ(0u, emptyMat.GetRows());
+    EXPECT_EQ(0u, emptyMat.GetCols());
+    EXPECT_EQ(0u, emptyMat.NumberOfNonZeros());
+    EXPECT_EQ(0u, emptyMat.NumberOfStoredElements());
+
+    const MatrixCSRD matCSR = MakeTestMatrix(19, 13);
+    const MatrixSELLD mat(matCSR);
+
+    EXPECT_EQ(19u, mat.GetRows());
+    EXPECT_EQ(13u, mat.GetCols());
+    EXPECT_EQ(matCSR.NumberOfNonZeros(), mat.NumberOfNonZeros());
+    EXPECT_LE(mat.NumberOfNonZeros(), mat.NumberOfStoredElements());
+    EXPECT_EQ(0u, mat.NumberOfStoredElements() % MatrixSELLD::CHUNK_SIZE);
+}
+
+TEST(MatrixSELL, Multiply)
+{
+    const MatrixMxND matDense = MakeTestMatrix(37, 29);
+    const MatrixCSRD matCSR = matDense;
+
+    VectorND x(29);
+    for (size_t i = 0; i < x.GetRows(); ++i)
+    {
+        x[i] = std::sin(static_cast<double>(i));
+    }
+
+    VectorND b(37);
+    for (size_t i = 0; i < b.GetRows(); ++i)
+    {
+        b[i] = std::cos(static_cast<double>(i));
+    }
+
+    const VectorND ans = matDense * x;
+
+    for (size_t sortingScope : { 1, 4, 16, 256 })
+    {
+        const MatrixSELLD mat(matCSR, sortingScope);
+
+        VectorND result(37, 0.0);
+        mat.Multiply(x, &result);
+
+        for (size_t i = 0; i < ans.GetRows(); ++i)
+        {
+            EXPECT_NEAR(ans[i], result[i], 1e-12);
+        }
+
+        mat.Residual(x, b, &result);
+
+        for (size_t i = 0; i < ans.GetRows(); ++i)
+        {
+            EXPECT_NEAR(b[i] - ans[i], result[i], 1e-12);
+        }
+    }
+}
+
+TEST(MatrixSELL, Clear)
+{
+    MatrixSELLD mat(MatrixCSRD(MakeTestMatrix(9, 9)));
+    mat.Clear();
+
+    EXPECT_EQ(0u, mat.GetRows());
+    EXPECT_EQ(0u, mat.GetCols());
+    EXPECT_EQ(0u, mat.NumberOfNonZeros());
+    EXPECT_EQ(0u, mat.NumberOfStoredElements());
+
+    VectorND x, result;
+    mat.Multiply(x, &result);
+    EXPECT_EQ(0u, result.GetRows());
+}
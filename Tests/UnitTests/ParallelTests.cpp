@@ -170,6 +170,64 @@ TEST(Parallel, RangeFor3D)
         });
 }
 
+TEST(Parallel, TiledRangeFor3D)
+{
+    // Thin domain with partial tiles on every side
+    const size_t nX = 70;
+    const size_t nY = 45;
+    const size_t nZ = 3;
+
+    for (const TileOrder order : { TileOrder::Linear, TileOrder::Morton })
+    {
+        for (const ExecutionPolicy policy :
+             { ExecutionPolicy::Serial, ExecutionPolicy::Parallel })
+        {
+            Array3<int> visits(nX, nY, nZ, 0);
+
+            TileParameters params;
+            params.sizeX = 16;
+            params.sizeY = 8;
+            params.sizeZ = 2;
+            params.order = order;
+
+            ParallelTiledRangeFor(
+                ZERO_SIZE, nX, ZERO_SIZE, nY, ZERO_SIZE, nZ,
+                [&](size_t iBegin, size_t iEnd, size_t jBegin, size_t jEnd,
+                    size_t kBegin, size_t kEnd) {
+                    EXPECT_LE(iEnd - iBegin, params.sizeX);
+                    EXPECT_LE(jEnd - jBegin, params.sizeY);
+                    EXPECT_LE(kEnd - kBegin, params.sizeZ);
+
+                    for (size_t k = kBegin; k < kEnd; ++k)
+                    {
+                        for (size_t j = jBegin; j < jEnd; ++j)
+                        {
+                            for (size_t i = iBegin; i < iEnd; ++i)
+                            {
+                                ++visits(i, j, k);
+                            }
+                        }
+                    }
+                },
+                params, policy);
+
+            for (const int v : visits)
+            {
+                EXPECT_EQ(1, v);
+            }
+        }
+    }
+
+    // Empty range
+    size_t numberOfTiles = 0;
+    ParallelTiledRangeFor(
+        ZERO_SIZE, ZERO_SIZE, ZERO_SIZE, nY, ZERO_SIZE, nZ,
+        [&](size_t, size_t, size_t, size_t, size_t, size_t) {
+            ++numberOfTiles;
+        });
+    EXPECT_EQ(ZERO_SIZE, numberOfTiles);
+}
+
 TEST(Parallel, Sort)
 {
     size_t N = std::max(20u, (3 * NUM_CORES) / 2);
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <Core/Particle/ParticleCache.hpp>
+
+#include <cstdio>
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+ParticleSystemData3 MakeParticles(size_t numberOfParticles)
+{
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<double> d{ -1.0, 1.0 };
+
+    ParticleSystemData3 particles(numberOfParticles);
+    auto positions = particles.Positions();
+    auto velocities = particles.Velocities();
+    for (size_t i = 0; i < numberOfParticles; ++i)
+    {
+        positions[i] = { d(rng), 2.0 * d(rng), 0.5 * d(rng) };
+        velocities[i] = { d(rng), d(rng), d(rng) };
+    }
+
+    return particles;
+}
+}  // namespace
+
+TEST(ParticleCache, KeyFrame)
+{
+    const std::string filename = "ParticleCacheTests.KeyFrame.pcache";
+
+    ParticleSystemData3 particles = MakeParticles(1000);
+    particles.SetRadius(0.02);
+    const size_t a0 = particles.AddScalarData(3.0);
+
+    ParticleCacheParameters params;
+    params.positionBits = 12;
+    params.storeVelocities = true;
+    params.storeCustomData = true;
+
+    ParticleCacheWriter3 writer(params);
+    writer.Write(filename, particles);
+    EXPECT_TRUE(writer.IsLastFrameKeyFrame());
+
+    ParticleSystemData3 particles2;
+    ParticleCacheReader3 reader;
+    reader.Read(filename, &particles2);
+
+    EXPECT_EQ(particles.NumberOfParticles(), particles2.NumberOfParticles());
+    EXPECT_DOUBLE_EQ(0.02, particles2.Radius());
+    EXPECT_EQ(1u, particles2.NumberOfScalarData());
+
+    // Quantization error is at most half of a quantization step.
+    const Vector3D tolerance = Vector3D{ 2.0, 4.0, 1.0 } / 4095.0;
+    for (size_t i = 0; i < particles.NumberOfParticles(); ++i)
+    {
+        for (size_t d = 0; d < 3; ++d)
+        {
+            EXPECT_NEAR(particles.Positions()[i][d],
+                        particles2.Positions()[i][d], tolerance[d]);
+            EXPECT_NEAR(particles.Velocities()[i][d],
+                        particles2.Velocities()[i][d], 1e-6);
+        }
+        EXPECT_DOUBLE_EQ(3.0, particles2.ScalarDataAt(a0)[i]);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(ParticleCache, DeltaEncoding)
+{
+    ParticleSystemData3 particles = MakeParticles(500);
+
+    ParticleCacheParameters params;
+    params.useDeltaEncoding = true;
+    params.keyFrameInterval = 3;
+
+    ParticleCacheWriter3 writer(params);
+    ParticleCacheReader3 reader;
+    ParticleSystemData3 particles2;
+
+    for (size_t frame = 0; frame < 5; ++frame)
+    {
+        const std::string filename =
+            "ParticleCacheTests.DeltaEncoding." + std::to_string(frame);
+
+        writer.Write(filename, particles);
+        EXPECT_EQ(frame % 3 == 0, writer.IsLastFrameKeyFrame());
+
+        reader.Read(filename, &particles2);
+        EXPECT_EQ(frame % 3 == 0, reader.IsLastFrameKeyFrame());
+
+        for (size_t i = 0; i < particles.NumberOfParticles(); ++i)
+        {
+            EXPECT_LT(
+                (particles.Positions()[i] - particles2.Positions()[i]).Length(),
+                1e-4);
+        }
+
+        std::remove(filename.c_str());
+
+        // Move the particles slightly
+        for (auto& p : particles.Positions())
+        {
+            p += Vector3D{ 0.001, -0.002, 0.0005 };
+        }
+    }
+
+    // Particles leaving the padded key frame box force a key frame.
+    particles.Positions()[0] = { 10.0, 0.0, 0.0 };
+    writer.Write("ParticleCacheTests.DeltaEncoding.5", particles);
+    EXPECT_TRUE(writer.IsLastFrameKeyFrame());
+    std::remove("ParticleCacheTests.DeltaEncoding.5");
+}
+
+TEST(ParticleCache, DeltaFrameOutOfOrder)
+{
+    ParticleSystemData3 particles = MakeParticles(10);
+
+    ParticleCacheParameters params;
+    params.useDeltaEncoding = true;
+
+    ParticleCacheWriter3 writer(params);
+    writer.Write("ParticleCacheTests.OutOfOrder.0", particles);
+    writer.Write("ParticleCacheTests.OutOfOrder.1", particles);
+    EXPECT_FALSE(writer.IsLastFrameKeyFrame());
+
+    ParticleCacheReader3 reader;
+    ParticleSystemData3 particles2;
+    EXPECT_ANY_THROW(
+        reader.Read("ParticleCacheTests.OutOfOrder.1", &particles2));
+
+    std::remove("ParticleCacheTests.OutOfOrder.0");
+    std::remove("ParticleCacheTests.OutOfOrder.1");
+}
\ No newline at end of file
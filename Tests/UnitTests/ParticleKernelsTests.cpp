@@ -0,0 +1,301 @@
+#include "gtest/gtest.h"
+
+#include <Core/Particle/ParticleKernels.hpp>
+#include <Core/Particle/SPHKernels.hpp>
+#include <Core/Particle/SPHSystemData.hpp>
+#include <Core/Utils/Constants.hpp>
+#include <Core/Utils/SIMD.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace CubbyFlow;
+
+namespace
+{
+std::vector<SIMDLevel> GetSupportedLevels()
+{
+    std::vector<SIMDLevel> levels{ SIMDLevel::Scalar };
+    for (SIMDLevel level :
+         { SIMDLevel::SSE4, SIMDLevel::AVX2, SIMDLevel::AVX512 })
+    {
+        if (level <= GetSupportedSIMDLevel())
+        {
+            levels.push_back(level);
+        }
+    }
+
+    return levels;
+}
+
+Array1<Vector3D> MakeRandomVectors(size_t n, double lower, double upper,
+                                   unsigned int seed)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_real_distribution<double> d{ lower, upper };
+
+    Array1<Vector3D> result(n);
+    for (Vector3D& v : result)
+    {
+        v = Vector3D{ d(rng), d(rng), d(rng) };
+    }
+
+    return result;
+}
+
+void ExpectNear(const Vector3D& expected, const Vector3D& actual)
+{
+    const double tolerance = 1e-10 * std::max(1.0, expected.Length());
+    EXPECT_NEAR(expected.x, actual.x, tolerance);
+    EXPECT_NEAR(expected.y, actual.y, tolerance);
+    EXPECT_NEAR(expected.z, actual.z, tolerance);
+}
+
+std::shared_ptr<SPHSystemData3> MakeRandomSPHSystemData()
+{
+    // Odd number of particles and irregular neighbor counts exercise the
+    // scalar remainders of the vectorized loops.
+    auto particles = std::make_shared<SPHSystemData3>();
+    particles->SetTargetSpacing(0.1);
+
+    const Array1<Vector3D> positions = MakeRandomVectors(1001, 0.0, 1.0, 7);
+    const Array1<Vector3D> velocities = MakeRandomVectors(1001, -1.0, 1.0, 8);
+    particles->AddParticles(positions, velocities);
+    particles->BuildNeighborSearcher();
+    particles->BuildNeighborLists();
+    particles->UpdateDensities();
+
+    return particles;
+}
+}  // namespace
+
+TEST(SIMD, SetSIMDLevel)
+{
+    const SIMDLevel supported = GetSupportedSIMDLevel();
+    EXPECT_EQ(supported, GetSIMDLevel());
+
+    SetSIMDLevel(SIMDLevel::Scalar);
+    EXPECT_EQ(SIMDLevel::Scalar, GetSIMDLevel());
+
+    SetSIMDLevel(SIMDLevel::AVX512);
+    EXPECT_EQ(supported, GetSIMDLevel());
+}
+
+TEST(ParticleKernels, IntegrateParticles)
+{
+    const size_t n = 1003;
+    const Array1<Vector3D> x = MakeRandomVectors(n, -10.0, 10.0, 1);
+    const Array1<Vector3D> v = MakeRandomVectors(n, -3.0, 3.0, 2);
+    const Array1<Vector3D> f = MakeRandomVectors(n, -100.0, 100.0, 3);
+    const double mass = 0.37;
+    const double dt = 1.0 / 60.0;
+
+    Array1<Vector3D> expectedX(n);
+    Array1<Vector3D> expectedV(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        expectedV[i] = v[i] + dt * f[i] / mass;
+        expectedX[i] = x[i] + dt * expectedV[i];
+    }
+
+    for (SIMDLevel level : GetSupportedLevels())
+    {
+        SetSIMDLevel(level);
+
+        Array1<Vector3D> newX(n);
+        Array1<Vector3D> newV(n);
+        IntegrateParticles(x, v, f, mass, dt, newX, newV);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(expectedV[i], newV[i]);
+            EXPECT_EQ(expectedX[i], newX[i]);
+        }
+    }
+
+    SetSIMDLevel(GetSupportedSIMDLevel());
+}
+
+TEST(ParticleKernels, ClampParticlesToBox)
+{
+    const size_t n = 1001;
+    const BoundingBox3D box{ Vector3D{ 0.0, 0.0, 0.0 },
+                             Vector3D{ 1.0, 2.0, 3.0 } };
+
+    Array1<Vector3D> x = MakeRandomVectors(n, -1.0, 4.0, 4);
+    const Array1<Vector3D> v = MakeRandomVectors(n, -1.0, 1.0, 5);
+
+    // Particles exactly on the sides are clamped as well.
+    x[0] = box.lowerCorner;
+    x[1] = box.upperCorner;
+
+    for (int flags : { DIRECTION_ALL, DIRECTION_LEFT | DIRECTION_UP,
+                       DIRECTION_RIGHT | DIRECTION_DOWN | DIRECTION_FRONT,
+                       DIRECTION_NONE })
+    {
+        Array1<Vector3D> expectedX{ x };
+        Array1<Vector3D> expectedV{ v };
+        for (size_t i = 0; i < n; ++i)
+        {
+            const int lowerFlags[3] = { DIRECTION_LEFT, DIRECTION_DOWN,
+                                        DIRECTION_BACK };
+            const int upperFlags[3] = { DIRECTION_RIGHT, DIRECTION_UP,
+                                        DIRECTION_FRONT };
+            for (size_t c = 0; c < 3; ++c)
+            {
+                if ((flags & lowerFlags[c]) &&
+                    expectedX[i][c] <= box.lowerCorner[c])
+                {
+                    expectedX[i][c] = box.lowerCorner[c];
+                    expectedV[i][c] = 0.0;
+                }
+                if ((flags & upperFlags[c]) &&
+                    expectedX[i][c] >= box.upperCorner[c])
+                {
+                    expectedX[i][c] = box.upperCorner[c];
+                    expectedV[i][c] = 0.0;
+                }
+            }
+        }
+
+        for (SIMDLevel level : GetSupportedLevels())
+        {
+            SetSIMDLevel(level);
+
+            Array1<Vector3D> newX{ x };
+            Array1<Vector3D> newV{ v };
+            ClampParticlesToBox(box, flags, newX, newV);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(expectedX[i], newX[i]);
+                EXPECT_EQ(expectedV[i], newV[i]);
+            }
+        }
+    }
+
+    SetSIMDLevel(GetSupportedSIMDLevel());
+}
+
+TEST(ParticleKernels, ComputeSPHStdKernelDensities)
+{
+    const std::shared_ptr<SPHSystemData3> particles =
+        MakeRandomSPHSystemData();
+    const size_t n = particles->NumberOfParticles();
+    const ConstArrayView1<double> expected = particles->Densities();
+
+    for (SIMDLevel level : GetSupportedLevels())
+    {
+        SetSIMDLevel(level);
+
+        Array1<double> densities(n);
+        ComputeSPHStdKernelDensities(
+            particles->Positions(), particles->NeighborLists(),
+            particles->KernelRadius(), particles->Mass(), densities);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(expected[i], densities[i], 1e-10 * expected[i]);
+        }
+    }
+
+    SetSIMDLevel(GetSupportedSIMDLevel());
+}
+
+TEST(ParticleKernels, AccumulateSPHPressureForces)
+{
+    const std::shared_ptr<SPHSystemData3> particles =
+        MakeRandomSPHSystemData();
+    const size_t n = particles->NumberOfParticles();
+    const ConstArrayView1<Vector3D> x = particles->Positions();
+    const ConstArrayView1<double> d = particles->Densities();
+    const Array1<Array1<size_t>>& neighborLists = particles->NeighborLists();
+    const double massSquared = Square(particles->Mass());
+    const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
+
+    std::mt19937 rng{ 9 };
+    std::uniform_real_distribution<double> dist{ -10.0, 100.0 };
+    Array1<double> p(n);
+    Array1<double> pressureTerms(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        p[i] = dist(rng);
+        pressureTerms[i] = p[i] / (d[i] * d[i]);
+    }
+
+    Array1<Vector3D> expected(n, Vector3D{ 1.0, 2.0, 3.0 });
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j : neighborLists[i])
+        {
+            const double r = x[i].DistanceTo(x[j]);
+            if (r > 0.0)
+            {
+                const Vector3D dir = (x[j] - x[i]) / r;
+                expected[i] -= massSquared *
+                               (p[i] / (d[i] * d[i]) + p[j] / (d[j] * d[j])) *
+                               kernel.Gradient(r, dir);
+            }
+        }
+    }
+
+    for (SIMDLevel level : GetSupportedLevels())
+    {
+        SetSIMDLevel(level);
+
+        Array1<Vector3D> forces(n, Vector3D{ 1.0, 2.0, 3.0 });
+        AccumulateSPHPressureForces(x, pressureTerms, neighborLists,
+                                    particles->KernelRadius(),
+                                    particles->Mass(), forces);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            ExpectNear(expected[i], forces[i]);
+        }
+    }
+
+    SetSIMDLevel(GetSupportedSIMDLevel());
+}
+
+TEST(ParticleKernels, AccumulateSPHViscosityForces)
+{
+    const std::shared_ptr<SPHSystemData3> particles =
+        MakeRandomSPHSystemData();
+    const size_t n = particles->NumberOfParticles();
+    const ConstArrayView1<Vector3D> x = particles->Positions();
+    const ConstArrayView1<Vector3D> v = particles->Velocities();
+    const ConstArrayView1<double> d = particles->Densities();
+    const Array1<Array1<size_t>>& neighborLists = particles->NeighborLists();
+    const double massSquared = Square(particles->Mass());
+    const SPHSpikyKernel3 kernel{ particles->KernelRadius() };
+    const double viscosityCoefficient = 0.05;
+
+    Array1<Vector3D> expected(n, Vector3D{ 1.0, 2.0, 3.0 });
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j : neighborLists[i])
+        {
+            const double r = x[i].DistanceTo(x[j]);
+            expected[i] += viscosityCoefficient * massSquared * (v[j] - v[i]) /
+                           d[j] * kernel.SecondDerivative(r);
+        }
+    }
+
+    for (SIMDLevel level : GetSupportedLevels())
+    {
+        SetSIMDLevel(level);
+
+        Array1<Vector3D> forces(n, Vector3D{ 1.0, 2.0, 3.0 });
+        AccumulateSPHViscosityForces(x, v, d, neighborLists,
+                                     particles->KernelRadius(),
+                                     particles->Mass(), viscosityCoefficient,
+                                     forces);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            ExpectNear(expected[i], forces[i]);
+        }
+    }
+
+    SetSIMDLevel(GetSupportedSIMDLevel());
+}
\ No newline at end of file
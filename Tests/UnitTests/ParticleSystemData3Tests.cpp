@@ -2,6 +2,10 @@
 
 #include <Core/Particle/ParticleSystemData.hpp>
 
+#include <cstdio>
+#include <sstream>
+#include <streambuf>
+
 using namespace CubbyFlow;
 
 TEST(ParticleSystemData3, Constructors)
@@ -275,4 +279,123 @@ TEST(ParticleSystemData3, Serialization)
             EXPECT_EQ(neighbors[j], neighbors2[j]);
         }
     }
+}
+
+TEST(ParticleSystemData3, ChannelSerialization)
+{
+    const std::string filename = "ParticleSystemData3.Channels.bin";
+
+    ParticleSystemData3 particleSystem;
+    ParticleSystemData3::VectorData positions = {
+        { 0.7, 0.2, 0.2 }, { 0.7, 0.8, 1.0 }, { 0.9, 0.4, 0.0 },
+        { 0.5, 0.1, 0.6 }, { 0.6, 0.3, 0.8 }, { 0.1, 0.6, 0.0 }
+    };
+    particleSystem.AddParticles(positions);
+    particleSystem.SetRadius(0.2);
+
+    size_t a0 = particleSystem.AddScalarData(2.0);
+    size_t a1 = particleSystem.AddVectorData({ 1.0, -3.0, 5.0 });
+
+    const double radius = 0.4;
+    particleSystem.BuildNeighborSearcher(radius);
+    particleSystem.BuildNeighborLists(radius);
+
+    {
+        ChannelStreamWriter writer(filename);
+        particleSystem.Serialize(&writer);
+    }
+
+    ParticleSystemData3 particleSystem2;
+    {
+        MappedChannelReader reader(filename);
+        particleSystem2.Deserialize(reader);
+    }
+
+    EXPECT_EQ(positions.Length(), particleSystem2.NumberOfParticles());
+    EXPECT_DOUBLE_EQ(0.2, particleSystem2.Radius());
+
+    auto p2 = particleSystem2.Positions();
+    auto as0 = particleSystem2.ScalarDataAt(a0);
+    auto as1 = particleSystem2.VectorDataAt(a1);
+    for (size_t i = 0; i < positions.Length(); ++i)
+    {
+        EXPECT_EQ(positions[i], p2[i]);
+        EXPECT_DOUBLE_EQ(2.0, as0[i]);
+        EXPECT_EQ(Vector3D(1.0, -3.0, 5.0), as1[i]);
+    }
+
+    // The neighbor searcher and lists are restored instead of left stale.
+    const auto& neighborLists = particleSystem.NeighborLists();
+    const auto& neighborLists2 = particleSystem2.NeighborLists();
+    ASSERT_EQ(neighborLists.Length(), neighborLists2.Length());
+    for (size_t i = 0; i < neighborLists.Length(); ++i)
+    {
+        ASSERT_EQ(neighborLists[i].Length(), neighborLists2[i].Length());
+        for (size_t j = 0; j < neighborLists[i].Length(); ++j)
+        {
+            EXPECT_EQ(neighborLists[i][j], neighborLists2[i][j]);
+        }
+    }
+
+    size_t numberOfNearbyPoints = 0;
+    particleSystem2.NeighborSearcher()->ForEachNearbyPoint(
+        positions[0], radius,
+        [&](size_t, const Vector3D&) { ++numberOfNearbyPoints; });
+    EXPECT_EQ(neighborLists[0].Length() + 1, numberOfNearbyPoints);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ParticleSystemData3, FileSerialization)
+{
+    const std::string filename = "ParticleSystemData3.File.bin";
+
+    ParticleSystemData3 particleSystem;
+    ParticleSystemData3::VectorData positions = { { 0.7, 0.2, 0.2 },
+                                                  { 0.1, 0.6, 0.0 } };
+    particleSystem.AddParticles(positions);
+
+    Serialize(&particleSystem, filename);
+
+    ParticleSystemData3 particleSystem2;
+    Deserialize(filename, &particleSystem2);
+
+    EXPECT_EQ(positions.Length(), particleSystem2.NumberOfParticles());
+    EXPECT_EQ(positions[1], particleSystem2.Positions()[1]);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ParticleSystemData3, NonSeekableStreamSerialization)
+{
+    // Stream buffer that can only be read forward, like a pipe.
+    class ForwardOnlyBuffer final : public std::streambuf
+    {
+     public:
+        explicit ForwardOnlyBuffer(std::vector<char>& data)
+        {
+            setg(data.data(), data.data(), data.data() + data.size());
+        }
+    };
+
+    ParticleSystemData3 particleSystem;
+    ParticleSystemData3::VectorData positions = { { 0.7, 0.2, 0.2 },
+                                                  { 0.1, 0.6, 0.0 } };
+    particleSystem.AddParticles(positions);
+
+    std::ostringstream output;
+    Serialize(&particleSystem, &output);
+    const std::string serialized = output.str();
+    std::vector<char> data(serialized.begin(), serialized.end());
+
+    ForwardOnlyBuffer buffer(data);
+    std::istream input(&buffer);
+    EXPECT_EQ(std::streampos(-1), input.tellg());
+    input.clear();
+
+    ParticleSystemData3 particleSystem2;
+    Deserialize(&input, &particleSystem2);
+
+    EXPECT_EQ(positions.Length(), particleSystem2.NumberOfParticles());
+    EXPECT_EQ(positions[1], particleSystem2.Positions()[1]);
 }
\ No newline at end of file
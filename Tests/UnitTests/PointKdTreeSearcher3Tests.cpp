@@ -2,6 +2,9 @@
 
 #include <Core/Searcher/PointKdTreeSearcher.hpp>
 
+#include <algorithm>
+#include <random>
+
 using namespace CubbyFlow;
 
 TEST(PointKdTreeSearcher3, ForEachNearbyPoint)
@@ -106,4 +109,77 @@ TEST(PointKdTreeSearcher3, Serialize)
                                  });
 
     EXPECT_EQ(2, cnt);
+}
+
+TEST(PointKdTreeSearcher3, GetKNearestPoints)
+{
+    Array1<Vector3D> points = { Vector3D(0, 1, 3), Vector3D(2, 5, 4),
+                                Vector3D(-1, 3, 0) };
+
+    PointKdTreeSearcher3 searcher;
+    searcher.Build(points);
+
+    Array1<size_t> indices;
+    searcher.GetKNearestPoints(Vector3D(0, 0, 0), 2, &indices);
+    EXPECT_EQ(2u, indices.Length());
+    EXPECT_EQ(0u, indices[0]);
+    EXPECT_EQ(2u, indices[1]);
+
+    searcher.GetKNearestPoints(Vector3D(0, 0, 0), 5, &indices);
+    EXPECT_EQ(3u, indices.Length());
+    EXPECT_EQ(1u, indices[2]);
+
+    searcher.GetKNearestPoints(Vector3D(0, 0, 0), 0, &indices);
+    EXPECT_EQ(0u, indices.Length());
+}
+
+TEST(PointKdTreeSearcher3, GetKNearestPointsBatch)
+{
+    // Large enough to build the subtrees in parallel
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<> d{ 0.0, 1.0 };
+
+    Array1<Vector3D> points(50001);
+    for (Vector3D& point : points)
+    {
+        point = Vector3D{ d(rng), d(rng) * d(rng), d(rng) };
+    }
+
+    Array1<Vector3D> origins(50);
+    for (Vector3D& origin : origins)
+    {
+        origin = Vector3D{ d(rng), d(rng), d(rng) };
+    }
+
+    PointKdTreeSearcher3 searcher;
+    searcher.Build(points);
+
+    Array2<size_t> indices;
+    searcher.GetKNearestPoints(origins, 32, &indices);
+    EXPECT_EQ(Vector2UZ(32, 50), indices.Size());
+
+    for (size_t j = 0; j < origins.Length(); ++j)
+    {
+        std::vector<std::pair<double, size_t>> answers;
+        for (size_t i = 0; i < points.Length(); ++i)
+        {
+            answers.emplace_back(points[i].DistanceSquaredTo(origins[j]), i);
+        }
+        std::sort(answers.begin(), answers.end());
+
+        for (size_t i = 0; i < 32; ++i)
+        {
+            EXPECT_EQ(answers[i].second, indices(i, j));
+        }
+
+        // Radius between the 32nd and the 33rd nearest points
+        const double radius =
+            0.5 * (std::sqrt(answers[31].first) + std::sqrt(answers[32].first));
+
+        size_t cnt = 0;
+        searcher.ForEachNearbyPoint(
+            origins[j], radius,
+            [&](size_t, const Vector3D&) { ++cnt; });
+        EXPECT_EQ(32u, cnt);
+    }
 }
\ No newline at end of file
@@ -148,4 +148,39 @@ TEST(RigidBodyCollider3, Empty)
     EXPECT_DOUBLE_EQ(1.0, newVelocity.x);
     EXPECT_DOUBLE_EQ(0.0, newVelocity.y);
     EXPECT_DOUBLE_EQ(0.0, newVelocity.z);
+}
+
+TEST(RigidBodyCollider3, Revisions)
+{
+    auto plane = std::make_shared<Plane3>(Vector3D(0, 1, 0), Vector3D(0, 0, 0));
+    RigidBodyCollider3 collider(plane);
+
+    const size_t shapeRevision = collider.GetShapeRevision();
+    const size_t transformRevision = collider.GetTransformRevision();
+
+    // Static collider
+    collider.Update(0.0, 0.01);
+    collider.Update(0.01, 0.01);
+    EXPECT_EQ(shapeRevision, collider.GetShapeRevision());
+    EXPECT_EQ(transformRevision, collider.GetTransformRevision());
+
+    // Moving collider
+    collider.SetOnBeginUpdateCallback([](Collider3* col, double t, double) {
+        col->GetSurface()->transform.SetTranslation(Vector3D(0, t, 0));
+    });
+    collider.Update(0.02, 0.01);
+    EXPECT_EQ(shapeRevision, collider.GetShapeRevision());
+    EXPECT_EQ(transformRevision + 1, collider.GetTransformRevision());
+
+    collider.Update(0.02, 0.01);
+    EXPECT_EQ(transformRevision + 1, collider.GetTransformRevision());
+
+    // Shape changes
+    collider.MarkShapeChanged();
+    EXPECT_EQ(shapeRevision + 1, collider.GetShapeRevision());
+
+    plane->isNormalFlipped = true;
+    collider.Update(0.02, 0.01);
+    EXPECT_EQ(shapeRevision + 2, collider.GetShapeRevision());
+    EXPECT_EQ(transformRevision + 1, collider.GetTransformRevision());
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+
+#include <Core/Utils/ScratchArena.hpp>
+
+#include <cstdint>
+
+using namespace CubbyFlow;
+
+TEST(ScratchArena, Constructors)
+{
+    ScratchArena arena;
+    EXPECT_EQ(0u, arena.GetNumberOfBytesInUse());
+    EXPECT_EQ(0u, arena.GetHighWaterMark());
+    EXPECT_EQ(0u, arena.GetCapacity());
+    EXPECT_EQ(0u, arena.GetNumberOfHeapAllocations());
+}
+
+TEST(ScratchArena, Acquire)
+{
+    ScratchArena arena;
+
+    {
+        ScratchArena::Scope scope{ arena };
+
+        ArrayView3<double> a = arena.Acquire(Vector3UZ{ 4, 5, 6 }, 1.5);
+        EXPECT_EQ(Vector3UZ(4, 5, 6), a.Size());
+        for (double v : a)
+        {
+            EXPECT_EQ(1.5, v);
+        }
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(a.data()) %
+                          ScratchArena::ALIGNMENT);
+
+        ArrayView1<Vector3D> b = arena.Acquire<Vector3D>(7);
+        EXPECT_EQ(7u, b.Length());
+        for (const Vector3D& v : b)
+        {
+            EXPECT_EQ(Vector3D(), v);
+        }
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(b.data()) %
+                          ScratchArena::ALIGNMENT);
+
+        ArrayView2<char> c =
+            arena.AcquireUninitialized<char>(Vector2UZ{ 3, 3 });
+        EXPECT_EQ(9u, c.Length());
+
+        // The arrays must not overlap.
+        a(3, 4, 5) = 2.0;
+        b[6] = Vector3D(1, 2, 3);
+        c.Fill(1);
+        EXPECT_EQ(2.0, a(3, 4, 5));
+        EXPECT_EQ(Vector3D(1, 2, 3), b[6]);
+
+        // Each array is padded to the alignment: 960 + 192 + 64 bytes.
+        EXPECT_EQ(1216u, arena.GetNumberOfBytesInUse());
+    }
+
+    EXPECT_EQ(0u, arena.GetNumberOfBytesInUse());
+    EXPECT_GT(arena.GetHighWaterMark(), 0u);
+    EXPECT_EQ(1u, arena.GetNumberOfHeapAllocations());
+
+    ArrayView1<int> empty = arena.Acquire<int>(0);
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ(0u, arena.GetNumberOfBytesInUse());
+}
+
+TEST(ScratchArena, Scope)
+{
+    ScratchArena arena;
+
+    ScratchArena::Scope outer{ arena };
+    [[maybe_unused]] ArrayView1<double> a = arena.Acquire<double>(8);
+    const size_t used = arena.GetNumberOfBytesInUse();
+
+    {
+        ScratchArena::Scope inner{ arena };
+        [[maybe_unused]] ArrayView1<double> b = arena.Acquire<double>(100);
+        EXPECT_GT(arena.GetNumberOfBytesInUse(), used);
+    }
+
+    EXPECT_EQ(used, arena.GetNumberOfBytesInUse());
+
+    ArrayView1<double> c = arena.Acquire<double>(100);
+    EXPECT_EQ(a.data() + 64 / sizeof(double), c.data());
+}
+
+TEST(ScratchArena, SteadyState)
+{
+    ScratchArena arena;
+
+    // The first step spills into several blocks.
+    {
+        ScratchArena::Scope scope{ arena };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            [[maybe_unused]] ArrayView3<double> a =
+                arena.AcquireUninitialized<double>(Vector3UZ{ 32, 32, 32 });
+        }
+    }
+
+    const size_t numberOfHeapAllocations = arena.GetNumberOfHeapAllocations();
+    EXPECT_GT(numberOfHeapAllocations, 1u);
+    EXPECT_EQ(arena.GetHighWaterMark(), arena.GetCapacity());
+
+    // The following steps reuse the merged block.
+    for (size_t step = 0; step < 5; ++step)
+    {
+        ScratchArena::Scope scope{ arena };
+        for (size_t i = 0; i < 10; ++i)
+        {
+            [[maybe_unused]] ArrayView3<double> a =
+                arena.AcquireUninitialized<double>(Vector3UZ{ 32, 32, 32 });
+        }
+    }
+
+    EXPECT_EQ(numberOfHeapAllocations, arena.GetNumberOfHeapAllocations());
+    EXPECT_EQ(10u * 32u * 32u * 32u * sizeof(double),
+              arena.GetHighWaterMark());
+
+    arena.Clear();
+    EXPECT_EQ(0u, arena.GetCapacity());
+    EXPECT_EQ(0u, arena.GetHighWaterMark());
+
+    arena.Reserve(1000);
+    EXPECT_EQ(ScratchArena::MIN_BLOCK_SIZE, arena.GetCapacity());
+    EXPECT_EQ(1u, arena.GetNumberOfHeapAllocations());
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <Core/Math/SymmetricEigen.hpp>
+
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+template <size_t N>
+Matrix<double, N, N> MakeRandomSymmetricMatrix(std::mt19937& rng)
+{
+    std::uniform_real_distribution<> d{ -1.0, 1.0 };
+
+    Matrix<double, N, N> a;
+    for (size_t i = 0; i < N; ++i)
+    {
+        for (size_t j = i; j < N; ++j)
+        {
+            a(i, j) = a(j, i) = d(rng);
+        }
+    }
+
+    return a;
+}
+
+template <size_t N>
+void ExpectDecomposition(const Matrix<double, N, N>& a,
+                         const Vector<double, N>& d,
+                         const Matrix<double, N, N>& v)
+{
+    const Matrix<double, N, N> aApprox =
+        v * Matrix<double, N, N>::MakeScaleMatrix(d) * v.Transposed();
+    EXPECT_TRUE(a.IsSimilar(aApprox, 1e-12));
+
+    const Matrix<double, N, N> identity = v.Transposed() * v;
+    EXPECT_TRUE(identity.IsSimilar(Matrix<double, N, N>::MakeIdentity(),
+                                   1e-12));
+}
+}  // namespace
+
+TEST(SymmetricEigen, Matrix2)
+{
+    std::mt19937 rng{ 0 };
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const Matrix2x2D a = MakeRandomSymmetricMatrix<2>(rng);
+
+        Vector2D d;
+        Matrix2x2D v;
+        SymmetricEigen(a, d, v);
+
+        ExpectDecomposition(a, d, v);
+    }
+}
+
+TEST(SymmetricEigen, Matrix3)
+{
+    std::mt19937 rng{ 0 };
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const Matrix3x3D a = MakeRandomSymmetricMatrix<3>(rng);
+
+        Vector3D d;
+        Matrix3x3D v;
+        SymmetricEigen(a, d, v);
+
+        ExpectDecomposition(a, d, v);
+    }
+
+    // Degenerate matrices
+    const Matrix3x3D degenerates[] = {
+        Matrix3x3D{},
+        Matrix3x3D::MakeScaleMatrix(2.0, -1.0, 3.0),
+        Matrix3x3D{ 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 },
+        Matrix3x3D{ 2.0, 1e-20, 0.0, 1e-20, 2.0, 0.0, 0.0, 0.0, 2.0 },
+    };
+
+    for (const Matrix3x3D& a : degenerates)
+    {
+        Vector3D d;
+        Matrix3x3D v;
+        SymmetricEigen(a, d, v);
+
+        ExpectDecomposition(a, d, v);
+    }
+
+    Vector3D d;
+    Matrix3x3D v;
+    SymmetricEigen(Matrix3x3D{ 2.0, 1.0, 0.0, 1.0, 2.0, 0.0, 0.0, 0.0, 5.0 },
+                   d, v);
+
+    std::sort(d.begin(), d.end());
+    EXPECT_NEAR(1.0, d[0], 1e-12);
+    EXPECT_NEAR(3.0, d[1], 1e-12);
+    EXPECT_NEAR(5.0, d[2], 1e-12);
+}
+
+TEST(SymmetricEigenBatch, Compute)
+{
+    std::mt19937 rng{ 0 };
+
+    // Not a multiple of the block size
+    SymmetricEigenBatch3<double> batch3{ 1000 };
+    SymmetricEigenBatch2<double> batch2{ 1000 };
+    EXPECT_EQ(1000u, batch3.Length());
+    EXPECT_EQ(1000u, batch2.Length());
+
+    Array1<Matrix3x3D> matrices3(1000);
+    Array1<Matrix2x2D> matrices2(1000);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        matrices3[i] = MakeRandomSymmetricMatrix<3>(rng);
+        matrices2[i] = MakeRandomSymmetricMatrix<2>(rng);
+        batch3.SetMatrix(i, matrices3[i]);
+        batch2.SetMatrix(i, matrices2[i]);
+    }
+
+    batch3.Compute();
+    batch2.Compute();
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        ExpectDecomposition(matrices3[i], batch3.EigenValues(i),
+                            batch3.EigenVectors(i));
+        ExpectDecomposition(matrices2[i], batch2.EigenValues(i),
+                            batch2.EigenVectors(i));
+
+        Vector3D d;
+        Matrix3x3D v;
+        SymmetricEigen(matrices3[i], d, v);
+        EXPECT_TRUE(d.IsSimilar(batch3.EigenValues(i), 1e-12));
+    }
+}
\ No newline at end of file
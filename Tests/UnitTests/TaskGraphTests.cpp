@@ -0,0 +1,180 @@
+#include "gtest/gtest.h"
+
+#include <Core/Field/CustomVectorField.hpp>
+#include <Core/Grid/FaceCenteredGrid.hpp>
+#include <Core/Solver/Advection/SemiLagrangian3.hpp>
+#include <Core/Utils/TaskGraph.hpp>
+
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+#include <omp.h>
+#endif
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace CubbyFlow;
+
+TEST(TaskGraph, Empty)
+{
+    TaskGraph graph;
+    EXPECT_EQ(0u, graph.NumberOfTasks());
+
+    graph.Run();
+    graph.Run(ExecutionPolicy::Serial);
+}
+
+TEST(TaskGraph, Dependencies)
+{
+    for (ExecutionPolicy policy :
+         { ExecutionPolicy::Serial, ExecutionPolicy::Parallel })
+    {
+        // Diamond: a -> (b, c) -> d, plus an independent e.
+        std::atomic<int> counter{ 0 };
+        int a = -1;
+        int b = -1;
+        int c = -1;
+        int d = -1;
+        int e = -1;
+
+        TaskGraph graph;
+        const TaskGraph::TaskID ta = graph.AddTask([&]() { a = counter++; });
+        const TaskGraph::TaskID tb =
+            graph.AddTask([&]() { b = counter++; }, { ta });
+        const TaskGraph::TaskID tc =
+            graph.AddTask([&]() { c = counter++; }, { ta });
+        graph.AddTask([&]() { d = counter++; }, { tb, tc });
+        graph.AddTask([&]() { e = counter++; });
+        EXPECT_EQ(5u, graph.NumberOfTasks());
+
+        graph.Run(policy);
+
+        EXPECT_EQ(5, counter);
+        EXPECT_LT(a, b);
+        EXPECT_LT(a, c);
+        EXPECT_LT(b, d);
+        EXPECT_LT(c, d);
+        EXPECT_GE(e, 0);
+    }
+}
+
+TEST(TaskGraph, AddDependency)
+{
+    std::atomic<int> counter{ 0 };
+    int a = -1;
+    int b = -1;
+
+    TaskGraph graph;
+    const TaskGraph::TaskID ta = graph.AddTask([&]() { a = counter++; });
+    const TaskGraph::TaskID tb = graph.AddTask([&]() { b = counter++; });
+    graph.AddDependency(tb, ta);
+
+    graph.Run();
+    EXPECT_EQ(0, a);
+    EXPECT_EQ(1, b);
+
+    EXPECT_THROW(graph.AddDependency(ta, tb), std::invalid_argument);
+    EXPECT_THROW(graph.AddDependency(ta, ta), std::invalid_argument);
+    EXPECT_THROW(graph.AddDependency(5, ta), std::invalid_argument);
+    EXPECT_THROW(graph.AddTask([]() {}, { 3 }), std::invalid_argument);
+    EXPECT_EQ(2u, graph.NumberOfTasks());
+}
+
+TEST(TaskGraph, Chains)
+{
+    // Many independent chains; each chain must run in order and every task
+    // must run exactly once, also when the graph is run again.
+    const size_t numberOfChains = 16;
+    const size_t chainLength = 8;
+
+    std::vector<std::atomic<size_t>> progress(numberOfChains);
+    std::atomic<size_t> numberOfErrors{ 0 };
+    std::atomic<size_t> numberOfRuns{ 0 };
+
+    TaskGraph graph;
+    for (size_t c = 0; c < numberOfChains; ++c)
+    {
+        std::vector<TaskGraph::TaskID> dependencies;
+        for (size_t k = 0; k < chainLength; ++k)
+        {
+            const TaskGraph::TaskID id = graph.AddTask(
+                [&, c, k]() {
+                    if (progress[c].fetch_add(1) % chainLength != k)
+                    {
+                        ++numberOfErrors;
+                    }
+                    ++numberOfRuns;
+                },
+                dependencies);
+            dependencies = { id };
+        }
+    }
+
+    graph.Run();
+    graph.Run();
+
+    EXPECT_EQ(0u, numberOfErrors);
+    EXPECT_EQ(2 * numberOfChains * chainLength, numberOfRuns);
+}
+
+TEST(TaskGraph, Exception)
+{
+    for (ExecutionPolicy policy :
+         { ExecutionPolicy::Serial, ExecutionPolicy::Parallel })
+    {
+        bool isSuccessorRun = false;
+
+        TaskGraph graph;
+        const TaskGraph::TaskID ta =
+            graph.AddTask([]() { throw std::runtime_error{ "Task failed" }; });
+        graph.AddTask([&]() { isSuccessorRun = true; }, { ta });
+
+        EXPECT_THROW(graph.Run(policy), std::runtime_error);
+        EXPECT_FALSE(isSuccessorRun);
+    }
+}
+
+TEST(TaskGraph, Clear)
+{
+    TaskGraph graph;
+    graph.AddTask([]() {});
+    graph.AddTask([]() {});
+    EXPECT_EQ(2u, graph.NumberOfTasks());
+
+    graph.Clear();
+    EXPECT_EQ(0u, graph.NumberOfTasks());
+}
+
+#if defined(CUBBYFLOW_TASKING_OPENMP)
+TEST(TaskGraph, OpenMPKeepsParallelForWide)
+{
+    const int prevNumThreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    // The face-centered advection runs its u, v and w loops as the tasks of
+    // a graph. Each loop should still use the whole team of threads instead
+    // of becoming a nested parallel region with a single thread.
+    std::atomic<int> maxTeamSize{ 0 };
+    const CustomVectorField3 flow{ [&](const Vector3D&) {
+        const int teamSize = omp_get_num_threads();
+        int prev = maxTeamSize.load();
+        while (prev < teamSize &&
+               !maxTeamSize.compare_exchange_weak(prev, teamSize))
+        {
+            // Do nothing
+        }
+
+        return Vector3D{ 1.0, 0.0, 0.0 };
+    } };
+
+    FaceCenteredGrid3 input{ { 16, 16, 16 }, { 0.1, 0.1, 0.1 } };
+    FaceCenteredGrid3 output{ { 16, 16, 16 }, { 0.1, 0.1, 0.1 } };
+
+    SemiLagrangian3 solver;
+    solver.Advect(input, flow, 0.01, &output);
+
+    omp_set_num_threads(prevNumThreads);
+
+    EXPECT_GT(maxTeamSize, 3);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/VertexCenteredScalarGrid.hpp>
+#include <Core/PointsToImplicit/ZhuBridsonPointsToImplicit2.hpp>
+
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+Array1<Vector2D> MakeSplashPoints()
+{
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<> d1{ 0.3, 0.7 };
+    std::uniform_real_distribution<> d2{ -0.1, 1.1 };
+
+    Array1<Vector2D> points;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        points.Append(Vector2D{ d1(rng), d1(rng) * 0.5 });
+    }
+    for (size_t i = 0; i < 20; ++i)
+    {
+        points.Append(Vector2D{ d2(rng), d2(rng) });
+    }
+
+    return points;
+}
+}  // namespace
+
+TEST(ZhuBridsonPointsToImplicit2, Splatting)
+{
+    const Array1<Vector2D> points = MakeSplashPoints();
+
+    ZhuBridsonPointsToImplicit2 converter{ 0.12, 0.25, false };
+    EXPECT_FALSE(converter.GetUseSplatting());
+
+    CellCenteredScalarGrid2 gathered{ { 20, 28 }, { 0.05, 0.05 } };
+    converter.Convert(points, &gathered);
+
+    converter.SetUseSplatting(true);
+    EXPECT_TRUE(converter.GetUseSplatting());
+
+    CellCenteredScalarGrid2 splatted{ { 20, 28 }, { 0.05, 0.05 } };
+    converter.Convert(points, &splatted);
+
+    ForEachIndex(splatted.DataSize(), [&](size_t i, size_t j) {
+        EXPECT_NEAR(gathered(i, j), splatted(i, j), 1e-9);
+    });
+
+    // The splatted field does not depend on the thread scheduling.
+    CellCenteredScalarGrid2 splattedAgain{ { 20, 28 }, { 0.05, 0.05 } };
+    converter.Convert(points, &splattedAgain);
+
+    ForEachIndex(splatted.DataSize(), [&](size_t i, size_t j) {
+        EXPECT_EQ(splatted(i, j), splattedAgain(i, j));
+    });
+
+    VertexCenteredScalarGrid2 splattedSDF{ { 17, 23 },
+                                           { 0.06, 0.05 },
+                                           { -0.05, 0.02 } };
+    VertexCenteredScalarGrid2 gatheredSDF{ { 17, 23 },
+                                           { 0.06, 0.05 },
+                                           { -0.05, 0.02 } };
+
+    ZhuBridsonPointsToImplicit2 sdfConverter{ 0.12, 0.25, true };
+    sdfConverter.Convert(points, &gatheredSDF);
+    sdfConverter.SetUseSplatting(true);
+    sdfConverter.Convert(points, &splattedSDF);
+
+    ForEachIndex(splattedSDF.DataSize(), [&](size_t i, size_t j) {
+        EXPECT_NEAR(gatheredSDF(i, j), splattedSDF(i, j), 1e-9);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include <Core/Grid/CellCenteredScalarGrid.hpp>
+#include <Core/Grid/VertexCenteredScalarGrid.hpp>
+#include <Core/PointsToImplicit/ZhuBridsonPointsToImplicit3.hpp>
+
+#include <random>
+
+using namespace CubbyFlow;
+
+namespace
+{
+Array1<Vector3D> MakeSplashPoints()
+{
+    std::mt19937 rng{ 0 };
+    std::uniform_real_distribution<> d1{ 0.3, 0.7 };
+    std::uniform_real_distribution<> d2{ -0.1, 1.1 };
+
+    Array1<Vector3D> points;
+    for (size_t i = 0; i < 400; ++i)
+    {
+        points.Append(Vector3D{ d1(rng), d1(rng) * 0.5, d1(rng) });
+    }
+    for (size_t i = 0; i < 20; ++i)
+    {
+        points.Append(Vector3D{ d2(rng), d2(rng), d2(rng) });
+    }
+
+    return points;
+}
+}  // namespace
+
+TEST(ZhuBridsonPointsToImplicit3, Splatting)
+{
+    const Array1<Vector3D> points = MakeSplashPoints();
+
+    ZhuBridsonPointsToImplicit3 converter{ 0.12, 0.25, false };
+    EXPECT_FALSE(converter.GetUseSplatting());
+
+    CellCenteredScalarGrid3 gathered{ { 20, 24, 28 },
+                                      { 0.05, 0.05, 0.05 } };
+    converter.Convert(points, &gathered);
+
+    converter.SetUseSplatting(true);
+    EXPECT_TRUE(converter.GetUseSplatting());
+
+    CellCenteredScalarGrid3 splatted{ { 20, 24, 28 },
+                                      { 0.05, 0.05, 0.05 } };
+    converter.Convert(points, &splatted);
+
+    ForEachIndex(splatted.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR(gathered(i, j, k), splatted(i, j, k), 1e-9);
+    });
+
+    // The splatted field does not depend on the thread scheduling.
+    CellCenteredScalarGrid3 splattedAgain{ { 20, 24, 28 },
+                                           { 0.05, 0.05, 0.05 } };
+    converter.Convert(points, &splattedAgain);
+
+    ForEachIndex(splatted.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_EQ(splatted(i, j, k), splattedAgain(i, j, k));
+    });
+
+    VertexCenteredScalarGrid3 splattedSDF{ { 17, 19, 23 },
+                                           { 0.06, 0.06, 0.05 },
+                                           { -0.05, 0.0, 0.02 } };
+    VertexCenteredScalarGrid3 gatheredSDF{ { 17, 19, 23 },
+                                           { 0.06, 0.06, 0.05 },
+                                           { -0.05, 0.0, 0.02 } };
+
+    ZhuBridsonPointsToImplicit3 sdfConverter{ 0.12, 0.25, true };
+    sdfConverter.Convert(points, &gatheredSDF);
+    sdfConverter.SetUseSplatting(true);
+    sdfConverter.Convert(points, &splattedSDF);
+
+    ForEachIndex(splattedSDF.DataSize(), [&](size_t i, size_t j, size_t k) {
+        EXPECT_NEAR(gatheredSDF(i, j, k), splattedSDF(i, j, k), 1e-9);
+    });
+}
\ No newline at end of file